@@ -129,6 +129,31 @@ HRESULT CreateTextureFromFile(ID3D11Device* d3dDevice, const wchar_t* szFileName
 	return S_OK;
 }
 
+HRESULT DecodeTextureFromFile(const wchar_t* szFileName, DirectX::ScratchImage& image)
+{
+	auto ext = std::filesystem::path(szFileName).extension().wstring();
+	for (auto& c : ext) c = (wchar_t)towlower(c);
+
+	if (ext == L".tga")
+		return DirectX::LoadFromTGAFile(szFileName, DirectX::TGA_FLAGS_NONE, nullptr, image);
+
+	// CreateTextureFromFile 과 같은 순서: DDS → WIC
+	HRESULT hr = DirectX::LoadFromDDSFile(szFileName, DirectX::DDS_FLAGS_NONE, nullptr, image);
+	if (FAILED(hr))
+		hr = DirectX::LoadFromWICFile(szFileName, DirectX::WIC_FLAGS_NONE, nullptr, image);
+	return hr;
+}
+
+HRESULT CreateTextureFromImage(ID3D11Device* d3dDevice, const DirectX::ScratchImage& image, ID3D11ShaderResourceView** textureView)
+{
+	return DirectX::CreateShaderResourceView(
+		d3dDevice,
+		image.GetImages(),
+		image.GetImageCount(),
+		image.GetMetadata(), textureView
+	);
+}
+
 void CheckDXGIDebug()
 {
 	IDXGIDebug1* pDebug = nullptr;
@@ -151,4 +151,10 @@ inline void HR_T_Impl(HRESULT hr, const char* file, int line, const char* func)
 //--------------------------------------------------------------------------------------
 HRESULT CompileShaderFromFile(const WCHAR* szFileName, LPCSTR szEntryPoint, LPCSTR szShaderModel, ID3DBlob** ppBlobOut);
 
-HRESULT CreateTextureFromFile(ID3D11Device* d3dDevice, const wchar_t* szFileName, ID3D11ShaderResourceView** textureView);
\ No newline at end of file
+HRESULT CreateTextureFromFile(ID3D11Device* d3dDevice, const wchar_t* szFileName, ID3D11ShaderResourceView** textureView);
+
+// CreateTextureFromFile 을 둘로 나눈 것 (스트리밍): 디코드는 디바이스 없이 아무 스레드에서, 생성은 디바이스로
+// - 백그라운드 스레드용이라 실패해도 메시지 박스 없이 HRESULT 만
+namespace DirectX { class ScratchImage; }
+HRESULT DecodeTextureFromFile(const wchar_t* szFileName, DirectX::ScratchImage& image);
+HRESULT CreateTextureFromImage(ID3D11Device* d3dDevice, const DirectX::ScratchImage& image, ID3D11ShaderResourceView** textureView);
\ No newline at end of file
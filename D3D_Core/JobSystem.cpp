@@ -0,0 +1,138 @@
+﻿#include "pch.h"
+#include "JobSystem.h"
+
+#include <cstdio>
+
+JobSystem::JobSystem(unsigned workerCount)
+{
+	if (workerCount == 0)
+	{
+		const unsigned hw = std::thread::hardware_concurrency();
+		workerCount = (hw > 1) ? hw - 1 : 1;
+	}
+
+	m_Workers.reserve(workerCount);
+	for (unsigned i = 0; i < workerCount; ++i)
+		m_Workers.emplace_back([this] { WorkerMain(); });
+}
+
+JobSystem::~JobSystem()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_Quit = true;
+	}
+	m_Cv.notify_all();
+	for (auto& t : m_Workers)
+		if (t.joinable()) t.join();
+}
+
+void JobSystem::Submit(Job job, JobCounter* counter)
+{
+	if (counter) counter->pending.fetch_add(1, std::memory_order_relaxed);
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_Queue.push_back({ std::move(job), counter });
+	}
+	m_Cv.notify_one();
+}
+
+void JobSystem::Run(Item& item)
+{
+	// 예외가 워커 스레드 밖으로 나가면 terminate, 카운터도 영영 0이 안 됨 → 여기서 잡고 항상 감소
+	try
+	{
+		item.job();
+	}
+	catch (...)
+	{
+		if (item.counter)
+		{
+			bool expected = false;
+			if (item.counter->failed.compare_exchange_strong(expected, true, std::memory_order_relaxed))
+				item.counter->error = std::current_exception();
+		}
+		else
+		{
+			// 기다리는 쪽이 없는 작업 → 로그만
+			try { throw; }
+			catch (const std::exception& e) { fprintf(stderr, "[JobSystem] job failed: %s\n", e.what()); }
+			catch (...) { fprintf(stderr, "[JobSystem] job failed: unknown exception\n"); }
+		}
+	}
+	if (item.counter) item.counter->pending.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+bool JobSystem::TryRunOne()
+{
+	Item item;
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		if (m_Queue.empty()) return false;
+		item = std::move(m_Queue.front());
+		m_Queue.pop_front();
+	}
+
+	Run(item);
+	if (item.counter)
+	{
+		// 기다리는 쪽 깨우기 (lock을 잡고 notify → Wait의 검사와 경합 없음)
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_DoneCv.notify_all();
+	}
+	return true;
+}
+
+void JobSystem::Wait(JobCounter& counter)
+{
+	while (!counter.Done())
+	{
+		// 남은 작업이 있으면 직접 처리, 없으면 다른 스레드가 끝내길 기다림
+		if (TryRunOne()) continue;
+
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_DoneCv.wait(lock, [&] { return counter.Done() || !m_Queue.empty(); });
+	}
+
+	if (counter.error)
+	{
+		std::exception_ptr e = counter.error;
+		counter.error = nullptr;
+		counter.failed.store(false, std::memory_order_relaxed);
+		std::rethrow_exception(e);
+	}
+}
+
+void JobSystem::WorkerMain()
+{
+	for (;;)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_Cv.wait(lock, [this] { return m_Quit || !m_Queue.empty(); });
+			if (m_Quit && m_Queue.empty()) return;
+		}
+		TryRunOne();
+	}
+}
+
+void JobSystem::ParallelFor(size_t count, size_t batch, const std::function<void(size_t, size_t)>& fn)
+{
+	if (count == 0) return;
+	if (batch == 0) batch = 1;
+
+	// 한 조각이면 그냥 호출 스레드에서
+	if (count <= batch)
+	{
+		fn(0, count);
+		return;
+	}
+
+	JobCounter counter;
+	for (size_t begin = 0; begin < count; begin += batch)
+	{
+		const size_t end = (begin + batch < count) ? begin + batch : count;
+		Submit([&fn, begin, end] { fn(begin, end); }, &counter);
+	}
+	Wait(counter);
+}
@@ -0,0 +1,73 @@
+﻿#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// JobSystem
+// - 고정 워커 스레드 풀 + 단일 작업 큐
+// - Submit(job, counter) 로 넣고 Wait(counter) 로 기다린다
+//   (Wait 하는 스레드도 큐에서 작업을 꺼내 같이 처리 → 데드락/유휴 없음)
+// - ParallelFor: [0,count) 를 batch 단위로 나눠 처리하고 끝날 때까지 블록
+// - 작업에서 던진 예외는 워커 밖으로 나가지 않는다
+//   카운터가 있으면 첫 번째 예외를 카운터에 담아 Wait 가 (전부 끝난 뒤) 다시 던지고,
+//   카운터가 없으면 stderr 에 로그만 남긴다
+// ============================================================================
+
+// 제출한 작업 묶음의 남은 개수 + 첫 번째 예외
+struct JobCounter
+{
+	std::atomic<int>   pending{ 0 };
+	std::atomic<bool>  failed{ false };   // error 를 처음 쓰는 작업만 true 로 바꿈
+	std::exception_ptr error;             // pending 이 0 이 된 뒤에만 읽는다
+
+	bool Done() const { return pending.load(std::memory_order_acquire) == 0; }
+};
+
+class JobSystem
+{
+public:
+	using Job = std::function<void()>;
+
+	// workerCount = 0 이면 (하드웨어 스레드 - 1), 최소 1
+	explicit JobSystem(unsigned workerCount = 0);
+	~JobSystem();
+
+	JobSystem(const JobSystem&) = delete;
+	JobSystem& operator=(const JobSystem&) = delete;
+
+	unsigned WorkerCount() const { return (unsigned)m_Workers.size(); }
+
+	void Submit(Job job, JobCounter* counter = nullptr);
+	// counter 의 작업이 모두 끝날 때까지 블록. 실패한 작업이 있었으면 첫 예외를 다시 던짐
+	void Wait(JobCounter& counter);
+
+	// fn(begin, end) 를 batch 크기 구간마다 호출. 호출 스레드도 참여한다
+	// fn 이 던지면 나머지 구간까지 끝난 뒤 첫 예외를 다시 던짐
+	void ParallelFor(size_t count, size_t batch, const std::function<void(size_t, size_t)>& fn);
+
+private:
+	struct Item
+	{
+		Job job;
+		JobCounter* counter = nullptr;
+	};
+
+	bool TryRunOne();
+	void WorkerMain();
+	static void Run(Item& item);
+
+	std::vector<std::thread> m_Workers;
+	std::deque<Item>         m_Queue;
+	std::mutex               m_Mutex;
+	std::condition_variable  m_Cv;        // 큐에 작업이 들어옴 / 종료
+	std::condition_variable  m_DoneCv;    // 어떤 카운터가 0이 됨
+	bool                     m_Quit = false;
+};
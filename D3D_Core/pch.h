@@ -8,31 +8,42 @@
 #define PCH_H
 
 // 여기에 미리 컴파일하려는 헤더 추가
+// 비 Windows (Tests/ 헤드리스 빌드): D3D / Win32 / ImGui 없이 표준 헤더 + SimpleMath(대체 헤더)만
+#ifdef _WIN32
 #include "framework.h"
 
 #include <windows.h>
+#endif
 #include <vector>
 #include <map>
 #include <set>
 #include <list>
 #include <memory>
+#ifdef _WIN32
 #include <DirectXMath.h>
 #include <wrl/client.h>
+#endif
 #include <directxtk/SimpleMath.h>
+#ifdef _WIN32
 #include <d3d11.h>
+#endif
 #include <string>
 #include <filesystem>
 #include <iostream>
 #include <utility>
 #include <algorithm>
 #include <functional>
+#ifdef _WIN32
 #include <imgui.h>
 #include <imgui_impl_win32.h>
 #include <imgui_impl_dx11.h>
 #include <imgui_stdlib.h>
+#endif
 
 namespace Math = DirectX::SimpleMath;
 using namespace DirectX;
+#ifdef _WIN32
 using namespace Microsoft::WRL;
+#endif
 using namespace DirectX::SimpleMath;
 #endif //PCH_H
@@ -0,0 +1,257 @@
+﻿// ============================================================================
+// AnimBake.cpp
+// - AnimBake 구현: 고정 fps 샘플링 / 정확도 측정 / 캐시 파일 입출력
+// ============================================================================
+
+// ---- includes ----
+#include "AnimBake.h"
+#include "AnimatedInstance.h"
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+    constexpr uint32_t kBakeMagic = 0x4B424E41;   // "ANBK"
+    constexpr uint32_t kBakeVersion = 1;
+
+    struct Fnv
+    {
+        uint64_t h = 1469598103934665603ull;
+        void Bytes(const void* p, size_t n)
+        {
+            const uint8_t* b = static_cast<const uint8_t*>(p);
+            for (size_t i = 0; i < n; ++i) { h ^= b[i]; h *= 1099511628211ull; }
+        }
+        template <class T> void Pod(const T& v) { Bytes(&v, sizeof(v)); }
+        void Str(const std::string& s) { Pod((uint64_t)s.size()); Bytes(s.data(), s.size()); }
+    };
+
+    // 전치 행렬(열벡터 기준)의 앞 3행
+    void CopyRows(const DirectX::SimpleMath::Matrix& transposed, float* dst)
+    {
+        memcpy(dst, &transposed, sizeof(float) * 12);
+    }
+
+    // 프레임 하나 기록: 팔레트 3행 x 본 + 노드 글로벌 3행 x 노드
+    void WriteFrame(const AnimatedInstance& inst, const std::vector<int>& nodes, float* dst)
+    {
+        for (const auto& m : inst.Palette()) { CopyRows(m, dst); dst += 12; }
+        for (int n : nodes) { CopyRows(inst.Global(n).Transpose(), dst); dst += 12; }
+    }
+
+    // a/b 두 프레임 행을 u 로 보간한 값과 exact 의 본별 오차
+    float FrameError(const float* a, const float* b, float u, const float* exact, uint32_t bones, float radius,
+        double& sum)
+    {
+        float worst = 0.0f;
+        for (uint32_t i = 0; i < bones; ++i) {
+            float e = 0.0f;
+            for (int r = 0; r < 3; ++r) {
+                const float* pa = a + (i * 3 + r) * 4;
+                const float* pb = b + (i * 3 + r) * 4;
+                const float* pe = exact + (i * 3 + r) * 4;
+                float d[4];
+                for (int c = 0; c < 4; ++c) d[c] = pa[c] + (pb[c] - pa[c]) * u - pe[c];
+                const float rowErr = std::sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]) * radius + std::fabs(d[3]);
+                if (rowErr > e) e = rowErr;
+            }
+            sum += e;
+            if (e > worst) worst = e;
+        }
+        return worst;
+    }
+}
+
+void AnimBakedSet::Locate(uint32_t clip, double tSec, bool loop, uint32_t& rowA, uint32_t& rowB, float& blend) const
+{
+    const AnimBakeClipInfo& c = clips[clip];
+    const double dur = c.durationSec;
+    double t = tSec;
+    if (dur > 0.0) {
+        if (loop) { t = std::fmod(t, dur); if (t < 0.0) t += dur; }
+        else t = (t < 0.0) ? 0.0 : (t > dur ? dur : t);
+    }
+    else t = 0.0;
+
+    const double f = t * fps;
+    uint32_t fa = (uint32_t)f;
+    if (fa >= c.frameCount - 1) fa = c.frameCount - 1;
+    const uint32_t fb = (fa + 1 < c.frameCount) ? fa + 1 : fa;
+
+    blend = (fb != fa) ? (float)(f - fa) : 0.0f;
+    rowA = (c.firstFrame + fa) * RowsPerFrame();
+    rowB = (c.firstFrame + fb) * RowsPerFrame();
+}
+
+uint64_t AnimBakeSourceHash(const SkeletonAsset& skeleton, const AnimClipLibrary& library,
+    float fps, const std::vector<int>& nodes)
+{
+    Fnv h;
+    h.Pod(kBakeVersion);
+    h.Pod(fps);
+    h.Pod((uint64_t)skeleton.NodeCount());
+    h.Pod((uint64_t)skeleton.BoneCount());
+    h.Bytes(skeleton.parents.data(), skeleton.parents.size() * sizeof(int));
+    h.Bytes(skeleton.bindLocal.data(), skeleton.bindLocal.size() * sizeof(DirectX::SimpleMath::Matrix));
+    h.Bytes(skeleton.boneOffsets.data(), skeleton.boneOffsets.size() * sizeof(DirectX::SimpleMath::Matrix));
+    h.Bytes(skeleton.boneNodes.data(), skeleton.boneNodes.size() * sizeof(int));
+    h.Bytes(nodes.data(), nodes.size() * sizeof(int));
+
+    h.Pod((uint64_t)library.Count());
+    for (const auto& clip : library.clips) {
+        h.Str(clip->name);
+        h.Pod(clip->duration);
+        h.Pod(clip->tps);
+        h.Pod((uint64_t)clip->channels.size());
+        for (const auto& ch : clip->channels) {
+            h.Str(ch.target);
+            // 키 구조체는 패딩이 있으니 필드 단위로
+            for (const auto& k : ch.T) { h.Pod(k.t); h.Pod(k.v.x); h.Pod(k.v.y); h.Pod(k.v.z); }
+            for (const auto& k : ch.R) { h.Pod(k.t); h.Pod(k.q.x); h.Pod(k.q.y); h.Pod(k.q.z); h.Pod(k.q.w); }
+            for (const auto& k : ch.S) { h.Pod(k.t); h.Pod(k.v.x); h.Pod(k.v.y); h.Pod(k.v.z); }
+        }
+        // 압축 트랙을 샘플링하므로 압축 결과도 포함
+        h.Pod(clip->packed.timeScale);
+        for (const auto& pc : clip->packed.channels) {
+            for (const AnimPackedTrack* tr : { &pc.T, &pc.R, &pc.S }) {
+                h.Pod(tr->kind);
+                h.Bytes(tr->c, sizeof(tr->c));
+                h.Bytes(tr->mn, sizeof(tr->mn));
+                h.Bytes(tr->ext, sizeof(tr->ext));
+                h.Bytes(tr->keys.data(), tr->keys.size() * sizeof(AnimPackedKey));
+            }
+        }
+    }
+    return h.h;
+}
+
+void AnimBake(std::shared_ptr<const SkeletonAsset> skeleton,
+    std::shared_ptr<const AnimClipLibrary> library,
+    float fps, const std::vector<int>& nodes, AnimBakedSet& out)
+{
+    out = AnimBakedSet{};
+    out.fps = (fps > 0.0f) ? fps : 30.0f;
+    out.boneCount = (uint32_t)skeleton->BoneCount();
+    out.nodes = nodes;
+    out.sourceHash = AnimBakeSourceHash(*skeleton, *library, out.fps, nodes);
+
+    const uint32_t rowsPerFrame = out.RowsPerFrame();
+    const size_t floatsPerFrame = (size_t)rowsPerFrame * 4;
+    const float radius = skeleton->bindRadius;
+
+    // 프레임 수 먼저 → 한 번에 할당
+    uint32_t total = 0;
+    out.clips.resize(library->Count());
+    for (size_t c = 0; c < library->Count(); ++c) {
+        AnimBakeClipInfo& info = out.clips[c];
+        info.name = library->Get(c).name;
+        info.durationSec = (float)library->Get(c).DurationSec();
+        info.firstFrame = total;
+        info.frameCount = (uint32_t)std::floor(info.durationSec * out.fps) + 1;
+        total += info.frameCount;
+    }
+    out.rows.resize((size_t)total * floatsPerFrame);
+
+    AnimatedInstance inst;
+    std::vector<float> exact(floatsPerFrame);
+    for (size_t c = 0; c < library->Count(); ++c) {
+        AnimBakeClipInfo& info = out.clips[c];
+        inst.Init(skeleton, library, (int)c);
+
+        // 1) 고정 fps 샘플링 (끝점 포함, loop 감싸기 없이 그대로)
+        for (uint32_t f = 0; f < info.frameCount; ++f) {
+            const double t = (double)f / out.fps;
+            inst.Evaluate(t < info.durationSec ? t : info.durationSec, /*loop*/false);
+            inst.BuildPalette();
+            WriteFrame(inst, nodes, out.rows.data() + (size_t)(info.firstFrame + f) * floatsPerFrame);
+        }
+
+        // 2) 정확도: 프레임 사이 중간 시각의 정확한 팔레트 vs 두 프레임 보간
+        double sum = 0.0;
+        size_t samples = 0;
+        for (uint32_t f = 0; f + 1 < info.frameCount; ++f) {
+            const double t = ((double)f + 0.5) / out.fps;
+            if (t > info.durationSec) break;
+            inst.Evaluate(t, /*loop*/false);
+            inst.BuildPalette();
+            WriteFrame(inst, nodes, exact.data());
+
+            const float* a = out.rows.data() + (size_t)(info.firstFrame + f) * floatsPerFrame;
+            const float e = FrameError(a, a + floatsPerFrame, 0.5f, exact.data(), out.boneCount, radius, sum);
+            if (e > info.maxError) info.maxError = e;
+            samples += out.boneCount;
+        }
+        info.avgError = samples ? (float)(sum / samples) : 0.0f;
+    }
+}
+
+bool AnimBakeSave(const AnimBakedSet& set, const std::filesystem::path& path)
+{
+    std::ofstream f(path, std::ios::binary | std::ios::trunc);
+    if (!f) return false;
+
+    auto pod = [&f](const auto& v) { f.write(reinterpret_cast<const char*>(&v), sizeof(v)); };
+    pod(kBakeMagic); pod(kBakeVersion);
+    pod(set.sourceHash); pod(set.fps); pod(set.boneCount);
+
+    pod((uint32_t)set.nodes.size());
+    f.write(reinterpret_cast<const char*>(set.nodes.data()), set.nodes.size() * sizeof(int));
+
+    pod((uint32_t)set.clips.size());
+    for (const auto& c : set.clips) {
+        pod((uint32_t)c.name.size());
+        f.write(c.name.data(), c.name.size());
+        pod(c.firstFrame); pod(c.frameCount); pod(c.durationSec); pod(c.maxError); pod(c.avgError);
+    }
+
+    pod((uint64_t)set.rows.size());
+    f.write(reinterpret_cast<const char*>(set.rows.data()), set.rows.size() * sizeof(float));
+    return (bool)f;
+}
+
+bool AnimBakeLoad(AnimBakedSet& set, const std::filesystem::path& path, uint64_t expectHash)
+{
+    std::ifstream f(path, std::ios::binary);
+    if (!f) return false;
+
+    auto pod = [&f](auto& v) { f.read(reinterpret_cast<char*>(&v), sizeof(v)); return (bool)f; };
+    uint32_t magic = 0, version = 0;
+    if (!pod(magic) || !pod(version) || magic != kBakeMagic || version != kBakeVersion) return false;
+
+    AnimBakedSet s;
+    if (!pod(s.sourceHash) || s.sourceHash != expectHash) return false;
+    if (!pod(s.fps) || !pod(s.boneCount)) return false;
+
+    uint32_t n = 0;
+    if (!pod(n)) return false;
+    s.nodes.resize(n);
+    f.read(reinterpret_cast<char*>(s.nodes.data()), n * sizeof(int));
+
+    if (!pod(n)) return false;
+    s.clips.resize(n);
+    for (auto& c : s.clips) {
+        uint32_t len = 0;
+        if (!pod(len)) return false;
+        c.name.resize(len);
+        f.read(c.name.data(), len);
+        if (!pod(c.firstFrame) || !pod(c.frameCount) || !pod(c.durationSec) || !pod(c.maxError) || !pod(c.avgError))
+            return false;
+    }
+
+    // 클립은 AnimBake 가 쓴 그대로 이어져 있어야 하고 행 수는 프레임 수와 맞아야 함 (Locate 가 범위 검사 안 함)
+    uint32_t frames = 0;
+    for (const auto& c : s.clips) {
+        if (c.firstFrame != frames || c.frameCount == 0) return false;
+        frames += c.frameCount;
+    }
+    uint64_t count = 0;
+    if (!pod(count) || count != (uint64_t)frames * s.RowsPerFrame() * 4) return false;
+    s.rows.resize((size_t)count);
+    f.read(reinterpret_cast<char*>(s.rows.data()), count * sizeof(float));
+    if (!f) return false;
+
+    set = std::move(s);
+    return true;
+}
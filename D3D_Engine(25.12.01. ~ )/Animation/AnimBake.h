@@ -0,0 +1,67 @@
+﻿// ============================================================================
+// AnimBake.h
+// - 군중(crowd)용 애니메이션 베이크: 클립을 고정 fps 로 미리 샘플링한 본 행렬 표
+//   · 프레임마다 [본 팔레트 3행 x 본 수][추가 노드 글로벌 3행 x 노드 수] (float4 행)
+//     → BonePaletteRing 과 같은 3행 형식이라 Skinning.hlsli 를 그대로 쓴다
+//   · 샘플링은 AnimatedInstance::Evaluate + BuildPalette (런타임 경로와 같은 식)
+//   · 인스턴스는 (프레임 A/B 행 시작, 보간 계수)만 넘기면 된다 → 포즈 평가/팔레트 업로드 없음
+// - 디스크 캐시: 스켈레톤/클립/설정 해시가 같으면 베이크 생략
+// - D3D 의존 없음 (헤드리스 베이크 가능)
+// ============================================================================
+
+#pragma once
+
+// ---- includes ----
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "AnimClip.h"
+#include "SkeletonAsset.h"
+
+// 클립 하나의 위치 + 정확도 보고
+struct AnimBakeClipInfo
+{
+    std::string name;
+    uint32_t firstFrame = 0;    // AnimBakedSet 전체 프레임 기준
+    uint32_t frameCount = 0;    // 끝점 포함 (duration * fps + 1)
+    float    durationSec = 0.0f;
+
+    // 프레임 사이(중간 시각) 보간 결과 vs 정확한 평가
+    //  - 본마다 bindRadius 거리의 점이 움직이는 양의 근사 (행 xyz 차이 * 반지름 + 이동 차이)
+    float    maxError = 0.0f;
+    float    avgError = 0.0f;
+};
+
+struct AnimBakedSet
+{
+    uint64_t sourceHash = 0;    // AnimBakeSourceHash (캐시 유효성)
+    float    fps = 30.0f;
+    uint32_t boneCount = 0;
+    std::vector<int> nodes;     // 프레임마다 글로벌을 같이 저장할 노드 (파트 ownerNode 등)
+    std::vector<AnimBakeClipInfo> clips;
+    std::vector<float> rows;    // [frame][bone | node][3][4]
+
+    uint32_t RowsPerFrame() const { return (boneCount + (uint32_t)nodes.size()) * 3; }
+    uint32_t FrameCount() const { return RowsPerFrame() ? (uint32_t)(rows.size() / 4 / RowsPerFrame()) : 0; }
+    size_t   Bytes() const { return rows.size() * sizeof(float); }
+    bool     Empty() const { return rows.empty(); }
+
+    // 재생 시각 → 두 프레임의 행 시작 + 보간 계수 (loop 면 길이로 감싸고, 아니면 끝 프레임 유지)
+    void Locate(uint32_t clip, double tSec, bool loop, uint32_t& rowA, uint32_t& rowB, float& blend) const;
+};
+
+// 스켈레톤 / 클립 키 / fps / 노드 목록으로 만든 64-bit 해시 (FNV-1a)
+uint64_t AnimBakeSourceHash(const SkeletonAsset& skeleton, const AnimClipLibrary& library,
+    float fps, const std::vector<int>& nodes);
+
+// 모든 클립을 베이크 + 정확도 측정
+void AnimBake(std::shared_ptr<const SkeletonAsset> skeleton,
+    std::shared_ptr<const AnimClipLibrary> library,
+    float fps, const std::vector<int>& nodes, AnimBakedSet& out);
+
+// 디스크 캐시 (리틀 엔디언 그대로 덤프). Load 는 해시가 다르면 false
+bool AnimBakeSave(const AnimBakedSet& set, const std::filesystem::path& path);
+bool AnimBakeLoad(AnimBakedSet& set, const std::filesystem::path& path, uint64_t expectHash);
@@ -0,0 +1,36 @@
+﻿// ============================================================================
+// AnimBlend.cpp
+// - 가산 레이어 기준 포즈 계산
+// ============================================================================
+
+// ---- includes ----
+#include "AnimBlend.h"
+#include "AnimClip.h"
+#include "SkeletonAsset.h"
+#include "AnimSIMD.h"
+
+void AnimBuildAdditiveRef(AnimationClipAsset& clip, const SkeletonAsset& sk)
+{
+    const size_t n = clip.bindings.size();
+    clip.additiveRef.assign(n * 10, 0.0f);
+    if (n == 0) return;
+
+    AnimPoseSoA soa;
+    soa.Resize(n);
+    for (size_t k = 0; k < n; ++k) {
+        const AnimBinding& b = clip.bindings[k];
+        const auto& dt = sk.defaultT[b.node];
+        const float defT[3] = { dt.x, dt.y, dt.z };
+        AnimKeyCursor cur;
+        if (!clip.packed.Empty()) AnimGatherPacked(clip.packed.channels[b.channel], cur, 0.0, defT, soa, k);
+        else AnimGatherChannel(clip.channels[b.channel], cur, 0.0, defT, soa, k);
+    }
+    AnimSimd::SampleTRS(soa);
+
+    for (size_t k = 0; k < n; ++k) {
+        float* o = &clip.additiveRef[k * 10];
+        for (int c = 0; c < 3; ++c) o[c] = soa.t[c][k];
+        for (int c = 0; c < 4; ++c) o[3 + c] = soa.r[c][k];
+        for (int c = 0; c < 3; ++c) o[7 + c] = soa.s[c][k];
+    }
+}
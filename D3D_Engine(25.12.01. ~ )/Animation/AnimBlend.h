@@ -0,0 +1,80 @@
+﻿// ============================================================================
+// AnimBlend.h
+// - 블렌드 레이어 정의 (크로스페이드 / N-way 가중 / 가산)
+// - 평가는 AnimatedInstance::EvaluateLayers
+//   · 레이어마다 클립을 한 번만 샘플링 → 로컬 TRS 공간에서 가중 합
+//   · 합성/글로벌 누적은 마지막에 한 번
+//   · 총 가중치가 0인 노드는 샘플링/합성 모두 건너뜀 (바인드 포즈)
+// ============================================================================
+
+#pragma once
+
+// ---- includes ----
+#include <vector>
+#include <cstddef>
+
+struct AnimationClipAsset;
+struct SkeletonAsset;
+
+// ---------------------------------------------------------------------------
+// AnimLayer
+//  - clip : AnimClipLibrary 인덱스
+//  - mask : 노드별 가중치 배율 (노드 수 길이, nullptr = 전부 1, 짧으면 모자란 노드는 1)
+//  - additive: 클립의 t=0 포즈 대비 차이를 일반 레이어 결과 위에 더한다
+// ---------------------------------------------------------------------------
+struct AnimLayer
+{
+    int    clip = 0;
+    double tSec = 0.0;
+    bool   loop = true;
+    float  weight = 1.0f;
+    bool   additive = false;
+    const std::vector<float>* mask = nullptr;
+};
+
+// ---------------------------------------------------------------------------
+// AnimCrossfade
+//  - 빠져나가는 클립(prev)의 시간/페이드 진행만 들고 있다
+//  - 현재 클립/시간은 호출부가 관리 → Layers()로 현재 레이어와 합쳐 최대 2개
+// ---------------------------------------------------------------------------
+struct AnimCrossfade
+{
+    int    prev = -1;
+    double prevT = 0.0;
+    bool   prevLoop = true;
+    double fade = 0.0;      // 경과(초)
+    double fadeLen = 0.0;   // 전환 시간(초)
+
+    void Begin(int fromClip, double fromT, bool fromLoop, double fadeSec)
+    {
+        if (fadeSec <= 0.0 || fromClip < 0) { prev = -1; return; }
+        prev = fromClip; prevT = fromT; prevLoop = fromLoop;
+        fade = 0.0; fadeLen = fadeSec;
+    }
+
+    void Advance(double dt)
+    {
+        if (prev < 0) return;
+        prevT += dt;
+        fade += (dt < 0.0) ? -dt : dt;
+        if (fade >= fadeLen) prev = -1;
+    }
+
+    bool Active() const { return prev >= 0; }
+
+    size_t Layers(const AnimLayer& current, AnimLayer out[2]) const
+    {
+        if (prev < 0) { out[0] = current; return 1; }
+
+        const float a = (float)(fade / fadeLen);
+        out[0] = current;
+        out[0].clip = prev; out[0].tSec = prevT; out[0].loop = prevLoop;
+        out[0].weight = current.weight * (1.0f - a);
+        out[1] = current;
+        out[1].weight = current.weight * a;
+        return 2;
+    }
+};
+
+// 가산 레이어 기준 포즈(t=0)를 clip.additiveRef 에 채운다 (bindings/압축 이후 호출)
+void AnimBuildAdditiveRef(AnimationClipAsset& clip, const SkeletonAsset& skeleton);
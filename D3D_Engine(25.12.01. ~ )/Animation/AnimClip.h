@@ -0,0 +1,94 @@
+﻿// ============================================================================
+// AnimClip.h
+// - 애니메이션 클립 데이터 (키프레임/채널/클립) 공용 정의
+// - SK_* / RS_* 는 이 타입들의 별칭 (SkinnedSkeletal / RigidSkeletal)
+// - AnimationClipAsset: 로드 후 불변. 여러 인스턴스가 shared_ptr로 공유
+//   (packed 가 있으면 샘플링은 압축 트랙만 읽는다. AnimCompress.h)
+// - AnimClipLibrary: 한 스켈레톤에 묶인 클립 전체 (FBX의 모든 aiAnimation)
+// ============================================================================
+
+#pragma once
+
+// ---- includes ----
+#include <memory>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <directxtk/SimpleMath.h>
+
+#include "AnimSampler.h"
+#include "AnimCompress.h"
+
+// ---------------------------------------------------------------------------
+// Keys / Channel
+//  - 키프레임: (time[tick], value)
+//  - 채널: 특정 노드(target)에 대해 T/R/S 키를 가진다
+// ---------------------------------------------------------------------------
+struct AnimKeyT { double t; DirectX::SimpleMath::Vector3    v; };   // Translation key
+struct AnimKeyR { double t; DirectX::SimpleMath::Quaternion q; };   // Rotation key
+struct AnimKeyS { double t; DirectX::SimpleMath::Vector3    v; };   // Scale key
+
+struct AnimChannel
+{
+    std::string target;              // 애니메이션이 적용될 노드 이름
+    std::vector<AnimKeyT> T;
+    std::vector<AnimKeyR> R;
+    std::vector<AnimKeyS> S;
+};
+
+// ---------------------------------------------------------------------------
+// AnimationClipAsset
+//  - 채널 집합 + (duration, ticksPerSecond)
+//  - bindings: 특정 스켈레톤에 묶은 (노드, 채널) 목록. 로드 시 1회 채움
+// ---------------------------------------------------------------------------
+struct AnimationClipAsset
+{
+    std::string name;
+    double duration = 0.0;           // tick 단위 (Assimp aiAnimation::mDuration)
+    double tps = 25.0;               // ticks per second (0이면 관례적으로 25로 취급)
+
+    std::vector<AnimChannel> channels;
+
+    // 빠른 lookup: target(node name) -> channels index
+    std::unordered_map<std::string, int> map;
+
+    // 스켈레톤 노드에 묶인 채널 (노드 순)
+    std::vector<AnimBinding> bindings;
+
+    // 압축 트랙 (channels와 1:1). 비어 있으면 원본 키로 샘플링
+    AnimPackedClip packed;
+
+    // 가산 블렌딩 기준 포즈: bindings와 1:1, t=0 샘플 (T3 R4 S3). AnimBuildAdditiveRef
+    std::vector<float> additiveRef;
+
+    double TicksPerSec() const { return (tps > 0.0) ? tps : 25.0; }
+    double DurationSec() const { return duration / TicksPerSec(); }
+};
+
+// ---------------------------------------------------------------------------
+// AnimClipLibrary
+//  - 클립 목록 + 이름 검색. 인스턴스들이 shared_ptr로 공유
+//  - 인덱스가 곧 AnimLayer::clip
+// ---------------------------------------------------------------------------
+struct AnimClipLibrary
+{
+    std::vector<std::shared_ptr<const AnimationClipAsset>> clips;
+    std::unordered_map<std::string, int> byName;     // 같은 이름이면 먼저 들어온 클립
+
+    int Add(std::shared_ptr<const AnimationClipAsset> clip)
+    {
+        const int idx = (int)clips.size();
+        byName.emplace(clip->name, idx);
+        clips.push_back(std::move(clip));
+        return idx;
+    }
+
+    int Find(const std::string& name) const
+    {
+        auto it = byName.find(name);
+        return (it != byName.end()) ? it->second : -1;
+    }
+
+    size_t Count() const { return clips.size(); }
+    const AnimationClipAsset& Get(size_t i) const { return *clips[i]; }
+};
@@ -0,0 +1,417 @@
+﻿// ============================================================================
+// AnimCompress.cpp
+// - 클립 압축기: 상수 트랙 검출 → 키 제거 → 양자화 → 모델 공간 검증/재압축
+// - 오차는 "가상 정점"으로 잰다: 노드 원점 + 로컬 축 방향 shell 거리의 점 3개
+//   (shell = 바인드 포즈에서 가장 먼 자손까지 거리, 하한 settings.shellDistance)
+// ============================================================================
+
+// ---- includes ----
+#include "AnimCompress.h"
+#include "AnimClip.h"
+#include "SkeletonAsset.h"
+
+#include <cstdio>
+#include <algorithm>
+
+using DirectX::SimpleMath::Matrix;
+
+namespace
+{
+    // 노드 하나의 오차 환산 정보 (모델 단위)
+    struct NodeMetric
+    {
+        float parentScale = 1.0f;   // 로컬 이동 1 → 모델 공간 거리
+        float shell = 1.0f;         // 회전/스케일 오차를 재는 거리
+    };
+
+    inline void KeyValue(const AnimKeyT& k, float o[4]) { o[0] = k.v.x; o[1] = k.v.y; o[2] = k.v.z; o[3] = 0.0f; }
+    inline void KeyValue(const AnimKeyS& k, float o[4]) { o[0] = k.v.x; o[1] = k.v.y; o[2] = k.v.z; o[3] = 0.0f; }
+    inline void KeyValue(const AnimKeyR& k, float o[4])
+    {
+        o[0] = k.q.x; o[1] = k.q.y; o[2] = k.q.z; o[3] = k.q.w;
+        const float l = std::sqrt(o[0] * o[0] + o[1] * o[1] + o[2] * o[2] + o[3] * o[3]);
+        if (l > 0.0f) for (int i = 0; i < 4; ++i) o[i] /= l;
+        else { o[0] = o[1] = o[2] = 0.0f; o[3] = 1.0f; }
+    }
+
+    inline float Dot4(const float* a, const float* b) { return a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3]; }
+
+    inline float Dist3(const float* a, const float* b)
+    {
+        const float x = a[0] - b[0], y = a[1] - b[1], z = a[2] - b[2];
+        return std::sqrt(x * x + y * y + z * z);
+    }
+
+    // 런타임 Slerp4 와 같은 규칙 (cos<0 뒤집기, 거의 같으면 선형)
+    inline void QSlerp(const float* a, const float* b, float u, float* o)
+    {
+        float c = Dot4(a, b);
+        const float sgn = (c < 0.0f) ? -1.0f : 1.0f;
+        c *= sgn;
+        float wa = 1.0f - u, wb = u;
+        if (c < 1.0f - 1e-6f) {
+            const float th = std::acos(c);
+            const float inv = 1.0f / std::sin(th);
+            wa = std::sin((1.0f - u) * th) * inv;
+            wb = std::sin(u * th) * inv;
+        }
+        for (int i = 0; i < 4; ++i) o[i] = a[i] * wa + b[i] * wb * sgn;
+    }
+
+    // 트랙 종류별 보간 / 오차
+    enum class TrackKind { T, R, S };
+
+    inline void Interp(TrackKind kind, const float* a, const float* b, float u, float* o)
+    {
+        if (kind == TrackKind::R) { QSlerp(a, b, u, o); return; }
+        for (int i = 0; i < 3; ++i) o[i] = a[i] + (b[i] - a[i]) * u;
+        o[3] = 0.0f;
+    }
+
+    inline float Error(TrackKind kind, const float* a, const float* b, const NodeMetric& m)
+    {
+        switch (kind) {
+        case TrackKind::T:
+            return Dist3(a, b) * m.parentScale;
+        case TrackKind::R: {
+            // 현 길이 = 2 * shell * sin(θ/2). dot→acos 는 작은 각에서 float 정밀도가 모자라서
+            // 쿼터니언 차이 d = |a - b| = 2 sin(θ/4) 로 계산
+            const float sgn = (Dot4(a, b) < 0.0f) ? -1.0f : 1.0f;
+            float d2 = 0.0f;
+            for (int i = 0; i < 4; ++i) { const float x = a[i] - b[i] * sgn; d2 += x * x; }
+            return 2.0f * m.shell * std::sqrt(d2 * std::max(0.0f, 1.0f - d2 * 0.25f));
+        }
+        default: {
+            float e = 0.0f;
+            for (int i = 0; i < 3; ++i) e = std::max(e, std::fabs(a[i] - b[i]));
+            return e * m.shell;
+        }
+        }
+    }
+
+    // 허용 오차 안에서 선형/구면 보간으로 복원되는 키를 앞에서부터 탐욕적으로 제거
+    std::vector<int> ReduceKeys(TrackKind kind, const std::vector<double>& t,
+        const std::vector<float>& v, float tol, const NodeMetric& m)
+    {
+        const int n = (int)t.size();
+        std::vector<int> keep;
+        keep.push_back(0);
+        if (n <= 2) { for (int i = 1; i < n; ++i) keep.push_back(i); return keep; }
+
+        int a = 0;
+        for (int b = a + 2; b < n; ++b) {
+            const double span = t[b] - t[a];
+            bool ok = true;
+            for (int k = a + 1; k < b && ok; ++k) {
+                const float u = (span > 0.0) ? float((t[k] - t[a]) / span) : 0.0f;
+                float r[4];
+                Interp(kind, &v[a * 4], &v[b * 4], u, r);
+                ok = Error(kind, r, &v[k * 4], m) <= tol;
+            }
+            if (!ok) { keep.push_back(b - 1); a = b - 1; }
+        }
+        keep.push_back(n - 1);
+        return keep;
+    }
+
+    // tick → 16-bit 양자화 시간 (클립 범위로 클램프)
+    inline uint16_t QuantizeTime(double t, double duration, double invTimeScale)
+    {
+        const double tc = std::clamp(t, 0.0, duration);
+        return (uint16_t)std::min(65535.0, std::floor(tc * invTimeScale + 0.5));
+    }
+
+    // 서로 다른 두 키가 같은 양자화 시간이 되는지 (키 제거는 부분집합만 남기므로 원본 키로 검사하면 충분)
+    template <class Key>
+    bool TimesCollide(const std::vector<Key>& keys, double duration, double invTimeScale)
+    {
+        for (size_t i = 1; i < keys.size(); ++i) {
+            if (keys[i].t <= keys[i - 1].t) continue;   // 원본부터 같은 시각이면 압축 탓이 아님
+            if (QuantizeTime(keys[i].t, duration, invTimeScale) <= QuantizeTime(keys[i - 1].t, duration, invTimeScale))
+                return true;
+        }
+        return false;
+    }
+
+    template <class Key>
+    void PackTrack(const std::vector<Key>& keys, TrackKind kind, float tol, bool reduce,
+        const NodeMetric& m, double duration, double invTimeScale, AnimPackedTrack& out)
+    {
+        out = AnimPackedTrack{};
+        const int n = (int)keys.size();
+        if (n == 0) return;
+
+        // 값 펼치기 (R은 정규화 + 이웃 키와 같은 반구로)
+        std::vector<double> t(n);
+        std::vector<float> v((size_t)n * 4);
+        for (int i = 0; i < n; ++i) {
+            t[i] = keys[i].t;
+            KeyValue(keys[i], &v[i * 4]);
+            if (kind == TrackKind::R && i > 0 && Dot4(&v[i * 4], &v[(i - 1) * 4]) < 0.0f)
+                for (int k = 0; k < 4; ++k) v[i * 4 + k] = -v[i * 4 + k];
+        }
+
+        // 상수 트랙
+        bool constant = true;
+        for (int i = 1; i < n && constant; ++i)
+            constant = Error(kind, &v[0], &v[i * 4], m) <= tol;
+        if (constant) {
+            out.kind = AnimPackedTrack::Constant;
+            for (int k = 0; k < 4; ++k) out.c[k] = v[k];
+            if (kind != TrackKind::R) out.c[3] = 0.0f;
+            return;
+        }
+
+        std::vector<int> keep;
+        if (reduce) keep = ReduceKeys(kind, t, v, tol, m);
+        else { keep.resize(n); for (int i = 0; i < n; ++i) keep[i] = i; }
+
+        out.kind = AnimPackedTrack::Animated;
+        if (kind != TrackKind::R) {
+            for (int k = 0; k < 3; ++k) {
+                float lo = v[keep[0] * 4 + k], hi = lo;
+                for (int i : keep) { lo = std::min(lo, v[i * 4 + k]); hi = std::max(hi, v[i * 4 + k]); }
+                out.mn[k] = lo;
+                out.ext[k] = hi - lo;
+            }
+        }
+
+        out.keys.resize(keep.size());
+        for (size_t j = 0; j < keep.size(); ++j) {
+            const int i = keep[j];
+            AnimPackedKey& pk = out.keys[j];
+            pk.t = QuantizeTime(t[i], duration, invTimeScale);
+            if (kind == TrackKind::R) AnimPackQuat48(&v[i * 4], pk.v);
+            else for (int k = 0; k < 3; ++k) pk.v[k] = AnimQuantize16(v[i * 4 + k], out.mn[k], out.ext[k]);
+        }
+    }
+
+    // 원본/압축 클립을 같은 시각에 평가해 노드별 최대 가상 정점 오차를 누적
+    void MeasureError(const AnimationClipAsset& clip, const AnimPackedClip& packed,
+        const SkeletonAsset& sk, const std::vector<double>& times,
+        const std::vector<float>& shell, const std::vector<float>& scale,
+        std::vector<float>& nodeErr)
+    {
+        const size_t N = sk.NodeCount();
+        const size_t nb = clip.bindings.size();
+
+        std::vector<Matrix> localA(sk.bindLocal.begin(), sk.bindLocal.end()), globalA(N);
+        std::vector<Matrix> localB(sk.bindLocal.begin(), sk.bindLocal.end()), globalB(N);
+        std::vector<AnimKeyCursor> curA(clip.channels.size()), curB(clip.channels.size());
+        AnimPoseSoA soaA, soaB;
+        soaA.Resize(nb);
+        soaB.Resize(nb);
+
+        nodeErr.assign(N, 0.0f);
+
+        for (double t : times) {
+            const double tq = t * packed.invTimeScale;
+            for (size_t k = 0; k < nb; ++k) {
+                const AnimBinding& b = clip.bindings[k];
+                const auto& dt = sk.defaultT[b.node];
+                const float defT[3] = { dt.x, dt.y, dt.z };
+                AnimGatherChannel(clip.channels[b.channel], curA[b.channel], t, defT, soaA, k);
+                AnimGatherPacked(packed.channels[b.channel], curB[b.channel], tq, defT, soaB, k);
+                soaA.dst[k] = soaB.dst[k] = b.node;
+            }
+            AnimSimd::SampleTRS(soaA);
+            AnimSimd::SampleTRS(soaB);
+            AnimSimd::ComposeTRS44(soaA, soaA.dst.data(), reinterpret_cast<float*>(localA.data()));
+            AnimSimd::ComposeTRS44(soaB, soaB.dst.data(), reinterpret_cast<float*>(localB.data()));
+            AnimLocalToGlobal(sk.parents.data(), localA.data(), globalA.data(), N);
+            AnimLocalToGlobal(sk.parents.data(), localB.data(), globalB.data(), N);
+
+            for (size_t i = 0; i < N; ++i) {
+                const Matrix& A = globalA[i];
+                const Matrix& B = globalB[i];
+                float e = Dist3(A.m[3], B.m[3]);
+                const float d = shell[i] / std::max(scale[i], 1e-6f);   // 로컬 축 거리 → 모델 거리 shell
+                for (int r = 0; r < 3; ++r) {
+                    float pa[3], pb[3];
+                    for (int c = 0; c < 3; ++c) {
+                        pa[c] = A.m[3][c] + A.m[r][c] * d;
+                        pb[c] = B.m[3][c] + B.m[r][c] * d;
+                    }
+                    e = std::max(e, Dist3(pa, pb));
+                }
+                nodeErr[i] = std::max(nodeErr[i], e);
+            }
+        }
+    }
+}
+
+// ============================================================================
+// AnimCompressClip
+// ============================================================================
+void AnimCompressClip(AnimationClipAsset& clip, const SkeletonAsset& sk,
+    const AnimCompressSettings& settings, AnimCompressReport* report)
+{
+    AnimCompressReport rep;
+    rep.clipName = clip.name;
+
+    for (const auto& ch : clip.channels) {
+        rep.rawKeys += ch.T.size() + ch.R.size() + ch.S.size();
+        rep.rawBytes += ch.T.size() * sizeof(AnimKeyT) + ch.R.size() * sizeof(AnimKeyR) + ch.S.size() * sizeof(AnimKeyS);
+    }
+
+    const size_t N = sk.NodeCount();
+    if (clip.duration <= 0.0 || clip.channels.empty() || N == 0) {
+        if (report) *report = rep;
+        return;
+    }
+
+    // ------------------------------------------------------------------------
+    // 0) 16-bit 시간으로 구분되지 않는 키가 있으면 압축하지 않고 원본 키로 샘플링
+    //    (같은 t 키가 생기면 구간 탐색이 뒤쪽 키로 건너뛰어 사이 키가 사라짐)
+    // ------------------------------------------------------------------------
+    const double invTimeScale = 65535.0 / clip.duration;
+    for (const auto& ch : clip.channels) {
+        if (TimesCollide(ch.T, clip.duration, invTimeScale)
+            || TimesCollide(ch.R, clip.duration, invTimeScale)
+            || TimesCollide(ch.S, clip.duration, invTimeScale)) {
+            rep.timeCollision = true;
+            if (report) *report = rep;
+            return;
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // 1) 바인드 포즈 기준 노드 크기 정보 (스켈레톤 크기, shell 거리, 스케일)
+    // ------------------------------------------------------------------------
+    std::vector<Matrix> bindG(N);
+    AnimLocalToGlobal(sk.parents.data(), sk.bindLocal.data(), bindG.data(), N);
+
+    std::vector<float> scale(N);
+    float lo[3] = { bindG[0].m[3][0], bindG[0].m[3][1], bindG[0].m[3][2] };
+    float hi[3] = { lo[0], lo[1], lo[2] };
+    for (size_t i = 0; i < N; ++i) {
+        float s = 0.0f;
+        for (int r = 0; r < 3; ++r) s = std::max(s, std::sqrt(bindG[i].m[r][0] * bindG[i].m[r][0] + bindG[i].m[r][1] * bindG[i].m[r][1] + bindG[i].m[r][2] * bindG[i].m[r][2]));
+        scale[i] = s;
+        for (int c = 0; c < 3; ++c) { lo[c] = std::min(lo[c], bindG[i].m[3][c]); hi[c] = std::max(hi[c], bindG[i].m[3][c]); }
+    }
+    float extent = Dist3(lo, hi);
+    if (extent <= 0.0f) extent = 1.0f;
+
+    const float budget = (settings.maxError > 0.0f) ? settings.maxError : extent * 1e-3f;
+    const float shellMin = (settings.shellDistance > 0.0f) ? settings.shellDistance : extent * 0.05f;
+
+    // shell: 가장 먼 자손까지 거리 (조상 방향으로 올라가며 갱신)
+    std::vector<float> shell(N, shellMin);
+    for (size_t i = 0; i < N; ++i)
+        for (int p = sk.parents[i]; p >= 0; p = sk.parents[p])
+            shell[p] = std::max(shell[p], Dist3(bindG[i].m[3], bindG[p].m[3]));
+
+    std::vector<NodeMetric> metric(N);
+    std::vector<float> nodeBudget(N, budget), tol(N);
+    for (size_t i = 0; i < N; ++i) {
+        metric[i].parentScale = (sk.parents[i] >= 0) ? scale[sk.parents[i]] : 1.0f;
+        metric[i].shell = shell[i];
+        auto it = settings.boneMaxError.find(sk.names[i]);
+        if (it != settings.boneMaxError.end() && it->second > 0.0f) nodeBudget[i] = it->second;
+        tol[i] = nodeBudget[i] * 0.5f;   // 나머지 절반은 양자화 + 부모 오차 누적 몫
+    }
+
+    // ------------------------------------------------------------------------
+    // 2) 검증 시각: 원본 키 시각 + 인접 키 사이 중간점
+    // ------------------------------------------------------------------------
+    std::vector<double> times;
+    for (const auto& ch : clip.channels) {
+        for (const auto& k : ch.T) times.push_back(k.t);
+        for (const auto& k : ch.R) times.push_back(k.t);
+        for (const auto& k : ch.S) times.push_back(k.t);
+    }
+    for (double& t : times) t = std::clamp(t, 0.0, clip.duration);
+    std::sort(times.begin(), times.end());
+    times.erase(std::unique(times.begin(), times.end()), times.end());
+    const size_t nt = times.size();
+    for (size_t i = 1; i < nt; ++i) times.push_back(0.5 * (times[i - 1] + times[i]));
+    std::sort(times.begin(), times.end());
+
+    // ------------------------------------------------------------------------
+    // 3) 압축 → 검증 → 예산 초과 노드(와 조상)의 허용 오차를 줄여 재압축
+    // ------------------------------------------------------------------------
+    AnimPackedClip packed;
+    packed.timeScale = clip.duration / 65535.0;
+    packed.invTimeScale = invTimeScale;
+    packed.channels.resize(clip.channels.size());
+
+    std::vector<float> nodeErr;
+    for (int pass = 0;; ++pass) {
+        for (const AnimBinding& b : clip.bindings) {
+            const AnimChannel& ch = clip.channels[b.channel];
+            AnimPackedChannel& pc = packed.channels[b.channel];
+            const NodeMetric& m = metric[b.node];
+            PackTrack(ch.T, TrackKind::T, tol[b.node], settings.reduceKeys, m, clip.duration, packed.invTimeScale, pc.T);
+            PackTrack(ch.R, TrackKind::R, tol[b.node], settings.reduceKeys, m, clip.duration, packed.invTimeScale, pc.R);
+            PackTrack(ch.S, TrackKind::S, tol[b.node], settings.reduceKeys, m, clip.duration, packed.invTimeScale, pc.S);
+        }
+
+        MeasureError(clip, packed, sk, times, shell, scale, nodeErr);
+        rep.refinePasses = pass;
+        if (pass >= settings.maxRefine) break;
+
+        std::vector<char> halve(N, 0);
+        bool over = false;
+        for (size_t i = 0; i < N; ++i) {
+            if (nodeErr[i] <= nodeBudget[i]) continue;
+            over = true;
+            for (int p = (int)i; p >= 0; p = sk.parents[p]) halve[p] = 1;
+        }
+        if (!over) break;
+        for (size_t i = 0; i < N; ++i) if (halve[i]) tol[i] *= 0.5f;
+    }
+
+    // ------------------------------------------------------------------------
+    // 4) 결과 정리
+    // ------------------------------------------------------------------------
+    for (size_t i = 0; i < N; ++i) {
+        if (nodeErr[i] > rep.maxError) { rep.maxError = nodeErr[i]; rep.worstNode = sk.names[i]; }
+    }
+    for (const auto& pc : packed.channels) {
+        for (const AnimPackedTrack* tr : { &pc.T, &pc.R, &pc.S }) {
+            if (tr->kind == AnimPackedTrack::Constant) {
+                ++rep.constantTracks;
+                rep.packedBytes += sizeof(tr->c);
+            }
+            else if (tr->kind == AnimPackedTrack::Animated) {
+                ++rep.animatedTracks;
+                rep.packedKeys += tr->keys.size();
+                rep.packedBytes += tr->keys.size() * sizeof(AnimPackedKey) + sizeof(tr->mn) + sizeof(tr->ext);
+            }
+        }
+    }
+    rep.budget = budget;
+    rep.compressed = true;
+
+    clip.packed = std::move(packed);
+    if (!settings.keepRaw) {
+        for (auto& ch : clip.channels) {
+            std::vector<AnimKeyT>().swap(ch.T);
+            std::vector<AnimKeyR>().swap(ch.R);
+            std::vector<AnimKeyS>().swap(ch.S);
+        }
+    }
+
+    if (report) *report = std::move(rep);
+}
+
+// ============================================================================
+// 리포트 출력
+// ============================================================================
+void AnimPrintCompressReport(const AnimCompressReport& r)
+{
+    if (r.timeCollision) {
+        printf("[AnimCompress] '%s': skipped (keys closer than 1/65535 of the clip, kept uncompressed)\n", r.clipName.c_str());
+        return;
+    }
+    if (!r.compressed) {
+        printf("[AnimCompress] '%s': skipped (no animated channels)\n", r.clipName.c_str());
+        return;
+    }
+    printf("[AnimCompress] '%s': %zu -> %zu bytes (x%.2f), keys %zu -> %zu, tracks const %zu / anim %zu\n",
+        r.clipName.c_str(), r.rawBytes, r.packedBytes, r.Ratio(),
+        r.rawKeys, r.packedKeys, r.constantTracks, r.animatedTracks);
+    printf("[AnimCompress]   max error %.5f (budget %.5f) at '%s', refine passes %d\n",
+        r.maxError, r.budget, r.worstNode.c_str(), r.refinePasses);
+}
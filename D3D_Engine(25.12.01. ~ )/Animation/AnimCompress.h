@@ -0,0 +1,225 @@
+﻿// ============================================================================
+// AnimCompress.h
+// - 애니메이션 클립 압축 (로드 시 1회) + 압축 키 샘플링
+//   · 시간: 클립 길이를 0~65535 로 양자화한 16-bit
+//     → 키 간격이 duration / 65535 tick 보다 촘촘한 클립 (예: 30fps 키로 약 36분 이상)은
+//       두 키가 같은 시간이 되므로 압축하지 않고 원본 키 그대로 둔다 (report.timeCollision)
+//   · R   : smallest-three 48-bit (가장 큰 성분 생략, 나머지 3개 15-bit)
+//   · T/S : 트랙별 [min, min+ext] 범위 16-bit 양자화
+//   · 상수 트랙은 키 없이 float 값 하나
+//   · 키 제거: 노드별 모델 공간 오차 예산 안에서 선형/구면 보간으로 복원되는 키 삭제
+// - 키 1개 = 8바이트 (원본 AnimKeyT/R/S 는 24바이트)
+// - 샘플링은 AnimGatherPacked → AnimPoseSoA (AnimGatherChannel과 같은 자리)
+// ============================================================================
+
+#pragma once
+
+// ---- includes ----
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "AnimSampler.h"
+#include "AnimSIMD.h"
+
+struct AnimationClipAsset;
+struct SkeletonAsset;
+
+// ---------------------------------------------------------------------------
+// 압축 키 / 트랙 / 클립
+// ---------------------------------------------------------------------------
+struct AnimPackedKey
+{
+    uint16_t t;       // 양자화 시간 (tick = t * timeScale)
+    uint16_t v[3];    // T/S: 범위 양자화 xyz, R: smallest-three
+};
+static_assert(sizeof(AnimPackedKey) == 8, "AnimPackedKey must be 8 bytes");
+
+struct AnimPackedTrack
+{
+    enum Kind : uint8_t { Empty = 0, Constant, Animated };
+
+    Kind  kind = Empty;
+    float c[4] = { 0.0f, 0.0f, 0.0f, 1.0f };   // Constant 값 (T/S: xyz, R: xyzw)
+    float mn[3] = {}, ext[3] = {};             // Animated T/S 역양자화 범위
+    std::vector<AnimPackedKey> keys;
+};
+
+struct AnimPackedChannel
+{
+    AnimPackedTrack T, R, S;
+};
+
+struct AnimPackedClip
+{
+    std::vector<AnimPackedChannel> channels;   // clip.channels와 1:1
+    double timeScale = 1.0;                    // tick / 양자화 시간 단위
+    double invTimeScale = 1.0;
+
+    bool Empty() const { return channels.empty(); }
+};
+
+// ---------------------------------------------------------------------------
+// 양자화 도우미
+// ---------------------------------------------------------------------------
+inline uint16_t AnimQuantize16(float x, float mn, float ext)
+{
+    if (ext <= 0.0f) return 0;
+    float u = (x - mn) / ext;
+    u = (u < 0.0f) ? 0.0f : (u > 1.0f ? 1.0f : u);
+    return (uint16_t)(u * 65535.0f + 0.5f);
+}
+
+inline float AnimDequantize16(uint16_t q, float mn, float ext)
+{
+    return mn + ext * (float(q) * (1.0f / 65535.0f));
+}
+
+// smallest-three: [15-bit a | idx hi], [15-bit b | idx lo], [15-bit c | 0]
+//  - 생략한 성분은 항상 양수가 되도록 부호 반전 (q == -q)
+inline void AnimPackQuat48(const float q[4], uint16_t out[3])
+{
+    static constexpr float kRange = 0.70710678f;    // 나머지 성분은 [-1/√2, 1/√2]
+
+    int big = 0;
+    for (int i = 1; i < 4; ++i)
+        if (std::fabs(q[i]) > std::fabs(q[big])) big = i;
+    const float sign = (q[big] < 0.0f) ? -1.0f : 1.0f;
+
+    int k = 0;
+    uint16_t v[3];
+    for (int i = 0; i < 4; ++i) {
+        if (i == big) continue;
+        float u = (q[i] * sign + kRange) / (2.0f * kRange);
+        u = (u < 0.0f) ? 0.0f : (u > 1.0f ? 1.0f : u);
+        v[k++] = (uint16_t)(u * 32767.0f + 0.5f);
+    }
+    out[0] = (uint16_t)((v[0] << 1) | ((big >> 1) & 1));
+    out[1] = (uint16_t)((v[1] << 1) | (big & 1));
+    out[2] = (uint16_t)(v[2] << 1);
+}
+
+inline void AnimUnpackQuat48(const uint16_t in[3], float q[4])
+{
+    static constexpr float kRange = 0.70710678f;
+
+    const int big = ((in[0] & 1) << 1) | (in[1] & 1);
+    float sum = 0.0f;
+    int k = 0;
+    for (int i = 0; i < 4; ++i) {
+        if (i == big) continue;
+        const float x = float(in[k++] >> 1) * (2.0f * kRange / 32767.0f) - kRange;
+        q[i] = x;
+        sum += x * x;
+    }
+    q[big] = std::sqrt((sum < 1.0f) ? 1.0f - sum : 0.0f);
+}
+
+// ---------------------------------------------------------------------------
+// AnimGatherPacked
+//  - AnimGatherChannel 의 압축 트랙 버전 (같은 lane 규칙/커서 사용)
+//  - tq: 양자화 시간 (tick * invTimeScale)
+// ---------------------------------------------------------------------------
+inline void AnimGatherPacked(
+    const AnimPackedChannel& ch, AnimKeyCursor& cur, double tq,
+    const float defT[3], AnimPoseSoA& soa, size_t lane)
+{
+    // 구간 [ub-1, ub] 를 a/b 키 + u 로
+    auto span = [tq](const std::vector<AnimPackedKey>& keys, int& cursor,
+        const AnimPackedKey*& a, const AnimPackedKey*& b, float& u) {
+        const int n = (int)keys.size();
+        const int ub = AnimUpperBound(tq, keys, cursor);
+        u = 0.0f;
+        if (ub <= 0) { a = b = &keys[0]; }
+        else if (ub >= n) { a = b = &keys[n - 1]; }
+        else {
+            a = &keys[ub - 1]; b = &keys[ub];
+            const double dt = double(b->t) - double(a->t);
+            u = (dt > 0.0) ? float((tq - a->t) / dt) : 0.0f;
+        }
+        };
+
+    // T/S 공통: 상수 / 범위 양자화 / 빈 트랙(def)
+    auto vec3 = [&](const AnimPackedTrack& tr, int& cursor, const float def[3],
+        std::vector<float>(&va)[3], std::vector<float>(&vb)[3], std::vector<float>& vu) {
+        if (tr.kind == AnimPackedTrack::Animated) {
+            const AnimPackedKey* a; const AnimPackedKey* b; float u;
+            span(tr.keys, cursor, a, b, u);
+            for (int k = 0; k < 3; ++k) {
+                va[k][lane] = AnimDequantize16(a->v[k], tr.mn[k], tr.ext[k]);
+                vb[k][lane] = AnimDequantize16(b->v[k], tr.mn[k], tr.ext[k]);
+            }
+            vu[lane] = u;
+            return;
+        }
+        const float* c = (tr.kind == AnimPackedTrack::Constant) ? tr.c : def;
+        for (int k = 0; k < 3; ++k) va[k][lane] = vb[k][lane] = c[k];
+        vu[lane] = 0.0f;
+        };
+
+    static const float kOne[3] = { 1.0f, 1.0f, 1.0f };
+    vec3(ch.T, cur.t, defT, soa.ta, soa.tb, soa.tu);
+    vec3(ch.S, cur.s, kOne, soa.sa, soa.sb, soa.su);
+
+    // R
+    if (ch.R.kind == AnimPackedTrack::Animated) {
+        const AnimPackedKey* a; const AnimPackedKey* b; float u;
+        span(ch.R.keys, cur.r, a, b, u);
+        float qa[4], qb[4];
+        AnimUnpackQuat48(a->v, qa);
+        AnimUnpackQuat48(b->v, qb);
+        for (int k = 0; k < 4; ++k) { soa.ra[k][lane] = qa[k]; soa.rb[k][lane] = qb[k]; }
+        soa.ru[lane] = u;
+    }
+    else {
+        for (int k = 0; k < 4; ++k) soa.ra[k][lane] = soa.rb[k][lane] = ch.R.c[k];
+        soa.ru[lane] = 0.0f;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// 압축 설정 / 리포트
+// ---------------------------------------------------------------------------
+struct AnimCompressSettings
+{
+    // 노드별 모델 공간 최대 오차 (모델 단위). 0 이하면 스켈레톤 크기의 0.1%
+    float maxError = 0.0f;
+    std::unordered_map<std::string, float> boneMaxError;   // 노드 이름별 예산 덮어쓰기
+
+    // 회전/스케일 오차를 재는 가상 정점 거리 하한. 0 이하면 스켈레톤 크기의 5%
+    float shellDistance = 0.0f;
+
+    bool reduceKeys = true;     // false면 양자화 + 상수 트랙만
+    bool keepRaw = false;       // false면 압축 후 원본 키 해제
+    int  maxRefine = 8;         // 예산 초과 노드 허용 오차 절반으로 줄여 재압축 반복 횟수
+};
+
+struct AnimCompressReport
+{
+    std::string clipName;
+    bool   compressed = false;
+    bool   timeCollision = false;   // 16-bit 시간으로 키가 겹쳐 압축을 건너뜀
+
+    size_t rawBytes = 0;
+    size_t packedBytes = 0;
+    size_t rawKeys = 0;
+    size_t packedKeys = 0;
+    size_t constantTracks = 0;
+    size_t animatedTracks = 0;
+
+    float  budget = 0.0f;       // 기본 예산 (모델 단위)
+    float  maxError = 0.0f;     // 검증 샘플 전체에서 최대 모델 공간 오차
+    std::string worstNode;
+    int    refinePasses = 0;
+
+    double Ratio() const { return packedBytes ? double(rawBytes) / double(packedBytes) : 0.0; }
+};
+
+// clip.packed 를 채운다 (bindings/skeleton 준비 후 호출). duration <= 0 이면 그대로 둠
+void AnimCompressClip(AnimationClipAsset& clip, const SkeletonAsset& skeleton,
+    const AnimCompressSettings& settings, AnimCompressReport* report = nullptr);
+
+// 콘솔(printf)로 압축률/최대 오차 출력
+void AnimPrintCompressReport(const AnimCompressReport& report);
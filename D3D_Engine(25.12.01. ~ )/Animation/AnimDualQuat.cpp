@@ -0,0 +1,100 @@
+﻿// ============================================================================
+// AnimDualQuat.cpp
+// - 듀얼 쿼터니언 팔레트 변환 / 블렌딩 (Shared.hlsli 의 SKIN_DQ 경로와 같은 식)
+// ============================================================================
+
+// ---- includes ----
+#include "AnimDualQuat.h"
+
+#include <cmath>
+
+const char* SkinModeName(SkinMode m)
+{
+    return (m == SkinMode::DualQuat) ? "Dual quaternion" : "Linear blend";
+}
+
+void AnimDualQuatFromT34(const float* rowsT, AnimDualQuat& out)
+{
+    // 열벡터 기준 R (rowsT[i*4 + j]) → 열 길이(스케일)로 나눠 순수 회전으로
+    float R[3][3];
+    for (int j = 0; j < 3; ++j) {
+        const float c0 = rowsT[0 * 4 + j], c1 = rowsT[1 * 4 + j], c2 = rowsT[2 * 4 + j];
+        const float len = std::sqrt(c0 * c0 + c1 * c1 + c2 * c2);
+        const float inv = (len > 0.0f) ? 1.0f / len : 0.0f;
+        R[0][j] = c0 * inv; R[1][j] = c1 * inv; R[2][j] = c2 * inv;
+    }
+
+    // 회전 행렬 → 쿼터니언 (대각 최대 성분 기준으로 나눠 수치 안정)
+    float x, y, z, w;
+    const float tr = R[0][0] + R[1][1] + R[2][2];
+    if (tr > 0.0f) {
+        const float s = std::sqrt(tr + 1.0f) * 2.0f;
+        w = 0.25f * s; x = (R[2][1] - R[1][2]) / s; y = (R[0][2] - R[2][0]) / s; z = (R[1][0] - R[0][1]) / s;
+    }
+    else if (R[0][0] > R[1][1] && R[0][0] > R[2][2]) {
+        const float s = std::sqrt(1.0f + R[0][0] - R[1][1] - R[2][2]) * 2.0f;
+        w = (R[2][1] - R[1][2]) / s; x = 0.25f * s; y = (R[0][1] + R[1][0]) / s; z = (R[0][2] + R[2][0]) / s;
+    }
+    else if (R[1][1] > R[2][2]) {
+        const float s = std::sqrt(1.0f + R[1][1] - R[0][0] - R[2][2]) * 2.0f;
+        w = (R[0][2] - R[2][0]) / s; x = (R[0][1] + R[1][0]) / s; y = 0.25f * s; z = (R[1][2] + R[2][1]) / s;
+    }
+    else {
+        const float s = std::sqrt(1.0f + R[2][2] - R[0][0] - R[1][1]) * 2.0f;
+        w = (R[1][0] - R[0][1]) / s; x = (R[0][2] + R[2][0]) / s; y = (R[1][2] + R[2][1]) / s; z = 0.25f * s;
+    }
+    const float ql = std::sqrt(x * x + y * y + z * z + w * w);
+    if (ql > 0.0f) { x /= ql; y /= ql; z /= ql; w /= ql; }
+
+    // dual = 0.5 * (t, 0) * q
+    const float tx = rowsT[3], ty = rowsT[7], tz = rowsT[11];
+    out.r[0] = x; out.r[1] = y; out.r[2] = z; out.r[3] = w;
+    out.d[0] = 0.5f * (w * tx + (ty * z - tz * y));
+    out.d[1] = 0.5f * (w * ty + (tz * x - tx * z));
+    out.d[2] = 0.5f * (w * tz + (tx * y - ty * x));
+    out.d[3] = -0.5f * (tx * x + ty * y + tz * z);
+}
+
+void AnimDualQuatToT34(const AnimDualQuat& q, float* rowsT)
+{
+    const float x = q.r[0], y = q.r[1], z = q.r[2], w = q.r[3];
+    const float dx = q.d[0], dy = q.d[1], dz = q.d[2], dw = q.d[3];
+
+    // t = 2 * (w*d.xyz - d.w*r.xyz + cross(r.xyz, d.xyz))
+    const float tx = 2.0f * (w * dx - dw * x + (y * dz - z * dy));
+    const float ty = 2.0f * (w * dy - dw * y + (z * dx - x * dz));
+    const float tz = 2.0f * (w * dz - dw * z + (x * dy - y * dx));
+
+    rowsT[0] = 1.0f - 2.0f * (y * y + z * z); rowsT[1] = 2.0f * (x * y - w * z);        rowsT[2] = 2.0f * (x * z + w * y);        rowsT[3] = tx;
+    rowsT[4] = 2.0f * (x * y + w * z);        rowsT[5] = 1.0f - 2.0f * (x * x + z * z); rowsT[6] = 2.0f * (y * z - w * x);        rowsT[7] = ty;
+    rowsT[8] = 2.0f * (x * z - w * y);        rowsT[9] = 2.0f * (y * z + w * x);        rowsT[10] = 1.0f - 2.0f * (x * x + y * y); rowsT[11] = tz;
+}
+
+void AnimDualQuatPalette(const float* paletteT44, size_t n, AnimDualQuat* out)
+{
+    for (size_t i = 0; i < n; ++i)
+        AnimDualQuatFromT34(paletteT44 + i * 16, out[i]);
+}
+
+AnimDualQuat AnimDualQuatBlend(const AnimDualQuat* palette, size_t boneCount,
+    const uint8_t bi[4], const float bw[4])
+{
+    AnimDualQuat b{};
+    const float* pivot = nullptr;   // 부호 기준 (첫 번째로 기여한 본)
+    for (int k = 0; k < 4; ++k) {
+        if (bw[k] == 0.0f || bi[k] >= boneCount) continue;
+        const AnimDualQuat& q = palette[bi[k]];
+        if (!pivot) pivot = q.r;
+
+        const float dot = pivot[0] * q.r[0] + pivot[1] * q.r[1] + pivot[2] * q.r[2] + pivot[3] * q.r[3];
+        const float w = (dot < 0.0f) ? -bw[k] : bw[k];
+        for (int c = 0; c < 4; ++c) { b.r[c] += w * q.r[c]; b.d[c] += w * q.d[c]; }
+    }
+
+    const float len = std::sqrt(b.r[0] * b.r[0] + b.r[1] * b.r[1] + b.r[2] * b.r[2] + b.r[3] * b.r[3]);
+    if (len <= 0.0f) return AnimDualQuat{ { 0.0f, 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, 0.0f, 0.0f } };
+
+    const float inv = 1.0f / len;
+    for (int c = 0; c < 4; ++c) { b.r[c] *= inv; b.d[c] *= inv; }
+    return b;
+}
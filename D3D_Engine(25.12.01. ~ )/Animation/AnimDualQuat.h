@@ -0,0 +1,47 @@
+﻿// ============================================================================
+// AnimDualQuat.h
+// - 듀얼 쿼터니언 스키닝 팔레트 (본당 8 float = 32B, 행렬 3행 48B 대비 2/3)
+//   · real = 회전 q, dual = 0.5 * (t, 0) * q
+//   · 블렌딩은 정점마다: 첫 본과 같은 반구로 부호 맞춤 → 가중 합 → |real| 로 정규화
+//   · 관절 비틀림에서 LBS 의 candy-wrapper(부피 손실)가 없다
+// - 스케일은 표현하지 못한다 (팔레트 회전부의 열 길이로 나눠 버림) → 스케일 없는 리그 전용
+// - D3D/SimpleMath 의존 없음 (float 배열만)
+// ============================================================================
+
+#pragma once
+
+// ---- includes ----
+#include <cstddef>
+#include <cstdint>
+
+// 인스턴스 스키닝 방식
+enum class SkinMode : uint8_t
+{
+    Linear,     // 행렬 가중 합 (LBS, 본당 3행)
+    DualQuat    // 듀얼 쿼터니언 (DQS, 본당 2행)
+};
+
+const char* SkinModeName(SkinMode m);
+
+// HLSL Buffer<float4> 2행 그대로 (r = (x,y,z,w), d = (x,y,z,w))
+struct AnimDualQuat
+{
+    float r[4];
+    float d[4];
+};
+static_assert(sizeof(AnimDualQuat) == 32, "AnimDualQuat must be 8 floats");
+
+// ---------------------------------------------------------------------------
+// 변환
+//  - FromT34  : 전치 팔레트의 앞 3행 (열벡터 기준 [R | t]) → 듀얼 쿼터니언
+//  - ToT34    : 정규화된 듀얼 쿼터니언 → 같은 형태의 3행 (셰이더/CPU 스키닝 공용 식)
+//  - Palette  : paletteT44[i] (전치 4x4, 16 float) 마다 FromT34
+// ---------------------------------------------------------------------------
+void AnimDualQuatFromT34(const float* rowsT, AnimDualQuat& out);
+void AnimDualQuatToT34(const AnimDualQuat& q, float* rowsT);
+void AnimDualQuatPalette(const float* paletteT44, size_t n, AnimDualQuat* out);
+
+// 정점 하나의 4본 블렌딩 (boneCount 이상 / 가중치 0 은 무시). 결과는 정규화됨
+//  - 기여한 본이 없으면 항등
+AnimDualQuat AnimDualQuatBlend(const AnimDualQuat* palette, size_t boneCount,
+    const uint8_t bi[4], const float bw[4]);
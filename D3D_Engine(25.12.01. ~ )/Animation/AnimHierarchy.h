@@ -0,0 +1,37 @@
+﻿// ============================================================================
+// AnimHierarchy.h
+// - 평탄화된 노드 계층 (parent 인덱스 배열) 유틸
+// - 노드는 "부모가 항상 자식보다 앞" (topological order) 이라고 가정
+//   → 글로벌 포즈 계산이 재귀 없이 선형 루프 한 번
+// ============================================================================
+
+#pragma once
+
+// ---- includes ----
+#include <vector>
+#include <cstddef>
+
+// parents[i] < i (루트는 -1) 인지 검사. 로드 직후 1회 호출용
+inline bool AnimIsTopoOrdered(const std::vector<int>& parents)
+{
+    for (int i = 0; i < (int)parents.size(); ++i) {
+        const int p = parents[i];
+        if (p >= i || p < -1) return false;
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// AnimLocalToGlobal
+//  - global[i] = local[i] * global[parent[i]]   (row-major, SimpleMath 곱 순서)
+//  - 루트(parent == -1)는 global = local
+//  - Mat은 operator* 를 가진 행렬 타입이면 무엇이든 (SimpleMath::Matrix 등)
+// ---------------------------------------------------------------------------
+template <class Mat>
+inline void AnimLocalToGlobal(const int* parents, const Mat* local, Mat* global, size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        const int p = parents[i];
+        global[i] = (p < 0) ? local[i] : local[i] * global[p];
+    }
+}
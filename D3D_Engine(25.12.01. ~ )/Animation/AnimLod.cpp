@@ -0,0 +1,68 @@
+﻿// ============================================================================
+// AnimLod.cpp
+// - LOD 레벨 선택 + 카메라 기준 입력 계산
+// ============================================================================
+
+// ---- includes ----
+#include "AnimLod.h"
+
+#include <cmath>
+#include <algorithm>
+
+const char* AnimLodLevelName(AnimLodLevel level)
+{
+    switch (level) {
+    case AnimLodLevel::Full:      return "Full";
+    case AnimLodLevel::Reduced:   return "Reduced";
+    case AnimLodLevel::Far:       return "Far";
+    case AnimLodLevel::Offscreen: return "Offscreen";
+    default:                      return "?";
+    }
+}
+
+AnimLodLevel AnimSelectLod(const AnimLodSettings& s, const AnimLodInput& in)
+{
+    if (!s.enabled) return AnimLodLevel::Full;
+    if (!in.visible) return AnimLodLevel::Offscreen;
+    if (in.distance >= s.farDistance) return AnimLodLevel::Far;
+    if (in.distance >= s.reducedDistance) return AnimLodLevel::Reduced;
+    return AnimLodLevel::Full;
+}
+
+int AnimLodInterval(const AnimLodSettings& s, AnimLodLevel level)
+{
+    switch (level) {
+    case AnimLodLevel::Reduced:   return std::max(1, s.reducedInterval);
+    case AnimLodLevel::Far:       return std::max(1, s.farInterval);
+    case AnimLodLevel::Offscreen: return std::max(0, s.offscreenInterval);
+    default:                      return 1;
+    }
+}
+
+AnimLodInput AnimLodFromView(const float c[3], float radius,
+    const float V[16], const float P[16], float viewportH)
+{
+    // 뷰 공간 중심 (행 벡터 * view)
+    const float vx = c[0] * V[0] + c[1] * V[4] + c[2] * V[8] + V[12];
+    const float vy = c[0] * V[1] + c[1] * V[5] + c[2] * V[9] + V[13];
+    const float vz = c[0] * V[2] + c[1] * V[6] + c[2] * V[10] + V[14];
+
+    AnimLodInput in;
+    in.distance = std::sqrt(vx * vx + vy * vy + vz * vz);
+
+    // 대칭 원근 절두체: |x * P11| <= z, |y * P22| <= z, z >= near
+    const float p11 = P[0], p22 = P[5];
+    const float zn = (P[10] != 0.0f) ? -P[14] / P[10] : 0.0f;
+    const float nx = 1.0f / std::sqrt(p11 * p11 + 1.0f);
+    const float ny = 1.0f / std::sqrt(p22 * p22 + 1.0f);
+
+    in.visible = (vz + radius >= zn)
+        && (( p11 * vx - vz) * nx <= radius)
+        && ((-p11 * vx - vz) * nx <= radius)
+        && (( p22 * vy - vz) * ny <= radius)
+        && ((-p22 * vy - vz) * ny <= radius);
+
+    // 화면상 지름: 2r / z * (P22 * H / 2)
+    in.screenPixels = (vz > radius) ? radius * p22 * viewportH / vz : 1.0e9f;
+    return in;
+}
@@ -0,0 +1,75 @@
+﻿// ============================================================================
+// AnimLod.h
+// - 애니메이션 LOD: 거리/가시성에 따라 포즈 갱신 주기를 낮춘다
+//   · Full     : 매 프레임 평가
+//   · Reduced  : N프레임마다 평가, 사이는 글로벌 포즈 보간
+//   · Far      : 더 긴 주기 (+ 화면에서 작으면 말단 본 샘플링 생략)
+//   · Offscreen: 화면 밖 → 긴 주기 또는 정지(interval 0)
+// - 레벨 선택/주기 계산만 여기서. 실제 평가/보간은 AnimationSystem 이 결정
+// ============================================================================
+
+#pragma once
+
+// ---- includes ----
+#include <cstdint>
+#include <cstddef>
+
+enum class AnimLodLevel : uint8_t
+{
+    Full = 0,
+    Reduced,
+    Far,
+    Offscreen,
+    Count
+};
+
+const char* AnimLodLevelName(AnimLodLevel level);
+
+// ---------------------------------------------------------------------------
+// AnimLodSettings
+//  - interval: 평가 주기(프레임). 1 = 매 프레임, 0 = 정지 (Offscreen 전용)
+//  - interpolate: 주기 사이 프레임을 글로벌 포즈 보간으로 채움 (false면 포즈 유지)
+//  - leafSkipPixels: 화면상 지름이 이보다 작으면 말단 본 샘플링 생략 (0 = 끔)
+// ---------------------------------------------------------------------------
+struct AnimLodSettings
+{
+    bool  enabled = true;
+    float reducedDistance = 800.0f;     // 월드 단위 (씬 스케일 기준)
+    float farDistance = 2000.0f;
+    int   reducedInterval = 2;
+    int   farInterval = 4;
+    int   offscreenInterval = 0;
+    bool  interpolate = true;
+    float leafSkipPixels = 48.0f;
+};
+
+// 인스턴스 하나의 이번 프레임 입력 (호출부가 카메라 기준으로 계산)
+struct AnimLodInput
+{
+    float distance = 0.0f;          // 카메라 ~ 캐릭터 (월드 단위)
+    bool  visible = true;           // 바운딩 구가 절두체와 겹치는지
+    float screenPixels = 1.0e9f;    // 바운딩 구의 화면상 지름 (px)
+};
+
+// 인스턴스가 프레임 사이에 들고 있는 LOD 상태 (AnimationSystem 만 갱신)
+struct AnimLodState
+{
+    AnimLodLevel level = AnimLodLevel::Full;
+    int    interval = 1;
+    int    phase = 0;           // 마지막 평가 이후 지난 프레임 (0 = 이번에 평가)
+    double lastT = 0.0;         // 직전 프레임 재생 시간
+    double step = 0.0;          // 프레임당 재생 진행량 (루프 되감김 프레임은 직전 값 유지)
+    bool   hasLast = false;
+};
+
+AnimLodLevel AnimSelectLod(const AnimLodSettings& s, const AnimLodInput& in);
+int AnimLodInterval(const AnimLodSettings& s, AnimLodLevel level);
+
+// ---------------------------------------------------------------------------
+// AnimLodFromView
+//  - center/radius: 월드 공간 바운딩 구
+//  - view/proj: row-major 4x4 (SimpleMath 배치, 원근 투영, LH)
+//  - viewportH: 화면 높이(px)
+// ---------------------------------------------------------------------------
+AnimLodInput AnimLodFromView(const float center[3], float radius,
+    const float view[16], const float proj[16], float viewportH);
@@ -0,0 +1,387 @@
+﻿// ============================================================================
+// AnimSIMD.cpp
+// - AnimPoseSoA / SoA 배치 커널 구현 (SSE + 스칼라)
+// - D3D 의존 없음 → 리눅스에서도 단독 컴파일/비교 가능
+// ============================================================================
+
+// ---- includes ----
+#include "AnimSIMD.h"
+
+#include <cmath>
+#include <algorithm>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define ANIM_SIMD_SSE 1
+#include <xmmintrin.h>
+#include <emmintrin.h>
+#else
+#define ANIM_SIMD_SSE 0
+#endif
+
+// XMQuaternionSlerp 와 같은 임계값: cos(omega)가 이보다 크면 선형 보간
+static constexpr float kSlerpLinearCos = 1.0f - 0.00001f;
+
+// ============================================================================
+// AnimPoseSoA
+// ============================================================================
+void AnimPoseSoA::Resize(size_t n)
+{
+    count = n;
+    const size_t padded = (n + 3) & ~size_t(3);
+
+    // 패딩 lane은 항등 TRS (T=0, R=(0,0,0,1), S=1, u=0)
+    for (int k = 0; k < 3; ++k) {
+        ta[k].assign(padded, 0.0f); tb[k].assign(padded, 0.0f); t[k].assign(padded, 0.0f);
+        sa[k].assign(padded, 1.0f); sb[k].assign(padded, 1.0f); s[k].assign(padded, 1.0f);
+    }
+    for (int k = 0; k < 4; ++k) {
+        const float v = (k == 3) ? 1.0f : 0.0f;
+        ra[k].assign(padded, v); rb[k].assign(padded, v); r[k].assign(padded, v);
+    }
+    tu.assign(padded, 0.0f);
+    ru.assign(padded, 0.0f);
+    su.assign(padded, 0.0f);
+    dst.assign(padded, -1);
+}
+
+// ============================================================================
+// 스칼라 버전
+// ============================================================================
+namespace AnimScalar
+{
+    void Lerp3(const std::vector<float>(&a)[3], const std::vector<float>(&b)[3],
+        const std::vector<float>& u, std::vector<float>(&out)[3], size_t n)
+    {
+        for (int k = 0; k < 3; ++k)
+            for (size_t i = 0; i < n; ++i)
+                out[k][i] = a[k][i] + (b[k][i] - a[k][i]) * u[i];
+    }
+
+    void Slerp4(const std::vector<float>(&a)[4], const std::vector<float>(&b)[4],
+        const std::vector<float>& u, std::vector<float>(&out)[4], size_t n)
+    {
+        for (size_t i = 0; i < n; ++i) {
+            float cosO = a[0][i] * b[0][i] + a[1][i] * b[1][i] + a[2][i] * b[2][i] + a[3][i] * b[3][i];
+            const float sign = (cosO < 0.0f) ? -1.0f : 1.0f;
+            cosO *= sign;
+
+            float s0 = 1.0f - u[i], s1 = u[i];
+            if (cosO < kSlerpLinearCos) {
+                const float sinO = std::sqrt(1.0f - cosO * cosO);
+                const float omega = std::atan2(sinO, cosO);
+                const float inv = 1.0f / sinO;
+                s0 = std::sin(s0 * omega) * inv;
+                s1 = std::sin(s1 * omega) * inv;
+            }
+            s1 *= sign;
+
+            for (int k = 0; k < 4; ++k)
+                out[k][i] = a[k][i] * s0 + b[k][i] * s1;
+        }
+    }
+
+    // lane i의 S*R*T 를 3x3(회전*스케일) + 이동으로 푼다
+    static void AffineOf(const AnimPoseSoA& soa, size_t i, float m[3][3], float tr[3])
+    {
+        const float x = soa.r[0][i], y = soa.r[1][i], z = soa.r[2][i], w = soa.r[3][i];
+        const float xx = x * x, yy = y * y, zz = z * z;
+        const float xy = x * y, xz = x * z, yz = y * z;
+        const float xw = x * w, yw = y * w, zw = z * w;
+
+        m[0][0] = 1.0f - 2.0f * (yy + zz); m[0][1] = 2.0f * (xy + zw); m[0][2] = 2.0f * (xz - yw);
+        m[1][0] = 2.0f * (xy - zw); m[1][1] = 1.0f - 2.0f * (xx + zz); m[1][2] = 2.0f * (yz + xw);
+        m[2][0] = 2.0f * (xz + yw); m[2][1] = 2.0f * (yz - xw); m[2][2] = 1.0f - 2.0f * (xx + yy);
+
+        for (int r = 0; r < 3; ++r)
+            for (int c = 0; c < 3; ++c)
+                m[r][c] *= soa.s[r][i];
+
+        tr[0] = soa.t[0][i]; tr[1] = soa.t[1][i]; tr[2] = soa.t[2][i];
+    }
+
+    void ComposeTRS44(const AnimPoseSoA& soa, const int* dst, float* dst44)
+    {
+        for (size_t i = 0; i < soa.count; ++i) {
+            float m[3][3], tr[3];
+            AffineOf(soa, i, m, tr);
+
+            float* o = dst44 + 16 * size_t(dst ? dst[i] : (int)i);
+            for (int r = 0; r < 3; ++r) {
+                o[r * 4 + 0] = m[r][0]; o[r * 4 + 1] = m[r][1]; o[r * 4 + 2] = m[r][2]; o[r * 4 + 3] = 0.0f;
+            }
+            o[12] = tr[0]; o[13] = tr[1]; o[14] = tr[2]; o[15] = 1.0f;
+        }
+    }
+
+    void ComposeTRS34(const AnimPoseSoA& soa, const int* dst, float* dst34)
+    {
+        for (size_t i = 0; i < soa.count; ++i) {
+            float m[3][3], tr[3];
+            AffineOf(soa, i, m, tr);
+
+            float* o = dst34 + 12 * size_t(dst ? dst[i] : (int)i);
+            for (int c = 0; c < 3; ++c) {
+                o[c * 4 + 0] = m[0][c]; o[c * 4 + 1] = m[1][c]; o[c * 4 + 2] = m[2][c]; o[c * 4 + 3] = tr[c];
+            }
+        }
+    }
+
+    void PaletteT44(const float* offset44, const float* global44,
+        const int* boneNode, size_t n, float* out44)
+    {
+        for (size_t i = 0; i < n; ++i) {
+            const float* A = offset44 + 16 * i;
+            const float* B = global44 + 16 * size_t(boneNode[i]);
+            float* o = out44 + 16 * i;
+            for (int r = 0; r < 4; ++r)
+                for (int c = 0; c < 4; ++c)
+                    o[c * 4 + r] = A[r * 4 + 0] * B[0 * 4 + c] + A[r * 4 + 1] * B[1 * 4 + c]
+                    + A[r * 4 + 2] * B[2 * 4 + c] + A[r * 4 + 3] * B[3 * 4 + c];
+        }
+    }
+
+    void SampleTRS(AnimPoseSoA& soa)
+    {
+        const size_t n = soa.Padded();
+        Lerp3(soa.ta, soa.tb, soa.tu, soa.t, n);
+        Slerp4(soa.ra, soa.rb, soa.ru, soa.r, n);
+        Lerp3(soa.sa, soa.sb, soa.su, soa.s, n);
+    }
+}
+
+// ============================================================================
+// SSE 버전
+// ============================================================================
+#if ANIM_SIMD_SSE
+namespace
+{
+    // [0, pi/2] 범위 sin (XMScalarSin 과 같은 11차 다항식)
+    inline __m128 SinHalfPi(__m128 y)
+    {
+        const __m128 y2 = _mm_mul_ps(y, y);
+        __m128 p = _mm_set1_ps(-2.3889859e-08f);
+        p = _mm_add_ps(_mm_mul_ps(p, y2), _mm_set1_ps(2.7525562e-06f));
+        p = _mm_add_ps(_mm_mul_ps(p, y2), _mm_set1_ps(-0.00019840874f));
+        p = _mm_add_ps(_mm_mul_ps(p, y2), _mm_set1_ps(0.0083333310f));
+        p = _mm_add_ps(_mm_mul_ps(p, y2), _mm_set1_ps(-0.16666667f));
+        p = _mm_add_ps(_mm_mul_ps(p, y2), _mm_set1_ps(1.0f));
+        return _mm_mul_ps(p, y);
+    }
+
+    // [0, 1] 범위 acos (XMScalarACos 와 같은 7차 다항식 * sqrt(1-x))
+    inline __m128 ACosUnit(__m128 x)
+    {
+        const __m128 root = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(_mm_set1_ps(1.0f), x), _mm_setzero_ps()));
+        __m128 p = _mm_set1_ps(-0.0012624911f);
+        p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(0.0066700901f));
+        p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(-0.0170881256f));
+        p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(0.0308918810f));
+        p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(-0.0501743046f));
+        p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(0.0889789874f));
+        p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(-0.2145988016f));
+        p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(1.5707963050f));
+        return _mm_mul_ps(p, root);
+    }
+
+    inline __m128 Select(__m128 f, __m128 t, __m128 mask)
+    {
+        return _mm_or_ps(_mm_and_ps(mask, t), _mm_andnot_ps(mask, f));
+    }
+
+    // 4 lane 회전*스케일 3x3 (m[row][col]) + 이동
+    struct Affine4
+    {
+        __m128 m[3][3];
+        __m128 t[3];
+    };
+
+    inline Affine4 LoadAffine4(const AnimPoseSoA& soa, size_t i)
+    {
+        const __m128 x = _mm_loadu_ps(&soa.r[0][i]);
+        const __m128 y = _mm_loadu_ps(&soa.r[1][i]);
+        const __m128 z = _mm_loadu_ps(&soa.r[2][i]);
+        const __m128 w = _mm_loadu_ps(&soa.r[3][i]);
+        const __m128 one = _mm_set1_ps(1.0f), two = _mm_set1_ps(2.0f);
+
+        const __m128 xx = _mm_mul_ps(x, x), yy = _mm_mul_ps(y, y), zz = _mm_mul_ps(z, z);
+        const __m128 xy = _mm_mul_ps(x, y), xz = _mm_mul_ps(x, z), yz = _mm_mul_ps(y, z);
+        const __m128 xw = _mm_mul_ps(x, w), yw = _mm_mul_ps(y, w), zw = _mm_mul_ps(z, w);
+
+        Affine4 a;
+        a.m[0][0] = _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz)));
+        a.m[0][1] = _mm_mul_ps(two, _mm_add_ps(xy, zw));
+        a.m[0][2] = _mm_mul_ps(two, _mm_sub_ps(xz, yw));
+        a.m[1][0] = _mm_mul_ps(two, _mm_sub_ps(xy, zw));
+        a.m[1][1] = _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz)));
+        a.m[1][2] = _mm_mul_ps(two, _mm_add_ps(yz, xw));
+        a.m[2][0] = _mm_mul_ps(two, _mm_add_ps(xz, yw));
+        a.m[2][1] = _mm_mul_ps(two, _mm_sub_ps(yz, xw));
+        a.m[2][2] = _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy)));
+
+        for (int r = 0; r < 3; ++r) {
+            const __m128 s = _mm_loadu_ps(&soa.s[r][i]);
+            for (int c = 0; c < 3; ++c) a.m[r][c] = _mm_mul_ps(a.m[r][c], s);
+            a.t[r] = _mm_loadu_ps(&soa.t[r][i]);
+        }
+        return a;
+    }
+
+    // lane 수(≤4)만큼 4개의 float4 행을 각 lane 목적지에 저장
+    inline void StoreLanes(__m128 v0, __m128 v1, __m128 v2, __m128 v3,
+        size_t lanes, float* const out[4], int rowOffset)
+    {
+        const __m128 v[4] = { v0, v1, v2, v3 };
+        for (size_t k = 0; k < lanes; ++k) _mm_storeu_ps(out[k] + rowOffset, v[k]);
+    }
+}
+
+namespace AnimSimd
+{
+    void Lerp3(const std::vector<float>(&a)[3], const std::vector<float>(&b)[3],
+        const std::vector<float>& u, std::vector<float>(&out)[3], size_t n)
+    {
+        for (size_t i = 0; i < n; i += 4) {
+            const __m128 vu = _mm_loadu_ps(&u[i]);
+            for (int k = 0; k < 3; ++k) {
+                const __m128 va = _mm_loadu_ps(&a[k][i]);
+                const __m128 vb = _mm_loadu_ps(&b[k][i]);
+                _mm_storeu_ps(&out[k][i], _mm_add_ps(va, _mm_mul_ps(_mm_sub_ps(vb, va), vu)));
+            }
+        }
+    }
+
+    void Slerp4(const std::vector<float>(&a)[4], const std::vector<float>(&b)[4],
+        const std::vector<float>& u, std::vector<float>(&out)[4], size_t n)
+    {
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 signBit = _mm_set1_ps(-0.0f);
+        const __m128 linCos = _mm_set1_ps(kSlerpLinearCos);
+
+        for (size_t i = 0; i < n; i += 4) {
+            __m128 qa[4], qb[4];
+            for (int k = 0; k < 4; ++k) { qa[k] = _mm_loadu_ps(&a[k][i]); qb[k] = _mm_loadu_ps(&b[k][i]); }
+
+            __m128 cosO = _mm_mul_ps(qa[0], qb[0]);
+            for (int k = 1; k < 4; ++k) cosO = _mm_add_ps(cosO, _mm_mul_ps(qa[k], qb[k]));
+
+            // cos<0 이면 짧은 경로로 (b 부호 반전)
+            const __m128 neg = _mm_and_ps(cosO, signBit);
+            cosO = _mm_xor_ps(cosO, neg);
+
+            const __m128 vu = _mm_loadu_ps(&u[i]);
+            const __m128 lin0 = _mm_sub_ps(one, vu);
+
+            const __m128 omega = ACosUnit(cosO);
+            // sqrt(1-cos^2) 대신 같은 omega 로 sin 을 구해야 acos 근사 오차가 분자/분모에서 상쇄됨
+            // (작은 각에서 omega 상대 오차가 그대로 s0/s1 에 실려 1e-5 대 오차가 나던 부분)
+            const __m128 sinO = SinHalfPi(omega);
+            const __m128 useSlerp = _mm_cmplt_ps(cosO, linCos);
+            // sinO==0 인 lane은 어차피 선형 쪽이 선택됨 (0 나눗셈 결과는 버려짐)
+            const __m128 inv = _mm_div_ps(one, Select(one, sinO, useSlerp));
+
+            __m128 s0 = _mm_mul_ps(SinHalfPi(_mm_mul_ps(lin0, omega)), inv);
+            __m128 s1 = _mm_mul_ps(SinHalfPi(_mm_mul_ps(vu, omega)), inv);
+            s0 = Select(lin0, s0, useSlerp);
+            s1 = Select(vu, s1, useSlerp);
+            s1 = _mm_xor_ps(s1, neg);
+
+            for (int k = 0; k < 4; ++k)
+                _mm_storeu_ps(&out[k][i], _mm_add_ps(_mm_mul_ps(qa[k], s0), _mm_mul_ps(qb[k], s1)));
+        }
+    }
+
+    void ComposeTRS44(const AnimPoseSoA& soa, const int* dst, float* dst44)
+    {
+        const __m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f);
+
+        for (size_t i = 0; i < soa.count; i += 4) {
+            const size_t lanes = std::min<size_t>(4, soa.count - i);
+            float* out[4] = {};
+            for (size_t k = 0; k < lanes; ++k)
+                out[k] = dst44 + 16 * size_t(dst ? dst[i + k] : int(i + k));
+
+            const Affine4 a = LoadAffine4(soa, i);
+
+            // 행 r: (m[r][0], m[r][1], m[r][2], 0) 를 lane별로 전치해서 저장
+            for (int r = 0; r < 3; ++r) {
+                __m128 v0 = a.m[r][0], v1 = a.m[r][1], v2 = a.m[r][2], v3 = zero;
+                _MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+                StoreLanes(v0, v1, v2, v3, lanes, out, r * 4);
+            }
+            __m128 v0 = a.t[0], v1 = a.t[1], v2 = a.t[2], v3 = one;
+            _MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+            StoreLanes(v0, v1, v2, v3, lanes, out, 12);
+        }
+    }
+
+    void ComposeTRS34(const AnimPoseSoA& soa, const int* dst, float* dst34)
+    {
+        for (size_t i = 0; i < soa.count; i += 4) {
+            const size_t lanes = std::min<size_t>(4, soa.count - i);
+            float* out[4] = {};
+            for (size_t k = 0; k < lanes; ++k)
+                out[k] = dst34 + 12 * size_t(dst ? dst[i + k] : int(i + k));
+
+            const Affine4 a = LoadAffine4(soa, i);
+
+            // 전치 행 c: (m[0][c], m[1][c], m[2][c], t[c])
+            for (int c = 0; c < 3; ++c) {
+                __m128 v0 = a.m[0][c], v1 = a.m[1][c], v2 = a.m[2][c], v3 = a.t[c];
+                _MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+                StoreLanes(v0, v1, v2, v3, lanes, out, c * 4);
+            }
+        }
+    }
+
+    void PaletteT44(const float* offset44, const float* global44,
+        const int* boneNode, size_t n, float* out44)
+    {
+        for (size_t i = 0; i < n; ++i) {
+            const float* A = offset44 + 16 * i;
+            const float* B = global44 + 16 * size_t(boneNode[i]);
+
+            const __m128 b0 = _mm_loadu_ps(B + 0), b1 = _mm_loadu_ps(B + 4);
+            const __m128 b2 = _mm_loadu_ps(B + 8), b3 = _mm_loadu_ps(B + 12);
+
+            __m128 row[4];
+            for (int r = 0; r < 4; ++r) {
+                const __m128 ar = _mm_loadu_ps(A + r * 4);
+                __m128 v = _mm_mul_ps(_mm_shuffle_ps(ar, ar, _MM_SHUFFLE(0, 0, 0, 0)), b0);
+                v = _mm_add_ps(v, _mm_mul_ps(_mm_shuffle_ps(ar, ar, _MM_SHUFFLE(1, 1, 1, 1)), b1));
+                v = _mm_add_ps(v, _mm_mul_ps(_mm_shuffle_ps(ar, ar, _MM_SHUFFLE(2, 2, 2, 2)), b2));
+                v = _mm_add_ps(v, _mm_mul_ps(_mm_shuffle_ps(ar, ar, _MM_SHUFFLE(3, 3, 3, 3)), b3));
+                row[r] = v;
+            }
+            _MM_TRANSPOSE4_PS(row[0], row[1], row[2], row[3]);
+
+            float* o = out44 + 16 * i;
+            _mm_storeu_ps(o + 0, row[0]);
+            _mm_storeu_ps(o + 4, row[1]);
+            _mm_storeu_ps(o + 8, row[2]);
+            _mm_storeu_ps(o + 12, row[3]);
+        }
+    }
+
+    void SampleTRS(AnimPoseSoA& soa)
+    {
+        const size_t n = soa.Padded();
+        Lerp3(soa.ta, soa.tb, soa.tu, soa.t, n);
+        Slerp4(soa.ra, soa.rb, soa.ru, soa.r, n);
+        Lerp3(soa.sa, soa.sb, soa.su, soa.s, n);
+    }
+}
+#else
+// SSE 없는 타깃: 스칼라 버전으로 위임
+namespace AnimSimd
+{
+    void Lerp3(const std::vector<float>(&a)[3], const std::vector<float>(&b)[3],
+        const std::vector<float>& u, std::vector<float>(&out)[3], size_t n) { AnimScalar::Lerp3(a, b, u, out, n); }
+    void Slerp4(const std::vector<float>(&a)[4], const std::vector<float>(&b)[4],
+        const std::vector<float>& u, std::vector<float>(&out)[4], size_t n) { AnimScalar::Slerp4(a, b, u, out, n); }
+    void ComposeTRS44(const AnimPoseSoA& soa, const int* dst, float* dst44) { AnimScalar::ComposeTRS44(soa, dst, dst44); }
+    void ComposeTRS34(const AnimPoseSoA& soa, const int* dst, float* dst34) { AnimScalar::ComposeTRS34(soa, dst, dst34); }
+    void PaletteT44(const float* offset44, const float* global44,
+        const int* boneNode, size_t n, float* out44) { AnimScalar::PaletteT44(offset44, global44, boneNode, n, out44); }
+    void SampleTRS(AnimPoseSoA& soa) { AnimScalar::SampleTRS(soa); }
+}
+#endif
@@ -0,0 +1,151 @@
+﻿// ============================================================================
+// AnimSIMD.h
+// - 포즈 평가용 SoA 배치 커널 (SSE, 4채널 동시)
+//   1) T/S lerp, R slerp  (SampleLocalOf의 보간을 여러 채널 한꺼번에)
+//   2) TRS → 아핀 행렬 직접 조립 (S*R*T 행렬곱 3번 없이)
+//   3) offset * global → 전치 팔레트 (UpdateBonePalette 1패스)
+// - D3D/SimpleMath 의존 없음 (float 배열만). 행렬은 SimpleMath와 같은 row-major 16 float
+// - AnimScalar:: 는 같은 계산의 스칼라 버전 (SSE 없는 빌드 + 결과 비교용)
+// ============================================================================
+
+#pragma once
+
+// ---- includes ----
+#include <vector>
+#include <cstddef>
+
+#include "AnimSampler.h"
+
+// ---------------------------------------------------------------------------
+// AnimPoseSoA
+//  - 바인딩 순서(lane)대로 "구간 양끝 키 + 보간 계수"를 모아두는 스크래치
+//  - 길이는 4의 배수로 패딩 (패딩 lane은 항등 TRS라 계산해도 안전)
+//  - dst: 결과 행렬을 쓸 노드 인덱스
+// ---------------------------------------------------------------------------
+struct AnimPoseSoA
+{
+    // 입력: 구간 시작(a)/끝(b) 키 + 보간 계수
+    std::vector<float> ta[3], tb[3], tu;
+    std::vector<float> ra[4], rb[4], ru;
+    std::vector<float> sa[3], sb[3], su;
+
+    // 출력: 보간된 TRS
+    std::vector<float> t[3], r[4], s[3];
+
+    std::vector<int> dst;
+    size_t count = 0;    // 실제 lane 수 (패딩 제외)
+
+    void Resize(size_t n);
+    size_t Padded() const { return tu.size(); }
+};
+
+// ---------------------------------------------------------------------------
+// AnimGatherChannel
+//  - 채널 하나의 T/R/S 구간을 찾아 lane에 기록 (커서 갱신 포함)
+//  - 빈 트랙: T는 defT, R은 항등, S는 1
+//  - 경계(ub<=0, ub>=n)는 a=b, u=0 으로 넣는다 → 보간 결과가 키 값 그대로
+// ---------------------------------------------------------------------------
+template <class Channel>
+inline void AnimGatherChannel(
+    const Channel& ch, AnimKeyCursor& cur, double tTick,
+    const float defT[3], AnimPoseSoA& soa, size_t lane)
+{
+    // 구간 [ub-1, ub] 를 a/b 인덱스 + u 로
+    auto span = [tTick](const auto& keys, int& cursor, int& ia, int& ib, float& u) {
+        const int n = (int)keys.size();
+        const int ub = AnimUpperBound(tTick, keys, cursor);
+        u = 0.0f;
+        if (ub <= 0) { ia = ib = 0; }
+        else if (ub >= n) { ia = ib = n - 1; }
+        else {
+            ia = ub - 1; ib = ub;
+            const double dt = keys[ib].t - keys[ia].t;
+            u = (dt > 0.0) ? float((tTick - keys[ia].t) / dt) : 0.0f;
+        }
+        };
+
+    int ia, ib; float u;
+
+    // T
+    if (!ch.T.empty()) {
+        span(ch.T, cur.t, ia, ib, u);
+        const auto& a = ch.T[ia].v; const auto& b = ch.T[ib].v;
+        soa.ta[0][lane] = a.x; soa.ta[1][lane] = a.y; soa.ta[2][lane] = a.z;
+        soa.tb[0][lane] = b.x; soa.tb[1][lane] = b.y; soa.tb[2][lane] = b.z;
+        soa.tu[lane] = u;
+    }
+    else {
+        for (int k = 0; k < 3; ++k) soa.ta[k][lane] = soa.tb[k][lane] = defT[k];
+        soa.tu[lane] = 0.0f;
+    }
+
+    // R
+    if (!ch.R.empty()) {
+        span(ch.R, cur.r, ia, ib, u);
+        const auto& a = ch.R[ia].q; const auto& b = ch.R[ib].q;
+        soa.ra[0][lane] = a.x; soa.ra[1][lane] = a.y; soa.ra[2][lane] = a.z; soa.ra[3][lane] = a.w;
+        soa.rb[0][lane] = b.x; soa.rb[1][lane] = b.y; soa.rb[2][lane] = b.z; soa.rb[3][lane] = b.w;
+        soa.ru[lane] = u;
+    }
+    else {
+        for (int k = 0; k < 4; ++k) soa.ra[k][lane] = soa.rb[k][lane] = (k == 3) ? 1.0f : 0.0f;
+        soa.ru[lane] = 0.0f;
+    }
+
+    // S
+    if (!ch.S.empty()) {
+        span(ch.S, cur.s, ia, ib, u);
+        const auto& a = ch.S[ia].v; const auto& b = ch.S[ib].v;
+        soa.sa[0][lane] = a.x; soa.sa[1][lane] = a.y; soa.sa[2][lane] = a.z;
+        soa.sb[0][lane] = b.x; soa.sb[1][lane] = b.y; soa.sb[2][lane] = b.z;
+        soa.su[lane] = u;
+    }
+    else {
+        for (int k = 0; k < 3; ++k) soa.sa[k][lane] = soa.sb[k][lane] = 1.0f;
+        soa.su[lane] = 0.0f;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// 커널 (n은 lane 수. SoA 입력은 4의 배수로 패딩되어 있어야 함)
+//  - Lerp3        : out = a + (b - a) * u
+//  - Slerp4       : XMQuaternionSlerp 와 같은 식 (cos<0 뒤집기, 1-eps 이상이면 선형)
+//  - ComposeTRS44 : dst44[dst[i]] = S * R * T   (row-major 4x4, 16 float)
+//  - ComposeTRS34 : dst34[dst[i]] = 위 행렬의 전치 3행 (float4 x 3, HLSL 3x4용)
+//  - PaletteT44   : out44[i] = transpose(offset44[i] * global44[boneNode[i]])
+//  - dst == nullptr 이면 lane i → i 에 쓴다
+// ---------------------------------------------------------------------------
+namespace AnimSimd
+{
+    void Lerp3(const std::vector<float>(&a)[3], const std::vector<float>(&b)[3],
+        const std::vector<float>& u, std::vector<float>(&out)[3], size_t n);
+
+    void Slerp4(const std::vector<float>(&a)[4], const std::vector<float>(&b)[4],
+        const std::vector<float>& u, std::vector<float>(&out)[4], size_t n);
+
+    void ComposeTRS44(const AnimPoseSoA& soa, const int* dst, float* dst44);
+    void ComposeTRS34(const AnimPoseSoA& soa, const int* dst, float* dst34);
+
+    void PaletteT44(const float* offset44, const float* global44,
+        const int* boneNode, size_t n, float* out44);
+
+    // Lerp3(T) + Slerp4(R) + Lerp3(S) 한 번에
+    void SampleTRS(AnimPoseSoA& soa);
+}
+
+namespace AnimScalar
+{
+    void Lerp3(const std::vector<float>(&a)[3], const std::vector<float>(&b)[3],
+        const std::vector<float>& u, std::vector<float>(&out)[3], size_t n);
+
+    void Slerp4(const std::vector<float>(&a)[4], const std::vector<float>(&b)[4],
+        const std::vector<float>& u, std::vector<float>(&out)[4], size_t n);
+
+    void ComposeTRS44(const AnimPoseSoA& soa, const int* dst, float* dst44);
+    void ComposeTRS34(const AnimPoseSoA& soa, const int* dst, float* dst34);
+
+    void PaletteT44(const float* offset44, const float* global44,
+        const int* boneNode, size_t n, float* out44);
+
+    void SampleTRS(AnimPoseSoA& soa);
+}
@@ -0,0 +1,87 @@
+﻿// ============================================================================
+// AnimSampler.h
+// - 키프레임 구간 탐색 (커서 캐시 + 이진 탐색)
+// - 클립 채널 → 노드 인덱스 바인딩 (로드 시 1회)
+// - SK_Key*/RS_Key* 처럼 double t 멤버를 가진 키 배열이면 그대로 사용
+// ============================================================================
+
+#pragma once
+
+// ---- includes ----
+#include <vector>
+#include <string>
+#include <algorithm>
+
+// ---------------------------------------------------------------------------
+// AnimKeyCursor
+//  - 채널 하나의 T/R/S 마지막 upper-bound 인덱스
+//  - 인스턴스(재생 상태)마다 따로 들고 있어야 한다 (클립 데이터는 공유)
+// ---------------------------------------------------------------------------
+struct AnimKeyCursor
+{
+    int t = 0;
+    int r = 0;
+    int s = 0;
+};
+
+// ---------------------------------------------------------------------------
+// AnimUpperBound
+//  - "처음으로 time > t 인 키 인덱스"를 반환 (기존 UB_* 와 동일한 결과)
+//  - cursor: 지난 프레임 결과. 순방향 재생이면 몇 칸만 전진하면 끝 (amortized O(1))
+//  - 되감기/루프/큰 점프면 범위를 좁혀 std::upper_bound (O(log n))
+// ---------------------------------------------------------------------------
+template <class Key>
+inline int AnimUpperBound(double t, const std::vector<Key>& keys, int& cursor)
+{
+    // 순방향으로 이 정도 넘게 움직이면 선형 전진 대신 이진 탐색
+    static constexpr int kLinearSteps = 4;
+
+    const int n = (int)keys.size();
+    int c = std::clamp(cursor, 0, n);
+
+    auto cmp = [](double tt, const Key& k) { return tt < k.t; };
+
+    if (c > 0 && keys[c - 1].t > t) {
+        // 뒤로 감김(루프/시크): [0, c) 안에서 찾는다
+        c = (int)(std::upper_bound(keys.begin(), keys.begin() + c, t, cmp) - keys.begin());
+    }
+    else {
+        // 앞으로 진행: 몇 칸은 선형, 그 이상이면 [c, n) 이진 탐색
+        int steps = 0;
+        while (c < n && keys[c].t <= t && steps < kLinearSteps) { ++c; ++steps; }
+        if (c < n && keys[c].t <= t)
+            c = (int)(std::upper_bound(keys.begin() + c, keys.end(), t, cmp) - keys.begin());
+    }
+
+    cursor = c;
+    return c;
+}
+
+// ---------------------------------------------------------------------------
+// AnimBinding
+//  - (노드 인덱스, 채널 인덱스) 한 쌍. 포즈 평가는 이 목록만 돈다
+//  - 이름 해시/unordered_map 조회는 로드 시점에 한 번만 한다
+// ---------------------------------------------------------------------------
+struct AnimBinding
+{
+    int node = -1;
+    int channel = -1;
+};
+
+// 노드마다 clip.map(target name -> channel)을 한 번 조회해 노드 순 바인딩 목록을 만든다
+//  - 기존 per-frame map.find(nd.name) 와 같은 대응 (동명 노드/마지막 채널 우선 포함)
+//  - 채널 없는 노드는 목록에 없다 → 호출부에서 bindLocal을 한 번만 넣어두면 됨
+template <class Clip>
+inline std::vector<AnimBinding> AnimBindChannels(const Clip& clip, const std::vector<std::string>& nodeNames)
+{
+    std::vector<AnimBinding> out;
+    if (clip.map.empty()) return out;
+
+    out.reserve(clip.channels.size());
+    for (int n = 0; n < (int)nodeNames.size(); ++n) {
+        auto it = clip.map.find(nodeNames[n]);
+        if (it == clip.map.end()) continue;
+        out.push_back({ n, it->second });
+    }
+    return out;
+}
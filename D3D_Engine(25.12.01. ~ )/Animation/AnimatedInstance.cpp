@@ -0,0 +1,437 @@
+﻿// ============================================================================
+// AnimatedInstance.cpp
+// - AnimatedInstance 구현: 샘플링(SoA) → 글로벌 누적 → 팔레트
+// - 레이어 블렌딩: 로컬 TRS 가중 누적 → 합성 1회
+// ============================================================================
+
+// ---- includes ----
+#include "AnimatedInstance.h"
+
+#include <cmath>
+#include <atomic>
+#include <algorithm>
+
+// AnimSimd 커널은 Matrix 배열을 row-major float[16] 배열로 본다
+static_assert(sizeof(DirectX::SimpleMath::Matrix) == sizeof(float) * 16, "Matrix must be 16 packed floats");
+
+static inline double fmod_pos(double x, double m) {
+    if (m <= 0.0) return 0.0;
+    double r = fmod(x, m);
+    return (r < 0.0) ? r + m : r;
+}
+
+// 초 → 클립 tick (loop면 감기, 아니면 클램프)
+static inline double ClipTick(const AnimationClipAsset& clip, double tSec, bool loop)
+{
+    const double T = tSec * clip.TicksPerSec();
+    return loop ? fmod_pos(T, clip.duration) : std::clamp(T, 0.0, clip.duration);
+}
+
+// 바인딩 k 를 SoA lane 에 수집 (압축 트랙이면 역양자화)
+static inline void GatherLane(const AnimationClipAsset& clip, const SkeletonAsset& sk,
+    size_t k, double tTick, std::vector<AnimKeyCursor>& cursors, AnimPoseSoA& soa, size_t lane)
+{
+    const AnimBinding& b = clip.bindings[k];
+    const auto& dt = sk.defaultT[b.node];
+    const float defT[3] = { dt.x, dt.y, dt.z };
+    if (!clip.packed.Empty())
+        AnimGatherPacked(clip.packed.channels[b.channel], cursors[b.channel], tTick * clip.packed.invTimeScale, defT, soa, lane);
+    else
+        AnimGatherChannel(clip.channels[b.channel], cursors[b.channel], tTick, defT, soa, lane);
+    soa.dst[lane] = b.node;
+}
+
+// 쿼터니언 곱 (x,y,z,w)
+static inline void QMul(const float* a, const float* b, float* o)
+{
+    o[0] = a[3] * b[0] + a[0] * b[3] + a[1] * b[2] - a[2] * b[1];
+    o[1] = a[3] * b[1] - a[0] * b[2] + a[1] * b[3] + a[2] * b[0];
+    o[2] = a[3] * b[2] + a[0] * b[1] - a[1] * b[0] + a[2] * b[3];
+    o[3] = a[3] * b[3] - a[0] * b[0] - a[1] * b[1] - a[2] * b[2];
+}
+
+static inline void QNormalize(float* q)
+{
+    const float l = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+    if (l > 0.0f) { const float inv = 1.0f / l; for (int i = 0; i < 4; ++i) q[i] *= inv; }
+    else { q[0] = q[1] = q[2] = 0.0f; q[3] = 1.0f; }
+}
+
+uint64_t AnimatedInstance::UniqueId::Next()
+{
+    static std::atomic<uint64_t> next{ 1 };
+    return next.fetch_add(1, std::memory_order_relaxed);
+}
+
+// ============================================================================
+// 초기화
+// ============================================================================
+void AnimatedInstance::Init(
+    std::shared_ptr<const SkeletonAsset> skeleton,
+    std::shared_ptr<const AnimClipLibrary> library, int clip)
+{
+    mSkeleton = std::move(skeleton);
+    mLibrary = std::move(library);
+    mTimeSec = 0.0;
+
+    const size_t nodes = mSkeleton->NodeCount();
+    mCursors.resize(mLibrary->Count());
+    for (size_t i = 0; i < mLibrary->Count(); ++i)
+        mCursors[i].assign(mLibrary->Get(i).channels.size(), AnimKeyCursor{});
+    mPoseLocal.assign(mSkeleton->bindLocal.begin(), mSkeleton->bindLocal.end());
+    mPoseGlobal.resize(nodes);
+    mPalette.resize(mSkeleton->BoneCount());
+    if (mSkinMode == SkinMode::DualQuat) mPaletteDQ.resize(mPalette.size());
+
+    mAccT.clear(); mAccR.clear(); mAccS.clear();
+    mAccW.clear(); mExpectW.clear(); mAddW.clear();
+    mBlendTouched.clear();
+    mBlendDirty = false;
+    mClipPosed = false;
+
+    mLod = AnimLodState{};
+    mLodFrom.clear(); mLodTo.clear();
+    mSkipLeaves = false;
+
+    mClip.reset();
+    SetClip(clip);
+
+    AnimLocalToGlobal(mSkeleton->parents.data(), mPoseLocal.data(), mPoseGlobal.data(), nodes);
+    BuildPalette();     // 첫 Evaluate 전에도 바인드 포즈 팔레트가 유효하도록
+}
+
+void AnimatedInstance::Init(
+    std::shared_ptr<const SkeletonAsset> skeleton,
+    std::shared_ptr<const AnimationClipAsset> clip)
+{
+    auto lib = std::make_shared<AnimClipLibrary>();
+    lib->Add(std::move(clip));
+    Init(std::move(skeleton), std::move(lib), 0);
+}
+
+void AnimatedInstance::SetClip(int clip)
+{
+    const int idx = std::clamp(clip, 0, (int)mLibrary->Count() - 1);
+    if (mClip && idx == mClipIndex) return;
+
+    // 이전 클립만 채널을 가진 노드가 남지 않도록 바인드 포즈로 되돌림
+    if (mClip) mPoseLocal.assign(mSkeleton->bindLocal.begin(), mSkeleton->bindLocal.end());
+    mClipIndex = idx;
+    mClip = mLibrary->clips[mClipIndex];
+}
+
+// ============================================================================
+// 포즈 평가
+// ============================================================================
+void AnimatedInstance::Evaluate(double tSec, bool loop)
+{
+    thread_local AnimPoseSoA tlsScratch;
+    Evaluate(tSec, loop, tlsScratch);
+}
+
+void AnimatedInstance::Evaluate(double tSec, bool loop, AnimPoseSoA& scratch)
+{
+    const SkeletonAsset& sk = *mSkeleton;
+    const AnimationClipAsset& clip = *mClip;
+    mTimeSec = tSec;
+
+    if (mBlendDirty) ResetBlendTouched();
+    mClipPosed = true;
+
+    // 채널 없는 노드의 mPoseLocal은 Init()에서 bindLocal로 고정해둠
+    if (clip.duration <= 0.0) {
+        for (const auto& b : clip.bindings) mPoseLocal[b.node] = sk.bindLocal[b.node];
+    }
+    else {
+        const double t = ClipTick(clip, tSec, loop);   // ticks
+
+        // 1) 채널별 키 구간 수집 (SoA, 압축 트랙이면 역양자화) → 2) 4채널씩 보간 → 3) TRS를 바로 행렬로
+        //    (LOD 말단 생략 시 해당 노드는 lane 에서 빼고 이전 로컬 포즈 유지)
+        const size_t nb = clip.bindings.size();
+        auto& cursors = mCursors[mClipIndex];
+        scratch.Resize(nb);
+        size_t n = 0;
+        for (size_t k = 0; k < nb; ++k) {
+            if (mSkipLeaves && sk.leaf[clip.bindings[k].node]) continue;
+            GatherLane(clip, sk, k, t, cursors, scratch, n++);
+        }
+        scratch.count = n;
+        AnimSimd::SampleTRS(scratch);
+        AnimSimd::ComposeTRS44(scratch, scratch.dst.data(), reinterpret_cast<float*>(mPoseLocal.data()));
+    }
+
+    // 부모가 항상 앞이므로 한 번의 선형 루프로 글로벌 누적
+    AnimLocalToGlobal(sk.parents.data(), mPoseLocal.data(), mPoseGlobal.data(), mPoseGlobal.size());
+}
+
+// ============================================================================
+// 레이어 블렌딩
+// ============================================================================
+void AnimatedInstance::EvaluateLayers(const AnimLayer* layers, size_t count)
+{
+    thread_local AnimPoseSoA tlsScratch;
+    EvaluateLayers(layers, count, tlsScratch);
+}
+
+void AnimatedInstance::ResetBlendTouched()
+{
+    for (size_t i = 0; i < mBlendTouched.size(); ++i) {
+        if (!mBlendTouched[i]) continue;
+        mPoseLocal[i] = mSkeleton->bindLocal[i];
+        mBlendTouched[i] = 0;
+    }
+    mBlendDirty = false;
+}
+
+void AnimatedInstance::EvaluateLayers(const AnimLayer* layers, size_t count, AnimPoseSoA& scratch)
+{
+    const SkeletonAsset& sk = *mSkeleton;
+    const size_t N = sk.NodeCount();
+    if (count > 0) mTimeSec = layers[0].tSec;
+
+    if (mAccW.size() != N) {
+        mAccT.resize(N * 3); mAccR.resize(N * 4); mAccS.resize(N * 3);
+        mAccW.resize(N); mExpectW.resize(N); mAddW.resize(N);
+        mBlendTouched.assign(N, 0);
+    }
+    // Evaluate 다음 첫 블렌딩: 그 클립이 움직인 노드도 이번에 가중치가 없으면 바인드 포즈로 (4 단계)
+    if (mClipPosed) {
+        for (const AnimBinding& b : mClip->bindings) mBlendTouched[b.node] = 1;
+        mClipPosed = false;
+    }
+    std::fill(mAccT.begin(), mAccT.end(), 0.0f);
+    std::fill(mAccR.begin(), mAccR.end(), 0.0f);
+    std::fill(mAccS.begin(), mAccS.end(), 0.0f);
+    std::fill(mAccW.begin(), mAccW.end(), 0.0f);
+    std::fill(mExpectW.begin(), mExpectW.end(), 0.0f);
+    std::fill(mAddW.begin(), mAddW.end(), 0.0f);
+
+    auto validLayer = [&](const AnimLayer& L) {
+        return L.weight > 0.0f && L.clip >= 0 && L.clip < (int)mLibrary->Count()
+            && mLibrary->Get(L.clip).duration > 0.0;
+        };
+    auto maskOf = [](const AnimLayer& L, int node) {
+        return (L.mask && (size_t)node < L.mask->size()) ? (*L.mask)[node] : 1.0f;
+        };
+
+    // 레이어 하나 샘플링: 가중치 > 0 인 바인딩만 lane 으로 (mLaneW / mLaneB)
+    auto sampleLayer = [&](const AnimLayer& L) -> size_t {
+        const AnimationClipAsset& clip = mLibrary->Get(L.clip);
+        const double t = ClipTick(clip, L.tSec, L.loop);
+        const size_t nb = clip.bindings.size();
+        scratch.Resize(nb);
+        mLaneW.resize(nb);
+        mLaneB.resize(nb);
+
+        size_t n = 0;
+        for (size_t k = 0; k < nb; ++k) {
+            const float w = L.weight * maskOf(L, clip.bindings[k].node);
+            if (w <= 0.0f) continue;
+            GatherLane(clip, sk, k, t, mCursors[L.clip], scratch, n);
+            mLaneW[n] = w;
+            mLaneB[n] = (int)k;
+            ++n;
+        }
+        scratch.count = n;
+        AnimSimd::SampleTRS(scratch);
+        return n;
+        };
+
+    // ------------------------------------------------------------------------
+    // 1) 일반 레이어: 노드별 기대 가중치 + 채널 있는 노드 가중 누적
+    // ------------------------------------------------------------------------
+    for (size_t li = 0; li < count; ++li) {
+        const AnimLayer& L = layers[li];
+        if (L.additive || !validLayer(L)) continue;
+
+        for (size_t i = 0; i < N; ++i) mExpectW[i] += L.weight * maskOf(L, (int)i);
+
+        const size_t n = sampleLayer(L);
+        for (size_t k = 0; k < n; ++k) {
+            const int node = scratch.dst[k];
+            const float w = mLaneW[k];
+            float* aT = &mAccT[node * 3]; float* aR = &mAccR[node * 4]; float* aS = &mAccS[node * 3];
+
+            float q[4] = { scratch.r[0][k], scratch.r[1][k], scratch.r[2][k], scratch.r[3][k] };
+            if (aR[0] * q[0] + aR[1] * q[1] + aR[2] * q[2] + aR[3] * q[3] < 0.0f)
+                for (int c = 0; c < 4; ++c) q[c] = -q[c];
+
+            for (int c = 0; c < 3; ++c) { aT[c] += scratch.t[c][k] * w; aS[c] += scratch.s[c][k] * w; }
+            for (int c = 0; c < 4; ++c) aR[c] += q[c] * w;
+            mAccW[node] += w;
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // 2) 채널이 없는 레이어 몫은 바인드 포즈로 채우고 정규화
+    // ------------------------------------------------------------------------
+    for (size_t i = 0; i < N; ++i) {
+        float& W = mAccW[i];
+        if (W <= 0.0f) continue;
+
+        float* aT = &mAccT[i * 3]; float* aR = &mAccR[i * 4]; float* aS = &mAccS[i * 3];
+        const float missing = mExpectW[i] - W;
+        if (missing > 1e-6f) {
+            const auto& bt = sk.bindT[i]; const auto& br = sk.bindR[i]; const auto& bs = sk.bindS[i];
+            float q[4] = { br.x, br.y, br.z, br.w };
+            if (aR[0] * q[0] + aR[1] * q[1] + aR[2] * q[2] + aR[3] * q[3] < 0.0f)
+                for (int c = 0; c < 4; ++c) q[c] = -q[c];
+            aT[0] += bt.x * missing; aT[1] += bt.y * missing; aT[2] += bt.z * missing;
+            aS[0] += bs.x * missing; aS[1] += bs.y * missing; aS[2] += bs.z * missing;
+            for (int c = 0; c < 4; ++c) aR[c] += q[c] * missing;
+            W += missing;
+        }
+
+        const float inv = 1.0f / W;
+        for (int c = 0; c < 3; ++c) { aT[c] *= inv; aS[c] *= inv; }
+        QNormalize(aR);
+    }
+
+    // ------------------------------------------------------------------------
+    // 3) 가산 레이어: (샘플 - 기준 포즈) * w 를 현재 결과 위에
+    // ------------------------------------------------------------------------
+    for (size_t li = 0; li < count; ++li) {
+        const AnimLayer& L = layers[li];
+        if (!L.additive || !validLayer(L)) continue;
+
+        const AnimationClipAsset& clip = mLibrary->Get(L.clip);
+        if (clip.additiveRef.size() != clip.bindings.size() * 10) continue;
+
+        const size_t n = sampleLayer(L);
+        for (size_t k = 0; k < n; ++k) {
+            const int node = scratch.dst[k];
+            const float w = std::min(mLaneW[k], 1.0f);
+            const float* ref = &clip.additiveRef[(size_t)mLaneB[k] * 10];
+            float* aT = &mAccT[node * 3]; float* aR = &mAccR[node * 4]; float* aS = &mAccS[node * 3];
+
+            // 일반 레이어가 안 건드린 노드는 바인드 포즈 위에
+            if (mAccW[node] <= 0.0f && mAddW[node] <= 0.0f) {
+                const auto& bt = sk.bindT[node]; const auto& br = sk.bindR[node]; const auto& bs = sk.bindS[node];
+                aT[0] = bt.x; aT[1] = bt.y; aT[2] = bt.z;
+                aR[0] = br.x; aR[1] = br.y; aR[2] = br.z; aR[3] = br.w;
+                aS[0] = bs.x; aS[1] = bs.y; aS[2] = bs.z;
+            }
+
+            // dQ = q * conj(q0), 가중치는 항등과 nlerp
+            const float q[4] = { scratch.r[0][k], scratch.r[1][k], scratch.r[2][k], scratch.r[3][k] };
+            const float q0c[4] = { -ref[3], -ref[4], -ref[5], ref[6] };
+            float dq[4];
+            QMul(q, q0c, dq);
+            if (dq[3] < 0.0f) for (int c = 0; c < 4; ++c) dq[c] = -dq[c];
+            for (int c = 0; c < 3; ++c) dq[c] *= w;
+            dq[3] = 1.0f + (dq[3] - 1.0f) * w;
+            QNormalize(dq);
+
+            float r[4];
+            QMul(dq, aR, r);
+            for (int c = 0; c < 4; ++c) aR[c] = r[c];
+
+            for (int c = 0; c < 3; ++c) {
+                aT[c] += (scratch.t[c][k] - ref[c]) * w;
+                const float s0 = ref[7 + c];
+                const float ratio = (std::fabs(s0) > 1e-8f) ? scratch.s[c][k] / s0 : 1.0f;
+                aS[c] *= 1.0f + (ratio - 1.0f) * w;
+            }
+            mAddW[node] += w;
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // 4) 가중치가 있는 노드만 합성 / 나머지는 바인드 포즈
+    // ------------------------------------------------------------------------
+    size_t active = 0;
+    for (size_t i = 0; i < N; ++i) if (mAccW[i] > 0.0f || mAddW[i] > 0.0f) ++active;
+
+    scratch.Resize(active);
+    size_t lane = 0;
+    for (size_t i = 0; i < N; ++i) {
+        if (mAccW[i] > 0.0f || mAddW[i] > 0.0f) {
+            for (int c = 0; c < 3; ++c) { scratch.t[c][lane] = mAccT[i * 3 + c]; scratch.s[c][lane] = mAccS[i * 3 + c]; }
+            for (int c = 0; c < 4; ++c) scratch.r[c][lane] = mAccR[i * 4 + c];
+            scratch.dst[lane] = (int)i;
+            ++lane;
+            mBlendTouched[i] = 1;
+        }
+        else if (mBlendTouched[i]) {
+            mPoseLocal[i] = sk.bindLocal[i];
+            mBlendTouched[i] = 0;
+        }
+    }
+    AnimSimd::ComposeTRS44(scratch, scratch.dst.data(), reinterpret_cast<float*>(mPoseLocal.data()));
+    mBlendDirty = true;
+
+    AnimLocalToGlobal(sk.parents.data(), mPoseLocal.data(), mPoseGlobal.data(), N);
+}
+
+// ============================================================================
+// 팔레트
+// ============================================================================
+void AnimatedInstance::BuildPalette()
+{
+    const SkeletonAsset& sk = *mSkeleton;
+    AnimSimd::PaletteT44(
+        reinterpret_cast<const float*>(sk.boneOffsets.data()),
+        reinterpret_cast<const float*>(mPoseGlobal.data()),
+        sk.boneNodes.data(), sk.BoneCount(),
+        reinterpret_cast<float*>(mPalette.data()));
+    if (mSkinMode == SkinMode::DualQuat)
+        AnimDualQuatPalette(reinterpret_cast<const float*>(mPalette.data()), mPalette.size(), mPaletteDQ.data());
+    ++mPaletteVersion;
+}
+
+void AnimatedInstance::SetSkinMode(SkinMode mode)
+{
+    if (mode == mSkinMode) return;
+    mSkinMode = mode;
+    if (mode == SkinMode::DualQuat) mPaletteDQ.resize(mPalette.size());
+    else { mPaletteDQ.clear(); mPaletteDQ.shrink_to_fit(); }
+    if (mSkeleton) BuildPalette();
+}
+
+// ============================================================================
+// LOD 보간
+//  - 평가 프레임: LodBeginStep → Evaluate(앞선 시간) → LodEndStep → LodBlend(1/N)
+//  - 사이 프레임: LodBlend(k/N) 만 (샘플링/글로벌 누적 없음)
+//  - 행렬 성분 선형 보간: 한 주기(수 프레임) 안의 작은 변화만 다루므로 충분
+// ============================================================================
+void AnimatedInstance::LodBeginStep()
+{
+    mLodFrom.assign(mPoseGlobal.begin(), mPoseGlobal.end());
+}
+
+void AnimatedInstance::LodEndStep()
+{
+    mLodTo.assign(mPoseGlobal.begin(), mPoseGlobal.end());
+}
+
+void AnimatedInstance::LodBlend(float a)
+{
+    if (mLodFrom.size() != mPoseGlobal.size() || mLodTo.size() != mPoseGlobal.size()) return;
+
+    // 주기 마지막 프레임: f + (t - f) * 1 은 반올림으로 t 와 다를 수 있음 → 목표를 그대로
+    if (a >= 1.0f) {
+        std::copy(mLodTo.begin(), mLodTo.end(), mPoseGlobal.begin());
+        return;
+    }
+
+    const float* f = reinterpret_cast<const float*>(mLodFrom.data());
+    const float* t = reinterpret_cast<const float*>(mLodTo.data());
+    float* o = reinterpret_cast<float*>(mPoseGlobal.data());
+    const size_t n = mPoseGlobal.size() * 16;
+    for (size_t i = 0; i < n; ++i) o[i] = f[i] + (t[i] - f[i]) * a;
+}
+
+size_t AnimatedInstance::InstanceBytes() const
+{
+    size_t cursors = 0;
+    for (const auto& c : mCursors) cursors += c.capacity() * sizeof(AnimKeyCursor);
+
+    const size_t blend = (mAccT.capacity() + mAccR.capacity() + mAccS.capacity()
+        + mAccW.capacity() + mExpectW.capacity() + mAddW.capacity() + mLaneW.capacity()) * sizeof(float)
+        + mLaneB.capacity() * sizeof(int) + mBlendTouched.capacity();
+
+    return sizeof(*this) + cursors + blend
+        + (mPoseLocal.capacity() + mPoseGlobal.capacity() + mPalette.capacity()
+            + mLodFrom.capacity() + mLodTo.capacity()) * sizeof(Matrix)
+        + mPaletteDQ.capacity() * sizeof(AnimDualQuat);
+}
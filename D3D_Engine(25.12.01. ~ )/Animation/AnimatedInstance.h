@@ -0,0 +1,138 @@
+﻿// ============================================================================
+// AnimatedInstance.h
+// - 캐릭터 1개체의 재생 상태 (시간/커서/로컬·글로벌 포즈/팔레트)
+// - 스켈레톤/클립 라이브러리는 shared_ptr<const ...> 로 공유만 한다 → 인스턴스당 수 KB
+// - Evaluate: 현재 클립 하나 / EvaluateLayers: 여러 클립 블렌딩 (AnimBlend.h)
+// - LOD: 평가 사이 프레임은 두 글로벌 포즈 보간 (AnimLod.h, AnimationSystem 이 구동)
+// ============================================================================
+
+#pragma once
+
+// ---- includes ----
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <directxtk/SimpleMath.h>
+
+#include "AnimClip.h"
+#include "AnimBlend.h"
+#include "AnimLod.h"
+#include "SkeletonAsset.h"
+#include "AnimSIMD.h"
+#include "AnimDualQuat.h"
+
+class AnimatedInstance
+{
+public:
+    using Matrix = DirectX::SimpleMath::Matrix;
+
+public:
+    // 스켈레톤/클립 연결 + 포즈를 바인드 포즈로 초기화 (할당은 여기서만)
+    void Init(std::shared_ptr<const SkeletonAsset> skeleton,
+        std::shared_ptr<const AnimClipLibrary> library, int clip = 0);
+    void Init(std::shared_ptr<const SkeletonAsset> skeleton,
+        std::shared_ptr<const AnimationClipAsset> clip);       // 클립 1개짜리 라이브러리로 감싼다
+
+    // Evaluate 가 재생할 클립 (라이브러리 인덱스)
+    void SetClip(int clip);
+    int ClipIndex() const { return mClipIndex; }
+
+    // 클립 샘플링 + 글로벌 누적 (tSec: 초)
+    //  - scratch: SoA 작업 버퍼. 스레드마다 하나씩 쓰면 된다
+    void Evaluate(double tSec, bool loop, AnimPoseSoA& scratch);
+    void Evaluate(double tSec, bool loop);   // 내부 thread_local 스크래치 사용
+
+    // 레이어 블렌딩 (일반 레이어 가중 평균 → 가산 레이어 → 합성 → 글로벌 1회)
+    void EvaluateLayers(const AnimLayer* layers, size_t count, AnimPoseSoA& scratch);
+    void EvaluateLayers(const AnimLayer* layers, size_t count);
+
+    // palette[i] = transpose(boneOffset[i] * poseGlobal[boneNode[i]])  (HLSL 업로드 형태)
+    //  - DualQuat 모드면 같은 행렬로 듀얼 쿼터니언 팔레트도 만든다
+    void BuildPalette();
+
+    // 스키닝 방식 (바꾸면 팔레트를 다시 만들어 버전이 올라감)
+    void SetSkinMode(SkinMode mode);
+    SkinMode GetSkinMode() const { return mSkinMode; }
+
+    // -----------------------------------------------------------------------
+    // LOD (AnimationSystem 전용)
+    // -----------------------------------------------------------------------
+    // true면 Evaluate 가 말단 노드(SkeletonAsset::leaf) 채널을 샘플링하지 않는다 (이전 포즈 유지)
+    void SetSkipLeaves(bool skip) { mSkipLeaves = skip; }
+
+    void LodBeginStep();        // 지금 표시 중인 글로벌 포즈 → 보간 출발점
+    void LodEndStep();          // 방금 평가한 글로벌 포즈 → 보간 목표
+    void LodBlend(float a);     // 글로벌 = lerp(출발점, 목표, a), a >= 1 이면 목표 그대로
+
+    AnimLodState& LodState() { return mLod; }
+    const AnimLodState& LodState() const { return mLod; }
+
+public:
+    // -----------------------------------------------------------------------
+    // 조회
+    // -----------------------------------------------------------------------
+    const SkeletonAsset& Skeleton() const { return *mSkeleton; }
+    const AnimationClipAsset& Clip() const { return *mClip; }
+    const AnimClipLibrary& Library() const { return *mLibrary; }
+    const std::shared_ptr<const SkeletonAsset>& SkeletonPtr() const { return mSkeleton; }
+    const std::shared_ptr<const AnimationClipAsset>& ClipPtr() const { return mClip; }
+    const std::shared_ptr<const AnimClipLibrary>& LibraryPtr() const { return mLibrary; }
+
+    const Matrix& Global(int node) const { return mPoseGlobal[node]; }
+    const std::vector<Matrix>& PoseLocal() const { return mPoseLocal; }
+    const std::vector<Matrix>& PoseGlobal() const { return mPoseGlobal; }
+    const std::vector<Matrix>& Palette() const { return mPalette; }
+    const std::vector<AnimDualQuat>& PaletteDQ() const { return mPaletteDQ; }  // DualQuat 모드에서만 채워짐
+
+    double TimeSec() const { return mTimeSec; }
+    uint64_t PaletteVersion() const { return mPaletteVersion; }   // BuildPalette 마다 +1
+
+    // 인스턴스 고유 번호 (프로세스 안에서 재사용 없음, 복사/이동/대입하면 새 번호)
+    //  - GPU 쪽 캐시 키 (BonePaletteRing 슬롯). 주소는 해제 후 다른 인스턴스가 재사용할 수 있음
+    uint64_t InstanceId() const { return mId.value; }
+
+    // 인스턴스가 따로 들고 있는 메모리 (공유 에셋 제외, 디버그 표시용)
+    size_t InstanceBytes() const;
+
+private:
+    // 블렌딩으로 바꾼 노드 중 이번 평가에서 안 쓰는 노드를 bindLocal로 되돌림
+    void ResetBlendTouched();
+
+    struct UniqueId
+    {
+        uint64_t value = Next();
+        UniqueId() = default;
+        UniqueId(const UniqueId&) : value(Next()) {}
+        UniqueId& operator=(const UniqueId&) { value = Next(); return *this; }   // 내용이 바뀌었으니 새 번호
+        static uint64_t Next();
+    };
+    UniqueId mId;
+
+    std::shared_ptr<const SkeletonAsset>      mSkeleton;
+    std::shared_ptr<const AnimClipLibrary>    mLibrary;
+    std::shared_ptr<const AnimationClipAsset> mClip;   // mLibrary->clips[mClipIndex]
+    int mClipIndex = 0;
+
+    double mTimeSec = 0.0;
+    std::vector<std::vector<AnimKeyCursor>> mCursors;  // [클립][채널]
+    std::vector<Matrix> mPoseLocal;       // 노드와 1:1 (채널 없는 노드는 bindLocal 고정)
+    std::vector<Matrix> mPoseGlobal;
+    std::vector<Matrix> mPalette;         // 본과 1:1 (전치된 스키닝 행렬)
+    uint64_t mPaletteVersion = 0;
+    SkinMode mSkinMode = SkinMode::Linear;
+    std::vector<AnimDualQuat> mPaletteDQ; // 본과 1:1 (DualQuat 모드)
+
+    // LOD 보간 (보간을 처음 쓸 때 할당)
+    AnimLodState mLod;
+    std::vector<Matrix> mLodFrom, mLodTo;
+    bool mSkipLeaves = false;
+
+    // 블렌딩 누적 (EvaluateLayers 처음 호출 시 할당)
+    std::vector<float> mAccT, mAccR, mAccS;   // 노드 x 3/4/3
+    std::vector<float> mAccW, mExpectW, mAddW;
+    std::vector<float> mLaneW;
+    std::vector<int>   mLaneB;
+    std::vector<uint8_t> mBlendTouched;
+    bool mBlendDirty = false;
+    bool mClipPosed = false;    // 마지막 평가가 Evaluate → 현재 클립 채널 노드가 mBlendTouched 밖에서 바뀌어 있음
+};
@@ -0,0 +1,151 @@
+﻿// ============================================================================
+// AnimationSystem.cpp
+// - AnimationSystem 구현: LOD 계획(직렬) → 인스턴스 batch 분배 + 직렬 폴백
+// ============================================================================
+
+// ---- includes ----
+#include "AnimationSystem.h"
+#include "../../D3D_Core/JobSystem.h"
+
+#include <chrono>
+
+void AnimationSystem::Add(AnimatedInstance& inst, double tSec, bool loop, bool buildPalette,
+    const AnimLodInput* lod)
+{
+    Item it;
+    it.inst = &inst;
+    it.tSec = tSec;
+    it.loop = loop;
+    it.buildPalette = buildPalette;
+    if (lod) { it.hasLod = true; it.lod = *lod; }
+    mItems.push_back(it);
+}
+
+void AnimationSystem::AddLayers(AnimatedInstance& inst, const AnimLayer* layers, size_t count, bool buildPalette,
+    const AnimLodInput* lod)
+{
+    Item it;
+    it.inst = &inst;
+    it.tSec = (count > 0) ? layers[0].tSec : 0.0;
+    it.buildPalette = buildPalette;
+    it.layerBegin = mLayers.size();
+    it.layerCount = count;
+    if (lod) { it.hasLod = true; it.lod = *lod; }
+    mLayers.insert(mLayers.end(), layers, layers + count);
+    mItems.push_back(it);
+}
+
+// ============================================================================
+// LOD 계획 (직렬: 인스턴스 LOD 상태와 mLayers 를 여기서만 고친다)
+//  - 주기 N: phase 0 에서 (N-1) 프레임 앞 시간으로 평가하고,
+//    사이 프레임은 표시 포즈 → 목표 포즈를 (k+1)/N 으로 보간 → 마지막 프레임에 정확히 목표
+//  - interpolate == false: phase 0 에서 현재 시간으로 평가, 나머지는 포즈 유지
+// ============================================================================
+void AnimationSystem::PlanLod()
+{
+    for (auto& c : mStats.lodCount) c = 0;
+    mStats.evaluated = mStats.interpolated = mStats.skipped = mStats.leafSkipped = 0;
+
+    for (Item& it : mItems) {
+        AnimLodState& st = it.inst->LodState();
+
+        const AnimLodLevel level = it.hasLod ? AnimSelectLod(mLod, it.lod) : AnimLodLevel::Full;
+        const int N = (level == AnimLodLevel::Full) ? 1 : AnimLodInterval(mLod, level);
+
+        const double d = it.tSec - st.lastT;
+        if (st.hasLast && d >= 0.0) st.step = d;
+        st.lastT = it.tSec;
+        st.hasLast = true;
+
+        if (level != st.level || N != st.interval) st.phase = 0;
+        st.level = level;
+        st.interval = N;
+        ++mStats.lodCount[(size_t)level];
+
+        it.skipLeaves = it.hasLod && mLod.enabled && it.layerCount == 0
+            && mLod.leafSkipPixels > 0.0f && it.lod.screenPixels < mLod.leafSkipPixels;
+        it.aheadSec = 0.0;
+        it.blend = 1.0f;
+
+        if (N == 0) {
+            it.step = Step::Skip;
+        }
+        else if (N == 1) {
+            it.step = Step::Evaluate;
+        }
+        else if (st.phase == 0) {
+            if (mLod.interpolate) {
+                it.step = Step::EvaluateAhead;
+                it.aheadSec = st.step * (N - 1);
+                it.blend = 1.0f / (float)N;
+                for (size_t l = 0; l < it.layerCount; ++l) mLayers[it.layerBegin + l].tSec += it.aheadSec;
+            }
+            else {
+                it.step = Step::Evaluate;
+            }
+        }
+        else {
+            it.step = mLod.interpolate ? Step::Blend : Step::Skip;
+            it.blend = (float)(st.phase + 1) / (float)N;
+        }
+        if (N > 0) st.phase = (st.phase + 1) % N;
+
+        switch (it.step) {
+        case Step::Blend: ++mStats.interpolated; break;
+        case Step::Skip:  ++mStats.skipped; break;
+        default:
+            ++mStats.evaluated;
+            if (it.skipLeaves) ++mStats.leafSkipped;
+            break;
+        }
+    }
+}
+
+void AnimationSystem::EvaluateRange(Item* items, const AnimLayer* layers, size_t begin, size_t end)
+{
+    for (size_t i = begin; i < end; ++i) {
+        Item& it = items[i];
+        if (it.step == Step::Skip) continue;
+
+        if (it.step == Step::Blend) {
+            it.inst->LodBlend(it.blend);
+        }
+        else {
+            const bool ahead = (it.step == Step::EvaluateAhead);
+            if (ahead) it.inst->LodBeginStep();
+
+            it.inst->SetSkipLeaves(it.skipLeaves);
+            if (it.layerCount > 0) it.inst->EvaluateLayers(layers + it.layerBegin, it.layerCount);
+            else it.inst->Evaluate(it.tSec + it.aheadSec, it.loop);
+
+            if (ahead) {
+                it.inst->LodEndStep();
+                it.inst->LodBlend(it.blend);
+            }
+        }
+        if (it.buildPalette) it.inst->BuildPalette();
+    }
+}
+
+void AnimationSystem::Update(JobSystem* jobs)
+{
+    const auto t0 = std::chrono::steady_clock::now();
+
+    PlanLod();
+
+    const size_t n = mItems.size();
+    Item* items = mItems.data();
+    const AnimLayer* layers = mLayers.data();
+
+    if (jobs && n > mBatch) {
+        jobs->ParallelFor(n, mBatch, [items, layers](size_t b, size_t e) { EvaluateRange(items, layers, b, e); });
+        mStats.batches = (n + mBatch - 1) / mBatch;
+    }
+    else {
+        EvaluateRange(items, layers, 0, n);
+        mStats.batches = (n > 0) ? 1 : 0;
+    }
+
+    mStats.instances = n;
+    mStats.updateMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+}
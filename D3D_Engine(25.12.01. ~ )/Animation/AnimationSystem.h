@@ -0,0 +1,92 @@
+﻿// ============================================================================
+// AnimationSystem.h
+// - 씬의 모든 AnimatedInstance 를 모아 한 번에 평가 (샘플링 → 글로벌 → 팔레트)
+// - JobSystem 이 있으면 인스턴스를 batch 단위로 워커에 나눠 준다
+//   · 인스턴스끼리는 공유 에셋을 읽기만 하고 자기 상태만 쓴다 → 순서 무관, 직렬과 결과 동일
+//   · SoA 스크래치는 워커(스레드)마다 하나 (AnimatedInstance 내부 thread_local)
+// - LOD 입력이 있는 인스턴스는 평가 전에 직렬로 이번 프레임 할 일을 정한다 (AnimLod.h)
+//   · 평가 / 보간만 / 건너뜀(포즈·팔레트 유지)
+// ============================================================================
+
+#pragma once
+
+// ---- includes ----
+#include <vector>
+#include <cstdint>
+
+#include "AnimatedInstance.h"
+
+class JobSystem;
+
+class AnimationSystem
+{
+public:
+    enum class Step : uint8_t
+    {
+        Evaluate,        // 이번 시간으로 평가
+        EvaluateAhead,   // 주기 끝 시간으로 평가 → 표시 포즈에서 1/N 만큼 보간
+        Blend,           // 샘플링 없이 보간만
+        Skip             // 아무것도 안 함
+    };
+
+    struct Item
+    {
+        AnimatedInstance* inst = nullptr;
+        double tSec = 0.0;
+        bool loop = true;
+        bool buildPalette = false;   // 스키닝 인스턴스만 true
+        size_t layerBegin = 0;       // layerCount > 0 이면 EvaluateLayers (mLayers 구간)
+        size_t layerCount = 0;
+
+        // LOD (PlanLod 가 채움)
+        bool         hasLod = false;
+        AnimLodInput lod;
+        Step   step = Step::Evaluate;
+        double aheadSec = 0.0;
+        float  blend = 1.0f;
+        bool   skipLeaves = false;
+    };
+
+    struct Stats
+    {
+        size_t instances = 0;
+        size_t batches = 0;
+        double updateMs = 0.0;
+
+        // LOD 카운터 (이번 프레임)
+        size_t lodCount[(size_t)AnimLodLevel::Count] = {};
+        size_t evaluated = 0;
+        size_t interpolated = 0;
+        size_t skipped = 0;
+        size_t leafSkipped = 0;
+    };
+
+public:
+    // 매 프레임: Begin → Add(...) → Update
+    void Begin() { mItems.clear(); mLayers.clear(); }
+    //  - lod == nullptr 이면 LOD 없이 매 프레임 평가
+    void Add(AnimatedInstance& inst, double tSec, bool loop, bool buildPalette,
+        const AnimLodInput* lod = nullptr);
+    void AddLayers(AnimatedInstance& inst, const AnimLayer* layers, size_t count, bool buildPalette,
+        const AnimLodInput* lod = nullptr);
+
+    // jobs == nullptr 이면 호출 스레드에서 직렬 평가
+    void Update(JobSystem* jobs);
+
+    void SetBatchSize(size_t n) { mBatch = (n > 0) ? n : 1; }
+    size_t BatchSize() const { return mBatch; }
+    const Stats& LastStats() const { return mStats; }
+
+    AnimLodSettings& Lod() { return mLod; }
+    const AnimLodSettings& Lod() const { return mLod; }
+
+private:
+    void PlanLod();
+    static void EvaluateRange(Item* items, const AnimLayer* layers, size_t begin, size_t end);
+
+    std::vector<Item> mItems;
+    std::vector<AnimLayer> mLayers;   // 블렌딩 인스턴스들의 레이어 (프레임마다 새로)
+    size_t mBatch = 8;      // 작업 하나당 인스턴스 수
+    AnimLodSettings mLod;
+    Stats mStats;
+};
@@ -0,0 +1,98 @@
+﻿// ============================================================================
+// SkeletonAsset.h
+// - 공유 스켈레톤 (계층 + 바인드 포즈 + inverse bind)
+// - 로드 후 불변. 같은 캐릭터 인스턴스들이 shared_ptr로 공유
+// ============================================================================
+
+#pragma once
+
+// ---- includes ----
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <stdexcept>
+#include <unordered_map>
+#include <cmath>
+#include <directxtk/SimpleMath.h>
+
+#include "AnimHierarchy.h"
+
+struct SkeletonAsset
+{
+    using Matrix = DirectX::SimpleMath::Matrix;
+    using Vector3 = DirectX::SimpleMath::Vector3;
+    using Quaternion = DirectX::SimpleMath::Quaternion;
+
+    // 노드 (부모가 항상 자식보다 앞)
+    std::vector<std::string> names;
+    std::vector<int>         parents;
+    std::vector<Matrix>      bindLocal;
+    std::vector<Vector3>     defaultT;    // 채널에 T 트랙이 없을 때 쓸 이동값
+    std::vector<Vector3>     bindT;       // bindLocal 분해값 (블렌딩에서 채널 없는 노드 몫)
+    std::vector<Quaternion>  bindR;
+    std::vector<Vector3>     bindS;
+    std::vector<uint8_t>     leaf;        // 자식 없는 노드 (애니메이션 LOD에서 샘플링 생략 후보)
+    std::unordered_map<std::string, int> nameToNode;
+
+    // 스키닝 본 (없으면 비어 있음: RigidSkeletal)
+    std::vector<std::string> boneNames;
+    std::vector<Matrix>      boneOffsets; // inverse bind matrix
+    std::vector<int>         boneNodes;
+
+    // 루트 보정 등에 사용하는 글로벌 인버스
+    Matrix globalInv = Matrix::Identity;
+
+    // 바인드 포즈 글로벌 원점들을 감싸는 반지름 (모델 공간, LOD 바운딩 구)
+    float bindRadius = 1.0f;
+
+    size_t NodeCount() const { return parents.size(); }
+    size_t BoneCount() const { return boneNodes.size(); }
+};
+
+// ---------------------------------------------------------------------------
+// SkeletonFromNodes
+//  - 로더의 노드 배열(SK_Node/RS_Node: name, parent, bindLocal)을 평탄화
+//  - keepBindT: T 트랙 없는 채널이 바인드 이동을 유지할지(true) 0으로 둘지(false)
+//  - 부모-자식 순서가 깨져 있으면 예외 (선형 글로벌 패스 전제)
+// ---------------------------------------------------------------------------
+template <class Node>
+inline void SkeletonFromNodes(SkeletonAsset& out, const std::vector<Node>& nodes, bool keepBindT)
+{
+    const size_t n = nodes.size();
+    out.names.resize(n);
+    out.parents.resize(n);
+    out.bindLocal.resize(n);
+    out.defaultT.resize(n);
+    out.bindT.resize(n);
+    out.bindR.resize(n);
+    out.bindS.resize(n);
+    out.leaf.assign(n, 1);
+    out.nameToNode.clear();
+
+    for (size_t i = 0; i < n; ++i) {
+        out.names[i] = nodes[i].name;
+        out.parents[i] = nodes[i].parent;
+        out.bindLocal[i] = nodes[i].bindLocal;
+        out.defaultT[i] = keepBindT ? nodes[i].bindLocal.Translation() : DirectX::SimpleMath::Vector3::Zero;
+        out.nameToNode[nodes[i].name] = (int)i;
+
+        DirectX::SimpleMath::Matrix m = nodes[i].bindLocal;
+        m.Decompose(out.bindS[i], out.bindR[i], out.bindT[i]);
+    }
+
+    // parent 범위 (-1 <= p < i) 검사가 leaf 표시보다 먼저 (잘못된 parent로 범위 밖 쓰기 방지)
+    if (!AnimIsTopoOrdered(out.parents))
+        throw std::runtime_error("SkeletonAsset: node order is not parent-before-child");
+
+    for (size_t i = 0; i < n; ++i)
+        if (out.parents[i] >= 0) out.leaf[out.parents[i]] = 0;
+
+    std::vector<SkeletonAsset::Matrix> bindGlobal(n);
+    AnimLocalToGlobal(out.parents.data(), out.bindLocal.data(), bindGlobal.data(), n);
+    float r2 = 0.0f;
+    for (const auto& g : bindGlobal) {
+        const float d2 = g.Translation().LengthSquared();
+        if (d2 > r2) r2 = d2;
+    }
+    out.bindRadius = (r2 > 0.0f) ? std::sqrt(r2) : 1.0f;
+}
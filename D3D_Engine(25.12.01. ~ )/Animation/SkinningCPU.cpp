@@ -0,0 +1,360 @@
+﻿// ============================================================================
+// SkinningCPU.cpp
+// - CPU 레퍼런스 스키닝 구현 (스칼라, 셰이더와 같은 순서로 누적)
+// - SSE / AVX 커널, JobSystem 청크 분할, 벤치마크
+// - D3D 의존 없음 → 리눅스에서도 단독 컴파일/측정 가능
+// ============================================================================
+
+// ---- includes ----
+#include "SkinningCPU.h"
+#include "../../D3D_Core/JobSystem.h"
+
+#include <cmath>
+#include <chrono>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define SKIN_CPU_SSE 1
+#include <xmmintrin.h>
+#include <emmintrin.h>
+#else
+#define SKIN_CPU_SSE 0
+#endif
+
+// AVX 커널은 /arch 옵션 없이 따로 컴파일하고 실행 시 CPUID 로 고른다
+#if SKIN_CPU_SSE && defined(_MSC_VER)
+#define SKIN_CPU_AVX 1
+#define SKIN_AVX_TARGET
+#include <intrin.h>
+#include <immintrin.h>
+#elif SKIN_CPU_SSE && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SKIN_CPU_AVX 1
+#define SKIN_AVX_TARGET __attribute__((target("avx")))
+#include <immintrin.h>
+#else
+#define SKIN_CPU_AVX 0
+#endif
+
+static inline void Normalize3(float* v)
+{
+    const float l = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+    if (l > 0.0f) { const float inv = 1.0f / l; v[0] *= inv; v[1] *= inv; v[2] *= inv; }
+}
+
+// 3x4 (열벡터 기준) 로 정점 하나 변환 + N/T 정규화
+static inline void ApplyT34(const float* S, const VertexCPU_PNTT_BW& v, VertexCPU_PNTT& o)
+{
+    const float p[3] = { v.px, v.py, v.pz };
+    const float n[3] = { v.nx, v.ny, v.nz };
+    const float t[3] = { v.tx, v.ty, v.tz };
+    float P[3], N[3], T[3];
+    for (int r = 0; r < 3; ++r) {
+        const float* R = S + r * 4;
+        P[r] = R[0] * p[0] + R[1] * p[1] + R[2] * p[2] + R[3];
+        N[r] = R[0] * n[0] + R[1] * n[1] + R[2] * n[2];
+        T[r] = R[0] * t[0] + R[1] * t[1] + R[2] * t[2];
+    }
+    Normalize3(N);
+    Normalize3(T);
+
+    o.px = P[0]; o.py = P[1]; o.pz = P[2];
+    o.nx = N[0]; o.ny = N[1]; o.nz = N[2];
+    o.u = v.u;   o.v = v.v;
+    o.tx = T[0]; o.ty = T[1]; o.tz = T[2]; o.tw = v.tw;
+}
+
+void SkinVerticesRef(const VertexCPU_PNTT_BW* src, size_t count,
+    const float* palette44, size_t boneCount, VertexCPU_PNTT* dst)
+{
+    for (size_t i = 0; i < count; ++i) {
+        const VertexCPU_PNTT_BW& v = src[i];
+
+        // 4본 가중 3x4
+        float S[12] = {};
+        for (int k = 0; k < 4; ++k) {
+            const float w = v.bw[k];
+            if (w == 0.0f || v.bi[k] >= boneCount) continue;
+            const float* rows = palette44 + (size_t)v.bi[k] * 16;
+            for (int c = 0; c < 12; ++c) S[c] += w * rows[c];
+        }
+        ApplyT34(S, v, dst[i]);
+    }
+}
+
+void SkinVerticesDQRef(const VertexCPU_PNTT_BW* src, size_t count,
+    const AnimDualQuat* paletteDQ, size_t boneCount, VertexCPU_PNTT* dst)
+{
+    for (size_t i = 0; i < count; ++i) {
+        const VertexCPU_PNTT_BW& v = src[i];
+        float S[12];
+        AnimDualQuatToT34(AnimDualQuatBlend(paletteDQ, boneCount, v.bi, v.bw), S);
+        ApplyT34(S, v, dst[i]);
+    }
+}
+
+SkinDiff SkinCompare(const VertexCPU_PNTT* a, const VertexCPU_PNTT* b, size_t count)
+{
+    SkinDiff d;
+    for (size_t i = 0; i < count; ++i) {
+        const float dx = a[i].px - b[i].px, dy = a[i].py - b[i].py, dz = a[i].pz - b[i].pz;
+        const float dp = std::sqrt(dx * dx + dy * dy + dz * dz);
+        if (dp > d.pos) { d.pos = dp; d.worstVertex = i; }
+
+        const float dn = std::fmax(std::fabs(a[i].nx - b[i].nx), std::fmax(std::fabs(a[i].ny - b[i].ny), std::fabs(a[i].nz - b[i].nz)));
+        const float dt = std::fmax(std::fabs(a[i].tx - b[i].tx), std::fmax(std::fabs(a[i].ty - b[i].ty), std::fabs(a[i].tz - b[i].tz)));
+        d.nrm = std::fmax(d.nrm, dn);
+        d.tan = std::fmax(d.tan, dt);
+    }
+    return d;
+}
+
+// ============================================================================
+// 커널 선택
+// ============================================================================
+static bool CpuHasAvx()
+{
+#if SKIN_CPU_AVX && defined(_MSC_VER)
+    int r[4];
+    __cpuid(r, 1);
+    const bool osxsave = (r[2] & (1 << 27)) != 0;
+    const bool avx = (r[2] & (1 << 28)) != 0;
+    // OS 가 YMM 상태를 저장해 주는지 (XCR0 bit 1, 2)
+    return osxsave && avx && (_xgetbv(0) & 0x6) == 0x6;
+#elif SKIN_CPU_AVX
+    return __builtin_cpu_supports("avx");
+#else
+    return false;
+#endif
+}
+
+const char* SkinKernelName(SkinKernel k)
+{
+    switch (k) {
+    case SkinKernel::Scalar: return "Scalar";
+    case SkinKernel::SSE:    return "SSE";
+    case SkinKernel::AVX:    return "AVX";
+    default:                 return "?";
+    }
+}
+
+bool SkinKernelAvailable(SkinKernel k)
+{
+    switch (k) {
+    case SkinKernel::Scalar: return true;
+    case SkinKernel::SSE:    return SKIN_CPU_SSE != 0;
+    case SkinKernel::AVX: {
+        static const bool s_avx = CpuHasAvx();
+        return s_avx;
+    }
+    default: return false;
+    }
+}
+
+SkinKernel SkinBestKernel()
+{
+    if (SkinKernelAvailable(SkinKernel::AVX)) return SkinKernel::AVX;
+    if (SkinKernelAvailable(SkinKernel::SSE)) return SkinKernel::SSE;
+    return SkinKernel::Scalar;
+}
+
+static SkinKernel Resolve(SkinKernel k)
+{
+    if (k == SkinKernel::AVX && !SkinKernelAvailable(k)) k = SkinKernel::SSE;
+    if (k == SkinKernel::SSE && !SkinKernelAvailable(k)) k = SkinKernel::Scalar;
+    return k;
+}
+
+// ============================================================================
+// SSE
+//  - 가중 3x4 행(s0..s2)을 스칼라와 같은 순서로 누적 → 전치해서 열(c0..c3)로
+//  - P = px*c0 + py*c1 + pz*c2 + c3, N/T 는 c3 없이 (스칼라 식의 항 순서 그대로)
+//  - 출력 저장은 16B 씩 겹쳐 쓴다 (P → N → uv → T 순서라 앞 값은 뒤 저장이 덮음)
+// ============================================================================
+#if SKIN_CPU_SSE
+static const float kZeroRows[16] = {};
+
+static inline __m128 Normalize3SSE(__m128 v)
+{
+    const __m128 sq = _mm_mul_ps(v, v);
+    const __m128 d = _mm_add_ss(_mm_add_ss(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(1, 1, 1, 1))),
+        _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(2, 2, 2, 2)));
+    const float l = _mm_cvtss_f32(_mm_sqrt_ss(d));
+    return (l > 0.0f) ? _mm_mul_ps(v, _mm_set1_ps(1.0f / l)) : v;
+}
+
+static inline void StoreSkinned(const VertexCPU_PNTT_BW& v, __m128 P, __m128 N, __m128 T, VertexCPU_PNTT& o)
+{
+    _mm_storeu_ps(&o.px, P);
+    _mm_storeu_ps(&o.nx, Normalize3SSE(N));
+    o.u = v.u; o.v = v.v;
+    _mm_storeu_ps(&o.tx, Normalize3SSE(T));
+    o.tw = v.tw;
+}
+
+static inline void SkinOneSSE(const VertexCPU_PNTT_BW& v, const float* palette44, size_t boneCount, VertexCPU_PNTT& o)
+{
+    __m128 s0 = _mm_setzero_ps(), s1 = _mm_setzero_ps(), s2 = _mm_setzero_ps(), s3 = _mm_setzero_ps();
+    for (int k = 0; k < 4; ++k) {
+        const float w = v.bw[k];
+        if (w == 0.0f || v.bi[k] >= boneCount) continue;
+        const float* rows = palette44 + (size_t)v.bi[k] * 16;
+        const __m128 W = _mm_set1_ps(w);
+        s0 = _mm_add_ps(s0, _mm_mul_ps(W, _mm_loadu_ps(rows + 0)));
+        s1 = _mm_add_ps(s1, _mm_mul_ps(W, _mm_loadu_ps(rows + 4)));
+        s2 = _mm_add_ps(s2, _mm_mul_ps(W, _mm_loadu_ps(rows + 8)));
+    }
+    _MM_TRANSPOSE4_PS(s0, s1, s2, s3);   // s0..s3 = 열 0..3 (w 성분 0)
+
+    const __m128 P = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+        _mm_mul_ps(_mm_set1_ps(v.px), s0), _mm_mul_ps(_mm_set1_ps(v.py), s1)),
+        _mm_mul_ps(_mm_set1_ps(v.pz), s2)), s3);
+    const __m128 N = _mm_add_ps(_mm_add_ps(
+        _mm_mul_ps(_mm_set1_ps(v.nx), s0), _mm_mul_ps(_mm_set1_ps(v.ny), s1)),
+        _mm_mul_ps(_mm_set1_ps(v.nz), s2));
+    const __m128 T = _mm_add_ps(_mm_add_ps(
+        _mm_mul_ps(_mm_set1_ps(v.tx), s0), _mm_mul_ps(_mm_set1_ps(v.ty), s1)),
+        _mm_mul_ps(_mm_set1_ps(v.tz), s2));
+
+    StoreSkinned(v, P, N, T, o);
+}
+#endif
+
+void SkinVerticesSSE(const VertexCPU_PNTT_BW* src, size_t count,
+    const float* palette44, size_t boneCount, VertexCPU_PNTT* dst)
+{
+#if SKIN_CPU_SSE
+    for (size_t i = 0; i < count; ++i)
+        SkinOneSSE(src[i], palette44, boneCount, dst[i]);
+#else
+    SkinVerticesRef(src, count, palette44, boneCount, dst);
+#endif
+}
+
+// ============================================================================
+// AVX (정점 2개: 128bit lane 0 = a, lane 1 = b)
+//  - 무효 본(가중치 0 / 범위 밖)은 0 행을 더한다 → 결과는 건너뛴 것과 같음
+//  - 정규화/저장은 lane 을 나눠 SSE 경로 재사용
+// ============================================================================
+#if SKIN_CPU_AVX
+SKIN_AVX_TARGET static inline __m256 Pair(float a, float b)
+{
+    return _mm256_setr_ps(a, a, a, a, b, b, b, b);
+}
+
+SKIN_AVX_TARGET static inline __m256 Rows(const float* a, const float* b)
+{
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(a)), _mm_loadu_ps(b), 1);
+}
+
+SKIN_AVX_TARGET static void SkinTwoAVX(const VertexCPU_PNTT_BW& a, const VertexCPU_PNTT_BW& b,
+    const float* palette44, size_t boneCount, VertexCPU_PNTT& oa, VertexCPU_PNTT& ob)
+{
+    __m256 s0 = _mm256_setzero_ps(), s1 = _mm256_setzero_ps(), s2 = _mm256_setzero_ps();
+    for (int k = 0; k < 4; ++k) {
+        const bool va = a.bw[k] != 0.0f && a.bi[k] < boneCount;
+        const bool vb = b.bw[k] != 0.0f && b.bi[k] < boneCount;
+        if (!va && !vb) continue;
+        const float* ra = va ? palette44 + (size_t)a.bi[k] * 16 : kZeroRows;
+        const float* rb = vb ? palette44 + (size_t)b.bi[k] * 16 : kZeroRows;
+        const __m256 W = Pair(va ? a.bw[k] : 0.0f, vb ? b.bw[k] : 0.0f);
+        s0 = _mm256_add_ps(s0, _mm256_mul_ps(W, Rows(ra + 0, rb + 0)));
+        s1 = _mm256_add_ps(s1, _mm256_mul_ps(W, Rows(ra + 4, rb + 4)));
+        s2 = _mm256_add_ps(s2, _mm256_mul_ps(W, Rows(ra + 8, rb + 8)));
+    }
+
+    // lane 별 4x4 전치 (s3 = 0)
+    const __m256 s3 = _mm256_setzero_ps();
+    const __m256 t0 = _mm256_unpacklo_ps(s0, s1), t1 = _mm256_unpacklo_ps(s2, s3);
+    const __m256 t2 = _mm256_unpackhi_ps(s0, s1), t3 = _mm256_unpackhi_ps(s2, s3);
+    const __m256 c0 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 c1 = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+    const __m256 c2 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m256 c3 = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+
+    const __m256 P = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(
+        _mm256_mul_ps(Pair(a.px, b.px), c0), _mm256_mul_ps(Pair(a.py, b.py), c1)),
+        _mm256_mul_ps(Pair(a.pz, b.pz), c2)), c3);
+    const __m256 N = _mm256_add_ps(_mm256_add_ps(
+        _mm256_mul_ps(Pair(a.nx, b.nx), c0), _mm256_mul_ps(Pair(a.ny, b.ny), c1)),
+        _mm256_mul_ps(Pair(a.nz, b.nz), c2));
+    const __m256 T = _mm256_add_ps(_mm256_add_ps(
+        _mm256_mul_ps(Pair(a.tx, b.tx), c0), _mm256_mul_ps(Pair(a.ty, b.ty), c1)),
+        _mm256_mul_ps(Pair(a.tz, b.tz), c2));
+
+    StoreSkinned(a, _mm256_castps256_ps128(P), _mm256_castps256_ps128(N), _mm256_castps256_ps128(T), oa);
+    StoreSkinned(b, _mm256_extractf128_ps(P, 1), _mm256_extractf128_ps(N, 1), _mm256_extractf128_ps(T, 1), ob);
+}
+
+SKIN_AVX_TARGET static void SkinRangeAVX(const VertexCPU_PNTT_BW* src, size_t count,
+    const float* palette44, size_t boneCount, VertexCPU_PNTT* dst)
+{
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2)
+        SkinTwoAVX(src[i], src[i + 1], palette44, boneCount, dst[i], dst[i + 1]);
+    if (i < count)
+        SkinOneSSE(src[i], palette44, boneCount, dst[i]);
+    _mm256_zeroupper();
+}
+#endif
+
+void SkinVerticesAVX(const VertexCPU_PNTT_BW* src, size_t count,
+    const float* palette44, size_t boneCount, VertexCPU_PNTT* dst)
+{
+#if SKIN_CPU_AVX
+    if (SkinKernelAvailable(SkinKernel::AVX)) {
+        SkinRangeAVX(src, count, palette44, boneCount, dst);
+        return;
+    }
+#endif
+    SkinVerticesSSE(src, count, palette44, boneCount, dst);
+}
+
+void SkinVertices(SkinKernel k, const VertexCPU_PNTT_BW* src, size_t count,
+    const float* palette44, size_t boneCount, VertexCPU_PNTT* dst)
+{
+    switch (Resolve(k)) {
+    case SkinKernel::AVX: SkinVerticesAVX(src, count, palette44, boneCount, dst); break;
+    case SkinKernel::SSE: SkinVerticesSSE(src, count, palette44, boneCount, dst); break;
+    default:              SkinVerticesRef(src, count, palette44, boneCount, dst); break;
+    }
+}
+
+// ============================================================================
+// 병렬 / 벤치마크
+// ============================================================================
+void SkinVerticesParallel(JobSystem* jobs, SkinKernel k,
+    const VertexCPU_PNTT_BW* src, size_t count,
+    const float* palette44, size_t boneCount, VertexCPU_PNTT* dst,
+    size_t chunk)
+{
+    if (chunk == 0) chunk = 1;
+    if (!jobs || count <= chunk) {
+        SkinVertices(k, src, count, palette44, boneCount, dst);
+        return;
+    }
+    jobs->ParallelFor(count, chunk, [=](size_t b, size_t e) {
+        SkinVertices(k, src + b, e - b, palette44, boneCount, dst + b);
+        });
+}
+
+SkinBenchResult SkinBenchmark(JobSystem* jobs, SkinKernel k,
+    const VertexCPU_PNTT_BW* src, size_t count,
+    const float* palette44, size_t boneCount, int iterations)
+{
+    SkinBenchResult r;
+    r.kernel = Resolve(k);
+    r.threads = jobs ? jobs->WorkerCount() + 1 : 1;
+    r.vertices = count;
+    r.iterations = (iterations > 0) ? iterations : 1;
+
+    std::vector<VertexCPU_PNTT> ref(count), out(count);
+    SkinVerticesRef(src, count, palette44, boneCount, ref.data());
+
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int it = 0; it < r.iterations; ++it)
+        SkinVerticesParallel(jobs, r.kernel, src, count, palette44, boneCount, out.data());
+    r.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+
+    r.err = SkinCompare(ref.data(), out.data(), count);
+    return r;
+}
@@ -0,0 +1,97 @@
+﻿// ============================================================================
+// SkinningCPU.h
+// - CPU 레퍼런스 스키닝 (D3D 없이 동작 → 헤드리스 검증/측정용)
+//   · GPU 스킨 캐시(Skinning_CS.hlsl)와 같은 식: 본당 3행 가중 합 → 위치/노멀/탄젠트
+//   · 노멀/탄젠트는 정규화해서 출력 (정적 메시 VS 입력과 같은 형태)
+// - SSE / AVX 커널 + JobSystem 청크 분할 (셰이더 변경 검증 기준, CPU 피킹용 포즈 정점)
+//   · 모든 커널은 스칼라와 같은 순서로 곱/합 → 결과가 비트 단위로 같다 (FMA 축약 없는 빌드 기준)
+// ============================================================================
+
+#pragma once
+
+// ---- includes ----
+#include <cstddef>
+#include <cstdint>
+
+#include "../MeshDataEx.h"
+#include "AnimDualQuat.h"
+
+// ---------------------------------------------------------------------------
+// SkinVerticesRef
+//  - palette44: AnimatedInstance::Palette() (전치 4x4, row-major float[16] x boneCount)
+//               → 본마다 앞 12 float(3행)만 읽는다
+//  - boneCount 이상인 인덱스의 가중치는 무시 (셰이더와 동일)
+// ---------------------------------------------------------------------------
+void SkinVerticesRef(const VertexCPU_PNTT_BW* src, size_t count,
+    const float* palette44, size_t boneCount, VertexCPU_PNTT* dst);
+
+// 듀얼 쿼터니언 버전 (SkinMode::DualQuat, Shared.hlsli SKIN_DQ 와 같은 식)
+//  - 정점마다 AnimDualQuatBlend → 3x4 로 바꿔 위와 같은 변환
+void SkinVerticesDQRef(const VertexCPU_PNTT_BW* src, size_t count,
+    const AnimDualQuat* paletteDQ, size_t boneCount, VertexCPU_PNTT* dst);
+
+// 두 스키닝 결과의 최대 오차 (위치: 거리, 노멀/탄젠트: 성분 절댓값)
+struct SkinDiff
+{
+    float  pos = 0.0f;
+    float  nrm = 0.0f;
+    float  tan = 0.0f;
+    size_t worstVertex = 0;     // 위치 오차가 가장 큰 정점
+};
+
+SkinDiff SkinCompare(const VertexCPU_PNTT* a, const VertexCPU_PNTT* b, size_t count);
+
+// ---------------------------------------------------------------------------
+// 커널 선택
+//  - Scalar : SkinVerticesRef
+//  - SSE    : 정점 1개씩, 가중 3x4 를 __m128 행으로 누적 → 전치 1번 → P/N/T
+//  - AVX    : 정점 2개씩 (256bit 의 128bit lane 마다 정점 하나, SSE 와 같은 식)
+//  - Available: 이 빌드/이 CPU 에서 쓸 수 있는지 (AVX 는 실행 시 CPUID 확인)
+// ---------------------------------------------------------------------------
+enum class SkinKernel : uint8_t { Scalar, SSE, AVX, Count };
+
+const char* SkinKernelName(SkinKernel k);
+bool        SkinKernelAvailable(SkinKernel k);
+SkinKernel  SkinBestKernel();
+
+void SkinVerticesSSE(const VertexCPU_PNTT_BW* src, size_t count,
+    const float* palette44, size_t boneCount, VertexCPU_PNTT* dst);
+void SkinVerticesAVX(const VertexCPU_PNTT_BW* src, size_t count,
+    const float* palette44, size_t boneCount, VertexCPU_PNTT* dst);
+
+// 쓸 수 없는 커널이면 다음으로 느린 커널로 내려간다 (AVX → SSE → Scalar)
+void SkinVertices(SkinKernel k, const VertexCPU_PNTT_BW* src, size_t count,
+    const float* palette44, size_t boneCount, VertexCPU_PNTT* dst);
+
+// ---------------------------------------------------------------------------
+// SkinVerticesParallel
+//  - [0,count) 를 chunk 정점씩 나눠 JobSystem 워커에 분배 (호출 스레드도 참여)
+//  - 정점끼리 독립 → 결과는 직렬과 같다. jobs == nullptr 이거나 chunk 이하면 직렬
+// ---------------------------------------------------------------------------
+class JobSystem;
+
+void SkinVerticesParallel(JobSystem* jobs, SkinKernel k,
+    const VertexCPU_PNTT_BW* src, size_t count,
+    const float* palette44, size_t boneCount, VertexCPU_PNTT* dst,
+    size_t chunk = 4096);
+
+// ---------------------------------------------------------------------------
+// SkinBenchmark
+//  - iterations 회 스키닝한 시간 + 처리량 (D3D 없이 동작 → 헤드리스 측정)
+//  - err: 마지막 결과를 SkinVerticesRef 와 비교한 최대 오차
+// ---------------------------------------------------------------------------
+struct SkinBenchResult
+{
+    SkinKernel kernel = SkinKernel::Scalar;   // 실제로 쓴 커널 (폴백 반영)
+    unsigned   threads = 1;                   // 참여 스레드 (워커 + 호출 스레드)
+    size_t     vertices = 0;                  // 1회 정점 수
+    int        iterations = 0;
+    double     ms = 0.0;                      // 전체 소요 시간
+    SkinDiff   err;
+
+    double VertsPerSec() const { return (ms > 0.0) ? double(vertices) * iterations / (ms * 1e-3) : 0.0; }
+};
+
+SkinBenchResult SkinBenchmark(JobSystem* jobs, SkinKernel k,
+    const VertexCPU_PNTT_BW* src, size_t count,
+    const float* palette44, size_t boneCount, int iterations);
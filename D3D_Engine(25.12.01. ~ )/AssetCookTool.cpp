@@ -0,0 +1,184 @@
+﻿// ============================================================================
+// AssetCookTool.cpp
+// - AssetCookTool 구현: 폴더 순회 / 종류 판별 / 쿠킹 + 검증 / 결과 출력
+// ============================================================================
+
+// ---- includes ----
+#include "../D3D_Core/pch.h"
+#include "AssetCookTool.h"
+#include "AssimpImporterEX.h"
+#include "MeshCook.h"
+#include "MeshLod.h"
+#include "MeshOptimize.h"
+#include "SkeletalCook.h"
+#include "SkinnedSkeletal.h"
+#include "RigidSkeletal.h"
+#include "VertexPack.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cwctype>
+#include <exception>
+
+namespace
+{
+    namespace fs = std::filesystem;
+
+    std::string Utf8(const fs::path& p)
+    {
+        const std::u8string s = p.generic_u8string();
+        return std::string(s.begin(), s.end());
+    }
+
+    double MsSince(std::chrono::steady_clock::time_point t0)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    }
+
+    bool IsFbx(const fs::path& p)
+    {
+        std::wstring ext = p.extension().wstring();
+        std::transform(ext.begin(), ext.end(), ext.begin(), [](wchar_t c) { return (wchar_t)std::towlower(c); });
+        return ext == L".fbx";
+    }
+
+    bool HasAnimatedClip(const SkelCookData& data)
+    {
+        for (const auto& clip : data.clips)
+            if (clip->duration > 0.0 && !clip->channels.empty()) return true;
+        return false;
+    }
+
+    // 스켈레탈 1개: 판별 → 임포트 → 저장 → (검증) 다시 매핑 후 비교. 반환: 실패 없음
+    bool CookSkeletal(const fs::path& fbx, bool verify)
+    {
+        const fs::path cookPath = SkelCookPath(fbx);
+
+        // 최신 쿠킹 파일이 있으면 (검증이 아니면) 건너뜀
+        if (!verify) {
+            for (uint32_t flags : { SkinnedSkeletal::kCookFlags, RigidSkeletal::kCookFlags }) {
+                SkelCookData cur;
+                if (SkelCookLoad(cookPath, SkelCookSourceHash(fbx, flags), cur)) {
+                    printf("  skel  up to date (%s)\n", cur.Skinned() ? "skinned" : "rigid");
+                    return true;
+                }
+            }
+        }
+
+        const auto t0 = std::chrono::steady_clock::now();
+        SkelCookData data;
+        SkinnedSkeletal::ImportFBX(fbx.wstring(), data);
+        if (data.skeleton->BoneCount() == 0) {
+            if (!HasAnimatedClip(data)) { printf("  skel  - (no bones, no animation)\n"); return true; }
+            RigidSkeletal::ImportFBX(fbx.wstring(), data);
+        }
+        const double importMs = MsSince(t0);
+
+        const uint64_t hash = SkelCookSourceHash(fbx, data.flags);
+        if (!SkelCookSave(data, hash, cookPath)) {
+            printf("  skel  FAILED to write %s\n", Utf8(cookPath).c_str());
+            return false;
+        }
+
+        std::error_code ec;
+        const uintmax_t bytes = fs::file_size(cookPath, ec);
+        printf("  skel  cooked %s: %zu nodes, %zu bones, %zu parts, %zu clips, %.1f KB (import %.1f ms)\n",
+            data.Skinned() ? "skinned" : "rigid", data.skeleton->NodeCount(), data.skeleton->BoneCount(),
+            data.parts.size(), data.clips.size(), ec ? 0.0 : bytes / 1024.0, importMs);
+
+        if (!verify) return true;
+
+        const auto t1 = std::chrono::steady_clock::now();
+        SkelCookData loaded;
+        if (!SkelCookLoad(cookPath, hash, loaded)) {
+            printf("  skel  VERIFY FAILED: cooked file did not load\n");
+            return false;
+        }
+        const double loadMs = MsSince(t1);
+
+        std::string what;
+        if (!SkelCookEqual(data, loaded, &what)) {
+            printf("  skel  VERIFY FAILED: %s differs\n", what.c_str());
+            return false;
+        }
+        printf("  skel  verify ok: bit-identical to Assimp import (load %.2f ms vs import %.1f ms)\n", loadMs, importMs);
+        return true;
+    }
+}
+
+int AssetCookMain(const std::vector<std::wstring>& args)
+{
+    if (args.size() < 2 || args[0] != L"--cook") {
+        printf("usage: --cook <dir> [--verify]\n");
+        return 2;
+    }
+    const fs::path root = args[1];
+    const bool verify = std::find(args.begin() + 2, args.end(), L"--verify") != args.end();
+
+    std::error_code ec;
+    if (!fs::is_directory(root, ec)) {
+        printf("not a directory: %s\n", Utf8(root).c_str());
+        return 2;
+    }
+
+    std::vector<fs::path> files;
+    for (fs::recursive_directory_iterator it(root, ec), end; it != end; it.increment(ec)) {
+        if (ec) break;
+        if (it->is_regular_file(ec) && IsFbx(it->path())) files.push_back(it->path());
+    }
+    std::sort(files.begin(), files.end());
+
+    int failed = 0;
+    MeshOptReport optAll;
+    MeshLodReport lodAll;
+    VertexPackReport packAll;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (const fs::path& fbx : files) {
+        printf("%s\n", Utf8(fbx).c_str());
+        MeshOptResetTotals();   // 파일별 최적화 / LOD / 정점 압축 통계
+        MeshLodResetTotals();
+        VertexPackResetTotals();
+        bool ok = true;
+        try {
+            CookedMesh mesh;
+            bool hit = false;
+            if (AssimpImporterEx::LoadCooked_PNTT(fbx.wstring(), mesh, /*flipUV*/true, /*leftHanded*/true, &hit)) {
+                printf("  mesh  %s (%u verts, %.1f KB)\n", hit ? "up to date" : "cooked",
+                    mesh.View().vertexCount, mesh.FileBytes() / 1024.0);
+                if (hit) VertexPackAddSizesToTotals(mesh.View().vertexCount, /*skinned*/false);
+            }
+            else { printf("  mesh  FAILED\n"); ok = false; }
+
+            ok = CookSkeletal(fbx, verify) && ok;
+        }
+        catch (const std::exception& e) {
+            printf("  FAILED: %s\n", e.what());
+            ok = false;
+        }
+        if (!ok) ++failed;
+
+        const MeshOptReport opt = MeshOptTotalsSnapshot();
+        const MeshLodReport lod = MeshLodTotalsSnapshot();
+        const VertexPackReport pack = VertexPackTotalsSnapshot();
+        if (opt.submeshes > 0) {
+            MeshOptPrintReport(Utf8(fbx.filename()).c_str(), opt);
+            optAll.Merge(opt);
+        }
+        if (lod.submeshes > 0) {
+            MeshLodPrintReport(Utf8(fbx.filename()).c_str(), lod);
+            lodAll.Merge(lod);
+        }
+        if (pack.bytesFloat > 0) {
+            VertexPackPrintReport(Utf8(fbx.filename()).c_str(), pack);
+            packAll.Merge(pack);
+        }
+    }
+
+    if (optAll.submeshes > 0) MeshOptPrintReport("all files", optAll);
+    if (lodAll.submeshes > 0) MeshLodPrintReport("all files", lodAll);
+    if (packAll.bytesFloat > 0) VertexPackPrintReport("all files", packAll);
+
+    printf("%zu files, %d failed, %.1f ms\n", files.size(), failed, MsSince(t0));
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,19 @@
+﻿// ============================================================================
+// AssetCookTool.h
+// - 오프라인 쿠킹 CLI: 폴더 아래 FBX 전부를 쿠킹하고 종료 (창/디바이스 없음)
+//   · D3D_Engine.exe --cook <dir> [--verify]
+//   · 모든 FBX → .meshcook (InitScene 정적 메시와 같은 플래그, 최신이면 건너뜀)
+//   · 본이 있으면 SkinnedSkeletal, 본 없이 애니메이션만 있으면 RigidSkeletal → .skelcook
+//   · --verify: 쿠킹 파일을 다시 매핑해서 방금 한 Assimp 임포트와 비트 단위 비교 (SkelCookEqual)
+//   · 새로 임포트한 파일마다 MeshOptimize 전/후 (ACMR / ATVR / fetch) + MeshLod 단계별 삼각형 출력
+// - 종료 코드: 0 전부 성공, 1 실패/불일치 있음, 2 사용법 오류
+// ============================================================================
+
+#pragma once
+
+// ---- includes ----
+#include <string>
+#include <vector>
+
+// args: 프로그램 이름 다음 인자들 (args[0] == L"--cook")
+int AssetCookMain(const std::vector<std::wstring>& args);
@@ -0,0 +1,135 @@
+﻿// ============================================================================
+// AssetLoadBatch.cpp
+// - AssetLoadBatch 구현: 잡 제출 / 단계 시간 측정 / 예외 전달 / 로그
+// ============================================================================
+
+// ---- includes ----
+#include "../D3D_Core/pch.h"
+#include "AssetLoadBatch.h"
+#include "../D3D_Core/JobSystem.h"
+
+#include <cstdio>
+#include <exception>
+#include <mutex>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double Ms(Clock::time_point a, Clock::time_point b)
+    {
+        return std::chrono::duration<double, std::milli>(b - a).count();
+    }
+
+    // WIC 텍스처 로더는 COM 이 필요 → 워커 스레드마다 MTA 로 (이미 초기화된 스레드면 참조만 늘어남)
+    struct ComScope
+    {
+#ifdef _WIN32
+        HRESULT hr = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+        ~ComScope() { if (SUCCEEDED(hr)) CoUninitialize(); }
+#endif
+    };
+}
+
+// ---------------------------------------------------------------------------
+// Stage
+// ---------------------------------------------------------------------------
+void AssetLoadBatch::Stage::GpuBegin()
+{
+    if (mInGpu) return;
+    mGpu0 = Clock::now();
+    mInGpu = true;
+}
+
+void AssetLoadBatch::Stage::ParallelFor(size_t count, const std::function<void(size_t)>& fn)
+{
+    if (!mJobs || count < 2) {
+        for (size_t i = 0; i < count; ++i) fn(i);
+        return;
+    }
+
+    // 워커에서 던진 예외는 잡 밖으로 나가면 안 됨 → 첫 번째만 잡아 두었다가 여기서
+    std::mutex mx;
+    std::exception_ptr first;
+    mJobs->ParallelFor(count, 1, [&](size_t begin, size_t end) {
+        ComScope com;
+        for (size_t i = begin; i < end; ++i) {
+            try { fn(i); }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(mx);
+                if (!first) first = std::current_exception();
+            }
+        }
+        });
+    if (first) std::rethrow_exception(first);
+}
+
+// ---------------------------------------------------------------------------
+// AssetLoadBatch
+// ---------------------------------------------------------------------------
+void AssetLoadBatch::Add(std::string name, Job job)
+{
+    AssetLoadTiming t;
+    t.name = std::move(name);
+    mTimings.push_back(std::move(t));
+    mJobsToRun.push_back(std::move(job));
+}
+
+void AssetLoadBatch::Run(JobSystem* jobs)
+{
+    const Clock::time_point t0 = Clock::now();
+    std::vector<std::exception_ptr> errors(mJobsToRun.size());
+
+    auto runOne = [&](size_t i) {
+        ComScope com;
+        AssetLoadTiming& t = mTimings[i];
+
+        Stage st;
+        st.mJobs = jobs;
+        st.mTiming = &t;
+        st.mT0 = Clock::now();
+        t.startMs = Ms(t0, st.mT0);
+
+        try { mJobsToRun[i](st); t.ok = true; }
+        catch (...) { errors[i] = std::current_exception(); }
+
+        const Clock::time_point t1 = Clock::now();
+        t.cpuMs = Ms(st.mT0, st.mInGpu ? st.mGpu0 : t1);
+        t.gpuMs = st.mInGpu ? Ms(st.mGpu0, t1) : 0.0;
+        };
+
+    if (jobs) {
+        JobCounter counter;
+        for (size_t i = 0; i < mJobsToRun.size(); ++i)
+            jobs->Submit([&runOne, i] { runOne(i); }, &counter);
+        jobs->Wait(counter);
+        mThreads = jobs->WorkerCount() + 1;
+    }
+    else {
+        for (size_t i = 0; i < mJobsToRun.size(); ++i) runOne(i);
+        mThreads = 1;
+    }
+
+    mWallMs = Ms(t0, Clock::now());
+    mJobsToRun.clear();   // 캡처한 참조가 Run 밖으로 살아남지 않게
+
+    for (const std::exception_ptr& e : errors)
+        if (e) std::rethrow_exception(e);
+}
+
+double AssetLoadBatch::SummedMs() const
+{
+    double sum = 0.0;
+    for (const AssetLoadTiming& t : mTimings) sum += t.TotalMs();
+    return sum;
+}
+
+void AssetLoadBatch::Print() const
+{
+    printf("[SceneLoad] %zu assets on %u threads: wall %.1f ms (summed %.1f ms)\n",
+        mTimings.size(), mThreads, mWallMs, SummedMs());
+    for (const AssetLoadTiming& t : mTimings)
+        printf("[SceneLoad]   %-20s start %7.1f  cpu %7.1f  gpu %7.1f  total %7.1f ms  %s%s\n",
+            t.name.c_str(), t.startMs, t.cpuMs, t.gpuMs, t.TotalMs(),
+            t.fromCache ? "cache" : "import", t.ok ? "" : "  FAILED");
+}
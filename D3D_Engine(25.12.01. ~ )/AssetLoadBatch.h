@@ -0,0 +1,81 @@
+﻿// ============================================================================
+// AssetLoadBatch.h
+// - InitScene 에셋 병렬 로드: 에셋 하나 = 잡 하나 (JobSystem 워커에서 동시에)
+//   · CPU 단계: 쿠킹 파일 매핑 / Assimp 임포트 / 압축 (에셋끼리 공유 상태 없음)
+//   · GPU 단계: 버퍼 + 텍스처 디코드/생성. D3D11 디바이스는 free-threaded → 워커에서 바로
+//     (즉시 컨텍스트는 건드리지 않음 → 컨텍스트가 필요한 일은 Run 이 끝난 뒤 호출 스레드에서)
+// - 에셋별 단계 시간 기록 → Print (콘솔) / Timings (ImGui)
+//   · Stage::ParallelFor 로 기다리는 동안 다른 에셋 잡을 대신 처리할 수 있음 → 에셋별 시간은 상한
+//     (병렬 이득은 Run(nullptr) 직렬 실행의 WallMs 와 비교)
+// - 잡 안 예외는 모아 두었다가 전부 끝난 뒤 첫 번째를 다시 던짐 (기존 InitScene 실패 처리와 같음)
+// ============================================================================
+
+#pragma once
+
+// ---- includes ----
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+class JobSystem;
+
+struct AssetLoadTiming
+{
+    std::string name;
+    double startMs = 0.0;       // Run 시작 → 잡 시작 (대기열에서 기다린 시간)
+    double cpuMs = 0.0;         // 잡 시작 → GpuBegin
+    double gpuMs = 0.0;         // GpuBegin → 끝 (호출 안 하면 0)
+    bool   fromCache = false;   // 쿠킹 파일을 그대로 매핑
+    bool   ok = false;
+
+    double TotalMs() const { return cpuMs + gpuMs; }
+};
+
+class AssetLoadBatch
+{
+public:
+    // 잡 안에서 단계 경계 / 캐시 여부 표시 + 에셋 안 팬아웃 (머티리얼 텍스처 등)
+    class Stage
+    {
+    public:
+        void GpuBegin();
+        void SetFromCache(bool hit) { mTiming->fromCache = hit; }
+
+        // fn(i), i ∈ [0,count). 같은 JobSystem 으로 나눠 처리 (없으면 순서대로). 예외는 첫 번째를 다시 던짐
+        void ParallelFor(size_t count, const std::function<void(size_t)>& fn);
+
+    private:
+        friend class AssetLoadBatch;
+        using Clock = std::chrono::steady_clock;
+
+        JobSystem*        mJobs = nullptr;
+        AssetLoadTiming*  mTiming = nullptr;
+        Clock::time_point mT0;
+        Clock::time_point mGpu0;
+        bool              mInGpu = false;
+    };
+
+    using Job = std::function<void(Stage&)>;
+
+    // name: 로그/ImGui 표시용 (UTF-8)
+    void Add(std::string name, Job job);
+
+    // 전부 끝날 때까지 블록 (호출 스레드도 잡을 처리). jobs == nullptr 이면 호출 스레드에서 순서대로
+    void Run(JobSystem* jobs);
+
+    const std::vector<AssetLoadTiming>& Timings() const { return mTimings; }
+    double   WallMs() const { return mWallMs; }
+    double   SummedMs() const;      // 에셋별 시간 합
+    unsigned Threads() const { return mThreads; }
+
+    // 콘솔 출력: 에셋마다 한 줄 + 합계
+    void Print() const;
+
+private:
+    std::vector<Job>             mJobsToRun;
+    std::vector<AssetLoadTiming> mTimings;
+    double                       mWallMs = 0.0;
+    unsigned                     mThreads = 1;
+};
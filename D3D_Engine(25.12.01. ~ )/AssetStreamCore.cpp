@@ -0,0 +1,285 @@
+﻿// ============================================================================
+// AssetStreamCore.cpp
+// - AssetStreamCore 구현: 요청 표 / 우선순위 선택 / I/O 스레드 / 예산 업로드 / 취소
+// ============================================================================
+
+// ---- includes ----
+#include "../D3D_Core/pch.h"
+#include "AssetStreamCore.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+const char* StreamStateName(StreamState s)
+{
+    switch (s) {
+    case StreamState::Queued:   return "queued";
+    case StreamState::Decoding: return "decoding";
+    case StreamState::Decoded:  return "decoded";
+    case StreamState::Resident: return "resident";
+    case StreamState::Failed:   return "failed";
+    default:                    return "none";
+    }
+}
+
+AssetStreamCore::~AssetStreamCore()
+{
+    Stop();
+}
+
+// ---------------------------------------------------------------------------
+// 수명
+// ---------------------------------------------------------------------------
+void AssetStreamCore::Start(IStreamBackend* backend, unsigned ioThreads)
+{
+    Stop();
+    mBackend = backend;
+    mQuit = false;
+    for (unsigned i = 0; i < ioThreads; ++i)
+        mThreads.emplace_back([this] { IoMain(); });
+}
+
+void AssetStreamCore::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mQuit = true;
+        for (auto& [id, e] : mEntries)
+            if (e.cancel) e.cancel->store(true, std::memory_order_relaxed);
+    }
+    mCv.notify_all();
+    for (std::thread& t : mThreads) t.join();
+    mThreads.clear();
+
+    mEntries.clear();
+    mBackend = nullptr;
+}
+
+// ---------------------------------------------------------------------------
+// 요청 / 취소 / 우선순위
+// ---------------------------------------------------------------------------
+StreamHandle AssetStreamCore::Request(const StreamRequest& req)
+{
+    StreamHandle h;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        h.id = mNextId++;
+        Entry& e = mEntries[h.id];
+        e.req = req;
+        e.cancel = std::make_shared<std::atomic<bool>>(false);
+    }
+    mCv.notify_one();
+    return h;
+}
+
+void AssetStreamCore::Cancel(StreamHandle h)
+{
+    // 리소스/페이로드 해제는 락 밖에서 (GPU 객체 Release 가 느릴 수 있음)
+    std::unique_ptr<StreamPayload> payload;
+    std::shared_ptr<StreamResource> resource;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto it = mEntries.find(h.id);
+        if (it == mEntries.end()) return;
+
+        Entry& e = it->second;
+        e.cancel->store(true, std::memory_order_relaxed);   // 디코드 중이면 I/O 스레드가 결과를 버림
+        payload = std::move(e.payload);
+        resource = std::move(e.resource);
+        mEntries.erase(it);
+        ++mFrame.totalCancelled;
+    }
+}
+
+void AssetStreamCore::SetViewer(const StreamFloat3& pos)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mViewer = pos;
+}
+
+void AssetStreamCore::SetPosition(StreamHandle h, const StreamFloat3& pos)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto it = mEntries.find(h.id);
+    if (it != mEntries.end()) it->second.req.position = pos;
+}
+
+float AssetStreamCore::PriorityLocked(const Entry& e) const
+{
+    const float dx = e.req.position.x - mViewer.x;
+    const float dy = e.req.position.y - mViewer.y;
+    const float dz = e.req.position.z - mViewer.z;
+    const float d = std::sqrt(dx * dx + dy * dy + dz * dz) - e.req.radius;
+    return (d > 0.0f ? d : 0.0f) + e.req.bias;
+}
+
+uint32_t AssetStreamCore::PickQueuedLocked() const
+{
+    // 요청 수가 수백 단위라 선형 탐색으로 충분 (뷰어가 움직이면 우선순위가 매번 바뀜)
+    uint32_t best = 0;
+    float bestP = 0.0f;
+    for (const auto& [id, e] : mEntries) {
+        if (e.state != StreamState::Queued) continue;
+        const float p = PriorityLocked(e);
+        if (!best || p < bestP || (p == bestP && id < best)) { best = id; bestP = p; }
+    }
+    return best;
+}
+
+// ---------------------------------------------------------------------------
+// 디코드 (I/O 스레드 또는 ioThreads == 0 일 때 Update)
+// ---------------------------------------------------------------------------
+void AssetStreamCore::DecodeOne(uint32_t id, const StreamRequest& req, const std::shared_ptr<std::atomic<bool>>& cancel)
+{
+    std::unique_ptr<StreamPayload> payload;
+    try { payload = mBackend->Decode(req, *cancel); }
+    catch (...) { payload.reset(); }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto it = mEntries.find(id);
+    if (it == mEntries.end() || cancel->load(std::memory_order_relaxed))
+        return;   // 디코드 중 취소됨 → payload 는 여기서 버려짐
+
+    Entry& e = it->second;
+    e.payload = std::move(payload);
+    e.state = e.payload ? StreamState::Decoded : StreamState::Failed;
+}
+
+void AssetStreamCore::IoMain()
+{
+    for (;;) {
+        uint32_t id = 0;
+        StreamRequest req;
+        std::shared_ptr<std::atomic<bool>> cancel;
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mCv.wait(lock, [&] { return mQuit || (id = PickQueuedLocked()) != 0; });
+            if (mQuit) return;
+
+            Entry& e = mEntries[id];
+            e.state = StreamState::Decoding;
+            req = e.req;
+            cancel = e.cancel;
+        }
+        DecodeOne(id, req, cancel);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// 업로드 (메인)
+// ---------------------------------------------------------------------------
+void AssetStreamCore::Update(const StreamBudget& budget)
+{
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point t0 = Clock::now();
+    auto elapsedMs = [&] { return std::chrono::duration<double, std::milli>(Clock::now() - t0).count(); };
+
+    mFrame.frameUploads = 0;
+    mFrame.frameBytes = 0;
+    if (!mBackend) { mFrame.frameMs = 0.0; return; }
+
+    // 스레드 없음: 여기서 가장 가까운 요청 하나만 디코드 (테스트/디버그용 결정적 경로)
+    if (mThreads.empty()) {
+        uint32_t id = 0;
+        StreamRequest req;
+        std::shared_ptr<std::atomic<bool>> cancel;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            id = PickQueuedLocked();
+            if (id) {
+                Entry& e = mEntries[id];
+                e.state = StreamState::Decoding;
+                req = e.req;
+                cancel = e.cancel;
+            }
+        }
+        if (id) DecodeOne(id, req, cancel);
+    }
+
+    // 디코드 끝난 것들을 가까운 순으로
+    struct Ready { uint32_t id; float priority; uint64_t bytes; };
+    std::vector<Ready> ready;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        for (const auto& [id, e] : mEntries)
+            if (e.state == StreamState::Decoded)
+                ready.push_back({ id, PriorityLocked(e), e.payload->uploadBytes });
+    }
+    std::sort(ready.begin(), ready.end(), [](const Ready& a, const Ready& b) {
+        return a.priority != b.priority ? a.priority < b.priority : a.id < b.id;
+        });
+
+    for (const Ready& r : ready) {
+        // 순서는 지킴: 가까운 큰 항목이 먼 작은 항목들에 계속 밀리지 않게 여기서 멈춤
+        if (mFrame.frameUploads > 0 &&
+            (mFrame.frameBytes + r.bytes > budget.bytesPerFrame || elapsedMs() >= budget.msPerFrame))
+            break;
+
+        // Decoded 항목은 메인 스레드만 건드림 → 페이로드를 꺼내고 락 없이 업로드
+        std::unique_ptr<StreamPayload> payload;
+        StreamRequest req;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            Entry& e = mEntries.at(r.id);
+            payload = std::move(e.payload);
+            req = e.req;
+        }
+
+        std::shared_ptr<StreamResource> res;
+        try { res = mBackend->Upload(req, *payload); }
+        catch (...) { res.reset(); }
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            Entry& e = mEntries.at(r.id);
+            e.resource = std::move(res);
+            e.state = e.resource ? StreamState::Resident : StreamState::Failed;
+        }
+        ++mFrame.frameUploads;
+        ++mFrame.totalUploads;
+        mFrame.frameBytes += r.bytes;
+    }
+    mFrame.frameMs = elapsedMs();
+}
+
+// ---------------------------------------------------------------------------
+// 조회
+// ---------------------------------------------------------------------------
+StreamState AssetStreamCore::State(StreamHandle h) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto it = mEntries.find(h.id);
+    return it == mEntries.end() ? StreamState::None : it->second.state;
+}
+
+std::shared_ptr<StreamResource> AssetStreamCore::Resource(StreamHandle h) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto it = mEntries.find(h.id);
+    return it == mEntries.end() ? nullptr : it->second.resource;
+}
+
+float AssetStreamCore::Priority(StreamHandle h) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto it = mEntries.find(h.id);
+    return it == mEntries.end() ? 0.0f : PriorityLocked(it->second);
+}
+
+StreamStats AssetStreamCore::Stats() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    StreamStats s = mFrame;
+    for (const auto& [id, e] : mEntries) {
+        switch (e.state) {
+        case StreamState::Queued:   ++s.queued; break;
+        case StreamState::Decoding: ++s.decoding; break;
+        case StreamState::Decoded:  ++s.decoded; break;
+        case StreamState::Resident: ++s.resident; s.residentBytes += e.resource->residentBytes; break;
+        case StreamState::Failed:   ++s.failed; break;
+        default: break;
+        }
+    }
+    return s;
+}
@@ -0,0 +1,156 @@
+﻿// ============================================================================
+// AssetStreamCore.h
+// - 실행 중 비동기 스트리밍 스케줄러 (D3D 없음 → 가짜 백엔드로 헤드리스 테스트 가능)
+//   · Request → 핸들을 바로 반환. 상태: Queued → Decoding → Decoded → Resident (또는 Failed)
+//   · 디코드(파일 I/O + 파싱/압축 해제): I/O 스레드에서 뷰어에 가까운 요청부터
+//   · 업로드(GPU 리소스 생성): Update 를 부르는 스레드에서, 프레임 예산(바이트/ms) 안에서 가까운 것부터
+//   · Cancel: 어느 단계든 바로 (디코드 중이면 끝난 결과를 버림)
+// - 실제 일은 IStreamBackend (AssetStreamer 가 D3D 백엔드)
+// - ioThreads = 0 이면 스레드 없이 Update 안에서 프레임당 1개 디코드 → 결정적 (테스트용)
+// - 스레드 규칙: I/O 스레드는 백엔드 Decode 만. 공개 함수는 전부 한 스레드(메인)에서
+// - 수학 라이브러리 의존 없음: 위치는 StreamFloat3 (SimpleMath 변환은 AssetStreamer 가)
+// ============================================================================
+
+#pragma once
+
+// ---- includes ----
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// None: 없는 핸들 / 취소(해제)됨
+enum class StreamState : uint8_t { None, Queued, Decoding, Decoded, Resident, Failed };
+
+const char* StreamStateName(StreamState s);
+
+// 우선순위 계산용 월드 위치
+struct StreamFloat3
+{
+    float x = 0.0f, y = 0.0f, z = 0.0f;
+};
+
+struct StreamHandle
+{
+    uint32_t id = 0;
+    bool Valid() const { return id != 0; }
+};
+
+struct StreamRequest
+{
+    uint32_t     kind = 0;      // 백엔드가 정의 (메시/스키닝/텍스처 ...)
+    std::wstring path;
+    std::wstring aux;           // 텍스처 폴더 등
+    StreamFloat3 position;
+    float        radius = 0.0f; // 우선순위 거리 = max(0, 중심 거리 - radius) + bias
+    float        bias = 0.0f;   // 음수면 먼저
+};
+
+// 디코드 결과 (I/O 스레드 → 업로드). uploadBytes 로 예산 계산
+struct StreamPayload
+{
+    virtual ~StreamPayload() = default;
+    uint64_t uploadBytes = 0;
+};
+
+// 업로드 결과 (상주 리소스)
+struct StreamResource
+{
+    virtual ~StreamResource() = default;
+    uint64_t residentBytes = 0;
+};
+
+class IStreamBackend
+{
+public:
+    virtual ~IStreamBackend() = default;
+
+    // I/O 스레드 (여러 개가 동시에). 실패는 nullptr 또는 예외. cancel 이 서면 일찍 끝내도 됨
+    virtual std::unique_ptr<StreamPayload> Decode(const StreamRequest& req, const std::atomic<bool>& cancel) = 0;
+
+    // Update 스레드. 끝나면 payload 는 버려짐. 실패는 nullptr 또는 예외
+    virtual std::shared_ptr<StreamResource> Upload(const StreamRequest& req, StreamPayload& payload) = 0;
+};
+
+// 프레임당 업로드 예산. 둘 중 하나라도 넘으면 다음 프레임으로
+//  - 예산보다 큰 항목도 프레임마다 최소 1개는 올림 (안 그러면 영영 못 올라감)
+struct StreamBudget
+{
+    uint64_t bytesPerFrame = 8ull << 20;
+    double   msPerFrame = 2.0;
+};
+
+struct StreamStats
+{
+    uint32_t queued = 0, decoding = 0, decoded = 0, resident = 0, failed = 0;
+    uint64_t residentBytes = 0;
+
+    // 마지막 Update
+    uint32_t frameUploads = 0;
+    uint64_t frameBytes = 0;
+    double   frameMs = 0.0;
+
+    // 누적
+    uint64_t totalUploads = 0;
+    uint64_t totalCancelled = 0;
+};
+
+class AssetStreamCore
+{
+public:
+    AssetStreamCore() = default;
+    ~AssetStreamCore();
+
+    AssetStreamCore(const AssetStreamCore&) = delete;
+    AssetStreamCore& operator=(const AssetStreamCore&) = delete;
+
+    // backend 는 Stop 까지 살아 있어야 함
+    void Start(IStreamBackend* backend, unsigned ioThreads);
+    void Stop();    // I/O 스레드 합류 + 전부 해제
+
+    StreamHandle Request(const StreamRequest& req);
+    void Cancel(StreamHandle h);    // 어느 상태든 취소/해제 → 이후 State 는 None
+
+    void SetViewer(const StreamFloat3& pos);
+    void SetPosition(StreamHandle h, const StreamFloat3& pos);
+
+    // 프레임마다: (ioThreads == 0 이면 여기서 디코드 1개) → 예산 안에서 가까운 것부터 업로드
+    void Update(const StreamBudget& budget);
+
+    StreamState State(StreamHandle h) const;
+    std::shared_ptr<StreamResource> Resource(StreamHandle h) const;   // Resident 가 아니면 null
+    float Priority(StreamHandle h) const;                              // 작을수록 먼저
+    StreamStats Stats() const;
+
+private:
+    struct Entry
+    {
+        StreamRequest req;
+        StreamState   state = StreamState::Queued;
+        std::shared_ptr<std::atomic<bool>> cancel;
+        std::unique_ptr<StreamPayload>     payload;
+        std::shared_ptr<StreamResource>    resource;
+    };
+
+    float PriorityLocked(const Entry& e) const;
+    uint32_t PickQueuedLocked() const;          // 0 = 없음
+    // 뽑은 요청 하나 디코드 (락 밖) → 결과 반영. 취소됐으면 버림
+    void DecodeOne(uint32_t id, const StreamRequest& req, const std::shared_ptr<std::atomic<bool>>& cancel);
+    void IoMain();
+
+    IStreamBackend*                    mBackend = nullptr;
+    std::vector<std::thread>           mThreads;
+    mutable std::mutex                 mMutex;
+    std::condition_variable            mCv;
+    bool                               mQuit = false;
+
+    std::unordered_map<uint32_t, Entry> mEntries;
+    uint32_t                           mNextId = 1;
+    StreamFloat3                       mViewer;
+    StreamStats                        mFrame;  // frame* / total* 만 사용
+};
@@ -0,0 +1,352 @@
+﻿// ============================================================================
+// AssetStreamer.cpp
+// - AssetStreamer 구현: D3D 백엔드 (디코드 / 업로드) + 대체 리소스
+// ============================================================================
+
+// ---- includes ----
+#include "../D3D_Core/pch.h"
+#include "AssetStreamer.h"
+#include "../D3D_Core/Helper.h"
+#include "AssimpImporterEX.h"
+#include "MeshCook.h"
+#include "SkeletalCook.h"
+#include "SkinnedSkeletal.h"
+
+#include <DirectXTex.h>
+
+using Microsoft::WRL::ComPtr;
+using DirectX::SimpleMath::Vector3;
+
+namespace
+{
+    enum StreamKind : uint32_t
+    {
+        Kind_StaticMesh = 1,
+        Kind_Skinned,
+        Kind_Texture,
+    };
+
+    // ---- 디코드 결과 (I/O 스레드) ----
+    struct MeshPayload : StreamPayload
+    {
+        CookedMesh    cooked;       // 쿠킹 파일 매핑 (보통)
+        MeshData_PNTT cpu;          // 쿠킹 실패 시 Assimp 결과
+        bool          useCooked = false;
+        std::vector<MaterialDecoded> materials;
+    };
+
+    struct SkinnedPayload : StreamPayload
+    {
+        SkelCookData data;
+        std::vector<MaterialDecoded> materials;
+    };
+
+    struct TexturePayload : StreamPayload
+    {
+        DirectX::ScratchImage image;
+    };
+
+    // ---- 상주 리소스 ----
+    struct MeshResource : StreamResource
+    {
+        StaticMesh mesh;
+        std::vector<MaterialGPU> materials;
+    };
+
+    struct SkinnedResource : StreamResource
+    {
+        std::unique_ptr<SkinnedSkeletal> model;
+    };
+
+    struct TextureResource : StreamResource
+    {
+        ComPtr<ID3D11ShaderResourceView> srv;
+    };
+
+    // WIC 디코드는 COM 필요 → I/O 스레드에서 호출마다 MTA (이미 초기화돼 있으면 참조만)
+    struct ComScope
+    {
+#ifdef _WIN32
+        HRESULT hr = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+        ~ComScope() { if (SUCCEEDED(hr)) CoUninitialize(); }
+#endif
+    };
+
+    // 머티리얼 텍스처 디코드. 취소되면 false
+    //  - used 가 있으면 false 인 항목은 빈 채로 둠 (FromCookData 가 빌드 안 하는 머티리얼)
+    bool DecodeMaterials(const std::vector<MaterialCPU>& src, const std::wstring& texDir,
+        const std::atomic<bool>& cancel, std::vector<MaterialDecoded>& out, uint64_t& bytes,
+        const std::vector<bool>* used = nullptr)
+    {
+        out.clear();
+        out.resize(src.size());
+        for (size_t i = 0; i < src.size(); ++i) {
+            if (used && !(*used)[i]) continue;
+            if (cancel.load(std::memory_order_relaxed)) return false;
+            out[i] = MaterialDecode(src[i], texDir);
+            bytes += out[i].Bytes();
+        }
+        return true;
+    }
+
+    // 정점 스트림 + 인덱스 (VB/IB 생성 바이트)
+    uint64_t StaticGeometryBytes(uint64_t vertexCount, uint64_t indexCount)
+    {
+        return vertexCount * (sizeof(VertexStreamPos_PNTT) + sizeof(VertexStreamAttr)) + indexCount * sizeof(uint32_t);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Backend
+// ---------------------------------------------------------------------------
+class AssetStreamer::Backend final : public IStreamBackend
+{
+public:
+    explicit Backend(ID3D11Device* dev) : mDev(dev) {}
+
+    std::unique_ptr<StreamPayload> Decode(const StreamRequest& req, const std::atomic<bool>& cancel) override
+    {
+        ComScope com;
+        switch (req.kind) {
+        case Kind_StaticMesh: return DecodeStatic(req, cancel);
+        case Kind_Skinned:    return DecodeSkinned(req, cancel);
+        case Kind_Texture:    return DecodeTexture(req);
+        default:              return nullptr;
+        }
+    }
+
+    std::shared_ptr<StreamResource> Upload(const StreamRequest& req, StreamPayload& payload) override
+    {
+        switch (req.kind) {
+        case Kind_StaticMesh: return UploadStatic(static_cast<MeshPayload&>(payload));
+        case Kind_Skinned:    return UploadSkinned(static_cast<SkinnedPayload&>(payload));
+        case Kind_Texture:    return UploadTexture(static_cast<TexturePayload&>(payload));
+        default:              return nullptr;
+        }
+    }
+
+private:
+    // ---- 정적 메시: InitScene 과 같은 플래그로 쿠킹 캐시 → 실패하면 Assimp ----
+    std::unique_ptr<StreamPayload> DecodeStatic(const StreamRequest& req, const std::atomic<bool>& cancel)
+    {
+        auto p = std::make_unique<MeshPayload>();
+        const std::vector<MaterialCPU>* mats = nullptr;
+
+        if (AssimpImporterEx::LoadCooked_PNTT(req.path, p->cooked, /*flipUV*/true, /*leftHanded*/true)) {
+            p->useCooked = true;
+            const MeshCookView& v = p->cooked.View();
+            p->uploadBytes = StaticGeometryBytes(v.vertexCount, v.indexCount);
+            mats = &p->cooked.Materials();
+        }
+        else if (AssimpImporterEx::LoadFBX_PNTT_AndMaterials(req.path, p->cpu, /*flipUV*/true, /*leftHanded*/true)) {
+            p->uploadBytes = StaticGeometryBytes(p->cpu.vertices.size(), p->cpu.indices.size());
+            mats = &p->cpu.materials;
+        }
+        else return nullptr;
+
+        if (!DecodeMaterials(*mats, req.aux, cancel, p->materials, p->uploadBytes)) return nullptr;
+        return p;
+    }
+
+    std::shared_ptr<StreamResource> UploadStatic(MeshPayload& p)
+    {
+        auto r = std::make_shared<MeshResource>();
+        const bool ok = p.useCooked ? r->mesh.Build(mDev, p.cooked.View()) : r->mesh.Build(mDev, p.cpu);
+        if (!ok) return nullptr;
+
+        r->materials.resize(p.materials.size());
+        for (size_t i = 0; i < p.materials.size(); ++i)
+            r->materials[i].Build(mDev, p.materials[i]);
+        r->residentBytes = p.uploadBytes;
+        return r;
+    }
+
+    // ---- 스키닝: .skelcook (없으면 임포트 + 쿠킹) ----
+    std::unique_ptr<StreamPayload> DecodeSkinned(const StreamRequest& req, const std::atomic<bool>& cancel)
+    {
+        auto p = std::make_unique<SkinnedPayload>();
+        if (!SkelCookLoadOrImport(req.path, SkinnedSkeletal::kCookFlags,
+            [&](SkelCookData& out) { SkinnedSkeletal::ImportFBX(req.path, out); }, p->data))
+            return nullptr;
+
+        // 서브메시가 쓰는 머티리얼만, 모델당 1번 (FromCookData 와 같은 규칙)
+        const std::vector<bool> used = SkelCookUsedMaterials(p->data);
+        if (!DecodeMaterials(p->data.materials, req.aux, cancel, p->materials, p->uploadBytes, &used)) return nullptr;
+
+        for (const SkelCookPart& part : p->data.parts)
+            p->uploadBytes += (uint64_t)part.vertexCount * (sizeof(VertexStreamPos_PNTT_BW) + sizeof(VertexStreamAttr))
+            + (uint64_t)part.indexCount * sizeof(uint32_t);
+        return p;
+    }
+
+    std::shared_ptr<StreamResource> UploadSkinned(SkinnedPayload& p)
+    {
+        auto r = std::make_shared<SkinnedResource>();
+        r->model = SkinnedSkeletal::FromCookData(mDev, p.data, p.materials);
+        r->residentBytes = p.uploadBytes;
+        return r;
+    }
+
+    // ---- 텍스처 ----
+    std::unique_ptr<StreamPayload> DecodeTexture(const StreamRequest& req)
+    {
+        auto p = std::make_unique<TexturePayload>();
+        if (FAILED(DecodeTextureFromFile(req.path.c_str(), p->image))) return nullptr;
+        p->uploadBytes = p->image.GetPixelsSize();
+        return p;
+    }
+
+    std::shared_ptr<StreamResource> UploadTexture(TexturePayload& p)
+    {
+        auto r = std::make_shared<TextureResource>();
+        if (FAILED(CreateTextureFromImage(mDev, p.image, r->srv.GetAddressOf()))) return nullptr;
+        r->residentBytes = p.uploadBytes;
+        return r;
+    }
+
+    ID3D11Device* mDev = nullptr;
+};
+
+// ---------------------------------------------------------------------------
+// 수명 + 대체 리소스
+// ---------------------------------------------------------------------------
+AssetStreamer::~AssetStreamer()
+{
+    Shutdown();
+}
+
+bool AssetStreamer::Init(ID3D11Device* dev, unsigned ioThreads)
+{
+    Shutdown();
+
+    // 단위 큐브: 면마다 (n, b) 에서 t = n × b → 바깥에서 봤을 때 시계 방향
+    MeshData_PNTT cube;
+    const Vector3 faces[6][2] = {
+        { { 1, 0, 0 }, { 0, 1, 0 } }, { { -1, 0, 0 }, { 0, 1, 0 } },
+        { { 0, 1, 0 }, { 0, 0, 1 } }, { { 0, -1, 0 }, { 0, 0, -1 } },
+        { { 0, 0, 1 }, { 0, 1, 0 } }, { { 0, 0, -1 }, { 0, 1, 0 } },
+    };
+    for (const auto& f : faces) {
+        const Vector3 n = f[0], b = f[1], t = n.Cross(b);
+        const uint32_t base = (uint32_t)cube.vertices.size();
+        const float corner[4][2] = { { -1, -1 }, { -1, 1 }, { 1, 1 }, { 1, -1 } };   // (t, b)
+        for (const auto& c : corner) {
+            const Vector3 p = (n + t * c[0] + b * c[1]) * 0.5f;
+            VertexCPU_PNTT v{};
+            v.px = p.x; v.py = p.y; v.pz = p.z;
+            v.nx = n.x; v.ny = n.y; v.nz = n.z;
+            v.u = c[0] * 0.5f + 0.5f; v.v = 0.5f - c[1] * 0.5f;
+            v.tx = t.x; v.ty = t.y; v.tz = t.z; v.tw = 1.0f;
+            cube.vertices.push_back(v);
+        }
+        for (uint32_t i : { 0u, 1u, 2u, 0u, 2u, 3u }) cube.indices.push_back(base + i);
+    }
+    SubMeshCPU sm;
+    sm.indexCount = (uint32_t)cube.indices.size();
+    cube.submeshes.push_back(sm);
+    if (!mPlaceholderMesh.Build(dev, cube)) return false;
+
+    MaterialCPU gray;
+    gray.diffuseColor[0] = gray.diffuseColor[1] = gray.diffuseColor[2] = 0.5f;
+    mPlaceholderMtls.resize(1);
+    mPlaceholderMtls[0].Build(dev, gray, L"");
+
+    // 1x1 흰색
+    const uint32_t white = 0xFFFFFFFFu;
+    D3D11_TEXTURE2D_DESC td{};
+    td.Width = td.Height = 1;
+    td.MipLevels = td.ArraySize = 1;
+    td.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    td.SampleDesc.Count = 1;
+    td.Usage = D3D11_USAGE_IMMUTABLE;
+    td.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+    D3D11_SUBRESOURCE_DATA init{ &white, sizeof(white), 0 };
+    ComPtr<ID3D11Texture2D> tex;
+    if (FAILED(dev->CreateTexture2D(&td, &init, tex.GetAddressOf()))) return false;
+    if (FAILED(dev->CreateShaderResourceView(tex.Get(), nullptr, mPlaceholderTex.GetAddressOf()))) return false;
+
+    mBackend = std::make_unique<Backend>(dev);
+    mCore.Start(mBackend.get(), ioThreads);
+    return true;
+}
+
+void AssetStreamer::Shutdown()
+{
+    mCore.Stop();           // I/O 스레드가 백엔드를 쓰는 중일 수 있음 → 먼저
+    mBackend.reset();
+    mPlaceholderMesh = StaticMesh{};
+    mPlaceholderMtls.clear();
+    mPlaceholderTex.Reset();
+}
+
+// ---------------------------------------------------------------------------
+// 요청 / 프레임
+// ---------------------------------------------------------------------------
+StreamHandle AssetStreamer::RequestStaticMesh(const std::wstring& fbx, const std::wstring& texDir, const Vector3& pos, float radius)
+{
+    StreamRequest r;
+    r.kind = Kind_StaticMesh;
+    r.path = fbx;
+    r.aux = texDir;
+    r.position = { pos.x, pos.y, pos.z };
+    r.radius = radius;
+    return mCore.Request(r);
+}
+
+StreamHandle AssetStreamer::RequestSkinned(const std::wstring& fbx, const std::wstring& texDir, const Vector3& pos, float radius)
+{
+    StreamRequest r;
+    r.kind = Kind_Skinned;
+    r.path = fbx;
+    r.aux = texDir;
+    r.position = { pos.x, pos.y, pos.z };
+    r.radius = radius;
+    return mCore.Request(r);
+}
+
+StreamHandle AssetStreamer::RequestTexture(const std::wstring& path, const Vector3& pos, float radius)
+{
+    StreamRequest r;
+    r.kind = Kind_Texture;
+    r.path = path;
+    r.position = { pos.x, pos.y, pos.z };
+    r.radius = radius;
+    return mCore.Request(r);
+}
+
+void AssetStreamer::Update(const Vector3& viewer, const StreamBudget& budget)
+{
+    if (!mBackend) return;
+    mCore.SetViewer({ viewer.x, viewer.y, viewer.z });
+    mCore.Update(budget);
+}
+
+// ---------------------------------------------------------------------------
+// 조회 (준비 전이면 대체 리소스)
+// ---------------------------------------------------------------------------
+AssetStreamer::MeshView AssetStreamer::StaticMeshView(StreamHandle h)
+{
+    MeshView v;
+    // 리소스는 Cancel/Shutdown 전까지 코어가 들고 있음 → raw 포인터로 넘겨도 됨
+    if (auto* r = dynamic_cast<MeshResource*>(mCore.Resource(h).get())) {
+        v.mesh = &r->mesh;
+        v.materials = &r->materials;
+        v.placeholder = false;
+        return v;
+    }
+    v.mesh = &mPlaceholderMesh;
+    v.materials = &mPlaceholderMtls;
+    return v;
+}
+
+SkinnedSkeletal* AssetStreamer::Skinned(StreamHandle h) const
+{
+    auto* r = dynamic_cast<SkinnedResource*>(mCore.Resource(h).get());
+    return r ? r->model.get() : nullptr;
+}
+
+ID3D11ShaderResourceView* AssetStreamer::Texture(StreamHandle h) const
+{
+    auto* r = dynamic_cast<TextureResource*>(mCore.Resource(h).get());
+    return r ? r->srv.Get() : mPlaceholderTex.Get();
+}
@@ -0,0 +1,82 @@
+﻿// ============================================================================
+// AssetStreamer.h
+// - 실행 중 비동기 로드 API: 정적 메시 / 스키닝 모델 / 텍스처 (AssetStreamCore + D3D 백엔드)
+//   · Request* 는 핸들을 바로 반환. 준비될 때까지 대체 리소스로 그림
+//     - 정적 메시: 단위 큐브([-0.5, 0.5]^3) + 회색 머티리얼 (MeshView.placeholder)
+//     - 텍스처: 1x1 흰색 SRV
+//     - 스키닝: Skinned() 가 null → 호출 쪽이 PlaceholderMesh 로 대신 그림
+//   · I/O 스레드: 쿠킹 파일 매핑 (없으면 Assimp 임포트 + 쿠킹) + 텍스처 디코드 (디바이스 없음)
+//   · Update (메인): 프레임 예산 안에서 버퍼/SRV 생성만 (즉시 컨텍스트 안 씀)
+// - 얻은 포인터는 그 핸들을 Cancel 하거나 Shutdown 할 때까지 유효
+// ============================================================================
+
+#pragma once
+
+// ---- includes ----
+#include <memory>
+#include <string>
+#include <vector>
+#include <d3d11.h>
+#include <wrl/client.h>
+#include <directxtk/SimpleMath.h>
+
+#include "AssetStreamCore.h"
+#include "StaticMesh.h"
+#include "Material.h"
+
+class SkinnedSkeletal;
+
+class AssetStreamer
+{
+public:
+    AssetStreamer() = default;
+    ~AssetStreamer();
+
+    AssetStreamer(const AssetStreamer&) = delete;
+    AssetStreamer& operator=(const AssetStreamer&) = delete;
+
+    // 대체 리소스 생성 + I/O 스레드 시작
+    bool Init(ID3D11Device* dev, unsigned ioThreads = 2);
+    void Shutdown();
+
+    // pos/radius: 우선순위 (뷰어에서 표면까지 거리, 가까울수록 먼저)
+    StreamHandle RequestStaticMesh(const std::wstring& fbx, const std::wstring& texDir,
+        const DirectX::SimpleMath::Vector3& pos, float radius = 0.0f);
+    StreamHandle RequestSkinned(const std::wstring& fbx, const std::wstring& texDir,
+        const DirectX::SimpleMath::Vector3& pos, float radius = 0.0f);
+    StreamHandle RequestTexture(const std::wstring& path,
+        const DirectX::SimpleMath::Vector3& pos, float radius = 0.0f);
+
+    void Cancel(StreamHandle h) { mCore.Cancel(h); }
+    void SetPosition(StreamHandle h, const DirectX::SimpleMath::Vector3& pos) { mCore.SetPosition(h, { pos.x, pos.y, pos.z }); }
+
+    // 프레임마다 (OnUpdate): 뷰어 위치 갱신 → 예산 안에서 업로드
+    void Update(const DirectX::SimpleMath::Vector3& viewer, const StreamBudget& budget);
+
+    struct MeshView
+    {
+        StaticMesh*                     mesh = nullptr;
+        const std::vector<MaterialGPU>* materials = nullptr;
+        bool                            placeholder = true;
+    };
+    MeshView                  StaticMeshView(StreamHandle h);      // 준비 전이면 대체 큐브
+    SkinnedSkeletal*          Skinned(StreamHandle h) const;       // 준비 전이면 null
+    ID3D11ShaderResourceView* Texture(StreamHandle h) const;       // 준비 전이면 1x1
+
+    StaticMesh&                     PlaceholderMesh() { return mPlaceholderMesh; }
+    const std::vector<MaterialGPU>& PlaceholderMaterials() const { return mPlaceholderMtls; }
+
+    StreamState State(StreamHandle h) const { return mCore.State(h); }
+    float       Priority(StreamHandle h) const { return mCore.Priority(h); }
+    StreamStats Stats() const { return mCore.Stats(); }
+
+private:
+    class Backend;
+
+    std::unique_ptr<Backend> mBackend;
+    AssetStreamCore          mCore;      // mBackend 보다 먼저 멈춰야 함 (Shutdown)
+
+    StaticMesh               mPlaceholderMesh;
+    std::vector<MaterialGPU> mPlaceholderMtls;
+    Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> mPlaceholderTex;
+};
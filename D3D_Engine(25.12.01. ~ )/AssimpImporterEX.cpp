@@ -8,6 +8,10 @@
 // AssimpImporterEx.cpp
 #include "../D3D_Core/pch.h"
 #include "AssimpImporterEx.h"
+#include "MeshCook.h"
+#include "MeshLod.h"
+#include "MeshOptimize.h"
+#include "VertexPack.h"
 
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
@@ -27,7 +31,6 @@ namespace
 		unsigned f =
 			aiProcess_Triangulate |
 			aiProcess_JoinIdenticalVertices |
-			aiProcess_ImproveCacheLocality |
 			aiProcess_SortByPType |
 			aiProcess_CalcTangentSpace |
 			aiProcess_GenNormals |
@@ -155,7 +158,7 @@ namespace
 // Load FBX: Mesh(PNTT) + Materials
 // ----------------------------------------------------------------------------
 bool AssimpImporterEx::LoadFBX_PNTT_AndMaterials(
-	const std::wstring& pathW, MeshData_PNTT& out, bool flipUV, bool leftHanded)
+	const std::wstring& pathW, MeshData_PNTT& out, bool flipUV, bool leftHanded, MeshImportReport* report)
 {
 	const std::string pathA(pathW.begin(), pathW.end());
 
@@ -252,9 +255,53 @@ bool AssimpImporterEx::LoadFBX_PNTT_AndMaterials(
 		out.submeshes.push_back(sm);
 	}
 
+// ----------------------------------------------------------------------------
+	// 3) 정점 캐시 / 오버드로 / fetch 순서 (서브메시 단위, 쿠킹 파일에도 이 순서로 저장)
+// ----------------------------------------------------------------------------
+	MeshOptReport optReport;
+	MeshOptimize(out.vertices, out.indices, out.submeshes, &optReport);
+	if (report) report->opt.Merge(optReport);
+	else MeshOptAddToTotals(optReport);
+
+// ----------------------------------------------------------------------------
+	// 4) LOD1~3 (정점 버퍼 공유, 인덱스만 뒤에 덧붙임 → out.lods)
+// ----------------------------------------------------------------------------
+	MeshLodReport lodReport;
+	MeshLodGenerate(out.vertices, out.indices, out.submeshes, out.lods, &lodReport);
+	if (report) report->lod.Merge(lodReport);
+	else MeshLodAddToTotals(lodReport);
+
 	return true;
 }
 
+// ----------------------------------------------------------------------------
+// Cooked mesh: mmap 캐시 → 없거나 낡았으면 Assimp 경로로 쿠킹
+// ----------------------------------------------------------------------------
+bool AssimpImporterEx::LoadCooked_PNTT(
+	const std::wstring& pathW, CookedMesh& out, bool flipUV, bool leftHanded, bool* fromCache, MeshImportReport* report)
+{
+	const uint32_t flags = (flipUV ? MeshCook_FlipUV : 0u) | (leftHanded ? MeshCook_LeftHanded : 0u);
+	const uint64_t hash = MeshCookSourceHash(pathW, flags);
+	if (hash == 0) return false; // 원본 없음
+
+	const path cookPath = path(pathW).replace_extension(L".meshcook");
+	if (fromCache) *fromCache = false;
+
+	if (out.Open(cookPath, hash)) {
+		if (fromCache) *fromCache = true;
+		return true;
+	}
+
+	// 압축 왕복 오차는 쿠킹할 때만 알 수 있으므로 여기서 합계에 누적
+	MeshData_PNTT cpu;
+	if (!LoadFBX_PNTT_AndMaterials(pathW, cpu, flipUV, leftHanded, report)) return false;
+	VertexPackReport packReport;
+	if (!MeshCookSave(cpu, hash, flags, cookPath, &packReport)) return false;
+	if (report) report->pack.Merge(packReport);
+	else VertexPackAddToTotals(packReport);
+	return out.Open(cookPath, hash);
+}
+
 // ----------------------------------------------------------------------------
 // Convert a single aiMesh -> MeshData_PNTT (one submesh)
 // ----------------------------------------------------------------------------
@@ -331,6 +378,10 @@ void AssimpImporterEx::ConvertAiMeshToPNTT(const aiMesh* am, MeshData_PNTT& out)
 	sm.indexCount = static_cast<uint32_t>(out.indices.size());
 	sm.materialIndex = am->mMaterialIndex;
 	out.submeshes.push_back(sm);
+
+	MeshOptReport optReport;
+	MeshOptimize(out.vertices, out.indices, out.submeshes, &optReport);
+	MeshOptAddToTotals(optReport);
 }
 
 // ----------------------------------------------------------------------------
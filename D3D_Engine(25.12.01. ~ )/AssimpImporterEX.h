@@ -8,18 +8,44 @@
 #pragma once
 #include <string>
 #include "MeshDataEx.h"
+#include "MeshOptimize.h"
+#include "MeshLod.h"
+#include "VertexPack.h"
+
+class CookedMesh;
 
 // Assimp 전방 선언(헤더 의존 최소화)
 struct aiScene;
 struct aiMesh;
 
+// 임포트 한 번의 최적화 / LOD / 정점 압축 통계
+//  - 로더에 넘기면 전역 합계 (MeshOptTotals 등) 대신 여기에 누적 (측정용 임포트가 합계에 섞이지 않게)
+struct MeshImportReport
+{
+    MeshOptReport opt;
+    MeshLodReport lod;
+    VertexPackReport pack;
+};
+
 class AssimpImporterEx {
 public:
     static bool LoadFBX_PNTT_AndMaterials(
         const std::wstring& path,
         MeshData_PNTT& out,
         bool flipUV = false,
-        bool leftHanded = true);
+        bool leftHanded = true,
+        MeshImportReport* report = nullptr);
+
+    // <path>.meshcook 이 유효하면 매핑만 (Assimp 미사용), 아니면 임포트 → 쿠킹 → 매핑
+    //  - fromCache: 쿠킹 파일을 그대로 썼는지
+    //  - report: LoadFBX_PNTT_AndMaterials 와 같음 (쿠킹할 때만 채워짐)
+    static bool LoadCooked_PNTT(
+        const std::wstring& path,
+        CookedMesh& out,
+        bool flipUV = false,
+        bool leftHanded = true,
+        bool* fromCache = nullptr,
+        MeshImportReport* report = nullptr);
 
     static void ConvertAiMeshToPNTT(const aiMesh* am, MeshData_PNTT& out);
 
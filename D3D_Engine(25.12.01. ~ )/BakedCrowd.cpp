@@ -0,0 +1,109 @@
+﻿// ============================================================================
+// BakedCrowd.cpp
+// - BakedCrowd 구현: 베이크 표 SRV / 인스턴스 VB / 파트 오프셋 CB
+// ============================================================================
+
+// ---- includes ----
+
+#include "../D3D_Core/pch.h"
+#include "BakedCrowd.h"
+#include "Animation/AnimBake.h"
+
+#include <cstring>
+
+static_assert(sizeof(BakedCrowd::Instance) == 64, "VertexShaderCrowd expects 64-byte instance records");
+
+bool BakedCrowd::Create(ID3D11Device* dev, const AnimBakedSet& set, UINT maxInstances)
+{
+    Release();
+    if (set.Empty() || maxInstances == 0) return false;
+
+    D3D11_BUFFER_DESC bd{};
+    bd.ByteWidth = (UINT)set.Bytes();
+    bd.Usage = D3D11_USAGE_IMMUTABLE;
+    bd.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+    D3D11_SUBRESOURCE_DATA sd{ set.rows.data(), 0, 0 };
+    if (FAILED(dev->CreateBuffer(&bd, &sd, mRows.GetAddressOf()))) { Release(); return false; }
+
+    D3D11_SHADER_RESOURCE_VIEW_DESC vd{};
+    vd.Format = DXGI_FORMAT_R32G32B32A32_FLOAT;
+    vd.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
+    vd.Buffer.FirstElement = 0;
+    vd.Buffer.NumElements = (UINT)(set.rows.size() / 4);
+    if (FAILED(dev->CreateShaderResourceView(mRows.Get(), &vd, mSRV.GetAddressOf()))) { Release(); return false; }
+
+    D3D11_BUFFER_DESC ib{};
+    ib.ByteWidth = maxInstances * InstanceStride();
+    ib.Usage = D3D11_USAGE_DYNAMIC;
+    ib.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+    ib.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+    if (FAILED(dev->CreateBuffer(&ib, nullptr, mInstVB.GetAddressOf()))) { Release(); return false; }
+
+    D3D11_BUFFER_DESC cb{};
+    cb.ByteWidth = 16;
+    cb.Usage = D3D11_USAGE_DYNAMIC;
+    cb.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+    cb.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+    if (FAILED(dev->CreateBuffer(&cb, nullptr, mPartCB.GetAddressOf()))) { Release(); return false; }
+
+    mBoneCount = set.boneCount;
+    mMaxInstances = maxInstances;
+    mStats = Stats{};
+    mStats.tableBytes = bd.ByteWidth;
+    return true;
+}
+
+void BakedCrowd::Release()
+{
+    mRows.Reset(); mSRV.Reset(); mInstVB.Reset(); mPartCB.Reset();
+    mBoneCount = mMaxInstances = mCount = 0;
+    mBoundPart = ~0u;
+}
+
+UINT BakedCrowd::Upload(ID3D11DeviceContext* ctx, const Instance* inst, UINT count)
+{
+    mCount = 0;
+    if (!Ready()) return 0;
+    if (count > mMaxInstances) count = mMaxInstances;
+
+    if (count > 0) {
+        D3D11_MAPPED_SUBRESOURCE m{};
+        if (FAILED(ctx->Map(mInstVB.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &m))) return 0;
+        memcpy(m.pData, inst, (size_t)count * InstanceStride());
+        ctx->Unmap(mInstVB.Get(), 0);
+    }
+
+    mCount = count;
+    mStats.instances = count;
+    mStats.uploadBytes = (uint64_t)count * InstanceStride();
+    return count;
+}
+
+void BakedCrowd::BindPart(ID3D11DeviceContext* ctx, UINT partNode)
+{
+    if (!Ready()) return;
+
+    if (partNode != mBoundPart) {
+        D3D11_MAPPED_SUBRESOURCE m{};
+        if (SUCCEEDED(ctx->Map(mPartCB.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &m))) {
+            // 프레임 안에서 본 팔레트 뒤에 노드 글로벌이 이어진다 (AnimBakedSet 레이아웃)
+            const UINT cb[4] = { (mBoneCount + partNode) * 3, 0, 0, 0 };
+            memcpy(m.pData, cb, sizeof(cb));
+            ctx->Unmap(mPartCB.Get(), 0);
+            mBoundPart = partNode;
+        }
+    }
+
+    ID3D11ShaderResourceView* srv = mSRV.Get();
+    ID3D11Buffer* cb = mPartCB.Get();
+    ctx->VSSetShaderResources(11, 1, &srv);     // t11
+    ctx->VSSetConstantBuffers(4, 1, &cb);       // b4
+}
+
+void BakedCrowd::Unbind(ID3D11DeviceContext* ctx) const
+{
+    // 팔레트 링과 같은 슬롯이라 다음 스키닝 드로우가 다시 바인딩한다. 여기선 IA 슬롯 2만 정리
+    ID3D11Buffer* nullVB = nullptr;
+    UINT zero = 0;
+    ctx->IASetVertexBuffers(2, 1, &nullVB, &zero, &zero);
+}
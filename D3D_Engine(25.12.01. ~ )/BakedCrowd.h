@@ -0,0 +1,70 @@
+﻿// ============================================================================
+// BakedCrowd.h
+// - 베이크된 애니메이션 표(AnimBakedSet)로 그리는 인스턴싱 군중
+//   · 표 전체를 IMMUTABLE Buffer<float4> 로 한 번 올림 (VS t11, BonePaletteRing 과 같은 자리/형식)
+//   · 인스턴스마다 64B 레코드(월드 3행 + 프레임 A/B 행 + 보간 계수)만 매 프레임 DISCARD 업로드
+//   · 파트 글로벌 행 오프셋은 16B CB(b4)로 → VertexShaderCrowd.hlsl
+//   · 포즈 평가 / 팔레트 업로드 / 스킨 캐시 모두 없음
+// ============================================================================
+
+// ---- includes ----
+
+#pragma once
+#include <d3d11.h>
+#include <wrl/client.h>
+#include <cstdint>
+#include <vector>
+
+struct AnimBakedSet;
+
+class BakedCrowd {
+public:
+    // IA 슬롯 2 (D3D11_INPUT_PER_INSTANCE_DATA, 0/1 은 메시 분리 스트림). VertexShaderCrowd.hlsl 의 INST* 와 맞출 것
+    struct Instance {
+        float    world[3][4];   // 전치된 월드의 앞 3행
+        uint32_t rowA = 0;      // AnimBakedSet::Locate 결과
+        uint32_t rowB = 0;
+        float    blend = 0.0f;
+        uint32_t pad = 0;
+    };
+
+    struct Stats {
+        uint32_t instances = 0;     // 마지막 Upload 인스턴스 수
+        uint32_t drawCalls = 0;     // 마지막 프레임 DrawIndexedInstanced 수
+        uint64_t uploadBytes = 0;   // 마지막 Upload 바이트 (인스턴스 레코드)
+        uint64_t tableBytes = 0;    // 상주 표 크기
+    };
+
+public:
+    bool Create(ID3D11Device* dev, const AnimBakedSet& set, UINT maxInstances);
+    void Release();
+    bool Ready() const { return mRows != nullptr; }
+
+    // 인스턴스 레코드 업로드 (maxInstances 로 잘림) → 실제 수 반환
+    UINT Upload(ID3D11DeviceContext* ctx, const Instance* inst, UINT count);
+
+    // t11(표) + b4(파트 글로벌 행 오프셋) 바인딩. partNode: 베이크 노드 목록 안 인덱스
+    void BindPart(ID3D11DeviceContext* ctx, UINT partNode);
+    void Unbind(ID3D11DeviceContext* ctx) const;
+
+    ID3D11Buffer* InstanceBuffer() const { return mInstVB.Get(); }
+    static constexpr UINT InstanceStride() { return sizeof(Instance); }
+    UINT InstanceCount() const { return mCount; }
+    UINT MaxInstances() const { return mMaxInstances; }
+
+    void CountDraw() { ++mStats.drawCalls; }
+    void BeginFrame() { mStats.drawCalls = 0; }
+    const Stats& GetStats() const { return mStats; }
+
+private:
+    Microsoft::WRL::ComPtr<ID3D11Buffer>             mRows;     // float4 x (프레임 x RowsPerFrame), IMMUTABLE
+    Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> mSRV;
+    Microsoft::WRL::ComPtr<ID3D11Buffer>             mInstVB;   // Instance x maxInstances, DYNAMIC
+    Microsoft::WRL::ComPtr<ID3D11Buffer>             mPartCB;   // uint PartRow (+pad), DYNAMIC
+
+    UINT mBoneCount = 0;
+    UINT mMaxInstances = 0;
+    UINT mCount = 0;
+    UINT mBoundPart = ~0u;
+    Stats mStats;
+};
@@ -0,0 +1,152 @@
+﻿// ============================================================================
+// BonePaletteRing.cpp
+// - BonePaletteRing 구현: 동적 링 버퍼 업로드/바인딩
+// ============================================================================
+
+// ---- includes ----
+
+#include "../D3D_Core/pch.h"
+#include "BonePaletteRing.h"
+#include "Animation/AnimatedInstance.h"
+
+#include <cstring>
+
+bool BonePaletteRing::Create(ID3D11Device* dev, UINT capacityBones)
+{
+    Release();
+    mCapacityRows = capacityBones * kRowsPerBone;
+
+    D3D11_BUFFER_DESC bd{};
+    bd.ByteWidth = mCapacityRows * sizeof(float) * 4;
+    bd.Usage = D3D11_USAGE_DYNAMIC;
+    bd.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+    bd.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+    if (FAILED(dev->CreateBuffer(&bd, nullptr, mRows.GetAddressOf()))) return false;
+
+    D3D11_SHADER_RESOURCE_VIEW_DESC sd{};
+    sd.Format = DXGI_FORMAT_R32G32B32A32_FLOAT;
+    sd.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
+    sd.Buffer.FirstElement = 0;
+    sd.Buffer.NumElements = mCapacityRows;
+    if (FAILED(dev->CreateShaderResourceView(mRows.Get(), &sd, mSRV.GetAddressOf()))) return false;
+
+    D3D11_BUFFER_DESC cb{};
+    cb.ByteWidth = 16;
+    cb.Usage = D3D11_USAGE_DYNAMIC;
+    cb.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+    cb.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+    if (FAILED(dev->CreateBuffer(&cb, nullptr, mBaseCB.GetAddressOf()))) return false;
+
+    // SRV 버퍼 NO_OVERWRITE 는 11.1 옵션 (없으면 업로드마다 DISCARD)
+    D3D11_FEATURE_DATA_D3D11_OPTIONS opt{};
+    mNoOverwrite = SUCCEEDED(dev->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &opt, sizeof(opt)))
+        && opt.MapNoOverwriteOnDynamicBufferSRV;
+
+    // 첫 Map 은 DISCARD 가 되도록 가득 찬 상태에서 시작
+    mCursor = mCapacityRows;
+    return true;
+}
+
+void BonePaletteRing::Release()
+{
+    mRows.Reset(); mSRV.Reset(); mBaseCB.Reset();
+    mSlots.clear();
+    mCapacityRows = mCursor = 0;
+    mBoundBase = ~0u;
+}
+
+void BonePaletteRing::BeginFrame()
+{
+    mLast = mCur;
+    mCur = Stats{};
+}
+
+UINT BonePaletteRing::Upload(ID3D11DeviceContext* ctx, const AnimatedInstance& inst)
+{
+    // Linear  : 전치된 4x4 → 앞 3행만 사용 (4행은 항상 0,0,0,1)
+    // DualQuat: 본당 (real, dual) 2행 그대로
+    const bool dq = inst.GetSkinMode() == SkinMode::DualQuat;
+    const auto& palette = inst.Palette();
+    const UINT rows = (UINT)palette.size() * (dq ? kRowsPerBoneDQ : kRowsPerBone);
+    if (rows == 0 || rows > mCapacityRows) return kInvalidBase;
+
+    D3D11_MAP mode = D3D11_MAP_WRITE_NO_OVERWRITE;
+    if (!mNoOverwrite || mCursor + rows > mCapacityRows) {
+        // 이전 오프셋들은 GPU가 아직 읽고 있을 수 있음 → 새 메모리로 바꾸고 캐시 무효화
+        mode = D3D11_MAP_WRITE_DISCARD;
+        mCursor = 0;
+        ++mEpoch;
+        mSlots.clear();
+        ++mCur.discards;
+    }
+
+    D3D11_MAPPED_SUBRESOURCE m{};
+    if (FAILED(ctx->Map(mRows.Get(), 0, mode, 0, &m))) return kInvalidBase;
+
+    float* dst = reinterpret_cast<float*>(m.pData) + (size_t)mCursor * 4;
+    if (dq) {
+        memcpy(dst, inst.PaletteDQ().data(), (size_t)rows * sizeof(float) * 4);
+    }
+    else {
+        for (size_t i = 0; i < palette.size(); ++i) {
+            memcpy(dst, &palette[i], sizeof(float) * 4 * kRowsPerBone);
+            dst += 4 * kRowsPerBone;
+        }
+    }
+    ctx->Unmap(mRows.Get(), 0);
+
+    const UINT base = mCursor;
+    mCursor += rows;
+
+    ++mCur.uploads;
+    mCur.bytes += (uint64_t)rows * sizeof(float) * 4;
+    return base;
+}
+
+UINT BonePaletteRing::Acquire(ID3D11DeviceContext* ctx, const AnimatedInstance& inst)
+{
+    const uint64_t id = inst.InstanceId();
+    auto it = mSlots.find(id);
+    if (it != mSlots.end() && it->second.epoch == mEpoch && it->second.version == inst.PaletteVersion()) {
+        ++mCur.reuses;
+        return it->second.base;
+    }
+
+    const UINT base = Upload(ctx, inst);
+    if (base == kInvalidBase) {
+        // 실패는 캐시하지 않음 (Upload 중 DISCARD 로 mSlots 가 비워졌을 수 있으니 다시 찾아 지움)
+        mSlots.erase(id);
+        return kInvalidBase;
+    }
+    Slot& s = mSlots[id];
+    s.base = base; s.epoch = mEpoch; s.version = inst.PaletteVersion();
+    return base;
+}
+
+bool BonePaletteRing::Bind(ID3D11DeviceContext* ctx, const AnimatedInstance& inst)
+{
+    if (!mRows) return false;
+
+    const UINT base = Acquire(ctx, inst);
+    if (base == kInvalidBase) return false;
+    if (base != mBoundBase) {
+        // 오프셋 CB 를 못 바꾸면 b4 는 다른 인스턴스 row 를 가리킴 → 바인딩하지 않고 실패
+        D3D11_MAPPED_SUBRESOURCE m{};
+        if (FAILED(ctx->Map(mBaseCB.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &m))) {
+            mBoundBase = kInvalidBase;  // 내용을 알 수 없으니 다음 Bind 에서 반드시 다시 씀
+            return false;
+        }
+        const UINT cb[4] = { base, 0, 0, 0 };
+        memcpy(m.pData, cb, sizeof(cb));
+        ctx->Unmap(mBaseCB.Get(), 0);
+        mBoundBase = base;
+        ++mCur.baseUpdates;
+        mCur.bytes += sizeof(cb);
+    }
+
+    ID3D11ShaderResourceView* srv = mSRV.Get();
+    ID3D11Buffer* cb = mBaseCB.Get();
+    ctx->VSSetShaderResources(11, 1, &srv);     // t11
+    ctx->VSSetConstantBuffers(4, 1, &cb);       // b4
+    return true;
+}
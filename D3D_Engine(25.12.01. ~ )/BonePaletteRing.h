@@ -0,0 +1,71 @@
+﻿// ============================================================================
+// BonePaletteRing.h
+// - 스키닝 본 팔레트 업로드 (VS t11: Buffer<float4>, VS b4: 시작 오프셋)
+//   · 본 수만큼만, 본당 3행(float4 x 3 = 48B) → 4x4 대비 25% 절약
+//     (듀얼 쿼터니언 인스턴스는 본당 2행 = 32B, 4x4 대비 절반)
+//   · 동적 버퍼를 링으로 사용: 평소엔 NO_OVERWRITE 로 뒤에 덧붙이고, 끝에 닿으면 DISCARD
+//   · 인스턴스 팔레트 버전이 같으면 다시 올리지 않는다 (패스마다 / LOD로 건너뛴 프레임)
+// ============================================================================
+
+// ---- includes ----
+
+#pragma once
+#include <d3d11.h>
+#include <wrl/client.h>
+#include <cstdint>
+#include <unordered_map>
+
+class AnimatedInstance;
+
+class BonePaletteRing {
+public:
+    // 프레임 단위 메모리 트래픽 (BeginFrame 에서 LastFrame 으로 넘어감)
+    struct Stats {
+        uint32_t uploads = 0;       // 팔레트 실제 업로드 횟수
+        uint32_t reuses = 0;        // 버전이 같아 업로드를 생략한 Bind
+        uint32_t discards = 0;      // 링이 가득 차 DISCARD 한 횟수
+        uint32_t baseUpdates = 0;   // b4 오프셋 갱신 횟수
+        uint64_t bytes = 0;         // 이번 프레임 업로드 바이트 (팔레트 + 오프셋 CB)
+    };
+
+public:
+    static constexpr UINT kRowsPerBone = 3;     // SkinMode::Linear
+    static constexpr UINT kRowsPerBoneDQ = 2;   // SkinMode::DualQuat
+    static constexpr UINT kInvalidBase = ~0u;   // Acquire 실패 (링보다 큰 팔레트 / Map 실패)
+
+    bool Create(ID3D11Device* dev, UINT capacityBones = 4096);
+    void Release();
+
+    // 프레임 시작: 통계만 넘긴다 (링 데이터는 유지 → 이전 프레임 팔레트 재사용 가능)
+    void BeginFrame();
+
+    // inst 팔레트를 링에 올리고(필요할 때만) t11/b4 바인딩
+    //  - false: 팔레트 업로드 또는 오프셋 CB(b4) 갱신 실패 → 바인딩 안 함. 호출부는 이 인스턴스 드로우를 건너뛴다
+    bool Bind(ID3D11DeviceContext* ctx, const AnimatedInstance& inst);
+
+    // 업로드만 (필요할 때만) → 시작 row 반환. 스킨 캐시 CS 처럼 다른 단계에서 직접 바인딩할 때
+    //  - 실패하면 kInvalidBase (캐시하지 않으므로 다음 호출에서 다시 시도)
+    UINT Acquire(ID3D11DeviceContext* ctx, const AnimatedInstance& inst);
+    ID3D11ShaderResourceView* SRV() const { return mSRV.Get(); }
+
+    const Stats& LastFrame() const { return mLast; }
+    UINT CapacityBones() const { return mCapacityRows / kRowsPerBone; }
+
+private:
+    UINT Upload(ID3D11DeviceContext* ctx, const AnimatedInstance& inst);
+
+    Microsoft::WRL::ComPtr<ID3D11Buffer>             mRows;     // float4 x (본 x 3), DYNAMIC
+    Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> mSRV;
+    Microsoft::WRL::ComPtr<ID3D11Buffer>             mBaseCB;   // uint BoneBase (+pad), DYNAMIC
+
+    UINT     mCapacityRows = 0;
+    UINT     mCursor = 0;           // 다음에 쓸 row
+    uint32_t mEpoch = 1;            // DISCARD 마다 +1 → 이전 오프셋 무효 (0 = 새 슬롯)
+    UINT     mBoundBase = ~0u;
+    bool     mNoOverwrite = false;
+
+    struct Slot { uint64_t version = 0; uint32_t epoch = 0; UINT base = 0; };
+    std::unordered_map<uint64_t, Slot> mSlots;   // AnimatedInstance::InstanceId → 슬롯
+
+    Stats mCur, mLast;
+};
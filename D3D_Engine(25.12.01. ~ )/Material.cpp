@@ -1,6 +1,6 @@
 ﻿// ============================================================================
 // Material.cpp
-// - MaterialGPU 구현: 텍스처 경로 해결 + SRV/CB 바인딩
+// - MaterialGPU 구현: 텍스처 경로 해결 + SRV/CB 바인딩 (SRV 는 TextureCache 공유)
 // ============================================================================
 
 // ---- includes ----
@@ -8,95 +8,130 @@
 #include "../D3D_Core/pch.h"
 #include "Material.h"
 #include "../D3D_Core/Helper.h"
-#include <filesystem>
+#include "TextureCache.h"
+#include "TexturePathIndex.h"
+#include <DirectXTex.h>
 
 using Microsoft::WRL::ComPtr;
 
-static ComPtr<ID3D11ShaderResourceView> LoadSRV(ID3D11Device* dev, const std::wstring& fullpath)
+// 슬롯별 색 공간 (TextureCache 키): 색은 sRGB, 데이터(노멀/스펙큘러/오파시티)는 Linear
+static TextureColorSpace SlotColorSpace(MaterialDecoded::Slot s)
 {
-	ComPtr<ID3D11ShaderResourceView> srv;
-	if (FAILED(CreateTextureFromFile(dev, fullpath.c_str(), srv.GetAddressOf())))
-		srv.Reset();
-	return srv;
+	return (s == MaterialDecoded::Diffuse || s == MaterialDecoded::Emissive)
+		? TextureColorSpace::SRGB : TextureColorSpace::Linear;
 }
 
-void MaterialGPU::Build(ID3D11Device* dev, const MaterialCPU& cpu, const std::wstring& texRoot)
+static ComPtr<ID3D11ShaderResourceView> LoadSRV(ID3D11Device* dev, const std::wstring& fullpath, MaterialDecoded::Slot s)
 {
-	ResetAll();
-
-	auto join = [&](const std::wstring& f)->std::wstring {
-		namespace fs = std::filesystem;
-		if (f.empty()) return L"";
+	return TextureCache::Instance().Load(dev, fullpath, SlotColorSpace(s));
+}
 
-		fs::path p(f);
+// FBX 에 적힌 텍스처 경로 → 실제 파일 경로 (못 찾으면 에러 메시지용 후보, embedded 면 빈 문자열)
+//  - 루트별 폴더 색인에서 메모리로만 찾음 (규칙은 TexturePathIndex.h)
+static std::wstring ResolveTexturePath(const std::wstring& f, const std::wstring& texRoot)
+{
+	if (f.empty()) return L"";
 
-		// FBX embedded texture (*0 같은 형태)면 지금 엔진 구조에선 포기
-		if (!f.empty() && f[0] == L'*')
-			return L"";
+	// 루트 없음: 색인할 폴더가 없으니 (현재 폴더 전체를 훑지 않게) 예전처럼 직접 확인
+	if (texRoot.empty())
+		return TexturePathResolveProbe(f, texRoot);
 
-		auto exists = [](const fs::path& x)->bool {
-			std::error_code ec;
-			return !x.empty() && fs::exists(x, ec);
-			};
+	return TexturePathIndex::For(texRoot)->Resolve(f);
+}
 
-		fs::path root(texRoot);
+// baseColor 정책 + 머티리얼 CB (두 Build 공통 마무리)
+static void FinishBuild(ID3D11Device* dev, MaterialGPU& m, const float diffuseColor[3])
+{
+	// FBX diffuseColor -> baseColor
+	m.baseColor[0] = diffuseColor[0];
+	m.baseColor[1] = diffuseColor[1];
+	m.baseColor[2] = diffuseColor[2];
+	m.baseColor[3] = 1.0f;
 
-		// 1) 절대경로가 실제로 존재하면 그대로 사용
-		if (p.is_absolute() && exists(p))
-			return p.wstring();
+	// 디퓨즈 텍스처 없으면 baseColor 쓰는 정책
+	m.useBaseColor = !m.hasDiffuse;
 
-		// 2) 절대경로인데 존재 안 하면: 파일명만 떼서 texRoot에서 찾기
-		// (다른 PC에서 export된 FBX 절대경로 대응)
-		if (p.is_absolute()) {
-			fs::path c1 = root / p.filename();
-			if (exists(c1)) return c1.wstring();
+	if (!m.cbMat)
+	{
+		struct CBMat { float baseColor[4]; UINT useBaseColor; UINT pad[3]; };
 
-			// "/Textures/a.png" 같은 "루트 붙은 경로"는 relative_path로 뽑아서 texRoot에 붙여보기
-			fs::path c2 = root / p.relative_path();
-			if (exists(c2)) return c2.wstring();
+		D3D11_BUFFER_DESC bd{};
+		bd.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+		bd.Usage = D3D11_USAGE_DEFAULT;
+		bd.ByteWidth = sizeof(CBMat);
 
-			// 마지막: 어차피 실패할 거지만 에러 메시지에 뜨게 경로 반환
-			return c1.wstring();
-		}
+		HR_T(dev->CreateBuffer(&bd, nullptr, m.cbMat.GetAddressOf()));
+	}
+}
 
-		// 3) 상대경로: texRoot/상대경로
-		fs::path c = root / p;
-		if (exists(c)) return c.wstring();
+void MaterialGPU::Build(ID3D11Device* dev, const MaterialCPU& cpu, const std::wstring& texRoot)
+{
+	ResetAll();
 
-		// 4) 상대경로인데 서브폴더가 깨진 케이스 대비: 파일명만으로도 찾아보기
-		fs::path c3 = root / p.filename();
-		if (exists(c3)) return c3.wstring();
+	auto join = [&](const std::wstring& f) { return ResolveTexturePath(f, texRoot); };
 
-		return c.wstring();
-		};
+	if (!cpu.diffuse.empty()) { texDiffuse = LoadSRV(dev, join(cpu.diffuse), MaterialDecoded::Diffuse);   hasDiffuse = (texDiffuse.Get() != nullptr); }
+	if (!cpu.normal.empty()) { texNormal = LoadSRV(dev, join(cpu.normal), MaterialDecoded::Normal);    hasNormal = (texNormal.Get() != nullptr); }
+	if (!cpu.specular.empty()) { texSpecular = LoadSRV(dev, join(cpu.specular), MaterialDecoded::Specular);  hasSpecular = (texSpecular.Get() != nullptr); }
+	if (!cpu.emissive.empty()) { texEmissive = LoadSRV(dev, join(cpu.emissive), MaterialDecoded::Emissive);  hasEmissive = (texEmissive.Get() != nullptr); }
+	if (!cpu.opacity.empty()) { texOpacity = LoadSRV(dev, join(cpu.opacity), MaterialDecoded::Opacity);   hasOpacity = (texOpacity.Get() != nullptr); }
 
+	FinishBuild(dev, *this, cpu.diffuseColor);
+}
 
-	if (!cpu.diffuse.empty()) { texDiffuse = LoadSRV(dev, join(cpu.diffuse));   hasDiffuse = (texDiffuse.Get() != nullptr); }
-	if (!cpu.normal.empty()) { texNormal = LoadSRV(dev, join(cpu.normal));    hasNormal = (texNormal.Get() != nullptr); }
-	if (!cpu.specular.empty()) { texSpecular = LoadSRV(dev, join(cpu.specular));  hasSpecular = (texSpecular.Get() != nullptr); }
-	if (!cpu.emissive.empty()) { texEmissive = LoadSRV(dev, join(cpu.emissive));  hasEmissive = (texEmissive.Get() != nullptr); }
-	if (!cpu.opacity.empty()) { texOpacity = LoadSRV(dev, join(cpu.opacity));   hasOpacity = (texOpacity.Get() != nullptr); }
+// ----------------------------------------------------------------------------
+// 2단계 빌드 (스트리밍)
+// ----------------------------------------------------------------------------
+uint64_t MaterialDecoded::Bytes() const
+{
+	uint64_t sum = 0;
+	for (const auto& img : images)
+		if (img) sum += img->GetPixelsSize();
+	return sum;
+}
 
-	// FBX diffuseColor -> baseColor
-	baseColor[0] = cpu.diffuseColor[0];
-	baseColor[1] = cpu.diffuseColor[1];
-	baseColor[2] = cpu.diffuseColor[2];
-	baseColor[3] = 1.0f;
+MaterialDecoded MaterialDecode(const MaterialCPU& cpu, const std::wstring& texRoot)
+{
+	MaterialDecoded out;
+	const std::wstring* paths[MaterialDecoded::SlotCount] = { &cpu.diffuse, &cpu.normal, &cpu.specular, &cpu.emissive, &cpu.opacity };
+	for (int s = 0; s < MaterialDecoded::SlotCount; ++s) {
+		const std::wstring full = ResolveTexturePath(*paths[s], texRoot);
+		if (full.empty()) continue;
+
+		// 이미 올라가 있으면 경로만 넘김 (Build 에서 캐시 히트)
+		if (TextureCache::Instance().Contains(full, SlotColorSpace((MaterialDecoded::Slot)s))) {
+			out.paths[s] = full;
+			continue;
+		}
 
-	// 디퓨즈 텍스처 없으면 baseColor 쓰는 정책
-	useBaseColor = !hasDiffuse;
+		auto img = std::make_shared<DirectX::ScratchImage>();
+		if (SUCCEEDED(DecodeTextureFromFile(full.c_str(), *img))) {
+			out.paths[s] = full;
+			out.images[s] = std::move(img);
+		}
+	}
+	out.diffuseColor[0] = cpu.diffuseColor[0];
+	out.diffuseColor[1] = cpu.diffuseColor[1];
+	out.diffuseColor[2] = cpu.diffuseColor[2];
+	return out;
+}
 
-	if (!cbMat)
-	{
-		struct CBMat { float baseColor[4]; UINT useBaseColor; UINT pad[3]; };
+void MaterialGPU::Build(ID3D11Device* dev, const MaterialDecoded& decoded)
+{
+	ResetAll();
 
-		D3D11_BUFFER_DESC bd{};
-		bd.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
-		bd.Usage = D3D11_USAGE_DEFAULT;
-		bd.ByteWidth = sizeof(CBMat);
+	auto create = [&](MaterialDecoded::Slot s, ComPtr<ID3D11ShaderResourceView>& srv, bool& has) {
+		if (!decoded.paths[s].empty())
+			srv = TextureCache::Instance().Load(dev, decoded.paths[s], SlotColorSpace(s), decoded.images[s].get());
+		has = (srv.Get() != nullptr);
+		};
+	create(MaterialDecoded::Diffuse, texDiffuse, hasDiffuse);
+	create(MaterialDecoded::Normal, texNormal, hasNormal);
+	create(MaterialDecoded::Specular, texSpecular, hasSpecular);
+	create(MaterialDecoded::Emissive, texEmissive, hasEmissive);
+	create(MaterialDecoded::Opacity, texOpacity, hasOpacity);
 
-		HR_T(dev->CreateBuffer(&bd, nullptr, cbMat.GetAddressOf()));
-	}
+	FinishBuild(dev, *this, decoded.diffuseColor);
 }
 
 void MaterialGPU::Bind(ID3D11DeviceContext* ctx) const
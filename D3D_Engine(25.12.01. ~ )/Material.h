@@ -7,11 +7,31 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <d3d11.h>
 #include <wrl/client.h>   // ComPtr
 #include "MeshDataEx.h"
 
+namespace DirectX { class ScratchImage; }
+
+// 스트리밍용 2단계 빌드의 중간 결과: MaterialDecode (워커: 경로 해결 + 파일 I/O + 디코드)
+//  → MaterialGPU::Build(dev, decoded) (디바이스: SRV/CB 생성만)
+//  - 텍스처는 두 Build 모두 TextureCache 경유 → 이미 캐시에 있는 텍스처는 디코드도 건너뜀
+struct MaterialDecoded
+{
+	enum Slot { Diffuse, Normal, Specular, Emissive, Opacity, SlotCount };
+
+	std::wstring paths[SlotCount];                              // 해결된 파일 경로 (캐시 키). 없음/디코드 실패면 빈 문자열
+	std::shared_ptr<DirectX::ScratchImage> images[SlotCount];   // 캐시에 이미 있거나 경로 없음/디코드 실패면 null
+	float diffuseColor[3] = { 1.f, 1.f, 1.f };
+
+	uint64_t Bytes() const;   // 픽셀 바이트 합 (업로드 예산용)
+};
+
+MaterialDecoded MaterialDecode(const MaterialCPU& cpu, const std::wstring& texRoot);
+
 struct MaterialGPU
 {
 	MaterialGPU() = default;
@@ -24,6 +44,7 @@ struct MaterialGPU
 	MaterialGPU& operator=(MaterialGPU&&) noexcept = default;
 
 	void Build(ID3D11Device* dev, const MaterialCPU& cpu, const std::wstring& texRoot);
+	void Build(ID3D11Device* dev, const MaterialDecoded& decoded);
 	void Bind(ID3D11DeviceContext* ctx) const;
 	static void Unbind(ID3D11DeviceContext* ctx);
 
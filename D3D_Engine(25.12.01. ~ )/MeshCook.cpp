@@ -0,0 +1,333 @@
+﻿// ============================================================================
+// MeshCook.cpp
+// - MeshCook 구현: 쿠킹 파일 기록 / 메모리 매핑 + 검증 / 머티리얼 문자열 파싱
+// - MappedFile: 쿠킹 파일 공용 읽기 전용 매핑
+// ============================================================================
+
+// ---- includes ----
+#include "../D3D_Core/pch.h"
+#include "MeshCook.h"
+#include "VertexPack.h"
+
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    constexpr uint32_t kCookMagic = 0x4B434D4D;   // "MMCK"
+    constexpr uint32_t kCookVersion = 3;          // 2: MeshOptimize 순서로 저장, 3: LOD 범위 섹션
+    constexpr uint64_t kAlign = 64;
+
+    // 파일 맨 앞. 오프셋은 파일 시작 기준, 모두 kAlign 배수
+    struct Header
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t sourceHash;
+        uint32_t flags;
+        uint32_t vertexCount;
+        uint32_t indexCount;
+        uint32_t submeshCount;
+        uint32_t materialCount;
+        uint32_t lodCount;
+        uint64_t posOffset;
+        uint64_t attrOffset;
+        uint64_t indexOffset;
+        uint64_t submeshOffset;
+        uint64_t lodOffset;
+        uint64_t materialOffset;
+        uint64_t materialBytes;
+        uint64_t fileBytes;
+    };
+
+    static_assert(sizeof(SubMeshCPU) == 16, "SubMeshCPU is stored verbatim");
+    static_assert(sizeof(SubMeshLodCPU) == 16, "SubMeshLodCPU is stored verbatim");
+
+    uint64_t AlignUp(uint64_t v) { return (v + kAlign - 1) & ~(kAlign - 1); }
+
+    struct Fnv
+    {
+        uint64_t h = 1469598103934665603ull;
+        void Bytes(const void* p, size_t n)
+        {
+            const uint8_t* b = static_cast<const uint8_t*>(p);
+            for (size_t i = 0; i < n; ++i) { h ^= b[i]; h *= 1099511628211ull; }
+        }
+        template <class T> void Pod(const T& v) { Bytes(&v, sizeof(v)); }
+    };
+
+    // 머티리얼 문자열: u32 길이 + UTF-16 코드 유닛 (wchar_t 크기와 무관하게 2바이트)
+    void PutString(std::vector<uint8_t>& out, const std::wstring& s)
+    {
+        const uint32_t n = (uint32_t)s.size();
+        const size_t at = out.size();
+        out.resize(at + sizeof(n) + n * sizeof(uint16_t));
+        memcpy(out.data() + at, &n, sizeof(n));
+        uint8_t* dst = out.data() + at + sizeof(n);
+        for (uint32_t i = 0; i < n; ++i) {
+            const uint16_t c = (uint16_t)s[i];
+            memcpy(dst + i * sizeof(uint16_t), &c, sizeof(c));
+        }
+    }
+
+    bool GetString(const uint8_t*& p, const uint8_t* end, std::wstring& s)
+    {
+        uint32_t n = 0;
+        if ((size_t)(end - p) < sizeof(n)) return false;
+        memcpy(&n, p, sizeof(n)); p += sizeof(n);
+        if ((size_t)(end - p) / sizeof(uint16_t) < n) return false;
+        s.resize(n);
+        for (uint32_t i = 0; i < n; ++i) {
+            uint16_t c = 0;
+            memcpy(&c, p + i * sizeof(uint16_t), sizeof(c));
+            s[i] = (wchar_t)c;
+        }
+        p += n * sizeof(uint16_t);
+        return true;
+    }
+
+    // 섹션 [offset, offset + bytes) 가 파일 안에 있고 정렬돼 있는지
+    bool SectionOk(const Header& h, uint64_t offset, uint64_t bytes)
+    {
+        return offset % kAlign == 0 && offset >= sizeof(Header)
+            && offset <= h.fileBytes && bytes <= h.fileBytes - offset;
+    }
+}
+
+uint64_t MeshCookSourceHash(const std::filesystem::path& source, uint32_t flags)
+{
+    std::error_code ec;
+    const uint64_t size = (uint64_t)std::filesystem::file_size(source, ec);
+    if (ec) return 0;
+    const int64_t mtime = (int64_t)std::filesystem::last_write_time(source, ec).time_since_epoch().count();
+    if (ec) return 0;
+
+    Fnv h;
+    h.Pod(kCookVersion);
+    h.Pod(flags);
+    h.Pod(size);
+    h.Pod(mtime);
+    const std::u8string name = source.generic_u8string();
+    h.Bytes(name.data(), name.size());
+    return h.h;
+}
+
+bool MeshCookSave(const MeshData_PNTT& src, uint64_t sourceHash, uint32_t flags,
+    const std::filesystem::path& path, VertexPackReport* report)
+{
+    const size_t vc = src.vertices.size();
+
+    // StaticMesh::Build 와 같은 압축 → 분리
+    std::vector<VertexPacked_PNTT> packed(vc);
+    VertexPackArray(src.vertices.data(), vc, packed.data(), report);
+    std::vector<VertexStreamPos_PNTT> pos(vc);
+    std::vector<VertexStreamAttr> attr(vc);
+    VertexSplitStreams(packed.data(), vc, pos.data(), attr.data());
+
+    std::vector<uint8_t> mtl;
+    MeshCookPutMaterials(mtl, src.materials);
+
+    Header h{};
+    h.magic = kCookMagic;
+    h.version = kCookVersion;
+    h.sourceHash = sourceHash;
+    h.flags = flags;
+    h.vertexCount = (uint32_t)vc;
+    h.indexCount = (uint32_t)src.indices.size();
+    h.submeshCount = (uint32_t)src.submeshes.size();
+    h.materialCount = (uint32_t)src.materials.size();
+    h.lodCount = (uint32_t)src.lods.size();
+    h.posOffset = AlignUp(sizeof(Header));
+    h.attrOffset = AlignUp(h.posOffset + vc * sizeof(VertexStreamPos_PNTT));
+    h.indexOffset = AlignUp(h.attrOffset + vc * sizeof(VertexStreamAttr));
+    h.submeshOffset = AlignUp(h.indexOffset + (uint64_t)h.indexCount * sizeof(uint32_t));
+    h.lodOffset = AlignUp(h.submeshOffset + (uint64_t)h.submeshCount * sizeof(SubMeshCPU));
+    h.materialOffset = AlignUp(h.lodOffset + (uint64_t)h.lodCount * sizeof(SubMeshLodCPU));
+    h.materialBytes = mtl.size();
+    h.fileBytes = h.materialOffset + h.materialBytes;
+
+    const std::filesystem::path tmp = MeshCookTempPath(path);
+    std::ofstream f(tmp, std::ios::binary | std::ios::trunc);
+    if (!f) return false;
+
+    uint64_t at = 0;
+    auto section = [&](uint64_t offset, const void* data, uint64_t bytes) {
+        static const char zeros[kAlign] = {};
+        f.write(zeros, (std::streamsize)(offset - at));
+        f.write(static_cast<const char*>(data), (std::streamsize)bytes);
+        at = offset + bytes;
+    };
+    section(0, &h, sizeof(h));
+    section(h.posOffset, pos.data(), vc * sizeof(VertexStreamPos_PNTT));
+    section(h.attrOffset, attr.data(), vc * sizeof(VertexStreamAttr));
+    section(h.indexOffset, src.indices.data(), (uint64_t)h.indexCount * sizeof(uint32_t));
+    section(h.submeshOffset, src.submeshes.data(), (uint64_t)h.submeshCount * sizeof(SubMeshCPU));
+    section(h.lodOffset, src.lods.data(), (uint64_t)h.lodCount * sizeof(SubMeshLodCPU));
+    section(h.materialOffset, mtl.data(), mtl.size());
+    f.close();
+    return MeshCookReplaceFile(tmp, path, (bool)f);
+}
+
+std::filesystem::path MeshCookTempPath(const std::filesystem::path& path)
+{
+    std::filesystem::path tmp = path;
+    tmp += L".tmp" + std::to_wstring(std::hash<std::thread::id>{}(std::this_thread::get_id()) & 0xFFFFFF);
+    return tmp;
+}
+
+bool MeshCookReplaceFile(const std::filesystem::path& tmp, const std::filesystem::path& path, bool written)
+{
+    std::error_code ec;
+    if (written) {
+        std::filesystem::rename(tmp, path, ec);   // 같은 폴더 → 교체 (매핑 중인 파일이면 실패: 다음 실행에서 다시 쿠킹)
+        if (!ec) return true;
+    }
+    std::filesystem::remove(tmp, ec);
+    return false;
+}
+
+void MeshCookPutMaterials(std::vector<uint8_t>& out, const std::vector<MaterialCPU>& materials)
+{
+    for (const MaterialCPU& m : materials) {
+        PutString(out, m.diffuse);
+        PutString(out, m.normal);
+        PutString(out, m.specular);
+        PutString(out, m.emissive);
+        PutString(out, m.opacity);
+        const size_t at = out.size();
+        out.resize(at + sizeof(m.diffuseColor));
+        memcpy(out.data() + at, m.diffuseColor, sizeof(m.diffuseColor));
+    }
+}
+
+bool MeshCookGetMaterials(const uint8_t*& p, const uint8_t* end, uint32_t count, std::vector<MaterialCPU>& out)
+{
+    out.resize(count);
+    for (MaterialCPU& m : out) {
+        if (!GetString(p, end, m.diffuse) || !GetString(p, end, m.normal) || !GetString(p, end, m.specular)
+            || !GetString(p, end, m.emissive) || !GetString(p, end, m.opacity)
+            || (size_t)(end - p) < sizeof(m.diffuseColor)) return false;
+        memcpy(m.diffuseColor, p, sizeof(m.diffuseColor));
+        p += sizeof(m.diffuseColor);
+    }
+    return true;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& o) noexcept
+{
+    if (this != &o) {
+        Close();
+        mBase = o.mBase; mBytes = o.mBytes;
+        o.mBase = nullptr; o.mBytes = 0;
+    }
+    return *this;
+}
+
+bool MappedFile::Open(const std::filesystem::path& path, size_t minBytes)
+{
+    Close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size{};
+    HANDLE mapping = nullptr;
+    if (GetFileSizeEx(file, &size) && size.QuadPart > 0 && (uint64_t)size.QuadPart >= minBytes)
+        mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping) {
+        mBase = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        mBytes = mBase ? (size_t)size.QuadPart : 0;
+        CloseHandle(mapping);
+    }
+    CloseHandle(file);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st{};
+    if (fstat(fd, &st) == 0 && st.st_size > 0 && (uint64_t)st.st_size >= minBytes) {
+        void* p = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p != MAP_FAILED) { mBase = static_cast<const uint8_t*>(p); mBytes = (size_t)st.st_size; }
+    }
+    ::close(fd);
+#endif
+    return mBase != nullptr;
+}
+
+void MappedFile::Close()
+{
+    if (mBase) {
+#ifdef _WIN32
+        UnmapViewOfFile(mBase);
+#else
+        munmap(const_cast<uint8_t*>(mBase), mBytes);
+#endif
+    }
+    mBase = nullptr;
+    mBytes = 0;
+}
+
+bool CookedMesh::Open(const std::filesystem::path& path, uint64_t expectHash)
+{
+    Close();
+    if (!mFile.Open(path, sizeof(Header))) return false;
+
+    const uint8_t* base = mFile.Data();
+    Header h{};
+    memcpy(&h, base, sizeof(h));
+    const bool ok = h.magic == kCookMagic && h.version == kCookVersion
+        && h.sourceHash == expectHash && h.fileBytes == mFile.Size()
+        && SectionOk(h, h.posOffset, (uint64_t)h.vertexCount * sizeof(VertexStreamPos_PNTT))
+        && SectionOk(h, h.attrOffset, (uint64_t)h.vertexCount * sizeof(VertexStreamAttr))
+        && SectionOk(h, h.indexOffset, (uint64_t)h.indexCount * sizeof(uint32_t))
+        && SectionOk(h, h.submeshOffset, (uint64_t)h.submeshCount * sizeof(SubMeshCPU))
+        && (h.lodCount == 0 || h.lodCount == h.submeshCount * (kMeshLodLevels - 1))
+        && SectionOk(h, h.lodOffset, (uint64_t)h.lodCount * sizeof(SubMeshLodCPU))
+        && SectionOk(h, h.materialOffset, h.materialBytes);
+    if (!ok) { Close(); return false; }
+
+    mView.pos = reinterpret_cast<const VertexStreamPos_PNTT*>(base + h.posOffset);
+    mView.attr = reinterpret_cast<const VertexStreamAttr*>(base + h.attrOffset);
+    mView.vertexCount = h.vertexCount;
+    mView.indices = reinterpret_cast<const uint32_t*>(base + h.indexOffset);
+    mView.indexCount = h.indexCount;
+    mView.submeshes = reinterpret_cast<const SubMeshCPU*>(base + h.submeshOffset);
+    mView.submeshCount = h.submeshCount;
+    mView.lods = h.lodCount ? reinterpret_cast<const SubMeshLodCPU*>(base + h.lodOffset) : nullptr;
+    mView.lodCount = h.lodCount;
+
+    // 서브메시 범위는 여기서 확인 (인덱스 값 자체는 검사하지 않음: 전체를 훑게 되므로)
+    for (uint32_t i = 0; i < h.submeshCount; ++i) {
+        const SubMeshCPU& sm = mView.submeshes[i];
+        if (sm.indexStart > h.indexCount || sm.indexCount > h.indexCount - sm.indexStart) { Close(); return false; }
+    }
+    for (uint32_t i = 0; i < h.lodCount; ++i) {
+        const SubMeshLodCPU& l = mView.lods[i];
+        if (l.indexStart > h.indexCount || l.indexCount > h.indexCount - l.indexStart) { Close(); return false; }
+    }
+
+    const uint8_t* p = base + h.materialOffset;
+    if (!MeshCookGetMaterials(p, p + h.materialBytes, h.materialCount, mMaterials)) { Close(); return false; }
+    return true;
+}
+
+void CookedMesh::Close()
+{
+    mFile.Close();
+    mView = MeshCookView{};
+    mMaterials.clear();
+}
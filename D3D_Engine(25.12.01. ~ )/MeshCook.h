@@ -0,0 +1,117 @@
+﻿// ============================================================================
+// MeshCook.h
+// - 쿠킹된 정적 메시 파일 (.meshcook): Assimp 후처리 결과를 GPU 그대로의 형태로 저장
+//   · 압축 + 분리 스트림(VertexStreamPos_PNTT / VertexStreamAttr) / 인덱스 / 서브메시 / LOD 범위 / 머티리얼
+//   · 섹션은 64B 정렬 → 메모리 매핑한 뒤 포인터를 그대로 StaticMesh::Build 에 넘긴다 (중간 vector 없음)
+//   · 원본 FBX 크기/수정 시각 + 임포트 플래그 + 쿠커 버전 해시가 다르면 무효 → 다시 쿠킹
+// - D3D / Assimp 의존 없음 (임포트 → 쿠킹 연결은 AssimpImporterEx::LoadCooked_PNTT)
+// - MappedFile / 머티리얼 직렬화는 SkeletalCook(.skelcook)과 공용
+// ============================================================================
+
+#pragma once
+
+// ---- includes ----
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#include "MeshDataEx.h"
+
+struct VertexPackReport;
+
+// 매핑된 파일 안을 가리키는 포인터들 (CookedMesh 가 열려 있는 동안만 유효)
+struct MeshCookView
+{
+    const VertexStreamPos_PNTT* pos = nullptr;
+    const VertexStreamAttr*     attr = nullptr;
+    uint32_t                    vertexCount = 0;
+    const uint32_t*             indices = nullptr;
+    uint32_t                    indexCount = 0;
+    const SubMeshCPU*           submeshes = nullptr;
+    uint32_t                    submeshCount = 0;
+    const SubMeshLodCPU*        lods = nullptr;     // submeshCount × (kMeshLodLevels - 1) 또는 없음 (MeshLod.h)
+    uint32_t                    lodCount = 0;
+};
+
+// 스키닝 메시 판 (위치 스트림에 본 인덱스/가중치 포함. SkeletalCook / SkinnedMesh::Build)
+struct SkinnedMeshCookView
+{
+    const VertexStreamPos_PNTT_BW* pos = nullptr;
+    const VertexStreamAttr*        attr = nullptr;
+    uint32_t                       vertexCount = 0;
+    const uint32_t*                indices = nullptr;
+    uint32_t                       indexCount = 0;
+    const SubMeshCPU*              submeshes = nullptr;
+    uint32_t                       submeshCount = 0;
+};
+
+// 읽기 전용 파일 매핑 (Win32 MapViewOfFile / POSIX mmap). 핸들은 매핑 직후 닫고 뷰만 유지
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    ~MappedFile() { Close(); }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& o) noexcept : mBase(o.mBase), mBytes(o.mBytes) { o.mBase = nullptr; o.mBytes = 0; }
+    MappedFile& operator=(MappedFile&& o) noexcept;
+
+    // minBytes 보다 작은 파일은 열지 않음 (헤더도 못 읽는 파일)
+    bool Open(const std::filesystem::path& path, size_t minBytes);
+    void Close();
+
+    const uint8_t* Data() const { return mBase; }
+    size_t Size() const { return mBytes; }
+
+private:
+    const uint8_t* mBase = nullptr;
+    size_t         mBytes = 0;
+};
+
+// 임포트 옵션 비트 (해시/헤더에 같이 기록)
+enum MeshCookFlags : uint32_t
+{
+    MeshCook_FlipUV = 1u << 0,
+    MeshCook_LeftHanded = 1u << 1,
+};
+
+// 원본 파일 크기 + 수정 시각 + 경로 + 플래그 + 쿠커 버전 (FNV-1a). 원본을 읽지 않으므로 웜 스타트 비용 없음
+uint64_t MeshCookSourceHash(const std::filesystem::path& source, uint32_t flags);
+
+// src 를 압축/분리해서 기록. report 가 있으면 압축 왕복 오차 누적 (VertexPackArray)
+bool MeshCookSave(const MeshData_PNTT& src, uint64_t sourceHash, uint32_t flags,
+    const std::filesystem::path& path, VertexPackReport* report = nullptr);
+
+// 쿠킹 파일은 임시 파일(스레드마다 다른 이름)에 다 쓴 뒤 교체 → 읽는 쪽은 이전 파일이나 완성된 파일만 봄
+//  (스트리밍으로 같은 원본을 동시에 쿠킹해도 안전). SkeletalCook 과 공용
+std::filesystem::path MeshCookTempPath(const std::filesystem::path& path);
+bool MeshCookReplaceFile(const std::filesystem::path& tmp, const std::filesystem::path& path, bool written);  // written 이 false 면 임시 파일만 지움
+
+// 머티리얼 목록 직렬화 (u32 길이 + UTF-16 문자열 5개 + diffuseColor). SkeletalCook 과 공용
+void MeshCookPutMaterials(std::vector<uint8_t>& out, const std::vector<MaterialCPU>& materials);
+bool MeshCookGetMaterials(const uint8_t*& p, const uint8_t* end, uint32_t count, std::vector<MaterialCPU>& out);
+
+class CookedMesh
+{
+public:
+    CookedMesh() = default;
+    ~CookedMesh() { Close(); }
+    CookedMesh(const CookedMesh&) = delete;
+    CookedMesh& operator=(const CookedMesh&) = delete;
+
+    // 매핑 + 헤더/섹션 범위 검증. 해시가 다르거나 깨진 파일이면 false (열린 상태 아님)
+    bool Open(const std::filesystem::path& path, uint64_t expectHash);
+    void Close();
+    bool IsOpen() const { return mFile.Data() != nullptr; }
+
+    const MeshCookView& View() const { return mView; }
+    const std::vector<MaterialCPU>& Materials() const { return mMaterials; }
+    size_t FileBytes() const { return mFile.Size(); }
+
+private:
+    MappedFile mFile;
+
+    MeshCookView             mView;
+    std::vector<MaterialCPU> mMaterials; // 문자열은 작아서 파싱해 둔다
+};
@@ -27,10 +27,68 @@ struct VertexCPU_PNTT_BW {
 	float    bw[4];       // Bone weights (정규화)
 };
 
+// GPU 정점 (임포트 후 Build 에서 VertexPack.h 로 압축, 입력 레이아웃은 TutorialApp_SceneInit.cpp)
+//  - 노멀 : 옥타헤드럴 SNORM16 x2            (R16G16_SNORM)
+//  - 탄젠트: 옥타헤드럴 UNORM16 + UNORM15 + 부호 (R16G16_UINT, 디코드는 Shader/VertexPack.hlsli)
+//  - UV   : half x2                          (R16G16_FLOAT)
+//  - 가중치: UNORM8 x4, 합 255               (R8G8B8A8_UNORM)
+struct VertexPacked_PNTT {
+	float    px, py, pz;
+	int16_t  n[2];
+	uint16_t t[2];        // t[1] bit15 = handedness (1 → -1)
+	uint16_t uv[2];
+};
+
+struct VertexPacked_PNTT_BW {
+	float    px, py, pz;
+	int16_t  n[2];
+	uint16_t t[2];
+	uint16_t uv[2];
+	uint8_t  bi[4];
+	uint8_t  bw[4];
+};
+
+static_assert(sizeof(VertexPacked_PNTT) == 24, "packed static vertex must stay 24 bytes");
+static_assert(sizeof(VertexPacked_PNTT_BW) == 32, "packed skinned vertex must stay 32 bytes");
+
+// GPU 분리 스트림 (VertexSplitStreams, VertexPack.h)
+//  - 슬롯 0: 깊이 패스가 읽는 것만 (위치 + 컷아웃용 UV [+ 스키닝])
+//  - 슬롯 1: 셰이딩 속성 (노멀 / 탄젠트)
+struct VertexStreamPos_PNTT {
+	float    px, py, pz;
+	uint16_t uv[2];
+};
+
+struct VertexStreamPos_PNTT_BW {
+	float    px, py, pz;
+	uint16_t uv[2];
+	uint8_t  bi[4];
+	uint8_t  bw[4];
+};
+
+struct VertexStreamAttr {
+	int16_t  n[2];
+	uint16_t t[2];
+};
+
+static_assert(sizeof(VertexStreamPos_PNTT) == 16, "static position stream must stay 16 bytes");
+static_assert(sizeof(VertexStreamPos_PNTT_BW) == 24, "skinned position stream must stay 24 bytes");
+static_assert(sizeof(VertexStreamAttr) == 8, "attribute stream must stay 8 bytes");
+
 struct SubMeshCPU {
 	uint32_t baseVertex = 0, indexStart = 0, indexCount = 0, materialIndex = 0;
 };
 
+// 서브메시 LOD (MeshLod.h). LOD0 은 SubMeshCPU 범위 그대로, LOD1~ 만 저장
+//  - lods[서브메시 × (kMeshLodLevels - 1) + (lod - 1)]. 인덱스는 LOD0 과 같은 정점 버퍼를 가리킴
+constexpr uint32_t kMeshLodLevels = 4;
+
+struct SubMeshLodCPU {
+	uint32_t indexStart = 0, indexCount = 0;
+	float    error = 0.0f;   // LOD0 대비 오차 (오브젝트 공간 거리)
+	uint32_t pad = 0;
+};
+
 struct MaterialCPU {
 	std::wstring diffuse, normal, specular, emissive, opacity;
 	float diffuseColor[3] = { 1,1,1 };
@@ -40,5 +98,6 @@ struct MeshData_PNTT {
 	std::vector<VertexCPU_PNTT> vertices;
 	std::vector<uint32_t> indices;
 	std::vector<SubMeshCPU> submeshes;
+	std::vector<SubMeshLodCPU> lods;   // 비어 있으면 LOD0 만
 	std::vector<MaterialCPU> materials;
 };
@@ -0,0 +1,629 @@
+﻿// ============================================================================
+// MeshLod.cpp
+// - MeshLod 구현: 정점 분류 / quadric edge collapse / 서브메시별 단계 생성 / 화면 오차 선택
+// ============================================================================
+
+// ---- includes ----
+#include "../D3D_Core/pch.h"
+#include "MeshLod.h"
+#include "MeshOptimize.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+namespace
+{
+    struct V3 { double x, y, z; };
+
+    V3 Sub(const V3& a, const V3& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+    V3 Cross(const V3& a, const V3& b) { return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x }; }
+    double Dot(const V3& a, const V3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+    double Len(const V3& a) { return std::sqrt(Dot(a, a)); }
+
+    // ------------------------------------------------------------------------
+    // Quadric: 평면까지 거리 제곱의 가중 합 (대칭 4x4 → 10개 + 가중치)
+    // ------------------------------------------------------------------------
+    struct Quadric
+    {
+        double a00 = 0, a01 = 0, a02 = 0, a11 = 0, a12 = 0, a22 = 0;
+        double b0 = 0, b1 = 0, b2 = 0, c = 0;
+        double w = 0;
+
+        // n 은 단위 벡터, 평면 n·p + d = 0
+        void AddPlane(const V3& n, double d, double weight)
+        {
+            a00 += weight * n.x * n.x; a01 += weight * n.x * n.y; a02 += weight * n.x * n.z;
+            a11 += weight * n.y * n.y; a12 += weight * n.y * n.z; a22 += weight * n.z * n.z;
+            b0 += weight * n.x * d; b1 += weight * n.y * d; b2 += weight * n.z * d;
+            c += weight * d * d;
+            w += weight;
+        }
+
+        void Add(const Quadric& o)
+        {
+            a00 += o.a00; a01 += o.a01; a02 += o.a02; a11 += o.a11; a12 += o.a12; a22 += o.a22;
+            b0 += o.b0; b1 += o.b1; b2 += o.b2; c += o.c; w += o.w;
+        }
+
+        // 평균 거리 제곱 (가중치로 나눔 → 오브젝트 공간 단위)
+        double Error(const V3& p) const
+        {
+            const double e = a00 * p.x * p.x + a11 * p.y * p.y + a22 * p.z * p.z
+                + 2.0 * (a01 * p.x * p.y + a02 * p.x * p.z + a12 * p.y * p.z)
+                + 2.0 * (b0 * p.x + b1 * p.y + b2 * p.z) + c;
+            return (w > 0.0) ? std::fabs(e) / w : 0.0;
+        }
+    };
+
+    // 경계선 평면 가중 (면적 단위와 맞추려고 변 길이 제곱에 곱함)
+    constexpr double kBorderWeight = 10.0;
+
+    enum class Kind : uint8_t { Manifold, Border, Seam, Locked };
+
+    constexpr uint32_t kNone = UINT32_MAX;
+
+    // 위치 비트 그대로 비교 (-0 == 0)
+    struct PosKey
+    {
+        uint32_t x, y, z;
+        bool operator==(const PosKey& o) const { return x == o.x && y == o.y && z == o.z; }
+    };
+    struct PosKeyHash
+    {
+        size_t operator()(const PosKey& k) const
+        {
+            return (size_t)((k.x * 73856093u) ^ (k.y * 19349663u) ^ (k.z * 83492791u));
+        }
+    };
+
+    PosKey MakeKey(const float* p)
+    {
+        PosKey k;
+        const float x = p[0] + 0.0f, y = p[1] + 0.0f, z = p[2] + 0.0f;
+        std::memcpy(&k.x, &x, 4); std::memcpy(&k.y, &y, 4); std::memcpy(&k.z, &z, 4);
+        return k;
+    }
+
+    const float* PosPtr(const float* positions, size_t stride, uint32_t v)
+    {
+        return reinterpret_cast<const float*>(reinterpret_cast<const uint8_t*>(positions) + (size_t)v * stride);
+    }
+
+    // ------------------------------------------------------------------------
+    // 정점 → 나가는 변 (a→b) / 삼각형 인접 (pass 마다 다시 만듦)
+    // ------------------------------------------------------------------------
+    struct Adjacency
+    {
+        std::vector<uint32_t> offset;   // vertexCount + 1
+        std::vector<uint32_t> data;
+
+        void Build(const std::vector<uint32_t>& idx, size_t vertexCount, bool triangles)
+        {
+            offset.assign(vertexCount + 1, 0);
+            for (uint32_t v : idx) ++offset[v + 1];
+            for (size_t v = 0; v < vertexCount; ++v) offset[v + 1] += offset[v];
+
+            data.resize(idx.size());
+            std::vector<uint32_t> fill(offset.begin(), offset.end() - 1);
+            for (size_t i = 0; i < idx.size(); ++i) {
+                const size_t t = i / 3;
+                // triangles: 삼각형 번호, 아니면 다음 꼭짓점 (a→b, b→c, c→a)
+                data[fill[idx[i]]++] = triangles ? (uint32_t)t : idx[t * 3 + (i + 1) % 3];
+            }
+        }
+
+        const uint32_t* Begin(uint32_t v) const { return data.data() + offset[v]; }
+        const uint32_t* End(uint32_t v) const { return data.data() + offset[v + 1]; }
+    };
+
+    // ------------------------------------------------------------------------
+    // 단순화 상태 (로컬 정점)
+    // ------------------------------------------------------------------------
+    class Simplifier
+    {
+    public:
+        Simplifier(const float* positions, size_t stride, size_t vertexCount, const uint8_t* locked)
+            : mLocked(locked), mCount(vertexCount)
+        {
+            mPos.resize(vertexCount);
+            for (size_t v = 0; v < vertexCount; ++v) {
+                const float* p = PosPtr(positions, stride, (uint32_t)v);
+                mPos[v] = { p[0], p[1], p[2] };
+            }
+        }
+
+        // 위치가 같은 정점끼리 묶음 (wedge). remap = 묶음 대표, next = 묶음 안 다음 정점 (원형)
+        void Weld(const std::vector<uint32_t>& idx, const float* positions, size_t stride)
+        {
+            mRemap.assign(mCount, kNone);
+            mNext.assign(mCount, kNone);
+            mRingSize.assign(mCount, 0);
+
+            std::unordered_map<PosKey, uint32_t, PosKeyHash> first;
+            first.reserve(idx.size() / 2);
+            for (uint32_t v : idx) {
+                if (mRemap[v] != kNone) continue;
+                const auto it = first.emplace(MakeKey(PosPtr(positions, stride, v)), v).first;
+                const uint32_t r = it->second;
+                mRemap[v] = r;
+                if (r == v) mNext[v] = v;
+                else { mNext[v] = mNext[r]; mNext[r] = v; }
+                ++mRingSize[r];
+            }
+            for (uint32_t v : idx) mRingSize[v] = mRingSize[mRemap[v]];
+        }
+
+        // 삼각형 평면 + 열린 경계 평면 → 묶음 대표 quadric
+        void InitQuadrics(const std::vector<uint32_t>& idx)
+        {
+            mQ.assign(mCount, Quadric{});
+            Adjacency out;
+            out.Build(idx, mCount, false);
+
+            for (size_t t = 0; t < idx.size(); t += 3) {
+                const uint32_t c[3] = { idx[t], idx[t + 1], idx[t + 2] };
+                const V3 n0 = Cross(Sub(mPos[c[1]], mPos[c[0]]), Sub(mPos[c[2]], mPos[c[0]]));
+                const double len = Len(n0);
+                if (len <= 0.0) continue;
+                const V3 n{ n0.x / len, n0.y / len, n0.z / len };
+                const double d = -Dot(n, mPos[c[0]]);
+                for (int k = 0; k < 3; ++k) mQ[mRemap[c[k]]].AddPlane(n, d, len * 0.5);
+
+                // 열린 변: 변을 지나고 면에 수직인 평면 → 경계가 안쪽으로 끌려 들어가지 않게
+                for (int k = 0; k < 3; ++k) {
+                    const uint32_t a = c[k], b = c[(k + 1) % 3];
+                    if (HasWeldedEdge(out, b, a)) continue;
+                    const V3 e = Sub(mPos[b], mPos[a]);
+                    const double el = Len(e);
+                    if (el <= 0.0) continue;
+                    V3 bn = Cross(e, n);
+                    const double bl = Len(bn);
+                    if (bl <= 0.0) continue;
+                    bn = { bn.x / bl, bn.y / bl, bn.z / bl };
+                    const double bd = -Dot(bn, mPos[a]);
+                    mQ[mRemap[a]].AddPlane(bn, bd, el * el * kBorderWeight);
+                    mQ[mRemap[b]].AddPlane(bn, bd, el * el * kBorderWeight);
+                }
+            }
+        }
+
+        // targets 에 도달할 때마다 기록
+        void Run(std::vector<uint32_t> idx, const size_t* targets, size_t targetCount, double maxError,
+            std::vector<uint32_t>* outs, float* errors, uint64_t* lockedCount)
+        {
+            const double limit = maxError * maxError;
+            double worst = 0.0;
+            size_t k = 0;
+            auto snapshot = [&]() {
+                while (k < targetCount && idx.size() <= targets[k]) {
+                    outs[k] = idx;
+                    errors[k] = (float)std::sqrt(worst);
+                    ++k;
+                }
+                };
+            snapshot();
+
+            size_t widen = 2;
+            for (int pass = 0; k < targetCount && pass < 256; ++pass) {
+                Classify(idx, pass == 0 ? lockedCount : nullptr);
+
+                Adjacency tris;
+                tris.Build(idx, mCount, true);
+
+                // 정점마다 가장 싼 collapse 1개
+                std::vector<double>   cost(mCount, 0.0);
+                std::vector<uint32_t> target(mCount, kNone);
+                for (size_t t = 0; t < idx.size(); t += 3)
+                    for (int e = 0; e < 3; ++e) {
+                        const uint32_t a = idx[t + e], b = idx[t + (e + 1) % 3];
+                        Consider(a, b, cost, target);
+                        Consider(b, a, cost, target);
+                    }
+
+                std::vector<uint32_t> order;
+                for (uint32_t v = 0; v < (uint32_t)mCount; ++v)
+                    if (target[v] != kNone) order.push_back(v);
+                std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+                    return cost[a] < cost[b] || (cost[a] == cost[b] && a < b);
+                    });
+
+                // 서로 1-ring 이 겹치지 않는 collapse 만 한 pass 에 (인접 정보가 그대로 유효)
+                std::vector<uint32_t> collapse(mCount, kNone);
+                std::vector<uint8_t>  changed(mCount, 0);
+                size_t tris_ = idx.size() / 3;
+                const size_t goal = targets[k] / 3;
+                size_t applied = 0;
+
+                // 이번 pass 상한: 목표까지 필요한 collapse 수(× widen) 번째 비용
+                //  - 1-ring 충돌로 밀린 비싼 collapse 를 먼저 하지 않도록 (다음 pass 에서 더 싼 후보가 생김)
+                //  - 싼 후보가 전부 뒤집힘 검사에 걸려 진행이 없으면 범위를 넓힘
+                double passLimit = limit;
+                size_t rank = ((tris_ - goal) / 2 + 1) * widen;
+                if (rank < order.size()) {
+                    if (cost[order[rank - 1]] < passLimit) passLimit = cost[order[rank - 1]];
+                }
+
+                for (uint32_t v : order) {
+                    if (tris_ <= goal) break;
+                    if (cost[v] > passLimit) break;
+
+                    const uint32_t t = target[v];
+                    uint32_t p = kNone, pt = kNone;
+                    if (mKind[v] == Kind::Seam) { p = mNext[v]; pt = SeamPartnerTarget(p, t); }
+
+                    if (changed[v] || changed[t]) continue;
+                    if (p != kNone && (changed[p] || changed[pt])) continue;
+
+                    size_t removed = 0;
+                    if (!CheckFlip(idx, tris, v, t, removed)) continue;
+                    if (p != kNone && !CheckFlip(idx, tris, p, pt, removed)) continue;
+
+                    collapse[v] = t;
+                    if (p != kNone) collapse[p] = pt;
+                    mQ[mRemap[t]].Add(mQ[mRemap[v]]);
+                    if (cost[v] > worst) worst = cost[v];
+
+                    MarkRing(idx, tris, v, changed);
+                    if (p != kNone) MarkRing(idx, tris, p, changed);
+
+                    tris_ -= removed;
+                    ++applied;
+                }
+                if (applied == 0) {
+                    if (rank >= order.size()) break;
+                    widen *= 4;
+                    continue;
+                }
+
+                // 인덱스 다시 쓰고 퇴화 삼각형 제거 (같은 위치 정점 둘 → 면적 0)
+                size_t w = 0;
+                for (size_t i = 0; i < idx.size(); i += 3) {
+                    uint32_t c[3];
+                    for (int j = 0; j < 3; ++j) c[j] = (collapse[idx[i + j]] != kNone) ? collapse[idx[i + j]] : idx[i + j];
+                    if (mRemap[c[0]] == mRemap[c[1]] || mRemap[c[1]] == mRemap[c[2]] || mRemap[c[0]] == mRemap[c[2]]) continue;
+                    idx[w++] = c[0]; idx[w++] = c[1]; idx[w++] = c[2];
+                }
+                idx.resize(w);
+                snapshot();
+            }
+
+            // 목표에 못 미친 단계는 마지막 결과
+            for (; k < targetCount; ++k) {
+                outs[k] = idx;
+                errors[k] = (float)std::sqrt(worst);
+            }
+        }
+
+    private:
+        bool HasEdge(const Adjacency& out, uint32_t a, uint32_t b) const
+        {
+            for (const uint32_t* it = out.Begin(a); it != out.End(a); ++it) if (*it == b) return true;
+            return false;
+        }
+
+        // a 묶음 어느 정점에서든 b 묶음으로 가는 변이 있는지 (seam 을 무시한 위상)
+        bool HasWeldedEdge(const Adjacency& out, uint32_t a, uint32_t b) const
+        {
+            const uint32_t rb = mRemap[b];
+            uint32_t w = a;
+            do {
+                for (const uint32_t* it = out.Begin(w); it != out.End(w); ++it) if (mRemap[*it] == rb) return true;
+                w = mNext[w];
+            } while (w != a);
+            return false;
+        }
+
+        // 열린 변 (원래 인덱스 / 위치 묶음) 개수로 정점 종류 결정
+        void Classify(const std::vector<uint32_t>& idx, uint64_t* lockedCount)
+        {
+            Adjacency out;
+            out.Build(idx, mCount, false);
+
+            std::vector<uint8_t> openOut(mCount, 0), openIn(mCount, 0), weldedOpen(mCount, 0);
+            mOpenNext.assign(mCount, kNone);
+            mOpenPrev.assign(mCount, kNone);
+            for (size_t t = 0; t < idx.size(); t += 3)
+                for (int e = 0; e < 3; ++e) {
+                    const uint32_t a = idx[t + e], b = idx[t + (e + 1) % 3];
+                    if (!HasEdge(out, b, a)) {
+                        if (openOut[a] < 255) ++openOut[a];
+                        if (openIn[b] < 255) ++openIn[b];
+                        mOpenNext[a] = b;
+                        mOpenPrev[b] = a;
+                    }
+                    if (!HasWeldedEdge(out, b, a)) {
+                        if (weldedOpen[a] < 255) ++weldedOpen[a];
+                        if (weldedOpen[b] < 255) ++weldedOpen[b];
+                    }
+                }
+
+            mKind.assign(mCount, Kind::Locked);
+            std::vector<uint8_t> seen(mCount, 0);
+            for (uint32_t v : idx) {
+                if (seen[v]) continue;
+                seen[v] = 1;
+
+                Kind k = Kind::Locked;
+                const bool single = openOut[v] == 1 && openIn[v] == 1;
+                if (mLocked && mLocked[v]) k = Kind::Locked;
+                else if (mRingSize[v] == 1) {
+                    if (weldedOpen[v] == 0 && openOut[v] == 0 && openIn[v] == 0) k = Kind::Manifold;
+                    else if (weldedOpen[v] == 2 && single) k = Kind::Border;
+                }
+                else if (mRingSize[v] == 2) {
+                    const uint32_t p = mNext[v];
+                    if (weldedOpen[v] == 0 && weldedOpen[p] == 0 && single && openOut[p] == 1 && openIn[p] == 1
+                        && !(mLocked && mLocked[p])) k = Kind::Seam;
+                }
+                mKind[v] = k;
+                if (k == Kind::Locked && lockedCount) ++*lockedCount;
+            }
+        }
+
+        // seam 짝 p 가 v→t 와 같은 위치로 가는 열린 변 끝
+        uint32_t SeamPartnerTarget(uint32_t p, uint32_t t) const
+        {
+            if (mOpenNext[p] != kNone && mRemap[mOpenNext[p]] == mRemap[t]) return mOpenNext[p];
+            if (mOpenPrev[p] != kNone && mRemap[mOpenPrev[p]] == mRemap[t]) return mOpenPrev[p];
+            return kNone;
+        }
+
+        void Consider(uint32_t v, uint32_t t, std::vector<double>& cost, std::vector<uint32_t>& target) const
+        {
+            switch (mKind[v]) {
+            case Kind::Manifold: break;
+            case Kind::Border:
+                if (t != mOpenNext[v] && t != mOpenPrev[v]) return;
+                break;
+            case Kind::Seam:
+                if (t != mOpenNext[v] && t != mOpenPrev[v]) return;
+                if (SeamPartnerTarget(mNext[v], t) == kNone) return;
+                break;
+            default: return;
+            }
+
+            Quadric q = mQ[mRemap[v]];
+            q.Add(mQ[mRemap[t]]);
+            const double c = q.Error(mPos[t]);
+            if (target[v] == kNone || c < cost[v]) { cost[v] = c; target[v] = t; }
+        }
+
+        // v 를 t 위치로 옮겼을 때 v 주변 삼각형이 뒤집히거나 찌그러지지 않는지. removed: 없어지는 삼각형 수
+        bool CheckFlip(const std::vector<uint32_t>& idx, const Adjacency& tris, uint32_t v, uint32_t t, size_t& removed) const
+        {
+            const uint32_t rt = mRemap[t];
+            size_t gone = 0;
+            for (const uint32_t* it = tris.Begin(v); it != tris.End(v); ++it) {
+                const uint32_t* c = idx.data() + (size_t)*it * 3;
+                if (mRemap[c[0]] == rt || mRemap[c[1]] == rt || mRemap[c[2]] == rt) { ++gone; continue; }
+
+                V3 p[3], q[3];
+                for (int j = 0; j < 3; ++j) { p[j] = mPos[c[j]]; q[j] = (c[j] == v) ? mPos[t] : p[j]; }
+                const V3 n0 = Cross(Sub(p[1], p[0]), Sub(p[2], p[0]));
+                const V3 n1 = Cross(Sub(q[1], q[0]), Sub(q[2], q[0]));
+                // 75° 넘게 돌거나 면적이 거의 0 이 되면 거부 (뒤집힘 / 일직선 삼각형)
+                const double l0 = Len(n0), l1 = Len(n1);
+                if (l0 > 0.0 && (Dot(n0, n1) <= 0.25 * l0 * l1 || l1 < 1.0e-2 * l0)) return false;
+            }
+            removed += gone;
+            return true;
+        }
+
+        void MarkRing(const std::vector<uint32_t>& idx, const Adjacency& tris, uint32_t v, std::vector<uint8_t>& changed) const
+        {
+            changed[v] = 1;
+            for (const uint32_t* it = tris.Begin(v); it != tris.End(v); ++it)
+                for (int j = 0; j < 3; ++j) changed[idx[(size_t)*it * 3 + j]] = 1;
+        }
+
+        const uint8_t* mLocked;
+        size_t mCount;
+        std::vector<V3> mPos;
+        std::vector<uint32_t> mRemap, mNext, mRingSize;
+        std::vector<uint32_t> mOpenNext, mOpenPrev;
+        std::vector<Kind> mKind;
+        std::vector<Quadric> mQ;
+    };
+
+    std::mutex s_totalsMx;
+    MeshLodReport s_totals;     // s_totalsMx 로 보호
+}
+
+// ============================================================================
+// 단순화
+// ============================================================================
+void MeshLodSimplify(const uint32_t* indices, size_t indexCount, const float* positions, size_t positionStride,
+    size_t vertexCount, const uint8_t* locked, const size_t* targets, size_t targetCount, float maxError,
+    std::vector<uint32_t>* outs, float* errors, uint64_t* lockedCount)
+{
+    std::vector<uint32_t> idx(indices, indices + (indexCount / 3) * 3);
+
+    Simplifier s(positions, positionStride, vertexCount, locked);
+    s.Weld(idx, positions, positionStride);
+    s.InitQuadrics(idx);
+    s.Run(std::move(idx), targets, targetCount, maxError, outs, errors, lockedCount);
+}
+
+// ============================================================================
+// 서브메시별 생성
+// ============================================================================
+void MeshLodReport::Merge(const MeshLodReport& o)
+{
+    submeshes += o.submeshes;
+    lockedVertices += o.lockedVertices;
+    for (uint32_t i = 0; i < kMeshLodLevels; ++i) triangles[i] += o.triangles[i];
+    ms += o.ms;
+}
+
+void MeshLodGenerate(const std::vector<VertexCPU_PNTT>& vertices, std::vector<uint32_t>& indices,
+    const std::vector<SubMeshCPU>& submeshes, std::vector<SubMeshLodCPU>& lods,
+    MeshLodReport* report, const MeshLodSettings& s)
+{
+    const auto t0 = std::chrono::steady_clock::now();
+    MeshLodReport rep;
+    constexpr uint32_t kExtra = kMeshLodLevels - 1;
+    lods.assign(submeshes.size() * kExtra, SubMeshLodCPU{});
+
+    const size_t lod0Indices = indices.size();
+    const float* positions = &vertices.data()->px;
+    const size_t stride = sizeof(VertexCPU_PNTT);
+
+    // 머티리얼 경계: 서로 다른 서브메시가 같은 위치를 쓰면 그 위치 정점은 잠금 (양쪽이 따로 접혀 틈이 생기지 않게)
+    std::vector<uint8_t> locked;
+    if (submeshes.size() > 1 && !vertices.empty()) {
+        constexpr uint32_t kMulti = kNone - 1;
+        std::unordered_map<PosKey, uint32_t, PosKeyHash> owner;
+        owner.reserve(vertices.size());
+        for (size_t i = 0; i < submeshes.size(); ++i) {
+            const SubMeshCPU& sm = submeshes[i];
+            if (sm.indexStart >= lod0Indices) continue;
+            size_t end = (size_t)sm.indexStart + sm.indexCount;
+            if (end > lod0Indices) end = lod0Indices;
+            for (size_t k = sm.indexStart; k < end; ++k) {
+                if (indices[k] >= vertices.size()) continue;
+                auto it = owner.emplace(MakeKey(&vertices[indices[k]].px), (uint32_t)i).first;
+                if (it->second != (uint32_t)i) it->second = kMulti;
+            }
+        }
+        locked.assign(vertices.size(), 0);
+        for (size_t v = 0; v < vertices.size(); ++v) {
+            const auto it = owner.find(MakeKey(&vertices[v].px));
+            if (it != owner.end() && it->second == kMulti) locked[v] = 1;
+        }
+    }
+
+    std::vector<uint32_t> local;
+    std::vector<uint32_t> outs[kExtra];
+    for (size_t i = 0; i < submeshes.size(); ++i) {
+        const SubMeshCPU& sm = submeshes[i];
+        SubMeshLodCPU prev{ sm.indexStart, sm.indexCount, 0.0f, 0 };
+        auto fill = [&](uint32_t from) { for (uint32_t k = from; k < kExtra; ++k) lods[i * kExtra + k] = prev; };
+
+        // MeshOptimize 와 같은 범위 검사. 쓸 수 없는 서브메시는 모든 단계 = LOD0
+        size_t count = 0;
+        if (sm.indexStart < lod0Indices) {
+            count = sm.indexCount;
+            if (count > lod0Indices - sm.indexStart) count = lod0Indices - sm.indexStart;
+        }
+        uint32_t vmin = UINT32_MAX, vmax = 0;
+        bool valid = count >= 3 && count % 3 == 0;
+        for (size_t k = sm.indexStart; valid && k < sm.indexStart + count; ++k) {
+            const uint32_t v = indices[k];
+            if (v >= vertices.size()) valid = false;
+            if (v < vmin) vmin = v;
+            if (v > vmax) vmax = v;
+        }
+
+        ++rep.submeshes;
+        rep.triangles[0] += count / 3;
+        if (!s.enabled || !valid || count / 3 < s.minTriangles) {
+            fill(0);
+            for (uint32_t k = 1; k < kMeshLodLevels; ++k) rep.triangles[k] += count / 3;
+            continue;
+        }
+
+        const size_t vc = (size_t)vmax - vmin + 1;
+        local.assign(indices.begin() + sm.indexStart, indices.begin() + sm.indexStart + count);
+        for (uint32_t& v : local) v -= vmin;
+
+        // 허용 오차: 서브메시 바운딩 박스 대각선 기준
+        float lo[3] = { FLT_MAX, FLT_MAX, FLT_MAX }, hi[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+        for (uint32_t v : local)
+            for (int a = 0; a < 3; ++a) {
+                const float p = (&vertices[vmin + v].px)[a];
+                if (p < lo[a]) lo[a] = p;
+                if (p > hi[a]) hi[a] = p;
+            }
+        const float diag = std::sqrt((hi[0] - lo[0]) * (hi[0] - lo[0]) + (hi[1] - lo[1]) * (hi[1] - lo[1]) + (hi[2] - lo[2]) * (hi[2] - lo[2]));
+
+        size_t targets[kExtra];
+        double r = 1.0;
+        for (uint32_t k = 0; k < kExtra; ++k) {
+            r *= s.ratio;
+            targets[k] = (size_t)((double)(count / 3) * r) * 3;
+        }
+
+        float errors[kExtra] = {};
+        MeshLodSimplify(local.data(), local.size(), positions + (size_t)vmin * (stride / sizeof(float)), stride, vc,
+            locked.empty() ? nullptr : locked.data() + vmin, targets, kExtra, s.maxError * diag,
+            outs, errors, &rep.lockedVertices);
+
+        for (uint32_t k = 0; k < kExtra; ++k) {
+            std::vector<uint32_t>& o = outs[k];
+            if (!o.empty() && o.size() < prev.indexCount) {
+                // 단계마다 정점 캐시 순서 (정점 순서는 LOD0 공유라 fetch 재배치는 안 함)
+                MeshOptVertexCache(o.data(), o.size(), vc);
+                prev.indexStart = (uint32_t)indices.size();
+                prev.indexCount = (uint32_t)o.size();
+                prev.error = errors[k];
+                for (uint32_t v : o) indices.push_back(v + vmin);
+            }
+            lods[i * kExtra + k] = prev;
+            rep.triangles[k + 1] += prev.indexCount / 3;
+        }
+    }
+
+    rep.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    if (report) report->Merge(rep);
+}
+
+MeshLodReport MeshLodTotalsSnapshot()
+{
+    std::lock_guard<std::mutex> lock(s_totalsMx);
+    return s_totals;
+}
+
+void MeshLodResetTotals()
+{
+    std::lock_guard<std::mutex> lock(s_totalsMx);
+    s_totals = {};
+}
+
+void MeshLodAddToTotals(const MeshLodReport& r)
+{
+    std::lock_guard<std::mutex> lock(s_totalsMx);
+    s_totals.Merge(r);
+}
+
+void MeshLodPrintReport(const char* label, const MeshLodReport& r)
+{
+    printf("[MeshLod] %s: %llu submeshes, tris", label, (unsigned long long)r.submeshes);
+    for (uint32_t i = 0; i < kMeshLodLevels; ++i)
+        printf("%s%llu", i ? " / " : " ", (unsigned long long)r.triangles[i]);
+    printf(" | %llu locked verts | %.2f ms\n", (unsigned long long)r.lockedVertices, r.ms);
+}
+
+// ============================================================================
+// 선택
+// ============================================================================
+float MeshLodPixelsPerUnit(const float c[3], float radius,
+    const float V[16], const float P[16], float viewportH)
+{
+    // 직교: 거리와 무관 (화면 높이 = 2 / P22 단위)
+    if (P[11] == 0.0f) return 0.5f * viewportH * P[5];
+
+    // 원근: 바운딩 구의 가장 가까운 점까지 거리 (큐브 면 밖 물체도 같은 기준)
+    const float vx = c[0] * V[0] + c[1] * V[4] + c[2] * V[8] + V[12];
+    const float vy = c[0] * V[1] + c[1] * V[5] + c[2] * V[9] + V[13];
+    const float vz = c[0] * V[2] + c[1] * V[6] + c[2] * V[10] + V[14];
+    const float d = std::sqrt(vx * vx + vy * vy + vz * vz) - radius;
+    if (d <= 1.0e-4f) return 1.0e9f;
+    return 0.5f * viewportH * P[5] / d;
+}
+
+uint32_t MeshLodSelect(const float* errors, uint32_t levelCount, float pixelsPerUnit, float maxPixels, uint32_t bias)
+{
+    if (levelCount == 0) return 0;
+
+    uint32_t lod = 0;
+    for (uint32_t i = 1; i < levelCount; ++i)
+        if (errors[i] * pixelsPerUnit <= maxPixels) lod = i;
+    lod += bias;
+    return (lod < levelCount) ? lod : levelCount - 1;
+}
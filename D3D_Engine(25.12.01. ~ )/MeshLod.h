@@ -0,0 +1,74 @@
+﻿// ============================================================================
+// MeshLod.h
+// - 정적 메시 LOD: 임포트 때 서브메시마다 단계 생성 + 실행 중 화면 오차로 선택
+//   · 생성: quadric edge collapse (Garland-Heckbert). 정점을 새로 만들지 않고 기존 정점으로 합침
+//     → 정점 버퍼는 LOD0 것을 공유, 단계마다 인덱스만 인덱스 버퍼 뒤에 덧붙임
+//   · 경계: 열린 경계는 경계선 방향으로만, UV/노멀 seam(같은 위치 정점 2개)은 두 쪽을 같이 접음
+//     다른 서브메시(머티리얼)와 위치를 공유하는 정점, 그 밖의 복잡한 정점은 잠금 → 머티리얼 경계 틈 없음
+//   · 단계마다 목표 삼각형 ratio 배 (1 → 1/2 → 1/4 → 1/8). 오차 한도를 넘으면 그 단계에서 멈춤
+//   · 단계 오차: 적용한 collapse 중 최대 quadric 오차의 제곱근 (오브젝트 공간 거리)
+// - 선택: 단계 오차를 화면 픽셀로 투영 → 허용 픽셀 이하인 가장 거친 단계 (+ 그림자 패스 bias)
+// - 순수 C++ (D3D / Assimp 없음). 결과 배치는 MeshDataEx.h SubMeshLodCPU 참고
+// ============================================================================
+
+#pragma once
+
+// ---- includes ----
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "MeshDataEx.h"
+
+struct MeshLodSettings
+{
+    bool  enabled = true;
+    float ratio = 0.5f;                 // 단계마다 목표 삼각형 비율
+    float maxError = 0.1f;              // 서브메시 바운딩 박스 대각선 대비 허용 오차
+    uint32_t minTriangles = 64;         // 이보다 작은 서브메시는 LOD 없음 (모든 단계 = LOD0)
+};
+
+struct MeshLodReport
+{
+    uint64_t submeshes = 0;
+    uint64_t lockedVertices = 0;                    // 경계 / seam 분류에서 잠긴 정점
+    uint64_t triangles[kMeshLodLevels] = {};        // 단계별 삼각형 합 (LOD0 포함)
+    double   ms = 0.0;
+
+    void Merge(const MeshLodReport& o);
+};
+
+// submeshes 마다 LOD1~ 생성 → indices 뒤에 덧붙이고 lods 를 채움 (기존 서브메시 범위는 그대로)
+//  - lods.size() == submeshes.size() × (kMeshLodLevels - 1)
+//  - 더 줄이지 못한 단계는 바로 앞 단계 범위를 그대로 씀 (인덱스 중복 없음)
+void MeshLodGenerate(const std::vector<VertexCPU_PNTT>& vertices, std::vector<uint32_t>& indices,
+    const std::vector<SubMeshCPU>& submeshes, std::vector<SubMeshLodCPU>& lods,
+    MeshLodReport* report, const MeshLodSettings& settings = {});
+
+// 불러온 메시 전체 합계 (임포트할 때만 누적)
+//  - 병렬 로드 / 스트리밍 I/O 스레드가 동시에 누적 → 읽기는 잠금 안에서 복사한 스냅샷으로만
+MeshLodReport MeshLodTotalsSnapshot();
+void MeshLodResetTotals();
+void MeshLodAddToTotals(const MeshLodReport& r);
+void MeshLodPrintReport(const char* label, const MeshLodReport& r);
+
+// ---------------------------------------------------------------------------
+// 단순화 (로컬 인덱스: 0 ≤ idx < vertexCount, indexCount 는 3의 배수)
+//  - targets[k] 인덱스 수에 도달할 때마다 그 시점 결과를 outs[k] / errors[k] 에 (targets 는 감소 순)
+//  - locked: 정점별 잠금 (nullptr 가능). maxError: 오브젝트 공간 거리
+//  - 목표에 못 미친 단계는 마지막 결과 그대로
+// ---------------------------------------------------------------------------
+void MeshLodSimplify(const uint32_t* indices, size_t indexCount, const float* positions, size_t positionStride,
+    size_t vertexCount, const uint8_t* locked, const size_t* targets, size_t targetCount, float maxError,
+    std::vector<uint32_t>* outs, float* errors, uint64_t* lockedCount = nullptr);
+
+// ---------------------------------------------------------------------------
+// 선택
+//  - MeshLodPixelsPerUnit: 월드 공간 바운딩 구의 가장 가까운 점에서 1 단위가 몇 px 인지
+//    view/proj: row-major 4x4 (SimpleMath 배치, LH). 원근/직교 둘 다 (proj[11] == 0 이면 직교)
+//    구 안에 시점이 있으면 매우 큰 값 (→ LOD0)
+//  - MeshLodSelect: errors[lod] × pixelsPerUnit ≤ maxPixels 인 가장 거친 단계 + bias (levelCount-1 까지)
+// ---------------------------------------------------------------------------
+float MeshLodPixelsPerUnit(const float center[3], float radius,
+    const float view[16], const float proj[16], float viewportH);
+uint32_t MeshLodSelect(const float* errors, uint32_t levelCount, float pixelsPerUnit, float maxPixels, uint32_t bias);
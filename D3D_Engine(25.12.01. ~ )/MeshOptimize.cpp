@@ -0,0 +1,471 @@
+﻿// ============================================================================
+// MeshOptimize.cpp
+// - MeshOptimize 구현: Forsyth 정점 캐시 / 오버드로 클러스터 정렬 / fetch 재배치 / 분석
+// ============================================================================
+
+// ---- includes ----
+#include "../D3D_Core/pch.h"
+#include "MeshOptimize.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <numeric>
+
+namespace
+{
+    // ------------------------------------------------------------------------
+    // FIFO 캐시 시뮬레이션 (post-transform cache)
+    //  - 정점마다 들어간 시각만 기록 → 리셋은 시각을 cacheSize 만큼 건너뛰면 끝 (O(1))
+    // ------------------------------------------------------------------------
+    class FifoCache
+    {
+    public:
+        FifoCache(size_t vertexCount, uint32_t size) : mStamp(vertexCount, 0), mSize(size), mTime(size + 1) {}
+
+        // 미스면 true (캐시에 넣음)
+        bool Access(uint32_t v)
+        {
+            if (mTime - mStamp[v] < mSize) return false;
+            mStamp[v] = mTime++;
+            return true;
+        }
+        uint32_t Triangle(const uint32_t* t) { return (uint32_t)Access(t[0]) + Access(t[1]) + Access(t[2]); }
+        void Reset() { mTime += mSize + 1; }
+
+    private:
+        std::vector<uint64_t> mStamp;
+        uint64_t mSize;
+        uint64_t mTime;
+    };
+
+    // ------------------------------------------------------------------------
+    // Forsyth 점수 ("Linear-Speed Vertex Cache Optimisation")
+    // ------------------------------------------------------------------------
+    constexpr int kForsythCache = 32;
+    constexpr uint32_t kForsythValence = 32;   // 이 이상은 공식으로 계산
+
+    float VertexScoreSlow(int cachePos, uint32_t remaining)
+    {
+        if (remaining == 0) return -1.0f;   // 더 쓸 삼각형 없음
+
+        float s = 0.0f;
+        if (cachePos >= 0) {
+            if (cachePos < 3) s = 0.75f;     // 방금 쓴 삼각형 정점: 같은 삼각형 반복 방지로 살짝 낮게
+            else s = std::pow(1.0f - (float)(cachePos - 3) / (float)(kForsythCache - 3), 1.5f);
+        }
+        // 남은 삼각형이 적은 정점 우선 (외톨이 삼각형이 남지 않게)
+        return s + 2.0f / std::sqrt((float)remaining);
+    }
+
+    // 삼각형 하나 낼 때마다 캐시 정점 전부 다시 점수 → pow/sqrt 는 표로
+    struct ForsythTable
+    {
+        float score[kForsythCache + 1][kForsythValence];   // [cachePos + 1][remaining]
+
+        ForsythTable()
+        {
+            for (int c = -1; c < kForsythCache; ++c)
+                for (uint32_t r = 0; r < kForsythValence; ++r) score[c + 1][r] = VertexScoreSlow(c, r);
+        }
+    };
+
+    float VertexScore(int cachePos, uint32_t remaining)
+    {
+        static const ForsythTable s_table;
+        return (remaining < kForsythValence) ? s_table.score[cachePos + 1][remaining] : VertexScoreSlow(cachePos, remaining);
+    }
+
+    struct Float3 { float x, y, z; };
+
+    Float3 Pos(const float* positions, size_t stride, uint32_t v)
+    {
+        const float* p = reinterpret_cast<const float*>(reinterpret_cast<const uint8_t*>(positions) + (size_t)v * stride);
+        return { p[0], p[1], p[2] };
+    }
+
+    // ------------------------------------------------------------------------
+    // 정점 배열 공통 구현 (정점 타입은 바이트 크기 + 위치 오프셋으로만 다룸)
+    // ------------------------------------------------------------------------
+    void OptimizeImpl(uint8_t* vertices, size_t vertexBytes, size_t vertexCount,
+        std::vector<uint32_t>& indices, const std::vector<SubMeshCPU>& submeshes,
+        size_t fetchBytes, MeshOptReport* report, const MeshOptSettings& s)
+    {
+        const auto t0 = std::chrono::steady_clock::now();
+        MeshOptReport rep;
+
+        struct Range { size_t begin = 0, count = 0; uint32_t vmin = 0, vmax = 0; bool valid = false, overlap = false; };
+        std::vector<Range> ranges(submeshes.size());
+
+        // 서브메시별 인덱스 / 정점 범위
+        for (size_t i = 0; i < submeshes.size(); ++i) {
+            const SubMeshCPU& sm = submeshes[i];
+            Range& r = ranges[i];
+            if (sm.indexStart >= indices.size()) continue;
+            r.begin = sm.indexStart;
+            r.count = sm.indexCount;
+            if (r.count > indices.size() - sm.indexStart) r.count = indices.size() - sm.indexStart;
+            if (r.count < 3 || r.count % 3 != 0) continue;
+
+            r.vmin = UINT32_MAX; r.vmax = 0;
+            bool inBounds = true;
+            for (size_t k = r.begin; k < r.begin + r.count; ++k) {
+                const uint32_t v = indices[k];
+                if (v >= vertexCount) { inBounds = false; break; }
+                if (v < r.vmin) r.vmin = v;
+                if (v > r.vmax) r.vmax = v;
+            }
+            r.valid = inBounds;
+        }
+
+        // 정점 범위가 겹치는 서브메시는 fetch 재배치 불가 (다른 서브메시 인덱스가 깨짐)
+        for (size_t i = 0; i < ranges.size(); ++i)
+            for (size_t j = i + 1; j < ranges.size(); ++j) {
+                Range& a = ranges[i];
+                Range& b = ranges[j];
+                if (!a.valid || !b.valid) continue;
+                if (a.vmin <= b.vmax && b.vmin <= a.vmax) a.overlap = b.overlap = true;
+            }
+
+        std::vector<uint32_t> local;
+        std::vector<uint32_t> remap;
+        std::vector<uint8_t> scratch;
+        for (const Range& r : ranges) {
+            if (!r.valid) continue;
+
+            const size_t vc = (size_t)r.vmax - r.vmin + 1;
+            local.assign(indices.begin() + r.begin, indices.begin() + r.begin + r.count);
+            for (uint32_t& v : local) v -= r.vmin;
+
+            uint8_t* base = vertices + (size_t)r.vmin * vertexBytes;
+            const float* positions = reinterpret_cast<const float*>(base);   // px 가 정점 맨 앞
+
+            remap.resize(vc);
+            const size_t used = MeshOptFetchRemap(local.data(), local.size(), vc, remap.data());
+
+            ++rep.submeshes;
+            rep.triangles += r.count / 3;
+            rep.vertices += used;
+            rep.fetchUniqueBytes += (uint64_t)used * fetchBytes;
+            rep.missesBefore += MeshOptCacheMisses(local.data(), local.size(), vc, s.cacheSize);
+            rep.fetchBytesBefore += MeshOptFetchBytes(local.data(), local.size(), vc, fetchBytes);
+
+            if (s.vertexCache) MeshOptVertexCache(local.data(), local.size(), vc);
+            if (s.overdraw) MeshOptOverdraw(local.data(), local.size(), positions, vertexBytes, vc, s.cacheSize, s.overdrawThreshold);
+
+            if (s.vertexFetch && !r.overlap) {
+                MeshOptFetchRemap(local.data(), local.size(), vc, remap.data());
+                scratch.resize(vc * vertexBytes);
+                for (size_t v = 0; v < vc; ++v)
+                    std::memcpy(scratch.data() + (size_t)remap[v] * vertexBytes, base + v * vertexBytes, vertexBytes);
+                std::memcpy(base, scratch.data(), scratch.size());
+                for (uint32_t& v : local) v = remap[v];
+            }
+            else if (s.vertexFetch) ++rep.skippedFetch;
+
+            rep.missesAfter += MeshOptCacheMisses(local.data(), local.size(), vc, s.cacheSize);
+            rep.fetchBytesAfter += MeshOptFetchBytes(local.data(), local.size(), vc, fetchBytes);
+
+            for (size_t k = 0; k < r.count; ++k) indices[r.begin + k] = local[k] + r.vmin;
+        }
+
+        rep.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+        if (report) report->Merge(rep);
+    }
+
+    std::mutex s_totalsMx;
+    MeshOptReport s_totals;     // s_totalsMx 로 보호
+}
+
+// ============================================================================
+// 1) 정점 캐시 (Forsyth)
+// ============================================================================
+void MeshOptVertexCache(uint32_t* indices, size_t indexCount, size_t vertexCount)
+{
+    const size_t triCount = indexCount / 3;
+    if (triCount < 2) return;
+
+    // 정점 → 삼각형 인접 목록 (앞쪽 remaining[v] 개가 아직 안 쓴 삼각형)
+    std::vector<uint32_t> remaining(vertexCount, 0);
+    for (size_t i = 0; i < triCount * 3; ++i) ++remaining[indices[i]];
+
+    std::vector<uint32_t> offset(vertexCount + 1, 0);
+    for (size_t v = 0; v < vertexCount; ++v) offset[v + 1] = offset[v] + remaining[v];
+
+    std::vector<uint32_t> adj(triCount * 3);
+    {
+        std::vector<uint32_t> fill(offset.begin(), offset.end() - 1);
+        for (size_t t = 0; t < triCount; ++t)
+            for (int k = 0; k < 3; ++k) adj[fill[indices[t * 3 + k]]++] = (uint32_t)t;
+    }
+
+    std::vector<int>   cachePos(vertexCount, -1);
+    std::vector<float> vScore(vertexCount);
+    for (size_t v = 0; v < vertexCount; ++v) vScore[v] = VertexScore(-1, remaining[v]);
+
+    std::vector<float> tScore(triCount);
+    std::vector<uint8_t> emitted(triCount, 0);
+    for (size_t t = 0; t < triCount; ++t)
+        tScore[t] = vScore[indices[t * 3]] + vScore[indices[t * 3 + 1]] + vScore[indices[t * 3 + 2]];
+
+    std::vector<uint32_t> out;
+    out.reserve(triCount * 3);
+
+    uint32_t cache[kForsythCache + 3];
+    int cacheCount = 0;
+    size_t cursor = 0;
+    int64_t best = (int64_t)(std::max_element(tScore.begin(), tScore.end()) - tScore.begin());
+
+    for (size_t n = 0; n < triCount; ++n) {
+        // 캐시 주변에 후보가 없으면 아직 안 쓴 첫 삼각형부터 다시
+        if (best < 0) {
+            while (emitted[cursor]) ++cursor;
+            best = (int64_t)cursor;
+        }
+
+        const uint32_t* tri = indices + (size_t)best * 3;
+        out.insert(out.end(), tri, tri + 3);
+        emitted[best] = 1;
+
+        // 인접 목록에서 뺌 (앞쪽 구간 끝과 맞바꿈)
+        for (int k = 0; k < 3; ++k) {
+            const uint32_t v = tri[k];
+            uint32_t* list = adj.data() + offset[v];
+            for (uint32_t i = 0; i < remaining[v]; ++i)
+                if (list[i] == (uint32_t)best) { std::swap(list[i], list[remaining[v] - 1]); --remaining[v]; break; }
+        }
+
+        // 새 캐시: 방금 삼각형 정점이 앞, 나머지는 한 칸씩 밀림
+        uint32_t next[kForsythCache + 3];
+        int nextCount = 0;
+        auto push = [&](uint32_t v) {
+            for (int i = 0; i < nextCount; ++i) if (next[i] == v) return;
+            next[nextCount++] = v;
+            };
+        for (int k = 0; k < 3; ++k) push(tri[k]);
+        for (int i = 0; i < cacheCount; ++i) push(cache[i]);
+
+        // 점수 갱신 (밀려난 정점 포함) → 캐시 정점에 붙은 삼각형 중 최고점
+        for (int i = 0; i < nextCount; ++i) {
+            const uint32_t v = next[i];
+            cachePos[v] = (i < kForsythCache) ? i : -1;
+            const float s = VertexScore(cachePos[v], remaining[v]);
+            const float d = s - vScore[v];
+            vScore[v] = s;
+            for (uint32_t j = 0; j < remaining[v]; ++j) tScore[adj[offset[v] + j]] += d;
+        }
+
+        cacheCount = (nextCount < kForsythCache) ? nextCount : kForsythCache;
+        std::memcpy(cache, next, sizeof(uint32_t) * cacheCount);
+
+        best = -1;
+        float bestScore = -1e30f;
+        for (int i = 0; i < cacheCount; ++i) {
+            const uint32_t v = cache[i];
+            for (uint32_t j = 0; j < remaining[v]; ++j) {
+                const uint32_t t = adj[offset[v] + j];
+                if (tScore[t] > bestScore) { bestScore = tScore[t]; best = t; }
+            }
+        }
+    }
+
+    std::memcpy(indices, out.data(), out.size() * sizeof(uint32_t));
+}
+
+// ============================================================================
+// 2) 오버드로 (캐시 순서를 클러스터 단위로 앞뒤 정렬)
+// ============================================================================
+void MeshOptOverdraw(uint32_t* indices, size_t indexCount, const float* positions, size_t positionStride,
+    size_t vertexCount, uint32_t cacheSize, float threshold)
+{
+    const size_t triCount = indexCount / 3;
+    if (triCount < 2) return;
+
+    FifoCache cache(vertexCount, cacheSize);
+
+    // 하드 경계: 세 정점 모두 미스 (캐시 순서가 어차피 끊긴 곳 → 잘라도 손해 없음)
+    std::vector<size_t> hard;
+    for (size_t t = 0; t < triCount; ++t)
+        if (cache.Triangle(indices + t * 3) == 3 || t == 0) hard.push_back(t);
+    hard.push_back(triCount);
+
+    // 소프트 경계: 클러스터 안에서 지금까지 ACMR 이 클러스터 ACMR × threshold 이하이면 자름
+    std::vector<size_t> clusters;
+    for (size_t h = 0; h + 1 < hard.size(); ++h) {
+        const size_t a = hard[h], b = hard[h + 1];
+
+        cache.Reset();
+        uint32_t clusterMisses = 0;
+        for (size_t t = a; t < b; ++t) clusterMisses += cache.Triangle(indices + t * 3);
+        const float limit = threshold * (float)clusterMisses / (float)(b - a);
+
+        cache.Reset();
+        clusters.push_back(a);
+        size_t start = a;
+        uint32_t misses = 0;
+        for (size_t t = a; t < b; ++t) {
+            misses += cache.Triangle(indices + t * 3);
+            if (t + 1 < b && (float)misses <= limit * (float)(t + 1 - start)) {
+                clusters.push_back(t + 1);
+                start = t + 1;
+                misses = 0;
+                cache.Reset();
+            }
+        }
+    }
+    clusters.push_back(triCount);
+
+    // 메시 중심 (면적 가중)
+    auto triInfo = [&](size_t t, Float3& c, Float3& n) {
+        const Float3 p0 = Pos(positions, positionStride, indices[t * 3]);
+        const Float3 p1 = Pos(positions, positionStride, indices[t * 3 + 1]);
+        const Float3 p2 = Pos(positions, positionStride, indices[t * 3 + 2]);
+        const Float3 e1{ p1.x - p0.x, p1.y - p0.y, p1.z - p0.z };
+        const Float3 e2{ p2.x - p0.x, p2.y - p0.y, p2.z - p0.z };
+        n = { e1.y * e2.z - e1.z * e2.y, e1.z * e2.x - e1.x * e2.z, e1.x * e2.y - e1.y * e2.x };   // |n| = 면적 × 2
+        c = { (p0.x + p1.x + p2.x) / 3.0f, (p0.y + p1.y + p2.y) / 3.0f, (p0.z + p1.z + p2.z) / 3.0f };
+        };
+
+    double mx = 0, my = 0, mz = 0, marea = 0;
+    for (size_t t = 0; t < triCount; ++t) {
+        Float3 c, n;
+        triInfo(t, c, n);
+        const double area = std::sqrt((double)n.x * n.x + (double)n.y * n.y + (double)n.z * n.z);
+        mx += c.x * area; my += c.y * area; mz += c.z * area; marea += area;
+    }
+    if (marea > 0) { mx /= marea; my /= marea; mz /= marea; }
+
+    // 클러스터 정렬 키: (클러스터 중심 - 메시 중심) · 클러스터 법선. 바깥을 보는 클러스터가 먼저
+    struct Cluster { size_t begin, end; float key; };
+    std::vector<Cluster> order(clusters.size() - 1);
+    for (size_t i = 0; i + 1 < clusters.size(); ++i) {
+        double cx = 0, cy = 0, cz = 0, area = 0, nx = 0, ny = 0, nz = 0;
+        for (size_t t = clusters[i]; t < clusters[i + 1]; ++t) {
+            Float3 c, n;
+            triInfo(t, c, n);
+            const double a = std::sqrt((double)n.x * n.x + (double)n.y * n.y + (double)n.z * n.z);
+            cx += c.x * a; cy += c.y * a; cz += c.z * a; area += a;
+            nx += n.x; ny += n.y; nz += n.z;
+        }
+        float key = 0.0f;
+        const double nl = std::sqrt(nx * nx + ny * ny + nz * nz);
+        if (area > 0 && nl > 0)
+            key = (float)(((cx / area - mx) * nx + (cy / area - my) * ny + (cz / area - mz) * nz) / nl);
+        order[i] = { clusters[i], clusters[i + 1], key };
+    }
+    std::stable_sort(order.begin(), order.end(), [](const Cluster& a, const Cluster& b) { return a.key > b.key; });
+
+    std::vector<uint32_t> out;
+    out.reserve(triCount * 3);
+    for (const Cluster& c : order) out.insert(out.end(), indices + c.begin * 3, indices + c.end * 3);
+    std::memcpy(indices, out.data(), out.size() * sizeof(uint32_t));
+}
+
+// ============================================================================
+// 3) 정점 fetch
+// ============================================================================
+size_t MeshOptFetchRemap(const uint32_t* indices, size_t indexCount, size_t vertexCount, uint32_t* remap)
+{
+    std::fill(remap, remap + vertexCount, UINT32_MAX);
+
+    uint32_t next = 0;
+    for (size_t i = 0; i < indexCount; ++i)
+        if (remap[indices[i]] == UINT32_MAX) remap[indices[i]] = next++;
+
+    const size_t used = next;
+    for (size_t v = 0; v < vertexCount; ++v)
+        if (remap[v] == UINT32_MAX) remap[v] = next++;
+    return used;
+}
+
+// ============================================================================
+// 분석
+// ============================================================================
+uint64_t MeshOptCacheMisses(const uint32_t* indices, size_t indexCount, size_t vertexCount, uint32_t cacheSize)
+{
+    FifoCache cache(vertexCount, cacheSize);
+    uint64_t misses = 0;
+    for (size_t i = 0; i < indexCount; ++i) misses += cache.Access(indices[i]);
+    return misses;
+}
+
+uint64_t MeshOptFetchBytes(const uint32_t* indices, size_t indexCount, size_t /*vertexCount*/, size_t vertexBytes)
+{
+    constexpr size_t kLine = 64;
+    constexpr size_t kLines = 16 * 1024 / kLine;   // 16KB direct-mapped
+
+    std::vector<uint64_t> tags(kLines, UINT64_MAX);
+    uint64_t fetched = 0;
+    for (size_t i = 0; i < indexCount; ++i) {
+        const uint64_t first = (uint64_t)indices[i] * vertexBytes / kLine;
+        const uint64_t last = ((uint64_t)indices[i] * vertexBytes + vertexBytes - 1) / kLine;
+        for (uint64_t line = first; line <= last; ++line) {
+            uint64_t& tag = tags[line % kLines];
+            if (tag != line) { tag = line; fetched += kLine; }
+        }
+    }
+    return fetched;
+}
+
+// ============================================================================
+// 진입점 / 보고
+// ============================================================================
+void MeshOptReport::Merge(const MeshOptReport& o)
+{
+    submeshes += o.submeshes;
+    skippedFetch += o.skippedFetch;
+    triangles += o.triangles;
+    vertices += o.vertices;
+    missesBefore += o.missesBefore;
+    missesAfter += o.missesAfter;
+    fetchUniqueBytes += o.fetchUniqueBytes;
+    fetchBytesBefore += o.fetchBytesBefore;
+    fetchBytesAfter += o.fetchBytesAfter;
+    ms += o.ms;
+}
+
+void MeshOptimize(std::vector<VertexCPU_PNTT>& vertices, std::vector<uint32_t>& indices,
+    const std::vector<SubMeshCPU>& submeshes, MeshOptReport* report, const MeshOptSettings& settings)
+{
+    static_assert(offsetof(VertexCPU_PNTT, px) == 0, "position must lead the vertex");
+    OptimizeImpl(reinterpret_cast<uint8_t*>(vertices.data()), sizeof(VertexCPU_PNTT), vertices.size(),
+        indices, submeshes, sizeof(VertexStreamPos_PNTT), report, settings);
+}
+
+void MeshOptimize(std::vector<VertexCPU_PNTT_BW>& vertices, std::vector<uint32_t>& indices,
+    const std::vector<SubMeshCPU>& submeshes, MeshOptReport* report, const MeshOptSettings& settings)
+{
+    static_assert(offsetof(VertexCPU_PNTT_BW, px) == 0, "position must lead the vertex");
+    OptimizeImpl(reinterpret_cast<uint8_t*>(vertices.data()), sizeof(VertexCPU_PNTT_BW), vertices.size(),
+        indices, submeshes, sizeof(VertexStreamPos_PNTT_BW), report, settings);
+}
+
+MeshOptReport MeshOptTotalsSnapshot()
+{
+    std::lock_guard<std::mutex> lock(s_totalsMx);
+    return s_totals;
+}
+
+void MeshOptResetTotals()
+{
+    std::lock_guard<std::mutex> lock(s_totalsMx);
+    s_totals = {};
+}
+
+void MeshOptAddToTotals(const MeshOptReport& r)
+{
+    std::lock_guard<std::mutex> lock(s_totalsMx);
+    s_totals.Merge(r);
+}
+
+void MeshOptPrintReport(const char* label, const MeshOptReport& r)
+{
+    printf("[MeshOpt] %s: %llu submeshes, %llu tris, %llu verts | ACMR %.3f -> %.3f | ATVR %.3f -> %.3f | fetch %.0f%% -> %.0f%%%s | %.2f ms\n",
+        label, (unsigned long long)r.submeshes, (unsigned long long)r.triangles, (unsigned long long)r.vertices,
+        r.AcmrBefore(), r.AcmrAfter(), r.AtvrBefore(), r.AtvrAfter(),
+        r.FetchEfficiencyBefore() * 100.0, r.FetchEfficiencyAfter() * 100.0,
+        r.skippedFetch ? " (some fetch skipped)" : "", r.ms);
+}
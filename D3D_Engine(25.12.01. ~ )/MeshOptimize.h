@@ -0,0 +1,82 @@
+﻿// ============================================================================
+// MeshOptimize.h
+// - 임포트 메시 최적화 (Assimp aiProcess_ImproveCacheLocality 대신, 서브메시 단위)
+//   1) 정점 캐시: Forsyth 점수 기반 삼각형 재정렬 (캐시 32 가정, 특정 하드웨어 크기에 덜 민감)
+//   2) 오버드로: 캐시 순서를 클러스터로 자르고 (ACMR 이 threshold 배 안에서만 더 자름)
+//      바깥을 향한 클러스터부터 그리도록 정렬 (중심 → 클러스터 중심 · 클러스터 법선, 큰 값 먼저)
+//   3) 정점 fetch: 처음 쓰이는 순서로 정점 재배치 + 인덱스 다시 매핑
+//      (서브메시끼리 정점 범위가 겹치면 그 서브메시는 건너뜀 → skippedFetch)
+// - 통계 (전/후): ACMR = 캐시 미스 / 삼각형, ATVR = 캐시 미스 / 쓰인 정점 (FIFO 시뮬레이션)
+//   fetch 효율 = 쓰인 정점 바이트 / 실제로 읽은 캐시 라인 바이트 (64B 라인, 16KB direct-mapped)
+//   · fetch 는 GPU 위치 스트림(슬롯 0, 깊이 패스 포함 모든 패스가 읽음) 크기 기준
+// - 순수 C++ (D3D / Assimp 없음): 임포터 (AssimpImporterEx / Rigid·SkinnedSkeletal::ImportFBX) 와
+//   오프라인 도구가 같이 씀. 쿠킹 파일은 최적화된 결과를 저장 (쿠킹 포맷 버전으로 무효화)
+// ============================================================================
+
+#pragma once
+
+// ---- includes ----
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "MeshDataEx.h"
+
+struct MeshOptSettings
+{
+    bool     vertexCache = true;
+    bool     overdraw = true;
+    bool     vertexFetch = true;
+    float    overdrawThreshold = 1.05f;   // 클러스터를 더 자를 때 허용하는 ACMR 배율 (1 = 캐시 순서 그대로)
+    uint32_t cacheSize = 16;              // 분석 / 하드 경계용 FIFO 크기
+};
+
+struct MeshOptReport
+{
+    uint64_t submeshes = 0;
+    uint64_t skippedFetch = 0;        // 정점 범위가 다른 서브메시와 겹쳐 fetch 재배치를 건너뜀
+    uint64_t triangles = 0;
+    uint64_t vertices = 0;            // 인덱스가 가리키는 정점 (중복 제외)
+    uint64_t missesBefore = 0;        // FIFO 캐시 미스
+    uint64_t missesAfter = 0;
+    uint64_t fetchUniqueBytes = 0;    // vertices × 위치 스트림 크기
+    uint64_t fetchBytesBefore = 0;    // 시뮬레이션한 라인 읽기 바이트
+    uint64_t fetchBytesAfter = 0;
+    double   ms = 0.0;
+
+    void Merge(const MeshOptReport& o);
+
+    double AcmrBefore() const { return triangles ? (double)missesBefore / (double)triangles : 0.0; }
+    double AcmrAfter()  const { return triangles ? (double)missesAfter / (double)triangles : 0.0; }
+    double AtvrBefore() const { return vertices ? (double)missesBefore / (double)vertices : 0.0; }
+    double AtvrAfter()  const { return vertices ? (double)missesAfter / (double)vertices : 0.0; }
+    double FetchEfficiencyBefore() const { return fetchBytesBefore ? (double)fetchUniqueBytes / (double)fetchBytesBefore : 1.0; }
+    double FetchEfficiencyAfter()  const { return fetchBytesAfter ? (double)fetchUniqueBytes / (double)fetchBytesAfter : 1.0; }
+};
+
+// 서브메시마다 1) → 2) → 3). 인덱스는 vertices 전체 기준 (서브메시 범위는 indexStart/indexCount)
+//  - 삼각형 순서 / 정점 순서만 바뀜 (개수, 서브메시 범위, 그려지는 삼각형 집합은 그대로)
+void MeshOptimize(std::vector<VertexCPU_PNTT>& vertices, std::vector<uint32_t>& indices,
+    const std::vector<SubMeshCPU>& submeshes, MeshOptReport* report, const MeshOptSettings& settings = {});
+void MeshOptimize(std::vector<VertexCPU_PNTT_BW>& vertices, std::vector<uint32_t>& indices,
+    const std::vector<SubMeshCPU>& submeshes, MeshOptReport* report, const MeshOptSettings& settings = {});
+
+// 불러온 메시 전체 합계 (임포트할 때만 누적, 쿠킹 캐시를 그대로 쓰면 안 늘어남)
+//  - 병렬 로드 / 스트리밍 I/O 스레드가 동시에 누적 → 읽기는 잠금 안에서 복사한 스냅샷으로만
+MeshOptReport MeshOptTotalsSnapshot();
+void MeshOptResetTotals();
+void MeshOptAddToTotals(const MeshOptReport& r);
+void MeshOptPrintReport(const char* label, const MeshOptReport& r);
+
+// ---------------------------------------------------------------------------
+// 단계별 (로컬 인덱스: 0 ≤ idx < vertexCount, indexCount 는 3의 배수)
+// ---------------------------------------------------------------------------
+void MeshOptVertexCache(uint32_t* indices, size_t indexCount, size_t vertexCount);
+void MeshOptOverdraw(uint32_t* indices, size_t indexCount, const float* positions, size_t positionStride,
+    size_t vertexCount, uint32_t cacheSize, float threshold);
+
+// remap[old] = new (쓰인 정점은 처음 쓰인 순서, 안 쓰인 정점은 뒤에 원래 순서). 반환: 쓰인 정점 수
+size_t MeshOptFetchRemap(const uint32_t* indices, size_t indexCount, size_t vertexCount, uint32_t* remap);
+
+uint64_t MeshOptCacheMisses(const uint32_t* indices, size_t indexCount, size_t vertexCount, uint32_t cacheSize);
+uint64_t MeshOptFetchBytes(const uint32_t* indices, size_t indexCount, size_t vertexCount, size_t vertexBytes);
@@ -10,7 +10,9 @@
 
 #include "RigidSkeletal.h"
 #include "AssimpImporterEX.h"
+#include "MeshOptimize.h"
 #include "RenderSharedCB.h"
+#include "VertexPack.h"
 #include <assimp/Importer.hpp>
 
 
@@ -21,12 +23,6 @@ using namespace DirectX;
 using namespace DirectX::SimpleMath;
 
 
-static inline double fmod_pos(double x, double period) {
-	if (period <= 0.0) return 0.0;
-	double r = fmod(x, period);
-	return (r < 0.0) ? r + period : r;
-}
-
 // ============================================================================
 // ai -> DX 변환
 // ============================================================================
@@ -49,102 +45,18 @@ static Vector3 ToV3(const aiVector3D& v)
 	return { v.x, v.y, v.z };
 }
 
-// ============================================================================
-// 키프레임 upper bound
-// ============================================================================
-int RigidSkeletal::UpperBoundT(double t, const std::vector<RS_KeyT>& v)
-{
-	int n = (int)v.size();
-	int i = 0; while (i < n && v[i].t <= t) ++i; return i;
-}
-int RigidSkeletal::UpperBoundR(double t, const std::vector<RS_KeyR>& v)
-{
-	int n = (int)v.size();
-	int i = 0; while (i < n && v[i].t <= t) ++i; return i;
-}
-int RigidSkeletal::UpperBoundS(double t, const std::vector<RS_KeyS>& v)
-{
-	int n = (int)v.size();
-	int i = 0; while (i < n && v[i].t <= t) ++i; return i;
-}
-
-// ============================================================================
-// 로컬 행렬 샘플링
-// ============================================================================
-Matrix RigidSkeletal::SampleLocalOf(int nodeIdx, double tTick) const
-{
-	const RS_Node& nd = mNodes[nodeIdx];
-
-	// 채널 찾기
-	Matrix S = Matrix::Identity, R = Matrix::Identity, T = Matrix::Identity;
-
-	auto it = mClip.map.find(nd.name);
-	if (it == mClip.map.end()) {
-		// 애니 없으면 바인드 로컬 유지
-		return nd.bindLocal;
-	}
-	const RS_Channel& ch = mClip.channels[it->second];
-
-	// T
-	if (!ch.T.empty()) {
-		int ub = UpperBoundT(tTick, ch.T);
-		if (ub <= 0) T = Matrix::CreateTranslation(ch.T.front().v);
-		else if (ub >= (int)ch.T.size()) T = Matrix::CreateTranslation(ch.T.back().v);
-		else {
-			const auto& a = ch.T[ub - 1]; const auto& b = ch.T[ub];
-			double len = b.t - a.t; double u = (len > 0.0) ? (tTick - a.t) / len : 0.0;
-			Vector3 v = a.v + (b.v - a.v) * float(u);
-			T = Matrix::CreateTranslation(v);
-		}
-	}
-	else T = Matrix::Identity;
-
-	// R
-	if (!ch.R.empty()) {
-		int ub = UpperBoundR(tTick, ch.R);
-		if (ub <= 0) R = Matrix::CreateFromQuaternion(ch.R.front().q);
-		else if (ub >= (int)ch.R.size()) R = Matrix::CreateFromQuaternion(ch.R.back().q);
-		else {
-			const auto& a = ch.R[ub - 1]; const auto& b = ch.R[ub];
-			double len = b.t - a.t; double u = (len > 0.0) ? (tTick - a.t) / len : 0.0;
-			Quaternion q = Quaternion::Slerp(a.q, b.q, float(u));
-			R = Matrix::CreateFromQuaternion(q);
-		}
-	}
-	else R = Matrix::Identity;
-
-	// S
-	if (!ch.S.empty()) {
-		int ub = UpperBoundS(tTick, ch.S);
-		if (ub <= 0) S = Matrix::CreateScale(ch.S.front().v);
-		else if (ub >= (int)ch.S.size()) S = Matrix::CreateScale(ch.S.back().v);
-		else {
-			const auto& a = ch.S[ub - 1]; const auto& b = ch.S[ub];
-			double len = b.t - a.t; double u = (len > 0.0) ? (tTick - a.t) / len : 0.0;
-			Vector3 v = a.v + (b.v - a.v) * float(u);
-			S = Matrix::CreateScale(v);
-		}
-	}
-	else S = Matrix::Identity;
-
-	return S * R * T;
-}
-
 // ============================================================================
 // 로딩
 // ============================================================================
-std::unique_ptr<RigidSkeletal> RigidSkeletal::LoadFromFBX(
-	ID3D11Device* dev,
-	const std::wstring& fbxPath,
-	const std::wstring& texDir)
+void RigidSkeletal::ImportFBX(const std::wstring& fbxPath, SkelCookData& out)
 {
-	auto up = std::unique_ptr<RigidSkeletal>(new RigidSkeletal);
+	out = SkelCookData{};
+	out.flags = kCookFlags;
 
 	Assimp::Importer imp;
 	unsigned flags =
 		aiProcess_Triangulate |
 		aiProcess_JoinIdenticalVertices |
-		aiProcess_ImproveCacheLocality |
 		aiProcess_SortByPType |
 		aiProcess_CalcTangentSpace |
 		aiProcess_GenNormals |
@@ -176,20 +88,17 @@ std::unique_ptr<RigidSkeletal> RigidSkeletal::LoadFromFBX(
 		}
 		return my;
 		};
-	int root = buildNode(sc->mRootNode, -1);
+	buildNode(sc->mRootNode, -1);
 
 	// ----------------------------------------------------------------------------
 	// 2) 파트(StaticMesh) 구성: 노드에 붙은 aiMesh를 각자 하나의 파트로 만든다
 	// ----------------------------------------------------------------------------
-	std::vector<RS_Part> parts;
-
-	std::vector<MaterialCPU> sceneMaterials;
-	AssimpImporterEx::ExtractMaterials(sc, sceneMaterials);
+	AssimpImporterEx::ExtractMaterials(sc, out.materials);
 
 	auto buildPartFromAiMesh = [&](unsigned meshIndex, int ownerNode) {
 		const aiMesh* am = sc->mMeshes[meshIndex];
 
-		MeshData_PNTT cpu; // 네 새 구조: vertices / indices / submeshes / materials
+		MeshData_PNTT cpu; // vertices / indices / submeshes (머티리얼은 장면 전체 목록 하나)
 		cpu.vertices.resize(am->mNumVertices);
 
 		for (unsigned v = 0; v < am->mNumVertices; ++v) {
@@ -260,22 +169,16 @@ std::unique_ptr<RigidSkeletal> RigidSkeletal::LoadFromFBX(
 		sm.materialIndex = am->mMaterialIndex;
 		cpu.submeshes.push_back(sm);
 
-		// materials (장면 전체 리스트 복사)
-		cpu.materials = sceneMaterials;
-
-		// GPU 빌드
-		RS_Part part;
-		if (!part.mesh.Build(dev, cpu))
-			throw std::runtime_error("part mesh build failed");
+		// 삼각형 / 정점 순서 최적화
+		MeshOptReport optReport;
+		MeshOptimize(cpu.vertices, cpu.indices, cpu.submeshes, &optReport);
+		MeshOptAddToTotals(optReport);
 
-		// 네 렌더러가 MaterialGPU::Bind를 직접 쓰는 구조라면 유지
-		part.materials.resize(cpu.materials.size());
-		for (size_t i = 0; i < cpu.materials.size(); ++i)
-			part.materials[i].Build(dev, cpu.materials[i], texDir);
-
-		part.ownerNode = ownerNode;
-		nodes[ownerNode].partIndices.push_back((int)parts.size());
-		parts.push_back(std::move(part));
+		// 압축 + 분리 스트림 (GPU 빌드는 FromCookData)
+		nodes[ownerNode].partIndices.push_back((int)out.parts.size());
+		VertexPackReport packReport;
+		out.AddPart(ownerNode, cpu.vertices.data(), cpu.vertices.size(), cpu.indices, cpu.submeshes, &packReport);
+		VertexPackAddToTotals(packReport);
 		};
 
 	// 각 노드에 할당된 aiMesh들 생성
@@ -290,14 +193,16 @@ std::unique_ptr<RigidSkeletal> RigidSkeletal::LoadFromFBX(
 	collectMeshes(sc->mRootNode);
 
 	// ----------------------------------------------------------------------------
-	// 3) 애니메이션(첫 개) 파싱
+	// 3) 애니메이션 파싱 (FBX의 모든 클립 → 클립 라이브러리)
 	// ----------------------------------------------------------------------------
-	RS_Clip clip;
-	if (sc->mNumAnimations > 0) {
-		const aiAnimation* a = sc->mAnimations[0];
+	std::vector<std::shared_ptr<RS_Clip>>& clipAssets = out.clips;
+	for (unsigned ai = 0; ai < sc->mNumAnimations; ++ai) {
+		const aiAnimation* a = sc->mAnimations[ai];
+		auto clipAsset = std::make_shared<RS_Clip>();
+		RS_Clip& clip = *clipAsset;
 		clip.name = a->mName.C_Str(); // 예: "Walk"일 수도 있고 공백일 수도
 		clip.duration = a->mDuration;
-		clip.ticksPerSec = (a->mTicksPerSecond > 0.0) ? a->mTicksPerSecond : 25.0;
+		clip.tps = (a->mTicksPerSecond > 0.0) ? a->mTicksPerSecond : 25.0;
 
 		clip.channels.reserve(a->mNumChannels);
 		for (unsigned i = 0; i < a->mNumChannels; ++i) {
@@ -315,14 +220,81 @@ std::unique_ptr<RigidSkeletal> RigidSkeletal::LoadFromFBX(
 			clip.map[ch.target] = (int)clip.channels.size();
 			clip.channels.push_back(std::move(ch));
 		}
+		clipAssets.push_back(std::move(clipAsset));
 	}
+	if (clipAssets.empty()) clipAssets.push_back(std::make_shared<RS_Clip>());   // 애니메이션 없음: 바인드 포즈
 
-	up->mNodes = std::move(nodes);
-	up->mParts = std::move(parts);
-	up->mNameToNode = std::move(nameToIdx);
-	up->mRoot = root;
-	up->mClip = std::move(clip);
+	// ----------------------------------------------------------------------------
+	// 4) 계층 평탄화 → 클립 바인딩/압축/가산 기준
+	// ----------------------------------------------------------------------------
+	auto skel = std::make_shared<SkeletonAsset>();
+	SkeletonFromNodes(*skel, nodes, /*keepBindT*/false);  // T 트랙 없으면 이동 0 (기존 동작)
 
+	out.skeleton = std::move(skel);
+	SkelCookFinishClips(out);
+}
+
+std::unique_ptr<RigidSkeletal> RigidSkeletal::FromCookData(
+	ID3D11Device* dev,
+	const SkelCookData& data,
+	const std::wstring& texDir)
+{
+	auto up = std::unique_ptr<RigidSkeletal>(new RigidSkeletal);
+	auto model = std::make_shared<RS_ModelAsset>();
+
+	model->parts.resize(data.parts.size());
+	for (size_t pi = 0; pi < data.parts.size(); ++pi) {
+		const SkelCookPart& src = data.parts[pi];
+		RS_Part& part = model->parts[pi];
+		if (!part.mesh.Build(dev, src.StaticView()))
+			throw std::runtime_error("part mesh build failed");
+
+		part.ownerNode = src.ownerNode;
+	}
+
+	// materials (모델당 1번, 서브메시가 쓰는 것만)
+	const std::vector<bool> used = SkelCookUsedMaterials(data);
+	model->materials.resize(data.materials.size());
+	for (size_t i = 0; i < data.materials.size(); ++i)
+		if (used[i]) model->materials[i].Build(dev, data.materials[i], texDir);
+
+	auto library = std::make_shared<AnimClipLibrary>();
+	for (const auto& clip : data.clips) library->Add(clip);
+	if (library->clips.empty()) library->Add(std::make_shared<RS_Clip>());   // 애니메이션 없음: 바인드 포즈
+
+	up->mModel = std::move(model);
+	up->mInst.Init(data.skeleton, std::move(library), 0);
+	return up;
+}
+
+std::unique_ptr<RigidSkeletal> RigidSkeletal::LoadFromFBX(
+	ID3D11Device* dev,
+	const std::wstring& fbxPath,
+	const std::wstring& texDir)
+{
+	SkelCookData data;
+	ImportFBX(fbxPath, data);
+	return FromCookData(dev, data, texDir);
+}
+
+std::unique_ptr<RigidSkeletal> RigidSkeletal::LoadCooked(
+	ID3D11Device* dev,
+	const std::wstring& fbxPath,
+	const std::wstring& texDir,
+	bool* fromCache)
+{
+	SkelCookData data;
+	if (!SkelCookLoadOrImport(fbxPath, kCookFlags,
+		[&](SkelCookData& out) { ImportFBX(fbxPath, out); }, data, fromCache))
+		throw std::runtime_error("FBX not found");
+	return FromCookData(dev, data, texDir);
+}
+
+std::unique_ptr<RigidSkeletal> RigidSkeletal::CreateInstance() const
+{
+	auto up = std::unique_ptr<RigidSkeletal>(new RigidSkeletal);
+	up->mModel = mModel;
+	up->mInst.Init(mInst.SkeletonPtr(), mInst.LibraryPtr(), mInst.ClipIndex());
 	return up;
 }
 
@@ -331,26 +303,8 @@ std::unique_ptr<RigidSkeletal> RigidSkeletal::LoadFromFBX(
 // ============================================================================
 void RigidSkeletal::EvaluatePose(double tSec, bool loop)
 {
-	if (mClip.duration <= 0.0) {
-		for (auto& n : mNodes) n.poseLocal = n.bindLocal;
-	}
-	else {
-		const double tps = (mClip.ticksPerSec > 0.0) ? mClip.ticksPerSec : 25.0;
-		const double T = tSec * tps; // seconds → ticks
-		const double u = loop ? fmod_pos(T, mClip.duration)
-			: std::clamp(T, 0.0, mClip.duration);
-
-		for (int i = 0; i < (int)mNodes.size(); ++i)
-			mNodes[i].poseLocal = SampleLocalOf(i, u);
-	}
-
-	// 글로벌 갱신(네 기존 코드 유지)
-	std::function<void(int, const Matrix&)> updateGlobal = [&](int idx, const Matrix& parent) {
-		mNodes[idx].poseGlobal = mNodes[idx].poseLocal * parent;
-		for (int c : mNodes[idx].children)
-			updateGlobal(c, mNodes[idx].poseGlobal);
-		};
-	updateGlobal(mRoot, Matrix::Identity);
+	// 샘플링(SoA) + 선형 글로벌 누적은 AnimatedInstance에서
+	mInst.Evaluate(tSec, loop);
 }
 
 // 기존 함수는 루프=true로 위임(호환)
@@ -358,6 +312,12 @@ void RigidSkeletal::EvaluatePose(double tSec) {
 	EvaluatePose(tSec, /*loop*/true);
 }
 
+// 여러 클립 블렌딩 (크로스페이드/가중/가산)
+void RigidSkeletal::EvaluateLayers(const AnimLayer* layers, size_t count)
+{
+	mInst.EvaluateLayers(layers, count);
+}
+
 
 static void FillCB(ConstantBuffer& cb,
 	const Matrix& world,
@@ -402,15 +362,15 @@ void RigidSkeletal::DrawOpaqueOnly(
 	const Vector3& kA, float ks, float shininess, const Vector3& Ia,
 	bool disableNormal, bool disableSpecular, bool disableEmissive)
 {
-	for (const auto& part : mParts)
+	for (const auto& part : mModel->parts)
 	{
 		const auto& ranges = part.mesh.Ranges(); // 또는 Submeshes() (아래 3) 참고)
 		for (size_t i = 0; i < ranges.size(); ++i) {
 			const auto& r = ranges[i];
-			const auto& mat = part.materials[r.materialIndex];
+			const auto& mat = mModel->materials[r.materialIndex];
 			if (mat.hasOpacity) continue;
 
-			const Matrix world = mNodes[part.ownerNode].poseGlobal * worldModel;
+			const Matrix world = mInst.Global(part.ownerNode) * worldModel;
 
 			ConstantBuffer cb{};
 			FillCB(cb, world, /*view*/view, /*proj*/proj, vLightDir, vLightColor);
@@ -439,15 +399,15 @@ void RigidSkeletal::DrawAlphaCutOnly(
 	const DirectX::SimpleMath::Vector3& Ia,
 	bool disableNormal, bool disableSpecular, bool disableEmissive)
 {
-	for (const auto& part : mParts)
+	for (const auto& part : mModel->parts)
 	{
 		const auto& ranges = part.mesh.Ranges();
 		for (size_t i = 0; i < ranges.size(); ++i) {
 			const auto& r = ranges[i];
-			const auto& mat = part.materials[r.materialIndex];
+			const auto& mat = mModel->materials[r.materialIndex];
 			if (!mat.hasOpacity) continue; // 컷아웃 패스: opacity 있는 애만
 
-			const Matrix world = mNodes[part.ownerNode].poseGlobal * worldModel;
+			const Matrix world = mInst.Global(part.ownerNode) * worldModel;
 
 			ConstantBuffer cb{};
 			FillCB(cb, world, view, proj, vLightDir, vLightColor);
@@ -477,15 +437,15 @@ void RigidSkeletal::DrawTransparentOnly(
 	const DirectX::SimpleMath::Vector3& Ia,
 	bool disableNormal, bool disableSpecular, bool disableEmissive)
 {
-	for (const auto& part : mParts)
+	for (const auto& part : mModel->parts)
 	{
 		const auto& ranges = part.mesh.Ranges();
 		for (size_t i = 0; i < ranges.size(); ++i) {
 			const auto& r = ranges[i];
-			const auto& mat = part.materials[r.materialIndex];
+			const auto& mat = mModel->materials[r.materialIndex];
 			if (!mat.hasOpacity) continue; // 투명 패스: opacity 있는 애만
 
-			const Matrix world = mNodes[part.ownerNode].poseGlobal * worldModel;
+			const Matrix world = mInst.Global(part.ownerNode) * worldModel;
 
 			ConstantBuffer cb{};
 			FillCB(cb, world, view, proj, vLightDir, vLightColor);
@@ -517,10 +477,10 @@ void RigidSkeletal::DrawDepthOnly(
 	ctx->VSSetShader(vsDepth, nullptr, 0);
 	ctx->PSSetShader(psDepth, nullptr, 0);
 
-	for (const auto& part : mParts)
+	for (const auto& part : mModel->parts)
 	{
 		const auto& ranges = part.mesh.Ranges();
-		const Matrix world = mNodes[part.ownerNode].poseGlobal * worldModel;
+		const Matrix world = mInst.Global(part.ownerNode) * worldModel;
 
 		ConstantBuffer cb{};
 		cb.mWorld = XMMatrixTranspose(world);
@@ -532,7 +492,7 @@ void RigidSkeletal::DrawDepthOnly(
 
 		for (size_t i = 0; i < ranges.size(); ++i) {
 			const auto& r = ranges[i];
-			const auto& mat = part.materials[r.materialIndex];
+			const auto& mat = mModel->materials[r.materialIndex];
 
 			// UseCB: alpha cut만 사용 (PS에서 clip)
 			UseCB use{};
@@ -544,7 +504,7 @@ void RigidSkeletal::DrawDepthOnly(
 
 			// txOpacity(t4) 필요하므로 머티리얼 바인딩(다른 텍스처가 같이 바인딩되어도 무방)
 			mat.Bind(ctx);
-			part.mesh.DrawSubmesh(ctx, (UINT)i);
+			part.mesh.DrawSubmeshDepth(ctx, (UINT)i);
 		}
 		MaterialGPU::Unbind(ctx);
 	}
@@ -14,9 +14,14 @@
 
 #include "StaticMesh.h"
 #include "Material.h"
+#include "SkeletalCook.h"
+#include "Animation/AnimClip.h"
+#include "Animation/SkeletonAsset.h"
+#include "Animation/AnimatedInstance.h"
 
 using namespace DirectX::SimpleMath;
 
+// 로드 중에만 쓰는 노드 계층 → 로드 후 SkeletonAsset으로 평탄화
 struct RS_Node
 {
     std::string name;
@@ -24,44 +29,34 @@ struct RS_Node
     std::vector<int> children;
 
     Matrix bindLocal = Matrix::Identity;     // FBX 노드의 로컬 바인드
-    Matrix poseLocal = Matrix::Identity;     // 애니메이션으로 계산된 로컬 포즈
-    Matrix poseGlobal = Matrix::Identity;    // 부모 누적된 글로벌 포즈
+    // 포즈(로컬/글로벌)는 인스턴스(AnimatedInstance)가 따로 가진다
 
     // 이 노드에 붙은 '부분 메시' 인덱스(여러 개일 수 있음, 보통 0~1개)
     std::vector<int> partIndices;
 };
 
-struct RS_KeyT { double t; Vector3 v; };
-struct RS_KeyR { double t; Quaternion q; };
-struct RS_KeyS { double t; Vector3 v; };
-
-struct RS_Channel
-{
-    std::string target;          // 노드 이름
-    std::vector<RS_KeyT> T;
-    std::vector<RS_KeyR> R;
-    std::vector<RS_KeyS> S;
-};
-
-struct RS_Clip
-{
-    std::string name;
-    double duration = 0.0;       // ticks
-    double ticksPerSec = 25.0;   // 기본 25
-    std::vector<RS_Channel> channels;
-
-    // targetName -> index
-    std::unordered_map<std::string, int> map;
-};
+// 키/채널/클립은 Animation/AnimClip.h 공용 타입 (기존 이름은 별칭)
+using RS_KeyT = AnimKeyT;
+using RS_KeyR = AnimKeyR;
+using RS_KeyS = AnimKeyS;
+using RS_Channel = AnimChannel;
+using RS_Clip = AnimationClipAsset;
 
 struct RS_Part
 {
     // 각 파트는 독립 StaticMesh (간단하게 구현; BoxHuman는 파트 수 적음)
-    StaticMesh mesh;
-    std::vector<MaterialGPU> materials; // 해당 파트에 쓰이는 머티리얼들
+    StaticMesh mesh;                    // 머티리얼은 모델 표를 서브메시 materialIndex 로 참조
     int ownerNode = -1;                 // 이 파트의 노드 인덱스
 };
 
+// 파트 묶음 + 장면 머티리얼 표 (로드 후 불변, 인스턴스끼리 공유)
+//  - 어떤 서브메시도 안 쓰는 머티리얼은 빌드 안 함
+struct RS_ModelAsset
+{
+    std::vector<RS_Part> parts;
+    std::vector<MaterialGPU> materials;
+};
+
 class RigidSkeletal
 {
 public:
@@ -71,10 +66,36 @@ public:
         const std::wstring& fbxPath,
         const std::wstring& texDir);
 
-    // 시간 업데이트(tSec = 초). 첫 애니메이션(보통 Walk)을 사용
+    // <fbx>.skelcook 이 유효하면 매핑해서 빌드 (Assimp 없음), 아니면 임포트 → 쿠킹 → 빌드
+    static std::unique_ptr<RigidSkeletal> LoadCooked(
+        ID3D11Device* dev,
+        const std::wstring& fbxPath,
+        const std::wstring& texDir,
+        bool* fromCache = nullptr);
+
+    // Assimp 임포트 → 쿠킹 데이터 (D3D 없음). 실패 시 예외
+    static void ImportFBX(const std::wstring& fbxPath, SkelCookData& out);
+
+    // 쿠킹 데이터 → GPU 파트/머티리얼 + 인스턴스
+    static std::unique_ptr<RigidSkeletal> FromCookData(
+        ID3D11Device* dev,
+        const SkelCookData& data,
+        const std::wstring& texDir);
+
+    static constexpr uint32_t kCookFlags = 0;   // 정적 스트림, keepBindT = false
+
+    // 같은 계층/클립/파트를 공유하는 새 인스턴스 (재임포트/GPU 재생성 없음)
+    std::unique_ptr<RigidSkeletal> CreateInstance() const;
+
+    // 시간 업데이트(tSec = 초). 현재 클립(SetClip, 기본 0번 = 보통 Walk)을 사용
     void EvaluatePose(double tSec);
     void EvaluatePose(double tSec, bool loop);      //
 
+    // 클립 라이브러리 (FBX의 모든 애니메이션) / 재생 클립 선택 / 레이어 블렌딩
+    const AnimClipLibrary& Clips() const { return mInst.Library(); }
+    void SetClip(int clip) { mInst.SetClip(clip); }
+    void EvaluateLayers(const AnimLayer* layers, size_t count);
+
     // Opaque / Cutout / Transparent 렌더(기존 파이프라인에 그대로 맞춤)
     void DrawOpaqueOnly(
         ID3D11DeviceContext* ctx,
@@ -132,29 +153,20 @@ public:
     // ----------------------------------------------------------------------------
     // IMGUI/타이밍용 간단 Getter
     // ----------------------------------------------------------------------------
-    double GetClipDurationTicks() const noexcept { return mClip.duration; }
-    double GetTicksPerSecond()   const noexcept { return (mClip.ticksPerSec > 0.0) ? mClip.ticksPerSec : 25.0; }
+    double GetClipDurationTicks() const noexcept { return mInst.Clip().duration; }
+    double GetTicksPerSecond()   const noexcept { return mInst.Clip().TicksPerSec(); }
     double GetClipDurationSec()  const noexcept { return GetClipDurationTicks() / GetTicksPerSecond(); }
-    const std::string& GetClipName() const noexcept { return mClip.name; }
+    const std::string& GetClipName() const noexcept { return mInst.Clip().name; }
+
+    // 인스턴스 재생 상태 (포즈 조회용)
+    const AnimatedInstance& Instance() const { return mInst; }
+    AnimatedInstance& Instance() { return mInst; }        // AnimationSystem 등록용
 
 
 private:
     RigidSkeletal() = default;
 
-    // 내부 유틸(보간)
-    static int UpperBoundT(double t, const std::vector<RS_KeyT>& v);
-    static int UpperBoundR(double t, const std::vector<RS_KeyR>& v);
-    static int UpperBoundS(double t, const std::vector<RS_KeyS>& v);
-
-    Matrix SampleLocalOf(int nodeIdx, double tTick) const;
-
 private:
-    std::vector<RS_Node> mNodes;
-    std::vector<RS_Part> mParts;
-
-    RS_Clip mClip;     // 첫 번째 클립 사용(예: Walk)
-    int mRoot = 0;
-
-    // 캐시: 이름->노드
-    std::unordered_map<std::string, int> mNameToNode;
+    std::shared_ptr<const RS_ModelAsset> mModel;   // 파트(StaticMesh/머티리얼) 공유
+    AnimatedInstance mInst;                        // 계층/클립 참조 + 포즈 (첫 번째 클립, 예: Walk)
 };
@@ -0,0 +1,655 @@
+﻿// ============================================================================
+// SkeletalCook.cpp
+// - SkeletalCook 구현: 파트 압축/분리 / 쿠킹 파일 기록 / 매핑 + 한 번 훑는 파싱 / 비트 비교
+// ============================================================================
+
+// ---- includes ----
+#include "../D3D_Core/pch.h"
+#include "SkeletalCook.h"
+#include "VertexPack.h"
+#include "Animation/AnimBlend.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+    constexpr uint32_t kCookMagic = 0x4B434B53;   // "SKCK"
+    constexpr uint32_t kCookVersion = 2;          // 2: MeshOptimize 순서로 저장
+    constexpr uint64_t kAlign = 64;
+
+    // 파일 맨 앞. [Header][메타: 계층/본/머티리얼/클립][파트 표][파트 섹션들 (kAlign 정렬)]
+    struct Header
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t sourceHash;
+        uint32_t flags;
+        uint32_t partCount;
+        uint64_t metaOffset;
+        uint64_t metaBytes;
+        uint64_t partTableOffset;
+        uint64_t fileBytes;
+    };
+
+    // 파트 표 항목 (오프셋은 파일 시작 기준)
+    struct PartEntry
+    {
+        int32_t  ownerNode;
+        uint32_t vertexCount;
+        uint32_t indexCount;
+        uint32_t submeshCount;
+        uint64_t posOffset;
+        uint64_t attrOffset;
+        uint64_t indexOffset;
+        uint64_t submeshOffset;
+    };
+
+    static_assert(sizeof(SubMeshCPU) == 16, "SubMeshCPU is stored verbatim");
+    static_assert(sizeof(AnimPackedKey) == 8, "AnimPackedKey is stored verbatim");
+
+    uint64_t AlignUp(uint64_t v) { return (v + kAlign - 1) & ~(kAlign - 1); }
+
+    struct Fnv
+    {
+        uint64_t h = 1469598103934665603ull;
+        void Bytes(const void* p, size_t n)
+        {
+            const uint8_t* b = static_cast<const uint8_t*>(p);
+            for (size_t i = 0; i < n; ++i) { h ^= b[i]; h *= 1099511628211ull; }
+        }
+        template <class T> void Pod(const T& v) { Bytes(&v, sizeof(v)); }
+    };
+
+    size_t PosStride(uint32_t flags)
+    {
+        return (flags & SkelCook_Skinned) ? sizeof(VertexStreamPos_PNTT_BW) : sizeof(VertexStreamPos_PNTT);
+    }
+
+    // -----------------------------------------------------------------------
+    // 메타 기록 / 파싱 (키 구조체는 패딩이 있어서 필드 단위)
+    // -----------------------------------------------------------------------
+    struct Writer
+    {
+        std::vector<uint8_t> b;
+        void Bytes(const void* p, size_t n)
+        {
+            const uint8_t* s = static_cast<const uint8_t*>(p);
+            b.insert(b.end(), s, s + n);
+        }
+        template <class T> void Pod(const T& v) { Bytes(&v, sizeof(v)); }
+        void Str(const std::string& s) { Pod((uint32_t)s.size()); Bytes(s.data(), s.size()); }
+    };
+
+    // 범위를 벗어나면 ok = false 로 고정 (이후 읽기는 전부 0)
+    struct Reader
+    {
+        const uint8_t* p;
+        const uint8_t* end;
+        bool ok = true;
+
+        bool Bytes(void* dst, size_t n)
+        {
+            if (!ok || (size_t)(end - p) < n) { ok = false; memset(dst, 0, n); return false; }
+            memcpy(dst, p, n);
+            p += n;
+            return true;
+        }
+        template <class T> T Pod() { T v{}; Bytes(&v, sizeof(v)); return v; }
+
+        // 원소 수 (원소당 최소 minBytes → 깨진 파일이 큰 할당을 만들지 않게)
+        uint32_t Count(size_t minBytes)
+        {
+            const uint32_t n = Pod<uint32_t>();
+            if (ok && (size_t)(end - p) / minBytes < n) ok = false;
+            return ok ? n : 0;
+        }
+        std::string Str()
+        {
+            const uint32_t n = Count(1);
+            std::string s(n, '\0');
+            if (n) Bytes(s.data(), n);
+            return s;
+        }
+    };
+
+    void PutTrack(Writer& w, const AnimPackedTrack& tr)
+    {
+        w.Pod((uint8_t)tr.kind);
+        w.Pod(tr.c);
+        w.Pod(tr.mn);
+        w.Pod(tr.ext);
+        w.Pod((uint32_t)tr.keys.size());
+        w.Bytes(tr.keys.data(), tr.keys.size() * sizeof(AnimPackedKey));
+    }
+
+    void GetTrack(Reader& r, AnimPackedTrack& tr)
+    {
+        const uint8_t kind = r.Pod<uint8_t>();
+        if (kind > AnimPackedTrack::Animated) r.ok = false;
+        tr.kind = (AnimPackedTrack::Kind)kind;
+        r.Bytes(tr.c, sizeof(tr.c));
+        r.Bytes(tr.mn, sizeof(tr.mn));
+        r.Bytes(tr.ext, sizeof(tr.ext));
+        tr.keys.resize(r.Count(sizeof(AnimPackedKey)));
+        if (!tr.keys.empty()) r.Bytes(tr.keys.data(), tr.keys.size() * sizeof(AnimPackedKey));
+    }
+
+    template <class Key, class V>
+    void PutKeys(Writer& w, const std::vector<Key>& keys, V Key::* value)
+    {
+        w.Pod((uint32_t)keys.size());
+        for (const Key& k : keys) { w.Pod(k.t); w.Pod(k.*value); }
+    }
+
+    template <class Key, class V>
+    void GetKeys(Reader& r, std::vector<Key>& keys, V Key::* value)
+    {
+        keys.resize(r.Count(sizeof(double) + sizeof(V)));
+        for (Key& k : keys) { k.t = r.Pod<double>(); k.*value = r.Pod<V>(); }
+    }
+
+    void PutClip(Writer& w, const AnimationClipAsset& clip)
+    {
+        w.Str(clip.name);
+        w.Pod(clip.duration);
+        w.Pod(clip.tps);
+
+        w.Pod((uint32_t)clip.channels.size());
+        for (const AnimChannel& ch : clip.channels) {
+            w.Str(ch.target);
+            PutKeys(w, ch.T, &AnimKeyT::v);
+            PutKeys(w, ch.R, &AnimKeyR::q);
+            PutKeys(w, ch.S, &AnimKeyS::v);
+        }
+
+        // 압축 트랙: 없으면 0, 있으면 channels 와 같은 수
+        w.Pod((uint32_t)clip.packed.channels.size());
+        w.Pod(clip.packed.timeScale);
+        w.Pod(clip.packed.invTimeScale);
+        for (const AnimPackedChannel& pc : clip.packed.channels) {
+            PutTrack(w, pc.T);
+            PutTrack(w, pc.R);
+            PutTrack(w, pc.S);
+        }
+
+        w.Pod((uint32_t)clip.additiveRef.size());
+        w.Bytes(clip.additiveRef.data(), clip.additiveRef.size() * sizeof(float));
+    }
+
+    void GetClip(Reader& r, AnimationClipAsset& clip, const SkeletonAsset& skel)
+    {
+        clip.name = r.Str();
+        clip.duration = r.Pod<double>();
+        clip.tps = r.Pod<double>();
+
+        clip.channels.resize(r.Count(sizeof(uint32_t) * 4));
+        for (size_t c = 0; c < clip.channels.size(); ++c) {
+            AnimChannel& ch = clip.channels[c];
+            ch.target = r.Str();
+            GetKeys(r, ch.T, &AnimKeyT::v);
+            GetKeys(r, ch.R, &AnimKeyR::q);
+            GetKeys(r, ch.S, &AnimKeyS::v);
+            clip.map[ch.target] = (int)c;     // 임포트와 같이 동명 채널은 뒤쪽 우선
+        }
+
+        const uint32_t packedCount = r.Count(3);
+        if (packedCount != 0 && packedCount != clip.channels.size()) r.ok = false;
+        clip.packed.timeScale = r.Pod<double>();
+        clip.packed.invTimeScale = r.Pod<double>();
+        clip.packed.channels.resize(r.ok ? packedCount : 0);
+        for (AnimPackedChannel& pc : clip.packed.channels) {
+            GetTrack(r, pc.T);
+            GetTrack(r, pc.R);
+            GetTrack(r, pc.S);
+        }
+
+        clip.additiveRef.resize(r.Count(sizeof(float)));
+        if (!clip.additiveRef.empty()) r.Bytes(clip.additiveRef.data(), clip.additiveRef.size() * sizeof(float));
+
+        clip.bindings = AnimBindChannels(clip, skel.names);
+        if (!clip.additiveRef.empty() && clip.additiveRef.size() != clip.bindings.size() * 10) r.ok = false;
+    }
+
+    // 섹션 [offset, offset + bytes) 가 파일 안에 있고 정렬돼 있는지
+    bool SectionOk(const Header& h, uint64_t offset, uint64_t bytes)
+    {
+        return offset % kAlign == 0 && offset >= sizeof(Header)
+            && offset <= h.fileBytes && bytes <= h.fileBytes - offset;
+    }
+
+    // -----------------------------------------------------------------------
+    // 비교 도우미 (memcmp: -0.0 / NaN 페이로드까지 같아야 같음)
+    // -----------------------------------------------------------------------
+    template <class T>
+    bool SameBytes(const std::vector<T>& a, const std::vector<T>& b)
+    {
+        return a.size() == b.size() && (a.empty() || memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0);
+    }
+
+    template <class Key, class V>
+    bool SameKeys(const std::vector<Key>& a, const std::vector<Key>& b, V Key::* value)
+    {
+        if (a.size() != b.size()) return false;
+        for (size_t i = 0; i < a.size(); ++i) {
+            if (memcmp(&a[i].t, &b[i].t, sizeof(double)) != 0) return false;
+            if (memcmp(&(a[i].*value), &(b[i].*value), sizeof(V)) != 0) return false;
+        }
+        return true;
+    }
+
+    bool SameTrack(const AnimPackedTrack& a, const AnimPackedTrack& b)
+    {
+        return a.kind == b.kind
+            && memcmp(a.c, b.c, sizeof(a.c)) == 0
+            && memcmp(a.mn, b.mn, sizeof(a.mn)) == 0
+            && memcmp(a.ext, b.ext, sizeof(a.ext)) == 0
+            && SameBytes(a.keys, b.keys);
+    }
+
+    bool SameClip(const AnimationClipAsset& a, const AnimationClipAsset& b)
+    {
+        if (a.name != b.name
+            || memcmp(&a.duration, &b.duration, sizeof(double)) != 0
+            || memcmp(&a.tps, &b.tps, sizeof(double)) != 0
+            || a.channels.size() != b.channels.size()
+            || a.map != b.map
+            || a.bindings.size() != b.bindings.size()
+            || a.packed.channels.size() != b.packed.channels.size()
+            || memcmp(&a.packed.timeScale, &b.packed.timeScale, sizeof(double)) != 0
+            || memcmp(&a.packed.invTimeScale, &b.packed.invTimeScale, sizeof(double)) != 0
+            || !SameBytes(a.additiveRef, b.additiveRef)) return false;
+
+        for (size_t i = 0; i < a.channels.size(); ++i) {
+            const AnimChannel& x = a.channels[i];
+            const AnimChannel& y = b.channels[i];
+            if (x.target != y.target || !SameKeys(x.T, y.T, &AnimKeyT::v)
+                || !SameKeys(x.R, y.R, &AnimKeyR::q) || !SameKeys(x.S, y.S, &AnimKeyS::v)) return false;
+        }
+        for (size_t i = 0; i < a.bindings.size(); ++i)
+            if (a.bindings[i].node != b.bindings[i].node || a.bindings[i].channel != b.bindings[i].channel) return false;
+        for (size_t i = 0; i < a.packed.channels.size(); ++i) {
+            const AnimPackedChannel& x = a.packed.channels[i];
+            const AnimPackedChannel& y = b.packed.channels[i];
+            if (!SameTrack(x.T, y.T) || !SameTrack(x.R, y.R) || !SameTrack(x.S, y.S)) return false;
+        }
+        return true;
+    }
+}
+
+// ============================================================================
+// SkelCookPart / SkelCookData
+// ============================================================================
+MeshCookView SkelCookPart::StaticView() const
+{
+    MeshCookView v{};
+    v.pos = reinterpret_cast<const VertexStreamPos_PNTT*>(pos);
+    v.attr = attr;
+    v.vertexCount = vertexCount;
+    v.indices = indices;
+    v.indexCount = indexCount;
+    v.submeshes = submeshes;
+    v.submeshCount = submeshCount;
+    return v;
+}
+
+SkinnedMeshCookView SkelCookPart::SkinnedView() const
+{
+    SkinnedMeshCookView v{};
+    v.pos = reinterpret_cast<const VertexStreamPos_PNTT_BW*>(pos);
+    v.attr = attr;
+    v.vertexCount = vertexCount;
+    v.indices = indices;
+    v.indexCount = indexCount;
+    v.submeshes = submeshes;
+    v.submeshCount = submeshCount;
+    return v;
+}
+
+// 스트림 4개를 버퍼 하나에 이어 붙이고 파트 포인터를 그 안으로
+template <class Packed, class PosStream, class Vertex>
+static void AddPartImpl(SkelCookData& data, int ownerNode, const Vertex* vtx, size_t vc,
+    const std::vector<uint32_t>& idx, const std::vector<SubMeshCPU>& submeshes, VertexPackReport* report)
+{
+    std::vector<Packed> packed(vc);
+    VertexPackArray(vtx, vc, packed.data(), report);
+    std::vector<PosStream> pos(vc);
+    std::vector<VertexStreamAttr> attr(vc);
+    VertexSplitStreams(packed.data(), vc, pos.data(), attr.data());
+
+    const size_t posBytes = vc * sizeof(PosStream);
+    const size_t attrBytes = vc * sizeof(VertexStreamAttr);
+    const size_t idxBytes = idx.size() * sizeof(uint32_t);
+    const size_t smBytes = submeshes.size() * sizeof(SubMeshCPU);
+
+    std::vector<uint8_t>& buf = data.storage.emplace_back(posBytes + attrBytes + idxBytes + smBytes);
+    uint8_t* p = buf.data();
+    if (posBytes) memcpy(p, pos.data(), posBytes);
+    if (attrBytes) memcpy(p + posBytes, attr.data(), attrBytes);
+    if (idxBytes) memcpy(p + posBytes + attrBytes, idx.data(), idxBytes);
+    if (smBytes) memcpy(p + posBytes + attrBytes + idxBytes, submeshes.data(), smBytes);
+
+    SkelCookPart part;
+    part.ownerNode = ownerNode;
+    part.pos = p;
+    part.attr = reinterpret_cast<const VertexStreamAttr*>(p + posBytes);
+    part.vertexCount = (uint32_t)vc;
+    part.indices = reinterpret_cast<const uint32_t*>(p + posBytes + attrBytes);
+    part.indexCount = (uint32_t)idx.size();
+    part.submeshes = reinterpret_cast<const SubMeshCPU*>(p + posBytes + attrBytes + idxBytes);
+    part.submeshCount = (uint32_t)submeshes.size();
+    data.parts.push_back(part);
+}
+
+void SkelCookData::AddPart(int ownerNode, const VertexCPU_PNTT* vtx, size_t vertexCount,
+    const std::vector<uint32_t>& idx, const std::vector<SubMeshCPU>& submeshes, VertexPackReport* report)
+{
+    AddPartImpl<VertexPacked_PNTT, VertexStreamPos_PNTT>(*this, ownerNode, vtx, vertexCount, idx, submeshes, report);
+}
+
+void SkelCookData::AddPart(int ownerNode, const VertexCPU_PNTT_BW* vtx, size_t vertexCount,
+    const std::vector<uint32_t>& idx, const std::vector<SubMeshCPU>& submeshes, VertexPackReport* report)
+{
+    AddPartImpl<VertexPacked_PNTT_BW, VertexStreamPos_PNTT_BW>(*this, ownerNode, vtx, vertexCount, idx, submeshes, report);
+}
+
+void SkelCookFinishClips(SkelCookData& data)
+{
+    const SkeletonAsset& skel = *data.skeleton;
+    for (auto& clipAsset : data.clips) {
+        AnimationClipAsset& clip = *clipAsset;
+        clip.bindings = AnimBindChannels(clip, skel.names);
+
+        // 클립 압축 (상수 트랙/키 제거/양자화) + 압축률·최대 오차 출력
+        AnimCompressReport packRep;
+        AnimCompressClip(clip, skel, AnimCompressSettings{}, &packRep);
+        AnimPrintCompressReport(packRep);
+
+        AnimBuildAdditiveRef(clip, skel);
+    }
+}
+
+std::vector<bool> SkelCookUsedMaterials(const SkelCookData& data)
+{
+    std::vector<bool> used(data.materials.size(), false);
+    for (const SkelCookPart& part : data.parts)
+        for (uint32_t s = 0; s < part.submeshCount; ++s) {
+            const uint32_t mi = part.submeshes[s].materialIndex;
+            if (mi < used.size()) used[mi] = true;
+        }
+    return used;
+}
+
+// ============================================================================
+// 해시 / 경로
+// ============================================================================
+uint64_t SkelCookSourceHash(const std::filesystem::path& source, uint32_t flags)
+{
+    const uint64_t base = MeshCookSourceHash(source, flags);
+    if (base == 0) return 0;
+
+    Fnv h;
+    h.Pod(kCookVersion);
+    h.Pod(base);
+    return h.h;
+}
+
+std::filesystem::path SkelCookPath(const std::filesystem::path& source)
+{
+    return std::filesystem::path(source).replace_extension(L".skelcook");
+}
+
+// ============================================================================
+// 기록
+// ============================================================================
+bool SkelCookSave(const SkelCookData& data, uint64_t sourceHash, const std::filesystem::path& path)
+{
+    if (!data.skeleton) return false;
+    const SkeletonAsset& skel = *data.skeleton;
+
+    Writer meta;
+    meta.Pod((uint32_t)skel.NodeCount());
+    for (size_t i = 0; i < skel.NodeCount(); ++i) {
+        meta.Str(skel.names[i]);
+        meta.Pod((int32_t)skel.parents[i]);
+        meta.Pod(skel.bindLocal[i]);
+    }
+    meta.Pod(skel.globalInv);
+
+    meta.Pod((uint32_t)skel.BoneCount());
+    for (size_t i = 0; i < skel.BoneCount(); ++i) {
+        meta.Str(skel.boneNames[i]);
+        meta.Pod((int32_t)skel.boneNodes[i]);
+        meta.Pod(skel.boneOffsets[i]);
+    }
+
+    meta.Pod((uint32_t)data.materials.size());
+    MeshCookPutMaterials(meta.b, data.materials);
+
+    meta.Pod((uint32_t)data.clips.size());
+    for (const auto& clip : data.clips) PutClip(meta, *clip);
+
+    Header h{};
+    h.magic = kCookMagic;
+    h.version = kCookVersion;
+    h.sourceHash = sourceHash;
+    h.flags = data.flags;
+    h.partCount = (uint32_t)data.parts.size();
+    h.metaOffset = AlignUp(sizeof(Header));
+    h.metaBytes = meta.b.size();
+    h.partTableOffset = AlignUp(h.metaOffset + h.metaBytes);
+
+    const size_t posStride = PosStride(data.flags);
+    std::vector<PartEntry> table(data.parts.size());
+    uint64_t at = AlignUp(h.partTableOffset + table.size() * sizeof(PartEntry));
+    for (size_t i = 0; i < data.parts.size(); ++i) {
+        const SkelCookPart& p = data.parts[i];
+        PartEntry& e = table[i];
+        e.ownerNode = p.ownerNode;
+        e.vertexCount = p.vertexCount;
+        e.indexCount = p.indexCount;
+        e.submeshCount = p.submeshCount;
+        e.posOffset = at;
+        e.attrOffset = at = AlignUp(e.posOffset + (uint64_t)p.vertexCount * posStride);
+        e.indexOffset = at = AlignUp(e.attrOffset + (uint64_t)p.vertexCount * sizeof(VertexStreamAttr));
+        e.submeshOffset = at = AlignUp(e.indexOffset + (uint64_t)p.indexCount * sizeof(uint32_t));
+        at = AlignUp(e.submeshOffset + (uint64_t)p.submeshCount * sizeof(SubMeshCPU));
+    }
+    h.fileBytes = table.empty() ? h.partTableOffset
+        : table.back().submeshOffset + (uint64_t)data.parts.back().submeshCount * sizeof(SubMeshCPU);
+
+    const std::filesystem::path tmp = MeshCookTempPath(path);
+    std::ofstream f(tmp, std::ios::binary | std::ios::trunc);
+    if (!f) return false;
+
+    uint64_t written = 0;
+    auto section = [&](uint64_t offset, const void* src, uint64_t bytes) {
+        static const char zeros[kAlign] = {};
+        f.write(zeros, (std::streamsize)(offset - written));
+        f.write(static_cast<const char*>(src), (std::streamsize)bytes);
+        written = offset + bytes;
+    };
+    section(0, &h, sizeof(h));
+    section(h.metaOffset, meta.b.data(), meta.b.size());
+    section(h.partTableOffset, table.data(), table.size() * sizeof(PartEntry));
+    for (size_t i = 0; i < data.parts.size(); ++i) {
+        const SkelCookPart& p = data.parts[i];
+        const PartEntry& e = table[i];
+        section(e.posOffset, p.pos, (uint64_t)p.vertexCount * posStride);
+        section(e.attrOffset, p.attr, (uint64_t)p.vertexCount * sizeof(VertexStreamAttr));
+        section(e.indexOffset, p.indices, (uint64_t)p.indexCount * sizeof(uint32_t));
+        section(e.submeshOffset, p.submeshes, (uint64_t)p.submeshCount * sizeof(SubMeshCPU));
+    }
+    f.close();
+    return MeshCookReplaceFile(tmp, path, (bool)f);
+}
+
+// ============================================================================
+// 로드 (헤더 → 메타 → 파트 표 순서로 한 번)
+// ============================================================================
+bool SkelCookLoad(const std::filesystem::path& path, uint64_t expectHash, SkelCookData& out)
+{
+    out = SkelCookData{};
+    if (!out.file.Open(path, sizeof(Header))) return false;
+
+    const uint8_t* base = out.file.Data();
+    Header h{};
+    memcpy(&h, base, sizeof(h));
+    if (h.magic != kCookMagic || h.version != kCookVersion || h.sourceHash != expectHash
+        || h.fileBytes != out.file.Size()
+        || !SectionOk(h, h.metaOffset, h.metaBytes)
+        || !SectionOk(h, h.partTableOffset, (uint64_t)h.partCount * sizeof(PartEntry))) {
+        out = SkelCookData{};
+        return false;
+    }
+    out.flags = h.flags;
+
+    // 계층 표 → 스켈레톤 (파생값은 임포트와 같은 함수로 다시 계산)
+    Reader r{ base + h.metaOffset, base + h.metaOffset + h.metaBytes };
+    std::vector<SkelCookNode> nodes(r.Count(sizeof(uint32_t) + sizeof(int32_t) + sizeof(DirectX::SimpleMath::Matrix)));
+    for (SkelCookNode& n : nodes) {
+        n.name = r.Str();
+        n.parent = r.Pod<int32_t>();
+        n.bindLocal = r.Pod<DirectX::SimpleMath::Matrix>();
+    }
+    for (size_t i = 0; i < nodes.size() && r.ok; ++i)
+        if (nodes[i].parent < -1 || nodes[i].parent >= (int)i) r.ok = false;   // 부모가 항상 앞
+    if (!r.ok) { out = SkelCookData{}; return false; }
+
+    auto skel = std::make_shared<SkeletonAsset>();
+    SkeletonFromNodes(*skel, nodes, (h.flags & SkelCook_KeepBindT) != 0);
+    skel->globalInv = r.Pod<DirectX::SimpleMath::Matrix>();
+
+    const uint32_t boneCount = r.Count(sizeof(uint32_t) + sizeof(int32_t) + sizeof(DirectX::SimpleMath::Matrix));
+    skel->boneNames.resize(boneCount);
+    skel->boneNodes.resize(boneCount);
+    skel->boneOffsets.resize(boneCount);
+    for (uint32_t i = 0; i < boneCount; ++i) {
+        skel->boneNames[i] = r.Str();
+        skel->boneNodes[i] = r.Pod<int32_t>();
+        skel->boneOffsets[i] = r.Pod<DirectX::SimpleMath::Matrix>();
+        if (skel->boneNodes[i] < 0 || skel->boneNodes[i] >= (int)nodes.size()) r.ok = false;
+    }
+    out.skeleton = skel;
+
+    const uint32_t materialCount = r.Count(5 * sizeof(uint32_t) + 3 * sizeof(float));
+    if (!r.ok || !MeshCookGetMaterials(r.p, r.end, materialCount, out.materials)) { out = SkelCookData{}; return false; }
+
+    out.clips.resize(r.Count(sizeof(uint32_t)));
+    for (auto& clip : out.clips) {
+        clip = std::make_shared<AnimationClipAsset>();
+        GetClip(r, *clip, *skel);
+    }
+    if (!r.ok || r.p != r.end) { out = SkelCookData{}; return false; }
+
+    // 파트: 매핑 포인터 그대로 (서브메시 범위만 확인, 인덱스 값은 훑지 않음)
+    const size_t posStride = PosStride(h.flags);
+    const PartEntry* table = reinterpret_cast<const PartEntry*>(base + h.partTableOffset);
+    out.parts.resize(h.partCount);
+    for (uint32_t i = 0; i < h.partCount; ++i) {
+        PartEntry e{};
+        memcpy(&e, table + i, sizeof(e));
+        bool ok = e.ownerNode >= 0 && e.ownerNode < (int32_t)nodes.size()
+            && SectionOk(h, e.posOffset, (uint64_t)e.vertexCount * posStride)
+            && SectionOk(h, e.attrOffset, (uint64_t)e.vertexCount * sizeof(VertexStreamAttr))
+            && SectionOk(h, e.indexOffset, (uint64_t)e.indexCount * sizeof(uint32_t))
+            && SectionOk(h, e.submeshOffset, (uint64_t)e.submeshCount * sizeof(SubMeshCPU));
+
+        SkelCookPart& p = out.parts[i];
+        if (ok) {
+            p.ownerNode = e.ownerNode;
+            p.pos = base + e.posOffset;
+            p.attr = reinterpret_cast<const VertexStreamAttr*>(base + e.attrOffset);
+            p.vertexCount = e.vertexCount;
+            p.indices = reinterpret_cast<const uint32_t*>(base + e.indexOffset);
+            p.indexCount = e.indexCount;
+            p.submeshes = reinterpret_cast<const SubMeshCPU*>(base + e.submeshOffset);
+            p.submeshCount = e.submeshCount;
+            for (uint32_t s = 0; s < p.submeshCount && ok; ++s) {
+                const SubMeshCPU& sm = p.submeshes[s];
+                ok = sm.indexStart <= p.indexCount && sm.indexCount <= p.indexCount - sm.indexStart;
+            }
+        }
+        if (!ok) { out = SkelCookData{}; return false; }
+    }
+    return true;
+}
+
+bool SkelCookLoadOrImport(const std::filesystem::path& source, uint32_t flags,
+    const std::function<void(SkelCookData&)>& import, SkelCookData& out, bool* fromCache)
+{
+    if (fromCache) *fromCache = false;
+    const uint64_t hash = SkelCookSourceHash(source, flags);
+    if (hash == 0) return false; // 원본 없음
+
+    const std::filesystem::path cookPath = SkelCookPath(source);
+    if (SkelCookLoad(cookPath, hash, out)) {
+        for (const SkelCookPart& p : out.parts)
+            VertexPackAddSizesToTotals(p.vertexCount, out.Skinned());
+        if (fromCache) *fromCache = true;
+        return true;
+    }
+
+    out = SkelCookData{};
+    out.flags = flags;
+    import(out);
+    SkelCookSave(out, hash, cookPath);
+    return true;
+}
+
+// ============================================================================
+// 비교
+// ============================================================================
+bool SkelCookEqual(const SkelCookData& a, const SkelCookData& b, std::string* what)
+{
+    auto fail = [what](const std::string& s) { if (what) *what = s; return false; };
+
+    if (a.flags != b.flags) return fail("flags");
+    if (!a.skeleton || !b.skeleton) return fail("skeleton missing");
+
+    const SkeletonAsset& x = *a.skeleton;
+    const SkeletonAsset& y = *b.skeleton;
+    if (x.names != y.names) return fail("node names");
+    if (x.parents != y.parents) return fail("node parents");
+    if (!SameBytes(x.bindLocal, y.bindLocal)) return fail("bindLocal");
+    if (!SameBytes(x.defaultT, y.defaultT)) return fail("defaultT");
+    if (!SameBytes(x.bindT, y.bindT) || !SameBytes(x.bindR, y.bindR) || !SameBytes(x.bindS, y.bindS))
+        return fail("bind TRS");
+    if (x.leaf != y.leaf) return fail("leaf");
+    if (x.nameToNode != y.nameToNode) return fail("nameToNode");
+    if (x.boneNames != y.boneNames) return fail("bone names");
+    if (x.boneNodes != y.boneNodes) return fail("bone nodes");
+    if (!SameBytes(x.boneOffsets, y.boneOffsets)) return fail("inverse binds");
+    if (memcmp(&x.globalInv, &y.globalInv, sizeof(x.globalInv)) != 0) return fail("globalInv");
+    if (memcmp(&x.bindRadius, &y.bindRadius, sizeof(float)) != 0) return fail("bindRadius");
+
+    if (a.materials.size() != b.materials.size()) return fail("material count");
+    for (size_t i = 0; i < a.materials.size(); ++i) {
+        const MaterialCPU& m = a.materials[i];
+        const MaterialCPU& n = b.materials[i];
+        if (m.diffuse != n.diffuse || m.normal != n.normal || m.specular != n.specular
+            || m.emissive != n.emissive || m.opacity != n.opacity
+            || memcmp(m.diffuseColor, n.diffuseColor, sizeof(m.diffuseColor)) != 0)
+            return fail("material " + std::to_string(i));
+    }
+
+    if (a.parts.size() != b.parts.size()) return fail("part count");
+    const size_t posStride = PosStride(a.flags);
+    for (size_t i = 0; i < a.parts.size(); ++i) {
+        const SkelCookPart& p = a.parts[i];
+        const SkelCookPart& q = b.parts[i];
+        const std::string tag = "part " + std::to_string(i);
+        if (p.ownerNode != q.ownerNode || p.vertexCount != q.vertexCount
+            || p.indexCount != q.indexCount || p.submeshCount != q.submeshCount) return fail(tag + " header");
+        if (memcmp(p.pos, q.pos, p.vertexCount * posStride) != 0) return fail(tag + " position stream");
+        if (memcmp(p.attr, q.attr, p.vertexCount * sizeof(VertexStreamAttr)) != 0) return fail(tag + " attribute stream");
+        if (memcmp(p.indices, q.indices, p.indexCount * sizeof(uint32_t)) != 0) return fail(tag + " indices");
+        if (memcmp(p.submeshes, q.submeshes, p.submeshCount * sizeof(SubMeshCPU)) != 0) return fail(tag + " submeshes");
+    }
+
+    if (a.clips.size() != b.clips.size()) return fail("clip count");
+    for (size_t i = 0; i < a.clips.size(); ++i)
+        if (!SameClip(*a.clips[i], *b.clips[i])) return fail("clip '" + a.clips[i]->name + "'");
+    return true;
+}
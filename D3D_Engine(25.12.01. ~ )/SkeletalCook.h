@@ -0,0 +1,110 @@
+﻿// ============================================================================
+// SkeletalCook.h
+// - 쿠킹된 스켈레탈 에셋 (.skelcook): SkinnedSkeletal / RigidSkeletal 임포트 결과를 그대로 저장
+//   · 계층 표(이름/부모/바인드 로컬) + 본(이름/노드/inverse bind) + globalInv + 장면 머티리얼
+//   · 파트: 압축 + 분리 스트림 / 인덱스 / 서브메시 (64B 정렬 → 매핑 포인터를 그대로 Build)
+//   · 클립: 압축 트랙(AnimPackedClip) + 남은 원본 키 + 가산 기준 포즈 (압축까지 끝난 상태)
+// - 로드: 매핑 → 헤더 / 메타 / 파트 표를 앞에서부터 한 번 훑는다. Assimp 없음
+//   · 스켈레톤 파생값(분해/leaf/반지름)과 채널 바인딩은 저장하지 않고 다시 계산 (결정적)
+// - 무효화: MeshCookSourceHash 규칙 (원본 크기/수정 시각/경로/플래그) + 이 포맷 버전
+// - D3D / Assimp 의존 없음 (임포트는 SkinnedSkeletal / RigidSkeletal::ImportFBX)
+// ============================================================================
+
+#pragma once
+
+// ---- includes ----
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include <directxtk/SimpleMath.h>
+
+#include "MeshDataEx.h"
+#include "MeshCook.h"
+#include "Animation/AnimClip.h"
+#include "Animation/SkeletonAsset.h"
+
+struct VertexPackReport;
+
+// 임포트 옵션 비트 (해시/헤더에 같이 기록)
+enum SkelCookFlags : uint32_t
+{
+    SkelCook_Skinned = 1u << 0,     // 파트 위치 스트림이 VertexStreamPos_PNTT_BW (아니면 VertexStreamPos_PNTT)
+    SkelCook_KeepBindT = 1u << 1,   // SkeletonFromNodes keepBindT
+};
+
+// SkeletonFromNodes 입력 (로드 시 계층 표 → 스켈레톤 재구성)
+struct SkelCookNode
+{
+    std::string name;
+    int parent = -1;
+    DirectX::SimpleMath::Matrix bindLocal = DirectX::SimpleMath::Matrix::Identity;
+};
+
+// 파트 1개. 포인터는 SkelCookData 의 버퍼(임포트) 또는 매핑(로드) 안
+struct SkelCookPart
+{
+    int32_t                 ownerNode = -1;
+    const uint8_t*          pos = nullptr;
+    const VertexStreamAttr* attr = nullptr;
+    uint32_t                vertexCount = 0;
+    const uint32_t*         indices = nullptr;
+    uint32_t                indexCount = 0;
+    const SubMeshCPU*       submeshes = nullptr;
+    uint32_t                submeshCount = 0;
+
+    MeshCookView        StaticView() const;     // 리지드 (StaticMesh::Build)
+    SkinnedMeshCookView SkinnedView() const;    // 스키닝 (SkinnedMesh::Build)
+};
+
+// ---------------------------------------------------------------------------
+// SkelCookData
+//  - 임포트 결과 / 쿠킹 파일 로드 결과 (둘이 같은 형태 → SkelCookEqual 로 비트 단위 비교)
+//  - skeleton / clips 는 로드 후 불변 → 에셋이 shared_ptr 그대로 공유
+// ---------------------------------------------------------------------------
+struct SkelCookData
+{
+    uint32_t flags = 0;
+    std::shared_ptr<SkeletonAsset> skeleton;
+    std::vector<std::shared_ptr<AnimationClipAsset>> clips;   // 바인딩/압축/가산 기준까지 끝난 상태
+    std::vector<MaterialCPU> materials;                       // 장면 전체 (모델 표 1개, 서브메시 materialIndex 로 참조)
+    std::vector<SkelCookPart> parts;
+
+    bool Skinned() const { return (flags & SkelCook_Skinned) != 0; }
+
+    // 임포트: StaticMesh / SkinnedMesh::Build 와 같은 압축 → 분리 후 내부 버퍼에 추가
+    void AddPart(int ownerNode, const VertexCPU_PNTT* vtx, size_t vertexCount,
+        const std::vector<uint32_t>& idx, const std::vector<SubMeshCPU>& submeshes, VertexPackReport* report);
+    void AddPart(int ownerNode, const VertexCPU_PNTT_BW* vtx, size_t vertexCount,
+        const std::vector<uint32_t>& idx, const std::vector<SubMeshCPU>& submeshes, VertexPackReport* report);
+
+    // 파트 포인터가 가리키는 곳 (둘 중 하나만 씀)
+    std::vector<std::vector<uint8_t>> storage;
+    MappedFile file;
+};
+
+// 클립마다 바인딩 → 압축(리포트 출력) → 가산 기준 포즈 (skeleton 준비 후, 임포트 마지막 단계)
+void SkelCookFinishClips(SkelCookData& data);
+
+// materials[i] 를 어느 파트의 서브메시든 하나라도 쓰면 true (크기 = materials.size(), 범위 밖 인덱스는 무시)
+//  - 모델 머티리얼 표는 장면 전체 크기 그대로 두고, 쓰는 항목만 빌드/디코드
+std::vector<bool> SkelCookUsedMaterials(const SkelCookData& data);
+
+uint64_t SkelCookSourceHash(const std::filesystem::path& source, uint32_t flags);
+std::filesystem::path SkelCookPath(const std::filesystem::path& source);   // <source>.skelcook
+
+bool SkelCookSave(const SkelCookData& data, uint64_t sourceHash, const std::filesystem::path& path);
+
+// 매핑 + 검증 + 파싱. 해시가 다르거나 깨진 파일이면 false (out 은 비워 둠)
+bool SkelCookLoad(const std::filesystem::path& path, uint64_t expectHash, SkelCookData& out);
+
+// 쿠킹 파일이 유효하면 로드, 아니면 import 로 채운 뒤 저장 (저장 실패는 다음 실행에서 다시 쿠킹할 뿐)
+//  - import 는 실패 시 예외 (기존 LoadFromFBX 와 같음)
+bool SkelCookLoadOrImport(const std::filesystem::path& source, uint32_t flags,
+    const std::function<void(SkelCookData&)>& import, SkelCookData& out, bool* fromCache = nullptr);
+
+// 비트 단위 비교 (스켈레톤 파생값/바인딩 포함). 다르면 what 에 처음 다른 항목
+bool SkelCookEqual(const SkelCookData& a, const SkelCookData& b, std::string* what = nullptr);
@@ -0,0 +1,168 @@
+﻿// ============================================================================
+// SkinCache.cpp
+// - SkinCache 구현: 출력 VB 생성 / CS 디스패치 / 검증용 readback
+// ============================================================================
+
+// ---- includes ----
+
+#include "../D3D_Core/pch.h"
+#include "SkinCache.h"
+#include "SkinnedMesh.h"
+#include "BonePaletteRing.h"
+#include "VertexPack.h"
+#include "Animation/AnimatedInstance.h"
+
+#include <cstring>
+
+// Skinning_CS.hlsl 의 kSrcPosStride / kAttrStride / kDstPosStride 와 맞춘다
+static_assert(sizeof(VertexStreamPos_PNTT_BW) == 24, "Skinning_CS expects 24-byte source position stream");
+static_assert(sizeof(VertexStreamPos_PNTT) == 16, "Skinning_CS writes 16-byte position stream");
+static_assert(sizeof(VertexStreamAttr) == 8, "Skinning_CS reads/writes 8-byte attribute stream");
+
+// VB 로도, CS raw UAV 로도 쓰는 버퍼
+static bool CreateOutStream(ID3D11Device* dev, UINT bytes,
+    ID3D11Buffer** vb, ID3D11UnorderedAccessView** uav)
+{
+    D3D11_BUFFER_DESC bd{};
+    bd.ByteWidth = bytes;
+    bd.Usage = D3D11_USAGE_DEFAULT;
+    bd.BindFlags = D3D11_BIND_VERTEX_BUFFER | D3D11_BIND_UNORDERED_ACCESS;
+    bd.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_ALLOW_RAW_VIEWS;
+    if (FAILED(dev->CreateBuffer(&bd, nullptr, vb))) return false;
+
+    D3D11_UNORDERED_ACCESS_VIEW_DESC ud{};
+    ud.Format = DXGI_FORMAT_R32_TYPELESS;
+    ud.ViewDimension = D3D11_UAV_DIMENSION_BUFFER;
+    ud.Buffer.NumElements = bytes / 4;
+    ud.Buffer.Flags = D3D11_BUFFER_UAV_FLAG_RAW;
+    return SUCCEEDED(dev->CreateUnorderedAccessView(*vb, &ud, uav));
+}
+
+static bool ReadBackBuffer(ID3D11DeviceContext* ctx, ID3D11Buffer* src, UINT bytes, void* dst)
+{
+    Microsoft::WRL::ComPtr<ID3D11Device> dev;
+    ctx->GetDevice(dev.GetAddressOf());
+
+    D3D11_BUFFER_DESC sd{};
+    sd.ByteWidth = bytes;
+    sd.Usage = D3D11_USAGE_STAGING;
+    sd.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+    Microsoft::WRL::ComPtr<ID3D11Buffer> staging;
+    if (FAILED(dev->CreateBuffer(&sd, nullptr, staging.GetAddressOf()))) return false;
+
+    ctx->CopyResource(staging.Get(), src);
+
+    D3D11_MAPPED_SUBRESOURCE m{};
+    if (FAILED(ctx->Map(staging.Get(), 0, D3D11_MAP_READ, 0, &m))) return false;
+    memcpy(dst, m.pData, bytes);
+    ctx->Unmap(staging.Get(), 0);
+    return true;
+}
+
+struct SkinCSConstants
+{
+    UINT boneBase;
+    UINT boneCount;
+    UINT vertexCount;
+    UINT pad;
+};
+
+bool SkinCache::Create(ID3D11Device* dev, const std::vector<const SkinnedMesh*>& parts)
+{
+    Release();
+
+    mParts.resize(parts.size());
+    for (size_t i = 0; i < parts.size(); ++i) {
+        Part& p = mParts[i];
+        p.vertexCount = parts[i]->VertexCount();
+        if (p.vertexCount == 0) continue;
+
+        if (!CreateOutStream(dev, p.vertexCount * PosStride(), p.vbPos.GetAddressOf(), p.uavPos.GetAddressOf())
+            || !CreateOutStream(dev, p.vertexCount * AttrStride(), p.vbAttr.GetAddressOf(), p.uavAttr.GetAddressOf())) {
+            Release(); return false;
+        }
+    }
+
+    D3D11_BUFFER_DESC cb{};
+    cb.ByteWidth = sizeof(SkinCSConstants);
+    cb.Usage = D3D11_USAGE_DYNAMIC;
+    cb.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+    cb.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+    if (FAILED(dev->CreateBuffer(&cb, nullptr, mCB.GetAddressOf()))) { Release(); return false; }
+
+    mVersion = ~0ull;
+    return true;
+}
+
+void SkinCache::Release()
+{
+    mParts.clear();
+    mCB.Reset();
+    mVersion = ~0ull;
+}
+
+bool SkinCache::Update(ID3D11DeviceContext* ctx, ID3D11ComputeShader* cs,
+    BonePaletteRing& bones, const AnimatedInstance& inst,
+    const std::vector<const SkinnedMesh*>& parts)
+{
+    if (!Ready() || !cs) return false;
+    if (inst.PaletteVersion() == mVersion) { ++mStats.skips; return false; }
+
+    // 팔레트를 못 올리면 디스패치하지 않음 → 이전 스키닝 결과로 그리고 다음 프레임에 다시 시도
+    const UINT base = bones.Acquire(ctx, inst);
+    if (base == BonePaletteRing::kInvalidBase) return false;
+
+    ctx->CSSetShader(cs, nullptr, 0);
+    ID3D11ShaderResourceView* rows = bones.SRV();
+    ctx->CSSetShaderResources(11, 1, &rows);
+    ID3D11Buffer* cb = mCB.Get();
+    ctx->CSSetConstantBuffers(0, 1, &cb);
+
+    for (size_t i = 0; i < mParts.size(); ++i) {
+        const Part& p = mParts[i];
+        if (p.vertexCount == 0) continue;
+
+        D3D11_MAPPED_SUBRESOURCE m{};
+        if (FAILED(ctx->Map(cb, 0, D3D11_MAP_WRITE_DISCARD, 0, &m))) continue;
+        const SkinCSConstants c{ base, (UINT)inst.Palette().size(), p.vertexCount, 0 };
+        memcpy(m.pData, &c, sizeof(c));
+        ctx->Unmap(cb, 0);
+
+        ID3D11ShaderResourceView* src[2] = { parts[i]->PosSRV(), parts[i]->AttrSRV() };
+        ID3D11UnorderedAccessView* uav[2] = { p.uavPos.Get(), p.uavAttr.Get() };
+        ctx->CSSetShaderResources(0, 2, src);
+        ctx->CSSetUnorderedAccessViews(0, 2, uav, nullptr);
+        ctx->Dispatch((p.vertexCount + 63) / 64, 1, 1);
+
+        ++mStats.dispatches;
+        mStats.vertices += p.vertexCount;
+    }
+
+    // 출력 VB 를 IA 에 바인딩할 수 있도록 UAV/SRV 해제
+    ID3D11UnorderedAccessView* nullUAV[2] = { nullptr, nullptr };
+    ID3D11ShaderResourceView* nullSRV[2] = { nullptr, nullptr };
+    ctx->CSSetUnorderedAccessViews(0, 2, nullUAV, nullptr);
+    ctx->CSSetShaderResources(0, 2, nullSRV);
+    ctx->CSSetShaderResources(11, 1, nullSRV);
+    ctx->CSSetShader(nullptr, nullptr, 0);
+
+    mVersion = inst.PaletteVersion();
+    return true;
+}
+
+bool SkinCache::ReadBack(ID3D11DeviceContext* ctx, size_t part, std::vector<VertexCPU_PNTT>& out) const
+{
+    if (part >= mParts.size() || !mParts[part].vbPos) return false;
+    const Part& p = mParts[part];
+
+    std::vector<VertexStreamPos_PNTT> pos(p.vertexCount);
+    std::vector<VertexStreamAttr> attr(p.vertexCount);
+    if (!ReadBackBuffer(ctx, p.vbPos.Get(), p.vertexCount * PosStride(), pos.data())) return false;
+    if (!ReadBackBuffer(ctx, p.vbAttr.Get(), p.vertexCount * AttrStride(), attr.data())) return false;
+
+    std::vector<VertexPacked_PNTT> packed(p.vertexCount);
+    VertexJoinStreams(pos.data(), attr.data(), p.vertexCount, packed.data());
+    out.resize(p.vertexCount);
+    for (UINT i = 0; i < p.vertexCount; ++i) out[i] = VertexUnpack(packed[i]);
+    return true;
+}
@@ -0,0 +1,63 @@
+﻿// ============================================================================
+// SkinCache.h
+// - Skin-once 캐시: 인스턴스 파트마다 스키닝 결과 VB 2개(위치+UV / 노멀+탄젠트 분리 스트림)를 가진다
+//   · 프레임당 한 번(팔레트 버전이 바뀐 경우만) CS(Skinning_CS.hlsl)로 채움
+//   · 이후 그림자/큐브 그림자/불투명/컷아웃/투명 패스는 정적 메시 파이프라인으로 읽는다
+//     (깊이 패스는 위치 스트림만 바인딩)
+// ============================================================================
+
+// ---- includes ----
+
+#pragma once
+#include <d3d11.h>
+#include <wrl/client.h>
+#include <cstdint>
+#include <vector>
+
+#include "MeshDataEx.h"
+
+class SkinnedMesh;
+class AnimatedInstance;
+class BonePaletteRing;
+
+class SkinCache {
+public:
+    struct Stats {
+        uint32_t dispatches = 0;    // 누적 CS 디스패치 (파트 단위)
+        uint32_t skips = 0;         // 팔레트가 그대로라 건너뛴 Update
+        uint64_t vertices = 0;      // 누적 스키닝 정점 수
+    };
+
+public:
+    // 파트별 정점 수만큼 출력 VB(VB + raw UAV) 스트림 2개 생성
+    bool Create(ID3D11Device* dev, const std::vector<const SkinnedMesh*>& parts);
+    void Release();
+    bool Ready() const { return !mParts.empty(); }
+
+    // 팔레트 버전이 바뀐 경우만 파트마다 디스패치. 반환: 디스패치 했는지
+    bool Update(ID3D11DeviceContext* ctx, ID3D11ComputeShader* cs,
+        BonePaletteRing& bones, const AnimatedInstance& inst,
+        const std::vector<const SkinnedMesh*>& parts);
+
+    ID3D11Buffer* PosBuffer(size_t part) const { return mParts[part].vbPos.Get(); }
+    ID3D11Buffer* AttrBuffer(size_t part) const { return mParts[part].vbAttr.Get(); }
+    static constexpr UINT PosStride() { return sizeof(VertexStreamPos_PNTT); }
+    static constexpr UINT AttrStride() { return sizeof(VertexStreamAttr); }
+
+    // GPU 결과 읽기 (스테이징 복사 + 압축 해제, 검증 전용: 파이프라인 동기화가 걸린다)
+    bool ReadBack(ID3D11DeviceContext* ctx, size_t part, std::vector<VertexCPU_PNTT>& out) const;
+
+    const Stats& GetStats() const { return mStats; }
+
+private:
+    struct Part {
+        Microsoft::WRL::ComPtr<ID3D11Buffer>              vbPos, vbAttr;
+        Microsoft::WRL::ComPtr<ID3D11UnorderedAccessView> uavPos, uavAttr;
+        UINT vertexCount = 0;
+    };
+
+    std::vector<Part> mParts;
+    Microsoft::WRL::ComPtr<ID3D11Buffer> mCB;     // BoneBase / BoneCount / VertexCount
+    uint64_t mVersion = ~0ull;                    // 마지막으로 스키닝한 팔레트 버전
+    Stats mStats;
+};
@@ -7,35 +7,116 @@
 
 #include "../D3D_Core/pch.h"
 #include "SkinnedMesh.h"
+#include "VertexPack.h"
+#include "MeshCook.h"
+
+// VB(IA) + raw SRV(스킨 캐시 CS) 겸용 IMMUTABLE 버퍼
+static bool CreateStream(ID3D11Device* dev, const void* data, UINT bytes,
+    ID3D11Buffer** vb, ID3D11ShaderResourceView** srv)
+{
+    D3D11_BUFFER_DESC bd{};
+    bd.ByteWidth = bytes;
+    bd.Usage = D3D11_USAGE_IMMUTABLE;
+    bd.BindFlags = D3D11_BIND_VERTEX_BUFFER | D3D11_BIND_SHADER_RESOURCE;
+    bd.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_ALLOW_RAW_VIEWS;
+    D3D11_SUBRESOURCE_DATA sd{ data,0,0 };
+    if (FAILED(dev->CreateBuffer(&bd, &sd, vb))) return false;
+
+    D3D11_SHADER_RESOURCE_VIEW_DESC vd{};
+    vd.Format = DXGI_FORMAT_R32_TYPELESS;
+    vd.ViewDimension = D3D11_SRV_DIMENSION_BUFFEREX;
+    vd.BufferEx.NumElements = bytes / 4;
+    vd.BufferEx.Flags = D3D11_BUFFEREX_SRV_FLAG_RAW;
+    return SUCCEEDED(dev->CreateShaderResourceView(*vb, &vd, srv));
+}
 
 bool SkinnedMesh::Build(ID3D11Device* dev,
     const std::vector<VertexCPU_PNTT_BW>& vtx,
     const std::vector<uint32_t>& idx,
     const std::vector<SubMeshCPU>& submeshes)
 {
-    D3D11_BUFFER_DESC vb{}; vb.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-    vb.ByteWidth = (UINT)(vtx.size() * sizeof(VertexCPU_PNTT_BW));
-    vb.Usage = D3D11_USAGE_IMMUTABLE;
-    D3D11_SUBRESOURCE_DATA vsd{ vtx.data(),0,0 };
-    if (FAILED(dev->CreateBuffer(&vb, &vsd, mVB.GetAddressOf()))) return false;
+    // 68B → 32B 압축 (왕복 오차/크기는 전체 합계에 누적)
+    std::vector<VertexPacked_PNTT_BW> packed(vtx.size());
+    VertexPackReport report;
+    VertexPackArray(vtx.data(), vtx.size(), packed.data(), &report);
+    VertexPackAddToTotals(report);
+
+    // 슬롯 0(위치+UV+본 24B) / 슬롯 1(노멀+탄젠트 8B) → 깊이 패스는 슬롯 0 만 읽음
+    std::vector<VertexStreamPos_PNTT_BW> pos(packed.size());
+    std::vector<VertexStreamAttr> attr(packed.size());
+    VertexSplitStreams(packed.data(), packed.size(), pos.data(), attr.data());
+
+    SkinnedMeshCookView view{};
+    view.pos = pos.data();
+    view.attr = attr.data();
+    view.vertexCount = (uint32_t)pos.size();
+    view.indices = idx.data();
+    view.indexCount = (uint32_t)idx.size();
+    view.submeshes = submeshes.data();
+    view.submeshCount = (uint32_t)submeshes.size();
+    return Build(dev, view);
+}
+
+bool SkinnedMesh::Build(ID3D11Device* dev, const SkinnedMeshCookView& src)
+{
+    if (!CreateStream(dev, src.pos, src.vertexCount * kStridePos,
+        mVBPos.GetAddressOf(), mPosSRV.GetAddressOf())) return false;
+    if (!CreateStream(dev, src.attr, src.vertexCount * kStrideAttr,
+        mVBAttr.GetAddressOf(), mAttrSRV.GetAddressOf())) return false;
 
     D3D11_BUFFER_DESC ib{}; ib.BindFlags = D3D11_BIND_INDEX_BUFFER;
-    ib.ByteWidth = (UINT)(idx.size() * sizeof(uint32_t));
+    ib.ByteWidth = src.indexCount * (UINT)sizeof(uint32_t);
     ib.Usage = D3D11_USAGE_IMMUTABLE;
-    D3D11_SUBRESOURCE_DATA isd{ idx.data(),0,0 };
+    D3D11_SUBRESOURCE_DATA isd{ src.indices,0,0 };
     if (FAILED(dev->CreateBuffer(&ib, &isd, mIB.GetAddressOf()))) return false;
 
-    mRanges = submeshes;
+    mRanges.assign(src.submeshes, src.submeshes + src.submeshCount);
+
+    // GPU 가 읽는 값과 같은 CPU 사본 (스킨 캐시 검증 / CPU 스키닝 레퍼런스)
+    std::vector<VertexPacked_PNTT_BW> packed(src.vertexCount);
+    VertexJoinStreams(src.pos, src.attr, src.vertexCount, packed.data());
+    mCpuVerts.resize(packed.size());
+    for (size_t i = 0; i < packed.size(); ++i) mCpuVerts[i] = VertexUnpack(packed[i]);
     return true;
 }
 
 void SkinnedMesh::DrawSubmesh(ID3D11DeviceContext* ctx, size_t i) const
 {
-    UINT offset = 0; ID3D11Buffer* vb = mVB.Get();
-    ctx->IASetVertexBuffers(0, 1, &vb, &mStride, &offset);
+    ID3D11Buffer* vbs[2] = { mVBPos.Get(), mVBAttr.Get() };
+    const UINT strides[2] = { kStridePos, kStrideAttr };
+    DrawSubmeshWith(ctx, i, 2, vbs, strides);
+}
+
+void SkinnedMesh::DrawSubmeshDepth(ID3D11DeviceContext* ctx, size_t i) const
+{
+    ID3D11Buffer* vb = mVBPos.Get();
+    const UINT stride = kStridePos;
+    DrawSubmeshWith(ctx, i, 1, &vb, &stride);
+}
+
+void SkinnedMesh::DrawSubmeshWith(ID3D11DeviceContext* ctx, size_t i,
+    UINT streams, ID3D11Buffer* const* vbs, const UINT* strides) const
+{
+    const UINT offsets[2] = { 0, 0 };
+    assert(streams <= 2);
+    ctx->IASetVertexBuffers(0, streams, vbs, strides, offsets);
     ctx->IASetIndexBuffer(mIB.Get(), DXGI_FORMAT_R32_UINT, 0);
 
     assert(i < mRanges.size()); // 혹시 모르니까 어설트 한번 때리자
     const auto& r = mRanges[i];
     ctx->DrawIndexed(r.indexCount, r.indexStart, 0);
 }
+
+void SkinnedMesh::DrawSubmeshInstanced(ID3D11DeviceContext* ctx, size_t i,
+    ID3D11Buffer* instVB, UINT instStride, UINT instanceCount) const
+{
+    ID3D11Buffer* vbs[3] = { mVBPos.Get(), mVBAttr.Get(), instVB };
+    const UINT strides[3] = { kStridePos, kStrideAttr, instStride };
+    const UINT offsets[3] = { 0, 0, 0 };
+    ctx->IASetVertexBuffers(0, 3, vbs, strides, offsets);
+    ctx->IASetIndexBuffer(mIB.Get(), DXGI_FORMAT_R32_UINT, 0);
+
+    assert(i < mRanges.size());
+    const auto& r = mRanges[i];
+    ctx->DrawIndexedInstanced(r.indexCount, instanceCount, r.indexStart, 0, 0);
+}
@@ -12,18 +12,41 @@
 
 #include "MeshDataEx.h"
 
+struct SkinnedMeshCookView;
+
 class SkinnedMesh {
 public:
     bool Build(ID3D11Device* dev,
         const std::vector<VertexCPU_PNTT_BW>& vtx,
         const std::vector<uint32_t>& idx,
         const std::vector<SubMeshCPU>& submeshes);
+    // 이미 압축/분리된 스트림 (.skelcook 매핑 포인터 그대로). CPU 사본은 합친 뒤 복원
+    bool Build(ID3D11Device* dev, const SkinnedMeshCookView& src);
     void DrawSubmesh(ID3D11DeviceContext* ctx, size_t smIdx) const;
+    // 깊이 전용: 슬롯 0(위치+UV+스키닝)만 바인딩
+    void DrawSubmeshDepth(ID3D11DeviceContext* ctx, size_t smIdx) const;
+    // 같은 IB + 다른 VB 들(스킨 캐시 출력 스트림 등)로 그리기. 슬롯 0 부터 streams 개
+    void DrawSubmeshWith(ID3D11DeviceContext* ctx, size_t smIdx,
+        UINT streams, ID3D11Buffer* const* vbs, const UINT* strides) const;
+    // 원본 VB(슬롯 0/1) + 인스턴스 VB(슬롯 2)로 instanceCount 개 (베이크 군중)
+    void DrawSubmeshInstanced(ID3D11DeviceContext* ctx, size_t smIdx,
+        ID3D11Buffer* instVB, UINT instStride, UINT instanceCount) const;
     const std::vector<SubMeshCPU>& Ranges() const { return mRanges; }
-    UINT Stride() const { return mStride; }
+
+    // 분리 스트림 (VertexPack.h): 슬롯 0 위치+UV+본 / 슬롯 1 노멀+탄젠트
+    static constexpr UINT kStridePos = sizeof(VertexStreamPos_PNTT_BW);
+    static constexpr UINT kStrideAttr = sizeof(VertexStreamAttr);
+
+    // 스킨 캐시 입력: 스트림별 raw SRV (CS 에서 ByteAddressBuffer 로 읽음)
+    // CPU 사본은 압축 → 복원한 값 (GPU 가 보는 것과 같은 입력으로 레퍼런스 검증/CPU 스키닝)
+    ID3D11ShaderResourceView* PosSRV() const { return mPosSRV.Get(); }
+    ID3D11ShaderResourceView* AttrSRV() const { return mAttrSRV.Get(); }
+    UINT VertexCount() const { return (UINT)mCpuVerts.size(); }
+    const std::vector<VertexCPU_PNTT_BW>& CpuVertices() const { return mCpuVerts; }
 
 private:
-    Microsoft::WRL::ComPtr<ID3D11Buffer> mVB, mIB;
-    UINT mStride = sizeof(VertexCPU_PNTT_BW);
+    Microsoft::WRL::ComPtr<ID3D11Buffer> mVBPos, mVBAttr, mIB;
+    Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> mPosSRV, mAttrSRV;
+    std::vector<VertexCPU_PNTT_BW> mCpuVerts;
     std::vector<SubMeshCPU> mRanges;
 };
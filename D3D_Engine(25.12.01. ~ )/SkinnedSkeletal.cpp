@@ -10,18 +10,16 @@
 
 #include "SkinnedSkeletal.h"
 #include "AssimpImporterEX.h"
+#include "MeshOptimize.h"
 #include "RenderSharedCB.h"
+#include "VertexPack.h"
 
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
 
+#include <chrono>
 
-static inline double fmod_pos(double x, double m) {
-	if (m <= 0.0) return 0.0;
-	double r = fmod(x, m);
-	return (r < 0.0) ? r + m : r;
-}
 
 static Matrix ToM(const aiMatrix4x4& A)
 {
@@ -39,7 +37,6 @@ static unsigned MakeFlags(bool flipUV, bool leftHanded)
 {
 	unsigned f = aiProcess_Triangulate
 		| aiProcess_JoinIdenticalVertices
-		| aiProcess_ImproveCacheLocality
 		| aiProcess_SortByPType
 		| aiProcess_CalcTangentSpace
 		| aiProcess_GenNormals;
@@ -48,98 +45,21 @@ static unsigned MakeFlags(bool flipUV, bool leftHanded)
 	return f;
 }
 
-// ============================================================================
-// 키프레임 upper bound
-// ============================================================================
-int SkinnedSkeletal::UB_T(double t, const std::vector<SK_KeyT>& v)
-{
-	int n = (int)v.size();
-	int i = 0; while (i < n && v[i].t <= t) ++i; return i;
-}
-int SkinnedSkeletal::UB_R(double t, const std::vector<SK_KeyR>& v)
-{
-	int n = (int)v.size();
-	int i = 0; while (i < n && v[i].t <= t) ++i; return i;
-}
-int SkinnedSkeletal::UB_S(double t, const std::vector<SK_KeyS>& v)
-{
-	int n = (int)v.size();
-	int i = 0; while (i < n && v[i].t <= t) ++i; return i;
-}
-
-// ============================================================================
-// 로컬 행렬 샘플링
-// ============================================================================
-Matrix SkinnedSkeletal::SampleLocalOf(int nodeIdx, double tTick) const
-{
-	const SK_Node& nd = mNodes[nodeIdx];
-
-	Matrix S = Matrix::Identity, R = Matrix::Identity, T = Matrix::Identity;
-
-	auto it = mClip.map.find(nd.name);
-	if (it == mClip.map.end()) {
-		return nd.bindLocal; // 채널 없으면 바인드 로컬 유지
-	}
-	const SK_Channel& ch = mClip.channels[it->second];
-
-	// T
-	if (!ch.T.empty()) {
-		int ub = UB_T(tTick, ch.T);
-		if (ub <= 0) T = Matrix::CreateTranslation(ch.T.front().v);
-		else if (ub >= (int)ch.T.size()) T = Matrix::CreateTranslation(ch.T.back().v);
-		else {
-			const auto& a = ch.T[ub - 1]; const auto& b = ch.T[ub];
-			double dt = (b.t - a.t); float u = (dt > 0.0) ? float((tTick - a.t) / dt) : 0.0f;
-			T = Matrix::CreateTranslation(a.v + (b.v - a.v) * u);
-		}
-	}
-	else T = Matrix::CreateTranslation(nd.bindLocal.Translation());
-
-	// R
-	if (!ch.R.empty()) {
-		int ub = UB_R(tTick, ch.R);
-		if (ub <= 0) R = Matrix::CreateFromQuaternion(ch.R.front().q);
-		else if (ub >= (int)ch.R.size()) R = Matrix::CreateFromQuaternion(ch.R.back().q);
-		else {
-			const auto& a = ch.R[ub - 1]; const auto& b = ch.R[ub];
-			double dt = (b.t - a.t); float u = (dt > 0.0) ? float((tTick - a.t) / dt) : 0.0f;
-			R = Matrix::CreateFromQuaternion(Quaternion::Slerp(a.q, b.q, u));
-		}
-	}
-	else R = Matrix::Identity;
-
-	// S
-	if (!ch.S.empty()) {
-		int ub = UB_S(tTick, ch.S);
-		if (ub <= 0) S = Matrix::CreateScale(ch.S.front().v);
-		else if (ub >= (int)ch.S.size()) S = Matrix::CreateScale(ch.S.back().v);
-		else {
-			const auto& a = ch.S[ub - 1]; const auto& b = ch.S[ub];
-			double dt = (b.t - a.t); float u = (dt > 0.0) ? float((tTick - a.t) / dt) : 0.0f;
-			S = Matrix::CreateScale(a.v + (b.v - a.v) * u);
-		}
-	}
-	else S = Matrix::Identity;
-
-	return S * R * T;
-}
-
 // ============================================================================
 // 로드
 // ============================================================================
-std::unique_ptr<SkinnedSkeletal> SkinnedSkeletal::LoadFromFBX(
-	ID3D11Device* dev,
-	const std::wstring& fbxPath,
-	const std::wstring& texDir)
+void SkinnedSkeletal::ImportFBX(const std::wstring& fbxPath, SkelCookData& out)
 {
-	auto up = std::unique_ptr<SkinnedSkeletal>(new SkinnedSkeletal());
+	out = SkelCookData{};
+	out.flags = kCookFlags;
+	auto skel = std::make_shared<SkeletonAsset>();
 
 	Assimp::Importer imp;
 	unsigned flags = MakeFlags(/*flipUV*/true, /*leftHanded*/true);
 	const aiScene* sc = imp.ReadFile(std::string(fbxPath.begin(), fbxPath.end()), flags);
 	if (!sc || !sc->mRootNode) throw std::runtime_error("Assimp load failed");
 
-	up->mGlobalInv = ToM(sc->mRootNode->mTransformation).Invert();
+	skel->globalInv = ToM(sc->mRootNode->mTransformation).Invert();
 
 	// ----------------------------------------------------------------------------
 	// 1) 노드 트리
@@ -162,20 +82,16 @@ std::unique_ptr<SkinnedSkeletal> SkinnedSkeletal::LoadFromFBX(
 		}
 		return my;
 		};
-	int root = buildNode(sc->mRootNode, -1);
+	buildNode(sc->mRootNode, -1);
 
 	// ----------------------------------------------------------------------------
 	// 2) 재질
 	// ----------------------------------------------------------------------------
-	std::vector<MaterialCPU> sceneMaterials;
-	AssimpImporterEx::ExtractMaterials(sc, sceneMaterials);
+	AssimpImporterEx::ExtractMaterials(sc, out.materials);
 
 	// ----------------------------------------------------------------------------
 	// 3) 파트 & 본/가중치 빌드
 	// ----------------------------------------------------------------------------
-	std::vector<SK_Part> parts;
-	parts.reserve(sc->mNumMeshes);
-
 	// 본 이름 -> bone index
 	std::unordered_map<std::string, int> boneNameToIndex;
 	std::vector<SK_Bone> bones;
@@ -253,6 +169,9 @@ std::unique_ptr<SkinnedSkeletal> SkinnedSkeletal::LoadFromFBX(
 				if (itNode == nameToIdx.end()) {
 					throw std::runtime_error(("Bone node not found: " + bname).c_str());
 				}
+				// BLENDINDICES 는 R8G8B8A8_UINT → 본 인덱스 8-bit (팔레트 링 용량과 별개인 제한)
+				if (bones.size() >= 256)
+					throw std::runtime_error("Skinned mesh uses more than 256 bones (8-bit BLENDINDICES)");
 				SK_Bone bone;
 				bone.name = bname;
 				bone.node = itNode->second;
@@ -277,19 +196,16 @@ std::unique_ptr<SkinnedSkeletal> SkinnedSkeletal::LoadFromFBX(
 			infl[v].finalize(vtx[v].bi, vtx[v].bw);
 		}
 
-		// build gpu mesh
-		SK_Part part;
-		if (!part.mesh.Build(dev, vtx, idx, submeshes))
-			throw std::runtime_error("SkinnedMesh build failed");
-
-		// materials
-		part.materials.clear(); part.materials.resize(sceneMaterials.size());
-		for (size_t i = 0; i < sceneMaterials.size(); ++i)
-			part.materials[i].Build(dev, sceneMaterials[i], texDir);
+		// 삼각형 / 정점 순서 최적화 (가중치까지 채운 뒤 → 정점과 같이 이동)
+		MeshOptReport optReport;
+		MeshOptimize(vtx, idx, submeshes, &optReport);
+		MeshOptAddToTotals(optReport);
 
-		part.ownerNode = ownerNode;
-		nodes[ownerNode].partIndices.push_back((int)parts.size());
-		parts.push_back(std::move(part));
+		// 압축 + 분리 스트림 (GPU 빌드는 FromCookData)
+		nodes[ownerNode].partIndices.push_back((int)out.parts.size());
+		VertexPackReport packReport;
+		out.AddPart(ownerNode, vtx.data(), vtx.size(), idx, submeshes, &packReport);
+		VertexPackAddToTotals(packReport);
 		};
 
 	// traverse and build parts
@@ -301,11 +217,13 @@ std::unique_ptr<SkinnedSkeletal> SkinnedSkeletal::LoadFromFBX(
 	collectMeshes(sc->mRootNode);
 
 	// ----------------------------------------------------------------------------
-	// 4) 애니메이션(첫 개)
+	// 4) 애니메이션 (FBX의 모든 클립 → 클립 라이브러리)
 	// ----------------------------------------------------------------------------
-	SK_Clip clip;
-	if (sc->mNumAnimations > 0) {
-		const aiAnimation* a = sc->mAnimations[0];
+	std::vector<std::shared_ptr<SK_Clip>>& clipAssets = out.clips;
+	for (unsigned ai = 0; ai < sc->mNumAnimations; ++ai) {
+		const aiAnimation* a = sc->mAnimations[ai];
+		auto clipAsset = std::make_shared<SK_Clip>();
+		SK_Clip& clip = *clipAsset;
 		clip.name = a->mName.C_Str();
 		clip.duration = a->mDuration;
 		clip.tps = (a->mTicksPerSecond > 0.0) ? a->mTicksPerSecond : 25.0;
@@ -326,15 +244,108 @@ std::unique_ptr<SkinnedSkeletal> SkinnedSkeletal::LoadFromFBX(
 			clip.map[ch.target] = (int)clip.channels.size();
 			clip.channels.push_back(std::move(ch));
 		}
+		clipAssets.push_back(std::move(clipAsset));
+	}
+	if (clipAssets.empty()) clipAssets.push_back(std::make_shared<SK_Clip>());   // 애니메이션 없음: 바인드 포즈
+
+	// ----------------------------------------------------------------------------
+	// 5) 스켈레톤 평탄화 + 본 → 클립 바인딩/압축/가산 기준
+	// ----------------------------------------------------------------------------
+	SkeletonFromNodes(*skel, nodes, /*keepBindT*/true);   // T 트랙 없으면 바인드 이동 유지
+	skel->boneNames.reserve(bones.size());
+	skel->boneOffsets.reserve(bones.size());
+	skel->boneNodes.reserve(bones.size());
+	for (const auto& b : bones) {
+		skel->boneNames.push_back(b.name);
+		skel->boneOffsets.push_back(b.offset);
+		skel->boneNodes.push_back(b.node);
+	}
+
+	out.skeleton = std::move(skel);
+	SkelCookFinishClips(out);
+}
+
+std::unique_ptr<SkinnedSkeletal> SkinnedSkeletal::FromCookData(
+	ID3D11Device* dev,
+	const SkelCookData& data,
+	const std::wstring& texDir)
+{
+	return FromCookDataImpl(dev, data,
+		[&](MaterialGPU& m, size_t i) { m.Build(dev, data.materials[i], texDir); });
+}
+
+std::unique_ptr<SkinnedSkeletal> SkinnedSkeletal::FromCookData(
+	ID3D11Device* dev,
+	const SkelCookData& data,
+	const std::vector<MaterialDecoded>& decoded)
+{
+	if (decoded.size() != data.materials.size())
+		throw std::runtime_error("decoded material count mismatch");
+	return FromCookDataImpl(dev, data,
+		[&](MaterialGPU& m, size_t i) { m.Build(dev, decoded[i]); });
+}
+
+std::unique_ptr<SkinnedSkeletal> SkinnedSkeletal::FromCookDataImpl(
+	ID3D11Device* dev,
+	const SkelCookData& data,
+	const std::function<void(MaterialGPU&, size_t)>& buildMaterial)
+{
+	auto up = std::unique_ptr<SkinnedSkeletal>(new SkinnedSkeletal());
+	auto model = std::make_shared<SK_ModelAsset>();
+
+	model->parts.resize(data.parts.size());
+	for (size_t pi = 0; pi < data.parts.size(); ++pi) {
+		const SkelCookPart& src = data.parts[pi];
+		SK_Part& part = model->parts[pi];
+		if (!part.mesh.Build(dev, src.SkinnedView()))
+			throw std::runtime_error("SkinnedMesh build failed");
+
+		part.ownerNode = src.ownerNode;
 	}
 
-	up->mNodes = std::move(nodes);
-	up->mParts = std::move(parts);
-	up->mBones = std::move(bones);
-	up->mNameToNode = std::move(nameToIdx);
-	up->mClip = std::move(clip);
-	up->mRoot = root;
+	// materials (모델당 1번, 서브메시가 쓰는 것만)
+	const std::vector<bool> used = SkelCookUsedMaterials(data);
+	model->materials.resize(data.materials.size());
+	for (size_t i = 0; i < data.materials.size(); ++i)
+		if (used[i]) buildMaterial(model->materials[i], i);
+
+	auto library = std::make_shared<AnimClipLibrary>();
+	for (const auto& clip : data.clips) library->Add(clip);
+	if (library->clips.empty()) library->Add(std::make_shared<SK_Clip>());   // 애니메이션 없음: 바인드 포즈
+
+	up->mModel = std::move(model);
+	up->mInst.Init(data.skeleton, std::move(library), 0);
+	return up;
+}
+
+std::unique_ptr<SkinnedSkeletal> SkinnedSkeletal::LoadFromFBX(
+	ID3D11Device* dev,
+	const std::wstring& fbxPath,
+	const std::wstring& texDir)
+{
+	SkelCookData data;
+	ImportFBX(fbxPath, data);
+	return FromCookData(dev, data, texDir);
+}
+
+std::unique_ptr<SkinnedSkeletal> SkinnedSkeletal::LoadCooked(
+	ID3D11Device* dev,
+	const std::wstring& fbxPath,
+	const std::wstring& texDir,
+	bool* fromCache)
+{
+	SkelCookData data;
+	if (!SkelCookLoadOrImport(fbxPath, kCookFlags,
+		[&](SkelCookData& out) { ImportFBX(fbxPath, out); }, data, fromCache))
+		throw std::runtime_error("FBX not found");
+	return FromCookData(dev, data, texDir);
+}
 
+std::unique_ptr<SkinnedSkeletal> SkinnedSkeletal::CreateInstance() const
+{
+	auto up = std::unique_ptr<SkinnedSkeletal>(new SkinnedSkeletal());
+	up->mModel = mModel;
+	up->mInst.Init(mInst.SkeletonPtr(), mInst.LibraryPtr(), mInst.ClipIndex());
 	return up;
 }
 
@@ -347,72 +358,147 @@ void SkinnedSkeletal::EvaluatePose(double tSec) {
 
 void SkinnedSkeletal::EvaluatePose(double tSec, bool loop)
 {
-	if (mClip.duration <= 0.0) {
-		for (auto& n : mNodes) n.poseLocal = n.bindLocal;
-	}
-	else {
-		const double tps = (mClip.tps > 0.0) ? mClip.tps : 25.0;
-		const double T = tSec * tps;               // ticks
-		const double t = loop ? fmod_pos(T, mClip.duration)
-			: std::clamp(T, 0.0, mClip.duration);
-		for (size_t i = 0; i < mNodes.size(); ++i)
-			mNodes[i].poseLocal = SampleLocalOf((int)i, t);
-	}
+	// 포즈와 팔레트를 같이 갱신 (AnimationSystem 경로와 동일한 결과)
+	mInst.Evaluate(tSec, loop);
+	mInst.BuildPalette();
+}
 
-	if (mRoot >= 0) {
-		mNodes[mRoot].poseGlobal = mNodes[mRoot].poseLocal;
-		std::function<void(int)> dfs = [&](int u) {
-			for (int v : mNodes[u].children) {
-				mNodes[v].poseGlobal = mNodes[v].poseLocal * mNodes[u].poseGlobal;
-				dfs(v);
-			}
-			};
-		dfs(mRoot);
-	}
+void SkinnedSkeletal::EvaluateLayers(const AnimLayer* layers, size_t count)
+{
+	mInst.EvaluateLayers(layers, count);
+	mInst.BuildPalette();
 }
 
 // ============================================================================
 // 본 팔레트 업데이트
 // ============================================================================
-void SkinnedSkeletal::UpdateBonePalette(
+bool SkinnedSkeletal::UpdateBonePalette(
 	ID3D11DeviceContext* ctx,
-	ID3D11Buffer* boneCB,
+	BonePaletteRing* bones,
 	const Matrix& /*worldModel*/)
 {
-	// HLSL 쪽 kMaxBones = 256과 반드시 일치시키자
-	static constexpr size_t kMaxBones = 256;
+	// 팔레트는 EvaluatePose / AnimationSystem 에서 이미 계산됨
+	//  - 링은 본 수만큼 3행씩만 올리고, 버전이 같으면(다른 패스/LOD 건너뜀) 오프셋만 다시 바인딩
+	//  - 링보다 큰 팔레트 / Map 실패면 false (다른 인스턴스 팔레트로 그리지 않도록)
+	return bones ? bones->Bind(ctx, mInst) : true;
+}
+
+// SkinnedSkeletal.cpp
+void SkinnedSkeletal::WarmupBonePalette(ID3D11DeviceContext* ctx, BonePaletteRing* bones)
+{
+	// 1) 바인드 포즈로 평가 (클립이 없으면 bindLocal, 있으면 t=0)
+	EvaluatePose(0.0, /*loop=*/true);
+
+	// 2) 팔레트 업로드
+	UpdateBonePalette(ctx, bones, Matrix::Identity);
+}
+
+// ============================================================================
+// 스킨 캐시 (skin once, draw many)
+// ============================================================================
+std::vector<const SkinnedMesh*> SkinnedSkeletal::PartMeshes() const
+{
+	std::vector<const SkinnedMesh*> meshes;
+	meshes.reserve(mModel->parts.size());
+	for (const auto& part : mModel->parts) meshes.push_back(&part.mesh);
+	return meshes;
+}
 
-	// 항상 kMaxBones 개 만큼 업로드할 임시 버퍼 (트랜스포즈 반영)
-	DirectX::XMFLOAT4X4 temp[kMaxBones];
+bool SkinnedSkeletal::EnableSkinCache(ID3D11Device* dev, bool enable)
+{
+	if (!enable) { mSkinCache.Release(); return true; }
+	if (mSkinCache.Ready()) return true;
+	return mSkinCache.Create(dev, PartMeshes());
+}
 
-	const size_t n = std::min(mBones.size(), kMaxBones);
+void SkinnedSkeletal::UpdateSkinCache(ID3D11DeviceContext* ctx, ID3D11ComputeShader* cs, BonePaletteRing* bones)
+{
+	if (!mSkinCache.Ready() || !bones) return;
+	mSkinCache.Update(ctx, cs, *bones, mInst, PartMeshes());
+}
 
-	// 1) 실제 본 개수만큼 계산해서 채우기
-	for (size_t i = 0; i < n; ++i) {
-		const auto& b = mBones[i];
-		const Matrix G = mNodes[b.node].poseGlobal;   // model space
-		const Matrix M = b.offset * G;                // skinning matrix
-		XMStoreFloat4x4(&temp[i], XMMatrixTranspose(M));
+bool SkinnedSkeletal::ValidateSkinCache(ID3D11DeviceContext* ctx, SkinDiff& diff, double& cpuMs)
+{
+	diff = SkinDiff{};
+	cpuMs = 0.0;
+	if (!mSkinCache.Ready()) return false;
+
+	const auto& palette = mInst.Palette();
+	const float* pal = reinterpret_cast<const float*>(palette.data());
+
+	std::vector<VertexCPU_PNTT> ref, gpu;
+	size_t offset = 0;
+	for (size_t pi = 0; pi < mModel->parts.size(); ++pi) {
+		const auto& src = mModel->parts[pi].mesh.CpuVertices();
+		if (src.empty()) continue;
+
+		ref.resize(src.size());
+		const auto t0 = std::chrono::high_resolution_clock::now();
+		if (mInst.GetSkinMode() == SkinMode::DualQuat)
+			SkinVerticesDQRef(src.data(), src.size(), mInst.PaletteDQ().data(), palette.size(), ref.data());
+		else
+			SkinVerticesRef(src.data(), src.size(), pal, palette.size(), ref.data());
+		const auto t1 = std::chrono::high_resolution_clock::now();
+		cpuMs += std::chrono::duration<double, std::milli>(t1 - t0).count();
+
+		if (!mSkinCache.ReadBack(ctx, pi, gpu)) return false;
+
+		// 파트별 최대 오차를 모델 전체로 합친다 (worstVertex 는 파트를 이어붙인 인덱스)
+		const SkinDiff d = SkinCompare(ref.data(), gpu.data(), src.size());
+		if (d.pos > diff.pos) { diff.pos = d.pos; diff.worstVertex = offset + d.worstVertex; }
+		if (d.nrm > diff.nrm) diff.nrm = d.nrm;
+		if (d.tan > diff.tan) diff.tan = d.tan;
+		offset += src.size();
 	}
+	return true;
+}
 
-	// 2) 남는 슬롯은 Identity로 패딩
-	for (size_t i = n; i < kMaxBones; ++i) {
-		XMStoreFloat4x4(&temp[i], XMMatrixIdentity());
+SkinBenchResult SkinnedSkeletal::BenchmarkCpuSkinning(JobSystem* jobs, SkinKernel kernel, int iterations) const
+{
+	const auto& palette = mInst.Palette();
+	const float* pal = reinterpret_cast<const float*>(palette.data());
+
+	SkinBenchResult total;
+	total.kernel = kernel;
+	for (const auto& part : mModel->parts) {
+		const auto& src = part.mesh.CpuVertices();
+		if (src.empty()) continue;
+
+		const SkinBenchResult r = SkinBenchmark(jobs, kernel, src.data(), src.size(), pal, palette.size(), iterations);
+		total.kernel = r.kernel;
+		total.threads = r.threads;
+		total.iterations = r.iterations;
+		total.vertices += r.vertices;
+		total.ms += r.ms;
+		if (r.err.pos > total.err.pos) total.err.pos = r.err.pos;
+		if (r.err.nrm > total.err.nrm) total.err.nrm = r.err.nrm;
+		if (r.err.tan > total.err.tan) total.err.tan = r.err.tan;
 	}
-
-	// 3) CB 전체 크기만큼 항상 업로드 (크래시 방지 핵심)
-	ctx->UpdateSubresource(boneCB, 0, nullptr, temp, 0, 0);
-	ctx->VSSetConstantBuffers(4, 1, &boneCB); // b4
+	return total;
 }
 
-// SkinnedSkeletal.cpp
-void SkinnedSkeletal::WarmupBoneCB(ID3D11DeviceContext* ctx, ID3D11Buffer* boneCB)
+void SkinnedSkeletal::DrawPartSubmesh(ID3D11DeviceContext* ctx, size_t part, size_t sub) const
 {
-	// 1) 바인드 포즈로 평가 (클립이 없으면 bindLocal, 있으면 t=0)
-	EvaluatePose(0.0, /*loop=*/true);
+	const SkinnedMesh& mesh = mModel->parts[part].mesh;
+	if (mSkinCache.Ready()) {
+		ID3D11Buffer* vbs[2] = { mSkinCache.PosBuffer(part), mSkinCache.AttrBuffer(part) };
+		const UINT strides[2] = { SkinCache::PosStride(), SkinCache::AttrStride() };
+		mesh.DrawSubmeshWith(ctx, sub, 2, vbs, strides);
+	}
+	else
+		mesh.DrawSubmesh(ctx, sub);
+}
 
-	// 2) 팔레트 업로드 (항상 256개 패딩)
-	UpdateBonePalette(ctx, boneCB, Matrix::Identity);
+void SkinnedSkeletal::DrawPartSubmeshDepth(ID3D11DeviceContext* ctx, size_t part, size_t sub) const
+{
+	const SkinnedMesh& mesh = mModel->parts[part].mesh;
+	if (mSkinCache.Ready()) {
+		ID3D11Buffer* vb = mSkinCache.PosBuffer(part);
+		const UINT stride = SkinCache::PosStride();
+		mesh.DrawSubmeshWith(ctx, sub, 1, &vb, &stride);
+	}
+	else
+		mesh.DrawSubmeshDepth(ctx, sub);
 }
 
 static void FillCB(ConstantBuffer& cb,
@@ -450,22 +536,23 @@ static void PushUseCB(ID3D11DeviceContext* ctx, ID3D11Buffer* useCB,
 void SkinnedSkeletal::DrawOpaqueOnly(
 	ID3D11DeviceContext* ctx,
 	const Matrix& worldModel, const Matrix& view, const Matrix& proj,
-	ID3D11Buffer* cb0, ID3D11Buffer* useCB, ID3D11Buffer* boneCB,
+	ID3D11Buffer* cb0, ID3D11Buffer* useCB, BonePaletteRing* bones,
 	const Vector4& vLightDir, const Vector4& vLightColor,
 	const Vector3& /*eyePos*/,
 	const Vector3& /*kA*/, float /*ks*/, float /*shininess*/, const Vector3& /*Ia*/,
 	bool disableNormal, bool disableSpecular, bool disableEmissive)
 {
-	UpdateBonePalette(ctx, boneCB, worldModel);
+	if (!SkinCacheActive() && !UpdateBonePalette(ctx, bones, worldModel)) return;
 
-	for (const auto& part : mParts) {
+	for (size_t pi = 0; pi < mModel->parts.size(); ++pi) {
+		const auto& part = mModel->parts[pi];
 		const auto& ranges = part.mesh.Ranges();
 		for (size_t i = 0; i < ranges.size(); ++i) {
 			const auto& r = ranges[i];
-			const auto& mat = part.materials[r.materialIndex];
+			const auto& mat = mModel->materials[r.materialIndex];
 			if (mat.hasOpacity) continue; // 불투명 패스: opacity X
 
-			const Matrix world = mNodes[part.ownerNode].poseGlobal * worldModel;
+			const Matrix world = mInst.Global(part.ownerNode) * worldModel;
 
 			ConstantBuffer cb{};
 			FillCB(cb, world, view, proj, vLightDir, vLightColor);
@@ -476,7 +563,7 @@ void SkinnedSkeletal::DrawOpaqueOnly(
 			mat.Bind(ctx);
 			PushUseCB(ctx, useCB, mat, /*useOpacity*/false, /*alphaCut*/-1.0f,
 				disableNormal, disableSpecular, disableEmissive);
-			part.mesh.DrawSubmesh(ctx, (UINT)i);
+			DrawPartSubmesh(ctx, pi, i);
 			MaterialGPU::Unbind(ctx);
 		}
 	}
@@ -485,22 +572,23 @@ void SkinnedSkeletal::DrawOpaqueOnly(
 void SkinnedSkeletal::DrawAlphaCutOnly(
 	ID3D11DeviceContext* ctx,
 	const Matrix& worldModel, const Matrix& view, const Matrix& proj,
-	ID3D11Buffer* cb0, ID3D11Buffer* useCB, ID3D11Buffer* boneCB,
+	ID3D11Buffer* cb0, ID3D11Buffer* useCB, BonePaletteRing* bones,
 	const Vector4& vLightDir, const Vector4& vLightColor,
 	const Vector3& /*eyePos*/,
 	const Vector3& /*kA*/, float /*ks*/, float /*shininess*/, const Vector3& /*Ia*/,
 	bool disableNormal, bool disableSpecular, bool disableEmissive)
 {
-	UpdateBonePalette(ctx, boneCB, worldModel);
+	if (!SkinCacheActive() && !UpdateBonePalette(ctx, bones, worldModel)) return;
 
-	for (const auto& part : mParts) {
+	for (size_t pi = 0; pi < mModel->parts.size(); ++pi) {
+		const auto& part = mModel->parts[pi];
 		const auto& ranges = part.mesh.Ranges();
 		for (size_t i = 0; i < ranges.size(); ++i) {
 			const auto& r = ranges[i];
-			const auto& mat = part.materials[r.materialIndex];
+			const auto& mat = mModel->materials[r.materialIndex];
 			if (!mat.hasOpacity) continue; // 컷아웃 패스: opacity 있는 애만
 
-			const Matrix world = mNodes[part.ownerNode].poseGlobal * worldModel;
+			const Matrix world = mInst.Global(part.ownerNode) * worldModel;
 
 			ConstantBuffer cb{};
 			FillCB(cb, world, view, proj, vLightDir, vLightColor);
@@ -512,7 +600,7 @@ void SkinnedSkeletal::DrawAlphaCutOnly(
 			// 컷아웃: useOpacity=1, alphaCut>0
 			PushUseCB(ctx, useCB, mat, /*useOpacity*/true, /*alphaCut*/0.5f,
 				disableNormal, disableSpecular, disableEmissive);
-			part.mesh.DrawSubmesh(ctx, (UINT)i);
+			DrawPartSubmesh(ctx, pi, i);
 			MaterialGPU::Unbind(ctx);
 		}
 	}
@@ -521,22 +609,23 @@ void SkinnedSkeletal::DrawAlphaCutOnly(
 void SkinnedSkeletal::DrawTransparentOnly(
 	ID3D11DeviceContext* ctx,
 	const Matrix& worldModel, const Matrix& view, const Matrix& proj,
-	ID3D11Buffer* cb0, ID3D11Buffer* useCB, ID3D11Buffer* boneCB,
+	ID3D11Buffer* cb0, ID3D11Buffer* useCB, BonePaletteRing* bones,
 	const Vector4& vLightDir, const Vector4& vLightColor,
 	const Vector3& /*eyePos*/,
 	const Vector3& /*kA*/, float /*ks*/, float /*shininess*/, const Vector3& /*Ia*/,
 	bool disableNormal, bool disableSpecular, bool disableEmissive)
 {
-	UpdateBonePalette(ctx, boneCB, worldModel);
+	if (!SkinCacheActive() && !UpdateBonePalette(ctx, bones, worldModel)) return;
 
-	for (const auto& part : mParts) {
+	for (size_t pi = 0; pi < mModel->parts.size(); ++pi) {
+		const auto& part = mModel->parts[pi];
 		const auto& ranges = part.mesh.Ranges();
 		for (size_t i = 0; i < ranges.size(); ++i) {
 			const auto& r = ranges[i];
-			const auto& mat = part.materials[r.materialIndex];
+			const auto& mat = mModel->materials[r.materialIndex];
 			if (!mat.hasOpacity) continue; // 투명 패스에서 쓰는 경우(직알파) — 상태는 앱에서 세팅
 
-			const Matrix world = mNodes[part.ownerNode].poseGlobal * worldModel;
+			const Matrix world = mInst.Global(part.ownerNode) * worldModel;
 
 			ConstantBuffer cb{};
 			FillCB(cb, world, view, proj, vLightDir, vLightColor);
@@ -548,7 +637,7 @@ void SkinnedSkeletal::DrawTransparentOnly(
 			// 투명: useOpacity=1, alphaCut=-1 (discard 없음), 블렌드 ST(직알파)
 			PushUseCB(ctx, useCB, mat, /*useOpacity*/true, /*alphaCut*/-1.0f,
 				disableNormal, disableSpecular, disableEmissive);
-			part.mesh.DrawSubmesh(ctx, (UINT)i);
+			DrawPartSubmesh(ctx, pi, i);
 			MaterialGPU::Unbind(ctx);
 		}
 	}
@@ -558,23 +647,24 @@ void SkinnedSkeletal::DrawDepthOnly(
 	ID3D11DeviceContext* ctx,
 	const Matrix& worldModel,
 	const Matrix& lightView, const Matrix& lightProj,
-	ID3D11Buffer* cb0, ID3D11Buffer* useCB, ID3D11Buffer* boneCB,
+	ID3D11Buffer* cb0, ID3D11Buffer* useCB, BonePaletteRing* bones,
 	ID3D11VertexShader* vsDepthSkinned,
 	ID3D11PixelShader* psDepth,
 	ID3D11InputLayout* ilPNTT_BW,
 	float alphaCut)
 {
-	// 본 팔레트(b4) 업데이트
-	UpdateBonePalette(ctx, boneCB, worldModel);
+	// 본 팔레트(t11/b4) 업데이트 (스킨 캐시 사용 시 호출부가 정적 깊이 VS / PNTT IL 을 넘김)
+	if (!SkinCacheActive() && !UpdateBonePalette(ctx, bones, worldModel)) return;
 
 	ctx->IASetInputLayout(ilPNTT_BW);
 	ctx->VSSetShader(vsDepthSkinned, nullptr, 0);
 	ctx->PSSetShader(psDepth, nullptr, 0);
 
-	for (const auto& part : mParts)
+	for (size_t pi = 0; pi < mModel->parts.size(); ++pi)
 	{
+		const auto& part = mModel->parts[pi];
 		const auto& ranges = part.mesh.Ranges();
-		const Matrix world = mNodes[part.ownerNode].poseGlobal * worldModel;
+		const Matrix world = mInst.Global(part.ownerNode) * worldModel;
 
 		ConstantBuffer cb{};
 		cb.mWorld = XMMatrixTranspose(world);
@@ -586,7 +676,7 @@ void SkinnedSkeletal::DrawDepthOnly(
 
 		for (size_t i = 0; i < ranges.size(); ++i) {
 			const auto& r = ranges[i];
-			const auto& mat = part.materials[r.materialIndex];
+			const auto& mat = mModel->materials[r.materialIndex];
 
 			UseCB use{};
 			use.useOpacity = mat.hasOpacity ? 1u : 0u;
@@ -596,8 +686,73 @@ void SkinnedSkeletal::DrawDepthOnly(
 			ctx->PSSetConstantBuffers(2, 1, &useCB);
 
 			mat.Bind(ctx);
-			part.mesh.DrawSubmesh(ctx, (UINT)i);
+			DrawPartSubmeshDepth(ctx, pi, i);
 		}
 		MaterialGPU::Unbind(ctx);
 	}
 }
+
+// ============================================================================
+// Baked crowd
+// ============================================================================
+bool SkinnedSkeletal::BakeCrowd(float fps, const std::filesystem::path& cachePath,
+	AnimBakedSet& out, bool* fromCache) const
+{
+	if (fromCache) *fromCache = false;
+	if (mInst.Library().clips.empty()) return false;
+
+	std::vector<int> nodes;
+	nodes.reserve(mModel->parts.size());
+	for (const auto& part : mModel->parts) nodes.push_back(part.ownerNode);
+
+	const uint64_t hash = AnimBakeSourceHash(mInst.Skeleton(), mInst.Library(), fps, nodes);
+	if (!cachePath.empty() && AnimBakeLoad(out, cachePath, hash)) {
+		if (fromCache) *fromCache = true;
+		return true;
+	}
+
+	AnimBake(mInst.SkeletonPtr(), mInst.LibraryPtr(), fps, nodes, out);
+	if (out.Empty()) return false;
+
+	// 캐시 저장 실패는 다음 실행에서 다시 베이크할 뿐
+	if (!cachePath.empty()) AnimBakeSave(out, cachePath);
+	return true;
+}
+
+void SkinnedSkeletal::DrawCrowdOpaque(
+	ID3D11DeviceContext* ctx, BakedCrowd& crowd,
+	const Matrix& view, const Matrix& proj,
+	ID3D11Buffer* cb0, ID3D11Buffer* useCB,
+	const Vector4& vLightDir, const Vector4& vLightColor,
+	bool disableNormal, bool disableSpecular, bool disableEmissive) const
+{
+	if (!crowd.Ready() || crowd.InstanceCount() == 0) return;
+
+	// 월드는 인스턴스 레코드, 파트 글로벌은 베이크 표 → CB0 는 View/Projection/라이트만
+	ConstantBuffer cb{};
+	FillCB(cb, Matrix::Identity, view, proj, vLightDir, vLightColor);
+	ctx->UpdateSubresource(cb0, 0, nullptr, &cb, 0, 0);
+	ctx->VSSetConstantBuffers(0, 1, &cb0);
+	ctx->PSSetConstantBuffers(0, 1, &cb0);
+
+	for (size_t pi = 0; pi < mModel->parts.size(); ++pi) {
+		const auto& part = mModel->parts[pi];
+		const auto& ranges = part.mesh.Ranges();
+		crowd.BindPart(ctx, (UINT)pi);
+
+		for (size_t i = 0; i < ranges.size(); ++i) {
+			const auto& r = ranges[i];
+			const auto& mat = mModel->materials[r.materialIndex];
+			if (mat.hasOpacity) continue; // 불투명 패스: opacity X
+
+			mat.Bind(ctx);
+			PushUseCB(ctx, useCB, mat, /*useOpacity*/false, /*alphaCut*/-1.0f,
+				disableNormal, disableSpecular, disableEmissive);
+			part.mesh.DrawSubmeshInstanced(ctx, i, crowd.InstanceBuffer(),
+				BakedCrowd::InstanceStride(), crowd.InstanceCount());
+			crowd.CountDraw();
+			MaterialGPU::Unbind(ctx);
+		}
+	}
+	crowd.Unbind(ctx);
+}
@@ -13,11 +13,22 @@
 #include <vector>
 #include <unordered_map>
 #include <memory>                   // std::unique_ptr
+#include <filesystem>
+#include <functional>
 #include <d3d11.h>
 #include <directxtk/SimpleMath.h>
 
 #include "SkinnedMesh.h"
 #include "Material.h"
+#include "BonePaletteRing.h"
+#include "SkinCache.h"
+#include "BakedCrowd.h"
+#include "SkeletalCook.h"
+#include "Animation/AnimClip.h"
+#include "Animation/SkeletonAsset.h"
+#include "Animation/AnimatedInstance.h"
+#include "Animation/SkinningCPU.h"
+#include "Animation/AnimBake.h"
 
 // 주의: 헤더에서 using namespace는 전역 오염이라 보통 피하는 편.
 // (지금은 기존 스타일 유지하되, 아래에서 타입 alias도 같이 둠)
@@ -25,8 +36,9 @@ using namespace DirectX::SimpleMath;
 
 // ---------------------------------------------------------------------------
 // Scene Graph (노드 트리)
-//  - FBX 노드 계층을 그대로 들고 있음
-//  - 각 노드는 "바인드 로컬 / 포즈 로컬 / 포즈 글로벌" 행렬을 가진다
+//  - 로드 중에만 쓰는 FBX 노드 계층 (preorder → 부모가 항상 자식보다 앞)
+//  - 로드가 끝나면 SkeletonAsset(평탄화 배열)으로 옮긴다
+//  - 포즈(로컬/글로벌)는 AnimatedInstance가 인스턴스마다 따로 가진다
 // ---------------------------------------------------------------------------
 struct SK_Node
 {
@@ -37,45 +49,19 @@ struct SK_Node
     // 바인드 포즈(local): FBX 로딩 시점의 로컬 변환
     Matrix bindLocal = Matrix::Identity;
 
-    // 애니메이션 샘플 결과(local)
-    Matrix poseLocal = Matrix::Identity;
-
-    // poseLocal을 부모부터 누적한 글로벌 변환
-    Matrix poseGlobal = Matrix::Identity;
-
     // 이 노드에 붙어있는 "파트(메시)" 인덱스 목록
     std::vector<int> partIndices;
 };
 
 // ---------------------------------------------------------------------------
 // Animation Keys / Channel / Clip
-//  - 키프레임: (time, value)
-//  - 채널: 특정 노드(target)에 대해 T/R/S 키를 가진다
-//  - 클립: 채널 집합 + (duration, ticksPerSecond)
+//  - 정의는 Animation/AnimClip.h (RigidSkeletal과 공용). 기존 이름은 별칭으로 유지
 // ---------------------------------------------------------------------------
-struct SK_KeyT { double t; Vector3    v; };   // Translation key
-struct SK_KeyR { double t; Quaternion q; };   // Rotation key
-struct SK_KeyS { double t; Vector3    v; };   // Scale key
-
-struct SK_Channel
-{
-    std::string target;              // 애니메이션이 적용될 노드 이름
-    std::vector<SK_KeyT> T;
-    std::vector<SK_KeyR> R;
-    std::vector<SK_KeyS> S;
-};
-
-struct SK_Clip
-{
-    std::string name;
-    double duration = 0.0;           // tick 단위 (Assimp aiAnimation::mDuration)
-    double tps = 25.0;          // ticks per second (0이면 관례적으로 25로 취급)
-
-    std::vector<SK_Channel> channels;
-
-    // 빠른 lookup: target(node name) -> channels index
-    std::unordered_map<std::string, int> map;
-};
+using SK_KeyT = AnimKeyT;
+using SK_KeyR = AnimKeyR;
+using SK_KeyS = AnimKeyS;
+using SK_Channel = AnimChannel;
+using SK_Clip = AnimationClipAsset;
 
 // ---------------------------------------------------------------------------
 // Bone (스키닝용 본 정보)
@@ -92,22 +78,36 @@ struct SK_Bone
 
 // ---------------------------------------------------------------------------
 // Part (메시 파트 단위)
-//  - 파트 = 한 덩어리의 스키닝 메시 + 머티리얼 배열
+//  - 파트 = 한 덩어리의 스키닝 메시 (머티리얼은 모델 표를 서브메시 materialIndex 로 참조)
 //  - ownerNode: 이 파트가 붙어있는 노드 인덱스(월드 변환의 기준)
 // ---------------------------------------------------------------------------
 struct SK_Part
 {
     SkinnedMesh mesh;
-    std::vector<MaterialGPU> materials;
     int ownerNode = -1;
 };
 
+// ---------------------------------------------------------------------------
+// Model asset (GPU 메시 + 머티리얼)
+//  - 로드 후 불변. CreateInstance()로 만든 인스턴스들이 공유
+//  - materials: 장면 머티리얼 표 (모델당 1개). 어떤 서브메시도 안 쓰는 항목은 빌드 안 함 (SRV/CB 없음)
+// ---------------------------------------------------------------------------
+struct SK_ModelAsset
+{
+    std::vector<SK_Part> parts;
+    std::vector<MaterialGPU> materials;
+};
+
 // ===========================================================================
 // SkinnedSkeletal
-//  - FBX 로드: 노드/본/파트/클립 구성
+//  - FBX 로드: 노드/본/파트/클립 구성 → 공유 에셋(스켈레톤/클립/모델)
+//    (임포트 결과 = SkelCookData → .skelcook 으로 쿠킹하면 다음 실행은 Assimp 없이 매핑)
+//  - 인스턴스: 에셋 shared_ptr + AnimatedInstance(재생 상태)만 가진다
 //  - 포즈 평가: EvaluatePose()
 //  - 렌더: Opaque / AlphaCut / Transparent / DepthOnly
 //  - 본 팔레트 업데이트: UpdateBonePalette()
+//  - 스킨 캐시: EnableSkinCache() / UpdateSkinCache()
+//  - 베이크 군중: BakeCrowd() / DrawCrowdOpaque()
 // ===========================================================================
 class SkinnedSkeletal
 {
@@ -127,15 +127,43 @@ public:
         const std::wstring& fbxPath,
         const std::wstring& texDir);
 
+    // <fbx>.skelcook 이 유효하면 매핑해서 빌드 (Assimp 없음), 아니면 임포트 → 쿠킹 → 빌드
+    //  - fromCache: 쿠킹 파일을 그대로 썼는지
+    static std::unique_ptr<SkinnedSkeletal> LoadCooked(
+        ID3D11Device* dev,
+        const std::wstring& fbxPath,
+        const std::wstring& texDir,
+        bool* fromCache = nullptr);
+
+    // Assimp 임포트 → 쿠킹 데이터 (계층/본/압축 스트림/압축 클립까지, D3D 없음). 실패 시 예외
+    static void ImportFBX(const std::wstring& fbxPath, SkelCookData& out);
+
+    // 쿠킹 데이터 → GPU 파트/머티리얼 + 인스턴스 (스켈레톤/클립은 shared_ptr 그대로 공유)
+    static std::unique_ptr<SkinnedSkeletal> FromCookData(
+        ID3D11Device* dev,
+        const SkelCookData& data,
+        const std::wstring& texDir);
+
+    // 위와 같지만 텍스처는 미리 디코드된 것 (스트리밍: data.materials 와 같은 순서, SRV 생성만)
+    static std::unique_ptr<SkinnedSkeletal> FromCookData(
+        ID3D11Device* dev,
+        const SkelCookData& data,
+        const std::vector<MaterialDecoded>& decoded);
+
+    static constexpr uint32_t kCookFlags = SkelCook_Skinned | SkelCook_KeepBindT;
+
+    // 같은 스켈레톤/클립/메시를 공유하는 새 인스턴스 (재임포트/GPU 재생성 없음)
+    std::unique_ptr<SkinnedSkeletal> CreateInstance() const;
+
     // 글로벌 인버스(스키닝에서 root 보정 등에 사용)
-    const Matrix& GlobalInverse() const { return mGlobalInv; }
+    const Matrix& GlobalInverse() const { return mInst.Skeleton().globalInv; }
 
     // 클립 길이(초 단위)
-    double DurationSec() const
-    {
-        return (mClip.tps > 0.0) ? (mClip.duration / mClip.tps)
-            : (mClip.duration / 25.0);
-    }
+    double DurationSec() const { return mInst.Clip().DurationSec(); }
+
+    // 인스턴스 재생 상태 (포즈/팔레트 조회용)
+    const AnimatedInstance& Instance() const { return mInst; }
+    AnimatedInstance& Instance() { return mInst; }        // AnimationSystem 등록용
 
 public:
     // -----------------------------------------------------------------------
@@ -144,16 +172,25 @@ public:
     void EvaluatePose(double tSec);                 // 기본: loop = true
     void EvaluatePose(double tSec, bool loop);      // loop 여부 선택
 
+    // 클립 라이브러리 / 재생 클립 선택 / 레이어 블렌딩 (팔레트까지 갱신)
+    const AnimClipLibrary& Clips() const { return mInst.Library(); }
+    void SetClip(int clip) { mInst.SetClip(clip); }
+    void EvaluateLayers(const AnimLayer* layers, size_t count);
+
+    // 스키닝 방식 (인스턴스마다). DualQuat 이면 호출부가 SKIN_DQ 셰이더 변형을 바인딩
+    void SetSkinMode(SkinMode mode) { mInst.SetSkinMode(mode); }
+    SkinMode GetSkinMode() const { return mInst.GetSkinMode(); }
+
 public:
     // -----------------------------------------------------------------------
     // Rendering (패스 분리)
-    //  - 각 Draw*는 "현재 poseGlobal"을 기준으로 파트를 렌더링한다
-    //  - boneCB는 UpdateBonePalette() 결과를 담는 팔레트 상수버퍼
+    //  - 각 Draw*는 "현재 글로벌 포즈(mPoseGlobal)"을 기준으로 파트를 렌더링한다
+    //  - bones는 팔레트 링 버퍼 (VS t11 + b4, UpdateBonePalette()가 업로드/바인딩)
     // -----------------------------------------------------------------------
     void DrawOpaqueOnly(
         ID3D11DeviceContext* ctx,
         const Matrix& worldModel, const Matrix& view, const Matrix& proj,
-        ID3D11Buffer* cb0, ID3D11Buffer* useCB, ID3D11Buffer* boneCB,
+        ID3D11Buffer* cb0, ID3D11Buffer* useCB, BonePaletteRing* bones,
         const Vector4& vLightDir, const Vector4& vLightColor,
         const Vector3& eyePos,
         const Vector3& kA, float ks, float shininess, const Vector3& Ia,
@@ -162,7 +199,7 @@ public:
     void DrawAlphaCutOnly(
         ID3D11DeviceContext* ctx,
         const Matrix& worldModel, const Matrix& view, const Matrix& proj,
-        ID3D11Buffer* cb0, ID3D11Buffer* useCB, ID3D11Buffer* boneCB,
+        ID3D11Buffer* cb0, ID3D11Buffer* useCB, BonePaletteRing* bones,
         const Vector4& vLightDir, const Vector4& vLightColor,
         const Vector3& eyePos,
         const Vector3& kA, float ks, float shininess, const Vector3& Ia,
@@ -171,7 +208,7 @@ public:
     void DrawTransparentOnly(
         ID3D11DeviceContext* ctx,
         const Matrix& worldModel, const Matrix& view, const Matrix& proj,
-        ID3D11Buffer* cb0, ID3D11Buffer* useCB, ID3D11Buffer* boneCB,
+        ID3D11Buffer* cb0, ID3D11Buffer* useCB, BonePaletteRing* bones,
         const Vector4& vLightDir, const Vector4& vLightColor,
         const Vector3& eyePos,
         const Vector3& kA, float ks, float shininess, const Vector3& Ia,
@@ -182,7 +219,7 @@ public:
         const Matrix& worldModel,
         const Matrix& lightView,
         const Matrix& lightProj,
-        ID3D11Buffer* cb0, ID3D11Buffer* useCB, ID3D11Buffer* boneCB,
+        ID3D11Buffer* cb0, ID3D11Buffer* useCB, BonePaletteRing* bones,
         ID3D11VertexShader* vsDepthSkinned,
         ID3D11PixelShader* psDepth,
         ID3D11InputLayout* ilPNTT_BW,
@@ -191,42 +228,69 @@ public:
 public:
     // -----------------------------------------------------------------------
     // Skinning (bone palette)
-    //  - UpdateBonePalette: CPU 팔레트 계산 + boneCB 업로드
-    //  - WarmupBoneCB     : 초기 1회 업로드(디버그/안전용)
+    //  - UpdateBonePalette : 계산된 CPU 팔레트를 링 버퍼에 업로드(버전이 바뀐 경우만) + 바인딩
+    //                        false 면 업로드 실패 → Draw* 는 그리지 않고 돌아간다
+    //  - WarmupBonePalette : 초기 1회 업로드(디버그/안전용)
     // -----------------------------------------------------------------------
-    void UpdateBonePalette(ID3D11DeviceContext* ctx, ID3D11Buffer* boneCB, const Matrix& worldModel);
-    void WarmupBoneCB(ID3D11DeviceContext* ctx, ID3D11Buffer* boneCB);
-
-private:
-    SkinnedSkeletal() = default;
+    bool UpdateBonePalette(ID3D11DeviceContext* ctx, BonePaletteRing* bones, const Matrix& worldModel);
+    void WarmupBonePalette(ID3D11DeviceContext* ctx, BonePaletteRing* bones);
 
+public:
     // -----------------------------------------------------------------------
-    // Key sampling helpers (upper-bound)
-    //  - t 기준으로 "처음으로 t보다 큰 원소의 인덱스"를 찾는 용도
+    // Skin cache (skin once → 모든 패스가 같은 결과 VB를 읽음)
+    //  - EnableSkinCache   : 인스턴스 전용 출력 VB 생성/해제 (CreateInstance 는 공유하지 않음)
+    //  - UpdateSkinCache   : 프레임당 1회, 포즈 평가 후 첫 Draw* 전에 호출 (팔레트 버전이 같으면 생략)
+    //  - SkinCacheActive   : true면 Draw* 가 캐시 VB(PNTT)로 그림 → 호출부는 정적 메시 VS/IL 을 바인딩
+    //  - ValidateSkinCache : GPU 결과를 CPU 레퍼런스(SkinVerticesRef)와 비교 (cpuMs: 레퍼런스 소요 시간)
     // -----------------------------------------------------------------------
-    static int UB_T(double t, const std::vector<SK_KeyT>& v);
-    static int UB_R(double t, const std::vector<SK_KeyR>& v);
-    static int UB_S(double t, const std::vector<SK_KeyS>& v);
+    bool EnableSkinCache(ID3D11Device* dev, bool enable);
+    bool SkinCacheActive() const { return mSkinCache.Ready(); }
+    void UpdateSkinCache(ID3D11DeviceContext* ctx, ID3D11ComputeShader* cs, BonePaletteRing* bones);
+    bool ValidateSkinCache(ID3D11DeviceContext* ctx, SkinDiff& diff, double& cpuMs);
+    const SkinCache::Stats& SkinCacheStats() const { return mSkinCache.GetStats(); }
 
-    // 노드 하나의 로컬 변환을 (T/R/S) 채널에서 샘플링
-    Matrix SampleLocalOf(int nodeIdx, double tTick) const;
+    // CPU 스키닝 측정 (현재 팔레트로 모든 파트를 iterations 회, 파트 합산)
+    SkinBenchResult BenchmarkCpuSkinning(JobSystem* jobs, SkinKernel kernel, int iterations) const;
 
-private:
+public:
     // -----------------------------------------------------------------------
-    // Core data
+    // Baked crowd (베이크 표 + 인스턴싱 → 인스턴스마다 포즈 평가/팔레트 업로드 없음)
+    //  - BakeCrowd       : 모든 클립을 fps 로 베이크 (베이크 노드 i = 파트 i 의 ownerNode)
+    //                      cachePath 의 해시가 같으면 디스크에서 읽고, 아니면 베이크 후 저장
+    //  - DrawCrowdOpaque : 불투명 서브메시만, 서브메시마다 DrawIndexedInstanced 1회
+    //                      (호출부가 VertexShaderCrowd VS / 군중 IL / 메시 PS 를 바인딩)
     // -----------------------------------------------------------------------
-    std::vector<SK_Node> mNodes;
-    std::vector<SK_Part> mParts;
-    std::vector<SK_Bone> mBones;
+    bool BakeCrowd(float fps, const std::filesystem::path& cachePath,
+        AnimBakedSet& out, bool* fromCache = nullptr) const;
 
-    SK_Clip mClip;
-    int mRoot = 0;
-    std::unordered_map<std::string, int> mNameToNode;
+    void DrawCrowdOpaque(
+        ID3D11DeviceContext* ctx, BakedCrowd& crowd,
+        const Matrix& view, const Matrix& proj,
+        ID3D11Buffer* cb0, ID3D11Buffer* useCB,
+        const Vector4& vLightDir, const Vector4& vLightColor,
+        bool disableNormal, bool disableSpecular, bool disableEmissive) const;
 
-    // 스키닝 팔레트(본 개수만큼):
-    //   finalBone = offset * poseGlobal(node)  (혹은 여기에 globalInv/worldModel 보정 포함)
-    std::vector<Matrix> mBonePalette;
+private:
+    SkinnedSkeletal() = default;
 
-    // 루트 보정 등에 사용하는 글로벌 인버스
-    Matrix mGlobalInv = Matrix::Identity;
+    // FromCookData 공통: 머티리얼 i 를 채우는 방법만 다름
+    static std::unique_ptr<SkinnedSkeletal> FromCookDataImpl(
+        ID3D11Device* dev,
+        const SkelCookData& data,
+        const std::function<void(MaterialGPU&, size_t)>& buildMaterial);
+
+    // 파트 메시 포인터 목록 (SkinCache 입력)
+    std::vector<const SkinnedMesh*> PartMeshes() const;
+    // 서브메시 드로우: 캐시가 켜져 있으면 캐시 VB 로, 아니면 원본(스키닝) VB 로
+    void DrawPartSubmesh(ID3D11DeviceContext* ctx, size_t part, size_t sub) const;
+    // 깊이 전용: 위치 스트림(슬롯 0)만
+    void DrawPartSubmeshDepth(ID3D11DeviceContext* ctx, size_t part, size_t sub) const;
+
+private:
+    // -----------------------------------------------------------------------
+    // Shared assets + per-instance state
+    // -----------------------------------------------------------------------
+    std::shared_ptr<const SK_ModelAsset> mModel;   // 파트(GPU 메시/머티리얼)
+    AnimatedInstance mInst;                        // 스켈레톤/클립 참조 + 포즈/팔레트
+    SkinCache mSkinCache;                          // 인스턴스 전용 스키닝 결과 VB (선택)
 };
@@ -7,41 +7,132 @@
 
 #include "../D3D_Core/pch.h"
 #include "StaticMesh.h"
+#include "VertexPack.h"
+#include "MeshCook.h"
 
-bool StaticMesh::Build(ID3D11Device* dev, const MeshData_PNTT& src)
+#include <cmath>
+
+bool StaticMesh::Build(ID3D11Device* dev, const MeshData_PNTT& src, VertexPackReport* packReport)
 {
-	assert(!src.vertices.empty());
-	assert(!src.indices.empty());
+    assert(!src.vertices.empty());
+    assert(!src.indices.empty());
+
+    // 48B → 24B 압축 (왕복 오차/크기는 packReport 또는 전체 합계에 누적)
+    std::vector<VertexPacked_PNTT> packed(src.vertices.size());
+    VertexPackReport report;
+    VertexPackArray(src.vertices.data(), src.vertices.size(), packed.data(), &report);
+    if (packReport) packReport->Merge(report);
+    else VertexPackAddToTotals(report);
+
+    // 슬롯 0(위치+UV 16B) / 슬롯 1(노멀+탄젠트 8B) 로 분리 → 깊이 패스는 슬롯 0 만 읽음
+    std::vector<VertexStreamPos_PNTT> pos(packed.size());
+    std::vector<VertexStreamAttr> attr(packed.size());
+    VertexSplitStreams(packed.data(), packed.size(), pos.data(), attr.data());
+
+    MeshCookView view{};
+    view.pos = pos.data();
+    view.attr = attr.data();
+    view.vertexCount = (uint32_t)pos.size();
+    view.indices = src.indices.data();
+    view.indexCount = (uint32_t)src.indices.size();
+    view.submeshes = src.submeshes.data();
+    view.submeshCount = (uint32_t)src.submeshes.size();
+    view.lods = src.lods.empty() ? nullptr : src.lods.data();
+    view.lodCount = (uint32_t)src.lods.size();
+    return Build(dev, view);
+}
+
+bool StaticMesh::Build(ID3D11Device* dev, const MeshCookView& src)
+{
+    assert(src.vertexCount && src.indexCount);
 
     D3D11_BUFFER_DESC vb{};
 
     vb.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-    vb.ByteWidth = (UINT)(src.vertices.size() * sizeof(VertexCPU_PNTT));
+    vb.ByteWidth = src.vertexCount * kStridePos;
     vb.Usage = D3D11_USAGE_IMMUTABLE;
 
-    D3D11_SUBRESOURCE_DATA vsd{ src.vertices.data(),0,0 };
-    if (FAILED(dev->CreateBuffer(&vb, &vsd, mVB.GetAddressOf()))) return false;
+    D3D11_SUBRESOURCE_DATA vsd{ src.pos,0,0 };
+    if (FAILED(dev->CreateBuffer(&vb, &vsd, mVBPos.GetAddressOf()))) return false;
+
+    vb.ByteWidth = src.vertexCount * kStrideAttr;
+    vsd.pSysMem = src.attr;
+    if (FAILED(dev->CreateBuffer(&vb, &vsd, mVBAttr.GetAddressOf()))) return false;
 
     D3D11_BUFFER_DESC ib{};
     ib.BindFlags = D3D11_BIND_INDEX_BUFFER;
-    ib.ByteWidth = (UINT)(src.indices.size() * sizeof(uint32_t));
+    ib.ByteWidth = src.indexCount * (UINT)sizeof(uint32_t);
     ib.Usage = D3D11_USAGE_IMMUTABLE;
-    D3D11_SUBRESOURCE_DATA isd{ src.indices.data(),0,0 };
+    D3D11_SUBRESOURCE_DATA isd{ src.indices,0,0 };
     if (FAILED(dev->CreateBuffer(&ib, &isd, mIB.GetAddressOf()))) return false;
 
-    mRanges.clear(); mRanges.reserve(src.submeshes.size());
-    for (auto& sm : src.submeshes)
+    mRanges.clear(); mRanges.reserve(src.submeshCount);
+    for (uint32_t i = 0; i < src.submeshCount; ++i) {
+        const SubMeshCPU& sm = src.submeshes[i];
         mRanges.push_back({ sm.indexStart, sm.indexCount, sm.materialIndex });
+    }
+
+    // LOD 범위: 개수가 서브메시 × (단계 - 1) 일 때만 사용 (아니면 LOD0 만)
+    constexpr uint32_t kExtra = kMeshLodLevels - 1;
+    mLodRanges.clear();
+    mLodCount = 1;
+    for (float& e : mLodErrors) e = 0.0f;
+    if (src.lods && src.submeshCount && src.lodCount == src.submeshCount * kExtra) {
+        mLodRanges.reserve(src.lodCount);
+        for (uint32_t i = 0; i < src.lodCount; ++i) {
+            const SubMeshLodCPU& l = src.lods[i];
+            mLodRanges.push_back({ l.indexStart, l.indexCount, mRanges[i / kExtra].materialIndex });
+            if (l.error > mLodErrors[1 + i % kExtra]) mLodErrors[1 + i % kExtra] = l.error;
+        }
+        mLodCount = kMeshLodLevels;
+    }
+
+    // 바운딩 구: 위치 스트림 AABB 중심 + 가장 먼 정점
+    float lo[3] = { src.pos[0].px, src.pos[0].py, src.pos[0].pz }, hi[3] = { lo[0], lo[1], lo[2] };
+    for (uint32_t v = 1; v < src.vertexCount; ++v) {
+        const float p[3] = { src.pos[v].px, src.pos[v].py, src.pos[v].pz };
+        for (int a = 0; a < 3; ++a) {
+            if (p[a] < lo[a]) lo[a] = p[a];
+            if (p[a] > hi[a]) hi[a] = p[a];
+        }
+    }
+    float r2 = 0.0f;
+    for (int a = 0; a < 3; ++a) mBoundsCenter[a] = 0.5f * (lo[a] + hi[a]);
+    for (uint32_t v = 0; v < src.vertexCount; ++v) {
+        const float dx = src.pos[v].px - mBoundsCenter[0], dy = src.pos[v].py - mBoundsCenter[1], dz = src.pos[v].pz - mBoundsCenter[2];
+        const float d2 = dx * dx + dy * dy + dz * dz;
+        if (d2 > r2) r2 = d2;
+    }
+    mBoundsRadius = std::sqrt(r2);
     return true;
 }
 
-void StaticMesh::DrawSubmesh(ID3D11DeviceContext* ctx, size_t i) const
+const StaticMesh::Range& StaticMesh::LodRange(size_t i, UINT lod) const
 {
-    UINT offset = 0; ID3D11Buffer* vb = mVB.Get();
-    ctx->IASetVertexBuffers(0, 1, &vb, &mStride, &offset);
+    assert(i < mRanges.size());
+    if (lod == 0 || mLodRanges.empty()) return mRanges[i];
+    if (lod >= mLodCount) lod = mLodCount - 1;
+    return mLodRanges[i * (kMeshLodLevels - 1) + (lod - 1)];
+}
+
+void StaticMesh::DrawSubmesh(ID3D11DeviceContext* ctx, size_t i, UINT lod) const
+{
+    ID3D11Buffer* vbs[2] = { mVBPos.Get(), mVBAttr.Get() };
+    const UINT strides[2] = { kStridePos, kStrideAttr };
+    const UINT offsets[2] = { 0, 0 };
+    ctx->IASetVertexBuffers(0, 2, vbs, strides, offsets);
     ctx->IASetIndexBuffer(mIB.Get(), DXGI_FORMAT_R32_UINT, 0);
 
-    assert(i < mRanges.size());
-    auto& r = mRanges[i];
+    const Range& r = LodRange(i, lod);
+    ctx->DrawIndexed(r.indexCount, r.indexStart, 0);
+}
+
+void StaticMesh::DrawSubmeshDepth(ID3D11DeviceContext* ctx, size_t i, UINT lod) const
+{
+    UINT offset = 0; ID3D11Buffer* vb = mVBPos.Get();
+    ctx->IASetVertexBuffers(0, 1, &vb, &kStridePos, &offset);
+    ctx->IASetIndexBuffer(mIB.Get(), DXGI_FORMAT_R32_UINT, 0);
+
+    const Range& r = LodRange(i, lod);
     ctx->DrawIndexed(r.indexCount, r.indexStart, 0);
 }
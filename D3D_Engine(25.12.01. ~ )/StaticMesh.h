@@ -11,16 +11,43 @@
 #include <vector>
 #include "MeshDataEx.h"
 
+struct MeshCookView;
+struct VertexPackReport;
+
 class StaticMesh {
 public:
-    bool Build(ID3D11Device* dev, const MeshData_PNTT& src);
-    void DrawSubmesh(ID3D11DeviceContext* ctx, size_t smIdx) const;
+    // packReport: 있으면 압축 오차/크기를 전역 합계 (VertexPack.h) 대신 여기에
+    bool Build(ID3D11Device* dev, const MeshData_PNTT& src, VertexPackReport* packReport = nullptr);
+    // 이미 압축/분리된 스트림 (쿠킹 파일 매핑) → 복사 없이 바로 버퍼 생성
+    bool Build(ID3D11Device* dev, const MeshCookView& src);
+    // lod: 0 = 원본, 1~ = MeshLod 단계 (LodCount() 밖이면 가장 거친 단계)
+    void DrawSubmesh(ID3D11DeviceContext* ctx, size_t smIdx, UINT lod = 0) const;
+    // 깊이 전용: 슬롯 0(위치+UV)만 바인딩 (그림자/포인트 그림자 패스)
+    void DrawSubmeshDepth(ID3D11DeviceContext* ctx, size_t smIdx, UINT lod = 0) const;
 
     struct Range { UINT indexStart, indexCount, materialIndex; };
     const std::vector<Range>& Ranges() const { return mRanges; }
 
+    // ---- LOD (MeshLod.h) ----
+    // 단계 수: LOD 가 없으면 1. 오차는 메시 단위 (서브메시 중 최대, 오브젝트 공간 거리)
+    UINT LodCount() const { return mLodCount; }
+    const float* LodErrors() const { return mLodErrors; }
+    UINT SubmeshIndexCount(size_t smIdx, UINT lod) const { return LodRange(smIdx, lod).indexCount; }
+    // 오브젝트 공간 바운딩 구 (위치 스트림 AABB 기준)
+    const float* BoundsCenter() const { return mBoundsCenter; }
+    float BoundsRadius() const { return mBoundsRadius; }
+
 private:
-    Microsoft::WRL::ComPtr<ID3D11Buffer> mVB, mIB;
-    UINT mStride = sizeof(VertexCPU_PNTT);
+    const Range& LodRange(size_t smIdx, UINT lod) const;
+
+    // Build 에서 압축 후 분리 (VertexPack.h): 슬롯 0 위치+UV / 슬롯 1 노멀+탄젠트
+    Microsoft::WRL::ComPtr<ID3D11Buffer> mVBPos, mVBAttr, mIB;
+    static constexpr UINT kStridePos = sizeof(VertexStreamPos_PNTT);
+    static constexpr UINT kStrideAttr = sizeof(VertexStreamAttr);
     std::vector<Range> mRanges;
+    std::vector<Range> mLodRanges;                  // [서브메시 × (kMeshLodLevels - 1) + (lod - 1)]
+    UINT  mLodCount = 1;
+    float mLodErrors[kMeshLodLevels] = {};
+    float mBoundsCenter[3] = {};
+    float mBoundsRadius = 0.0f;
 };
@@ -0,0 +1,70 @@
+﻿// ============================================================================
+// TextureCache.cpp
+// - TextureCache 구현: SRV 생성 콜백 + 바이트 계산 (캐시 자체는 TextureCacheCore)
+// ============================================================================
+
+// ---- includes ----
+#include "../D3D_Core/pch.h"
+#include "TextureCache.h"
+#include "../D3D_Core/Helper.h"   // CreateTextureFromFile / CreateTextureFromImage
+
+#include <DirectXTex.h>
+
+using Microsoft::WRL::ComPtr;
+
+namespace
+{
+    struct SrvResource : TextureCacheResource
+    {
+        ComPtr<ID3D11ShaderResourceView> srv;
+    };
+
+    // SRV 가 가리키는 2D 텍스처 바이트 (밉 체인 × 배열)
+    uint64_t TextureBytes(ID3D11ShaderResourceView* srv)
+    {
+        ComPtr<ID3D11Resource> res;
+        srv->GetResource(res.GetAddressOf());
+
+        ComPtr<ID3D11Texture2D> tex;
+        if (!res || FAILED(res.As(&tex))) return 0;
+
+        D3D11_TEXTURE2D_DESC td{};
+        tex->GetDesc(&td);
+
+        uint64_t sum = 0;
+        for (UINT m = 0; m < td.MipLevels; ++m) {
+            const size_t w = (td.Width >> m) ? (td.Width >> m) : 1;
+            const size_t h = (td.Height >> m) ? (td.Height >> m) : 1;
+            size_t rowPitch = 0, slicePitch = 0;
+            if (FAILED(DirectX::ComputePitch(td.Format, w, h, rowPitch, slicePitch))) return 0;
+            sum += slicePitch;
+        }
+        return sum * td.ArraySize;
+    }
+}
+
+TextureCache& TextureCache::Instance()
+{
+    static TextureCache s_instance;
+    return s_instance;
+}
+
+ComPtr<ID3D11ShaderResourceView> TextureCache::Load(ID3D11Device* dev, const std::wstring& path,
+    TextureColorSpace cs, const DirectX::ScratchImage* decoded)
+{
+    auto res = mCore.Load(path, cs, [&] {
+        TextureCacheCore::Created made;
+        ComPtr<ID3D11ShaderResourceView> srv;
+        const HRESULT hr = decoded
+            ? CreateTextureFromImage(dev, *decoded, srv.GetAddressOf())
+            : CreateTextureFromFile(dev, path.c_str(), srv.GetAddressOf());
+        if (FAILED(hr) || !srv) return made;
+
+        auto r = std::make_shared<SrvResource>();
+        r->srv = srv;
+        made.bytes = TextureBytes(srv.Get());
+        made.resource = std::move(r);
+        return made;
+        });
+    return res ? static_cast<SrvResource*>(res.get())->srv : nullptr;
+}
@@ -0,0 +1,49 @@
+﻿// ============================================================================
+// TextureCache.h
+// - 머티리얼 텍스처 SRV 공유 캐시: 키 = 정규화된 전체 경로 + 색 공간
+//   · 같은 파일은 SRV 를 한 번만 만든다 (파트 × 머티리얼 만큼 같은 텍스처를 다시 읽던 문제)
+//   · 정규화: absolute → weakly_canonical → '/' 통일 (Windows 는 소문자까지)
+//   · 색 공간: 디퓨즈/이미시브 = SRGB, 노멀/스펙큘러/오파시티 = Linear
+//     (지금은 둘 다 원본 포맷 그대로 생성, 감마는 셰이더 쪽. 나중에 sRGB 뷰로 바꿔도 서로 섞이지 않게 키만 분리)
+// - 스레드 안전: InitScene 병렬 로드 워커들이 동시에 Load
+//   · 같은 키를 동시에 요청하면 먼저 온 스레드만 생성, 나머지는 그 결과를 기다렸다가 공유
+//   · 실패(파일 없음 등)도 기록 → 같은 경로로 다시 읽지 않음 (null 반환)
+//   · 키 / 1회 생성 / 통계는 TextureCacheCore (D3D 없음, 헤드리스 테스트). 여기는 SRV 생성 콜백만
+// - 항목은 Clear 전까지 살아 있음 (UninitScene). 쓰는 쪽 MaterialGPU 는 ComPtr 로 참조만 더 잡는다
+// - 미사용 ResourceManager 의 TextureKey weak_ptr 캐시를 대신함
+// ============================================================================
+
+#pragma once
+
+// ---- includes ----
+#include <string>
+#include <d3d11.h>
+#include <wrl/client.h>   // ComPtr
+
+#include "TextureCacheCore.h"
+
+namespace DirectX { class ScratchImage; }
+
+class TextureCache
+{
+public:
+    static TextureCache& Instance();
+
+    // path: 실제 파일 경로 (ResolveTexturePath 결과). 실패하면 null
+    //  - decoded 가 있으면 파일 대신 그 이미지로 생성 (스트리밍: 워커에서 디코드 → 여기서 생성만)
+    Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> Load(ID3D11Device* dev, const std::wstring& path,
+        TextureColorSpace cs, const DirectX::ScratchImage* decoded = nullptr);
+
+    // 이미 만들어졌는지 (스트리밍 디코드를 건너뛸지 판단용)
+    bool Contains(const std::wstring& path, TextureColorSpace cs) const { return mCore.Contains(path, cs); }
+
+    void Clear() { mCore.Clear(); }
+    TextureCacheStats Stats() const { return mCore.Stats(); }
+
+    static std::wstring NormalizePath(const std::wstring& path) { return TextureCacheCore::NormalizePath(path); }
+
+private:
+    TextureCache() = default;
+
+    TextureCacheCore mCore;
+};
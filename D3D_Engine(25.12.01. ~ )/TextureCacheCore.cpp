@@ -0,0 +1,102 @@
+﻿// ============================================================================
+// TextureCacheCore.cpp
+// - TextureCacheCore 구현: 키 정규화 / 생성 1회 보장 (once_flag) / 바이트 집계
+// ============================================================================
+
+// ---- includes ----
+#include "../D3D_Core/pch.h"
+#include "TextureCacheCore.h"
+
+#include <algorithm>
+#include <cwctype>
+#include <filesystem>
+
+std::wstring TextureCacheCore::NormalizePath(const std::wstring& path)
+{
+    namespace fs = std::filesystem;
+    std::error_code ec;
+
+    fs::path p = fs::absolute(fs::path(path), ec);
+    if (ec) p = fs::path(path);
+
+    fs::path c = fs::weakly_canonical(p, ec);
+    if (!ec) p = c;
+
+    // generic_wstring() => 슬래시 통일(/)
+    std::wstring out = p.generic_wstring();
+
+#if defined(_WIN32)
+    // Windows는 대소문자 무시 → 키도 통일 (같은 파일이 대소문자만 달리 적혀 있는 FBX 대응)
+    std::transform(out.begin(), out.end(), out.begin(),
+        [](wchar_t c) { return (wchar_t)std::towlower(c); });
+#endif
+
+    return out;
+}
+
+std::shared_ptr<TextureCacheResource> TextureCacheCore::Load(const std::wstring& path, TextureColorSpace cs,
+    const CreateFn& create)
+{
+    if (path.empty()) return nullptr;
+
+    Key key{ NormalizePath(path), cs };
+
+    std::shared_ptr<Entry> e;
+    {
+        std::lock_guard<std::mutex> lk(mMx);
+        auto& slot = mEntries[key];
+        if (slot) ++mHits;
+        else { slot = std::make_shared<Entry>(); ++mMisses; }
+        e = slot;
+    }
+
+    // 처음 온 스레드만 생성 (나머지는 여기서 기다림). 생성 중에 다른 잡을 기다리지 않으므로 워커끼리 교착 없음
+    std::call_once(e->once, [&] {
+        Created made = create();
+        if (!made.resource) made.bytes = 0;
+
+        std::lock_guard<std::mutex> lk(mMx);
+        e->resource = made.resource;
+        e->bytes = made.bytes;
+
+        // 생성 중에 Clear 됐으면 집계에서 빠진 항목 → 요청한 쪽에만 돌려줌
+        auto it = mEntries.find(key);
+        if (it == mEntries.end() || it->second != e) return;
+        if (made.resource) { ++mLive; mResidentBytes += made.bytes; }
+        else ++mFailed;
+        });
+
+    std::lock_guard<std::mutex> lk(mMx);
+    return e->resource;
+}
+
+bool TextureCacheCore::Contains(const std::wstring& path, TextureColorSpace cs) const
+{
+    if (path.empty()) return false;
+
+    const Key key{ NormalizePath(path), cs };
+    std::lock_guard<std::mutex> lk(mMx);
+    auto it = mEntries.find(key);
+    return it != mEntries.end() && it->second->resource;
+}
+
+void TextureCacheCore::Clear()
+{
+    std::lock_guard<std::mutex> lk(mMx);
+    mEntries.clear();
+    mHits = mMisses = mFailed = 0;
+    mLive = 0;
+    mResidentBytes = 0;
+}
+
+TextureCacheStats TextureCacheCore::Stats() const
+{
+    std::lock_guard<std::mutex> lk(mMx);
+    TextureCacheStats s;
+    s.hits = mHits;
+    s.misses = mMisses;
+    s.failed = mFailed;
+    s.entries = mLive;
+    s.residentBytes = mResidentBytes;
+    return s;
+}
@@ -0,0 +1,97 @@
+﻿// ============================================================================
+// TextureCacheCore.h
+// - TextureCache 의 D3D 없는 부분: 키 정규화 / 키당 생성 1회 (once_flag) / 통계
+//   · 실제 생성은 Load 에 넘기는 콜백 (TextureCache 는 D3D SRV, 테스트는 가짜 리소스)
+//   · 같은 키를 동시에 요청하면 먼저 온 스레드만 콜백을 부르고 나머지는 그 결과를 기다렸다가 공유
+//   · 실패 (콜백이 null) 도 기록 → 같은 키로 다시 부르지 않음
+//   · 생성 중에 Clear 되면 결과는 요청한 쪽에만 돌려주고 통계/항목에는 넣지 않음
+// ============================================================================
+
+#pragma once
+
+// ---- includes ----
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+enum class TextureColorSpace : uint8_t
+{
+    SRGB = 0,
+    Linear = 1
+};
+
+struct TextureCacheStats
+{
+    uint64_t hits = 0;            // 이미 있거나 다른 스레드가 만드는 중이던 요청
+    uint64_t misses = 0;          // 새로 만든 요청 (= 생성 시도 수)
+    uint64_t failed = 0;          // misses 중 생성 실패
+    size_t   entries = 0;         // 살아 있는 리소스 수
+    uint64_t residentBytes = 0;   // 살아 있는 리소스 바이트 합 (밉/배열 포함)
+};
+
+// 캐시가 들고 있는 리소스 (TextureCache 는 SRV 를 담은 파생 타입)
+struct TextureCacheResource
+{
+    virtual ~TextureCacheResource() = default;
+};
+
+class TextureCacheCore
+{
+public:
+    // 생성 콜백: 실패면 resource == null. bytes 는 통계용
+    struct Created
+    {
+        std::shared_ptr<TextureCacheResource> resource;
+        uint64_t bytes = 0;
+    };
+    using CreateFn = std::function<Created()>;
+
+    // path 가 비어 있으면 null. create 는 이 키의 첫 요청에서만 (락 밖에서) 불림
+    std::shared_ptr<TextureCacheResource> Load(const std::wstring& path, TextureColorSpace cs,
+        const CreateFn& create);
+
+    // 만들어진 (성공한) 항목이 있는지
+    bool Contains(const std::wstring& path, TextureColorSpace cs) const;
+
+    void Clear();
+    TextureCacheStats Stats() const;
+
+    // absolute → weakly_canonical → '/' 통일 (Windows 는 소문자까지)
+    static std::wstring NormalizePath(const std::wstring& path);
+
+private:
+    struct Key
+    {
+        std::wstring path;   // NormalizePath
+        TextureColorSpace cs = TextureColorSpace::SRGB;
+
+        bool operator==(const Key& o) const { return cs == o.cs && path == o.path; }
+    };
+    struct KeyHash
+    {
+        size_t operator()(const Key& k) const noexcept
+        {
+            size_t h1 = std::hash<std::wstring>{}(k.path);
+            size_t h2 = std::hash<uint8_t>{}(static_cast<uint8_t>(k.cs));
+            return h1 ^ (h2 + 0x9e3779b97f4a7c15ull + (h1 << 6) + (h1 >> 2));
+        }
+    };
+    struct Entry
+    {
+        std::once_flag once;
+        std::shared_ptr<TextureCacheResource> resource;
+        uint64_t bytes = 0;
+    };
+
+    mutable std::mutex mMx;
+    std::unordered_map<Key, std::shared_ptr<Entry>, KeyHash> mEntries;
+    uint64_t mHits = 0;
+    uint64_t mMisses = 0;
+    uint64_t mFailed = 0;
+    size_t   mLive = 0;
+    uint64_t mResidentBytes = 0;
+};
@@ -0,0 +1,325 @@
+﻿// ============================================================================
+// TexturePathIndex.cpp
+// - TexturePathIndex 구현: 루트 폴더 색인 / 메모리 해결 / 루트별 공유 / 벤치
+// ============================================================================
+
+// ---- includes ----
+#include "../D3D_Core/pch.h"
+#include "TexturePathIndex.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cwctype>
+
+namespace
+{
+    namespace fs = std::filesystem;
+
+    // 표 키: '\\' → '/', 소문자, "." 제거, ".." 는 앞 요소와 상쇄 (남으면 유지), 빈 요소/앞뒤 '/' 제거
+    //  - fs::path 를 거치지 않음 (조회마다 path 파싱/조립이 exists 만큼 느림)
+    std::wstring Key(std::wstring_view s)
+    {
+        std::wstring out;
+        out.reserve(s.size());
+        size_t i = 0;
+        while (i < s.size()) {
+            size_t j = i;
+            while (j < s.size() && s[j] != L'/' && s[j] != L'\\') ++j;
+            const std::wstring_view part = s.substr(i, j - i);
+            i = j + 1;
+
+            if (part.empty() || part == L".") continue;
+            if (part == L"..") {
+                const size_t slash = out.rfind(L'/');
+                const std::wstring_view last = (slash == std::wstring::npos) ? std::wstring_view(out) : std::wstring_view(out).substr(slash + 1);
+                if (!out.empty() && last != L"..") { out.resize(slash == std::wstring::npos ? 0 : slash); continue; }
+            }
+            if (!out.empty()) out.push_back(L'/');
+            for (wchar_t c : part) out.push_back((wchar_t)std::towlower(c));
+        }
+        return out;
+    }
+
+    std::wstring PathKey(const fs::path& p) { return Key(std::wstring_view(p.wstring())); }
+
+    std::wstring_view FileName(std::wstring_view s)
+    {
+        const size_t slash = s.find_last_of(L"/\\");
+        return (slash == std::wstring_view::npos) ? s : s.substr(slash + 1);
+    }
+
+    // fs::path::is_absolute 와 같은 규칙 (Windows: "C:/..." 또는 "//server/...", 그 외: '/' 시작)
+    bool IsAbsolute(std::wstring_view s)
+    {
+        auto sep = [](wchar_t c) { return c == L'/' || c == L'\\'; };
+#if defined(_WIN32)
+        return (s.size() >= 3 && s[1] == L':' && sep(s[2])) || (s.size() >= 2 && sep(s[0]) && sep(s[1]));
+#else
+        return !s.empty() && sep(s[0]);
+#endif
+    }
+
+    // fs::path::relative_path 와 같음 ("C:/a/b" → "a/b", "/a/b" → "a/b")
+    std::wstring_view RelativePart(std::wstring_view s)
+    {
+#if defined(_WIN32)
+        if (s.size() >= 2 && s[1] == L':') s.remove_prefix(2);
+#endif
+        while (!s.empty() && (s[0] == L'/' || s[0] == L'\\')) s.remove_prefix(1);
+        return s;
+    }
+
+    bool IsOutsideKey(const std::wstring& key)
+    {
+        return key.empty() || key == L".." || key.compare(0, 3, L"../") == 0;
+    }
+
+    // "a/b/" → "a/b" (lexically_relative 기준이 마지막 빈 요소 때문에 어긋나지 않게)
+    fs::path StripTrailingSeparator(fs::path p)
+    {
+        if (!p.has_filename() && p.has_relative_path()) p = p.parent_path();
+        return p;
+    }
+
+    double MsSince(std::chrono::steady_clock::time_point t0)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    }
+
+    struct IndexSlot
+    {
+        std::once_flag once;
+        std::shared_ptr<const TexturePathIndex> index;
+    };
+
+    std::mutex g_indexMx;
+    std::unordered_map<std::wstring, std::shared_ptr<IndexSlot>> g_indices;
+}
+
+TexturePathIndex::TexturePathIndex(const std::wstring& texRoot)
+    : mRoot(texRoot)
+{
+    const auto t0 = std::chrono::steady_clock::now();
+
+    const fs::path base = StripTrailingSeparator(fs::path(mRoot));
+    std::error_code ec;
+    fs::path abs = fs::absolute(base, ec);
+    mRootKey = PathKey(ec ? base : abs);
+
+    for (fs::recursive_directory_iterator it(base, fs::directory_options::skip_permission_denied, ec), end;
+        !ec && it != end; it.increment(ec)) {
+        std::error_code fec;
+        if (!it->is_regular_file(fec)) continue;
+        // 대소문자만 다른 파일이 둘이면 먼저 나온 쪽 (Windows 에선 있을 수 없음)
+        mFiles.emplace(PathKey(it->path().lexically_relative(base)), it->path().wstring());
+    }
+
+    mBuildMs = MsSince(t0);
+}
+
+std::shared_ptr<const TexturePathIndex> TexturePathIndex::For(const std::wstring& texRoot)
+{
+    std::error_code ec;
+    fs::path abs = fs::absolute(StripTrailingSeparator(texRoot), ec);
+    const std::wstring key = PathKey(ec ? fs::path(texRoot) : abs);
+
+    std::shared_ptr<IndexSlot> slot;
+    {
+        std::lock_guard<std::mutex> lk(g_indexMx);
+        auto& s = g_indices[key];
+        if (!s) s = std::make_shared<IndexSlot>();
+        slot = s;
+    }
+    std::call_once(slot->once, [&] { slot->index = std::make_shared<TexturePathIndex>(texRoot); });
+    return slot->index;
+}
+
+void TexturePathIndex::ClearAll()
+{
+    std::lock_guard<std::mutex> lk(g_indexMx);
+    g_indices.clear();
+}
+
+std::vector<std::wstring> TexturePathIndex::RelativePaths() const
+{
+    const fs::path base = StripTrailingSeparator(fs::path(mRoot));
+    std::vector<std::wstring> out;
+    out.reserve(mFiles.size());
+    for (const auto& kv : mFiles)
+        out.push_back(fs::path(kv.second).lexically_relative(base).generic_wstring());
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+bool TexturePathIndex::Find(std::wstring_view rel, std::wstring& out) const
+{
+    const std::wstring key = Key(rel);
+    if (IsOutsideKey(key)) {
+        std::wstring full = Join(rel);
+        if (!ExistsOutside(full, Key(std::wstring_view(full)))) return false;
+        out = std::move(full);
+        return true;
+    }
+
+    auto it = mFiles.find(key);
+    if (it == mFiles.end()) return false;
+    out = it->second;
+    return true;
+}
+
+std::wstring TexturePathIndex::Join(std::wstring_view rel) const
+{
+    // mRoot / rel 과 같은 결과 (rel 은 상대 경로)
+    std::wstring out = mRoot;
+    if (!out.empty() && out.back() != L'/' && out.back() != L'\\') out.push_back((wchar_t)fs::path::preferred_separator);
+    out.append(rel);
+    return out;
+}
+
+bool TexturePathIndex::ExistsOutside(const std::wstring& path, const std::wstring& key) const
+{
+    {
+        std::lock_guard<std::mutex> lk(mOutsideMx);
+        auto it = mOutside.find(key);
+        if (it != mOutside.end()) return it->second;
+    }
+    std::error_code ec;
+    const bool e = fs::exists(fs::path(path), ec);
+    std::lock_guard<std::mutex> lk(mOutsideMx);
+    mOutside.emplace(key, e);
+    return e;
+}
+
+std::wstring TexturePathIndex::Resolve(const std::wstring& f) const
+{
+    // FBX embedded texture (*0 같은 형태)면 지금 엔진 구조에선 포기
+    if (f.empty() || f[0] == L'*') return L"";
+
+    const std::wstring name(FileName(f));
+    std::wstring out;
+
+    if (IsAbsolute(f)) {
+        // 1) 존재하면 그대로 (루트 안이면 표, 밖이면 exists 1번)
+        const std::wstring key = Key(std::wstring_view(f));
+        const size_t n = mRootKey.size();
+        const bool inRoot = key.size() > n + 1 && key.compare(0, n, mRootKey) == 0 && (n == 0 || key[n] == L'/');
+        if (inRoot ? mFiles.count(key.substr(n ? n + 1 : 0)) != 0 : ExistsOutside(f, key))
+            return f;
+
+        // 2) 다른 PC 에서 export 된 절대 경로: 파일명 → "루트 붙은 경로" → textures/파일명
+        if (Find(name, out)) return out;
+        if (Find(RelativePart(f), out)) return out;
+        if (Find(L"textures/" + name, out)) return out;
+        return Join(name);
+    }
+
+    // 3) 상대 경로 → 4) 파일명만 → textures/파일명
+    if (Find(f, out)) return out;
+    if (Find(name, out)) return out;
+    if (Find(L"textures/" + name, out)) return out;
+    return Join(f);
+}
+
+// ----------------------------------------------------------------------------
+// 색인 없는 원래 방식 (후보마다 fs::exists)
+// ----------------------------------------------------------------------------
+std::wstring TexturePathResolveProbe(const std::wstring& f, const std::wstring& texRoot)
+{
+    if (f.empty()) return L"";
+
+    fs::path p(f);
+
+    // FBX embedded texture (*0 같은 형태)면 지금 엔진 구조에선 포기
+    if (f[0] == L'*')
+        return L"";
+
+    auto exists = [](const fs::path& x)->bool {
+        std::error_code ec;
+        return !x.empty() && fs::exists(x, ec);
+        };
+
+    fs::path root(texRoot);
+
+    // 1) 절대경로가 실제로 존재하면 그대로 사용
+    if (p.is_absolute() && exists(p))
+        return p.wstring();
+
+    // 2) 절대경로인데 존재 안 하면: 파일명만 떼서 texRoot에서 찾기
+    // (다른 PC에서 export된 FBX 절대경로 대응)
+    if (p.is_absolute()) {
+        fs::path c1 = root / p.filename();
+        if (exists(c1)) return c1.wstring();
+
+        // "/Textures/a.png" 같은 "루트 붙은 경로"는 relative_path로 뽑아서 texRoot에 붙여보기
+        fs::path c2 = root / p.relative_path();
+        if (exists(c2)) return c2.wstring();
+
+        fs::path c3 = root / L"textures" / p.filename();
+        if (exists(c3)) return c3.wstring();
+
+        // 마지막: 어차피 실패할 거지만 에러 메시지에 뜨게 경로 반환
+        return c1.wstring();
+    }
+
+    // 3) 상대경로: texRoot/상대경로
+    fs::path c = root / p;
+    if (exists(c)) return c.wstring();
+
+    // 4) 상대경로인데 서브폴더가 깨진 케이스 대비: 파일명만으로도 찾아보기
+    fs::path c3 = root / p.filename();
+    if (exists(c3)) return c3.wstring();
+
+    fs::path c4 = root / L"textures" / p.filename();
+    if (exists(c4)) return c4.wstring();
+
+    return c.wstring();
+}
+
+// ----------------------------------------------------------------------------
+// 벤치
+// ----------------------------------------------------------------------------
+TexturePathBenchResult TexturePathBenchmark(const std::wstring& texRoot, size_t materialCount)
+{
+    constexpr size_t kSlots = 5;
+    TexturePathBenchResult r;
+
+    // 새로 만든 색인 (공유 인스턴스를 쓰면 빌드 시간이 안 잡힘)
+    const TexturePathIndex index(texRoot);
+    r.files = index.FileCount();
+    r.buildMs = index.BuildMs();
+
+    std::vector<std::wstring> files = index.RelativePaths();
+    if (files.empty()) files.push_back(L"none.png");
+
+    std::error_code ec;
+    const fs::path rootAbs = fs::absolute(fs::path(texRoot), ec);
+    const fs::path foreign = rootAbs.root_path() / L"__export__" / L"textures";
+
+    std::vector<std::wstring> inputs;
+    inputs.reserve(materialCount * kSlots);
+    for (size_t i = 0; i < materialCount * kSlots; ++i) {
+        const fs::path rel(files[i % files.size()]);
+        switch ((i / files.size() + i) % 5) {
+        case 0:  inputs.push_back(rel.wstring()); break;                              // 정상 상대 경로
+        case 1:  inputs.push_back((fs::path(L"broken") / rel.filename()).wstring()); break;   // 깨진 서브폴더
+        case 2:  inputs.push_back((foreign / rel.filename()).wstring()); break;        // 다른 PC 절대 경로
+        case 3:  inputs.push_back((rootAbs / rel).wstring()); break;                   // 루트 안 절대 경로
+        default: inputs.push_back(L"missing_" + rel.filename().wstring()); break;       // 없는 파일
+        }
+    }
+    r.lookups = inputs.size();
+
+    std::vector<std::wstring> probe(inputs.size()), indexed(inputs.size());
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < inputs.size(); ++i) probe[i] = TexturePathResolveProbe(inputs[i], texRoot);
+    r.probeMs = MsSince(t0);
+
+    t0 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < inputs.size(); ++i) indexed[i] = index.Resolve(inputs[i]);
+    r.indexMs = MsSince(t0);
+
+    for (size_t i = 0; i < inputs.size(); ++i)
+        if (Key(probe[i]) != Key(indexed[i])) ++r.mismatches;
+    return r;
+}
@@ -0,0 +1,80 @@
+﻿// ============================================================================
+// TexturePathIndex.h
+// - 머티리얼 텍스처 경로 해결 (FBX 에 적힌 경로 → 실제 파일)
+//   · 이전: 슬롯마다 후보 경로를 fs::exists 로 최대 4번 찔러 봄 → 네트워크 드라이브/큰 텍스처 폴더에서 I/O 바운드
+//   · 지금: 텍스처 루트마다 한 번 폴더를 훑어 "루트 기준 상대 경로(소문자) → 실제 경로" 표를 만들고 메모리에서만 찾음
+//     (같은 루트를 쓰는 모델끼리 표 공유: For)
+// - 찾는 순서 (TexturePathResolveProbe 와 같은 규칙)
+//   1) 절대 경로가 존재 → 그대로 (루트 밖이면 fs::exists 1번, 결과는 표에 기억)
+//   2) 절대 경로인데 없음 → 루트/파일명 → 루트/relative_path
+//   3) 상대 경로 → 루트/상대 경로
+//   4) 루트/파일명 → 루트/textures/파일명 (서브폴더가 깨진 export 대비)
+//   · 대소문자 무시. 못 찾으면 에러 메시지용 후보 경로, embedded(*0) 면 빈 문자열
+// - 표는 만든 시점 기준 → 실행 중 파일을 추가했으면 ClearAll (UninitScene 에서도 호출)
+// - D3D 의존 없음 (헤드리스 벤치: TexturePathBenchmark)
+// ============================================================================
+
+#pragma once
+
+// ---- includes ----
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class TexturePathIndex
+{
+public:
+    // 루트 폴더를 재귀로 훑어 표 생성 (없는 폴더면 빈 표)
+    explicit TexturePathIndex(const std::wstring& texRoot);
+
+    // 루트별 공유 인스턴스 (처음 요청한 스레드만 훑고 나머지는 기다렸다가 공유)
+    static std::shared_ptr<const TexturePathIndex> For(const std::wstring& texRoot);
+    static void ClearAll();
+
+    std::wstring Resolve(const std::wstring& f) const;
+
+    size_t FileCount() const { return mFiles.size(); }
+    double BuildMs() const { return mBuildMs; }
+    std::vector<std::wstring> RelativePaths() const;   // 색인된 파일의 루트 기준 상대 경로 (실제 대소문자)
+
+private:
+    // 루트 기준 상대 경로 → 실제 경로. 루트 밖(..)으로 나가면 ExistsOutside
+    bool Find(std::wstring_view rel, std::wstring& out) const;
+    bool ExistsOutside(const std::wstring& path, const std::wstring& key) const;
+    std::wstring Join(std::wstring_view rel) const;
+
+    std::wstring mRoot;      // 받은 그대로 (결과 경로는 문자열로 조립: 조회마다 fs::path 를 만들지 않음)
+    std::wstring mRootKey;   // 루트 절대 경로의 키 (절대 경로가 루트 안인지 판단)
+    std::unordered_map<std::wstring, std::wstring> mFiles;   // 상대 경로(소문자, '/') → 실제 경로
+    double mBuildMs = 0.0;
+
+    // 루트 밖 절대 경로 존재 여부 (같은 FBX 절대 경로가 머티리얼마다 반복됨)
+    mutable std::mutex mOutsideMx;
+    mutable std::unordered_map<std::wstring, bool> mOutside;
+};
+
+// 색인 없이 매번 fs::exists 로 찾는 원래 방식 (벤치 기준선 / 루트가 비었을 때)
+std::wstring TexturePathResolveProbe(const std::wstring& f, const std::wstring& texRoot);
+
+// ---------------------------------------------------------------------------
+// TexturePathBenchmark
+//  - texRoot 의 파일로 materialCount 개 × 5 슬롯 가짜 머티리얼 경로를 만들어 (상대/깨진 서브폴더/
+//    다른 PC 절대 경로/루트 안 절대 경로/없는 파일 섞음) 두 방식으로 해결한 시간 비교
+//  - mismatches: 두 결과가 다른 수 (대소문자/구분자만 다른 건 같음으로 봄). 0 이어야 함
+// ---------------------------------------------------------------------------
+struct TexturePathBenchResult
+{
+    size_t files = 0;          // 색인된 파일 수
+    size_t lookups = 0;        // 해결 횟수 (materialCount × 5)
+    size_t mismatches = 0;
+    double buildMs = 0.0;      // 색인 만들기 (1번)
+    double probeMs = 0.0;      // TexturePathResolveProbe 전체
+    double indexMs = 0.0;      // TexturePathIndex::Resolve 전체 (buildMs 제외)
+};
+
+TexturePathBenchResult TexturePathBenchmark(const std::wstring& texRoot, size_t materialCount);
@@ -46,7 +46,18 @@
 #include "../Material.h"
 #include "../RigidSkeletal.h"
 #include "../SkinnedSkeletal.h"
+#include "../BonePaletteRing.h"
+#include "../VertexPack.h"
 #include "../AssimpImporterEx.h"
+#include "../MeshCook.h"
+#include "../MeshLod.h"
+#include "../MeshOptimize.h"
+#include "../AssetLoadBatch.h"
+#include "../AssetStreamer.h"
+#include "../TextureCache.h"
+#include "../TexturePathIndex.h"
+#include "../Animation/AnimationSystem.h"
+#include "../../D3D_Core/JobSystem.h"
 
 #pragma comment(lib, "d3d11.lib")
 #pragma comment(lib, "d3dcompiler.lib")
@@ -96,6 +107,9 @@ private:
 	bool InitScene();
 	void UninitScene();
 
+	// 정적 메시 로드 경로 비교 (Assimp 임포트 vs 쿠킹 파일 mmap). 결과는 mMeshCookUI
+	void MeasureMeshLoadPaths();
+
 	// =========================================================================
 	// Shadow / DepthOnly
 	// =========================================================================
@@ -148,6 +162,10 @@ private:
 	void BindStaticMeshPipeline(ID3D11DeviceContext* ctx);
 	void BindStaticMeshPipeline_PBR(ID3D11DeviceContext* ctx);
 	void BindSkinnedMeshPipeline(ID3D11DeviceContext* ctx);
+	void BindCrowdPipeline(ID3D11DeviceContext* ctx);
+
+	// 베이크 군중: 인스턴스 레코드(월드 + 베이크 프레임) 작성/업로드 (OnRender 초반 1회)
+	void UpdateBakedCrowd(ID3D11DeviceContext* ctx);
 
 	void DrawStaticOpaqueOnly(
 		ID3D11DeviceContext* ctx,
@@ -170,6 +188,9 @@ private:
 		const Matrix& world,
 		const ConstantBuffer& cb);
 
+	// 스트리밍 메시 (준비 전에는 대체 큐브)
+	void DrawStreamedOpaque(ID3D11DeviceContext* ctx, const ConstantBuffer& cb);
+
 	// =========================================================================
 	// Tone Mapping / SceneHDR
 	// =========================================================================
@@ -263,10 +284,123 @@ private:
 	// =========================================================================
 
 	ID3D11VertexShader* m_pSkinnedVS = nullptr;
+	Microsoft::WRL::ComPtr<ID3D11VertexShader> mVS_SkinnedDQ;   // SKIN_DQ 변형 (같은 IL)
 	ID3D11InputLayout* m_pSkinnedIL = nullptr;
-	ID3D11Buffer* m_pBoneCB = nullptr; // VS b4
+	BonePaletteRing mBonePalette;      // VS t11(본 행) + b4(시작 오프셋)
+	Microsoft::WRL::ComPtr<ID3D11ComputeShader> mCS_Skinning;   // Skinning_CS.hlsl (스킨 캐시)
+	Microsoft::WRL::ComPtr<ID3D11ComputeShader> mCS_SkinningDQ; // SKIN_DQ 변형
+	bool mUseSkinCache = true;         // skin once → 모든 패스가 캐시 VB 사용
 	std::unique_ptr<SkinnedSkeletal> mSkinRig;             // SkinningTest.fbx
 
+	// =========================================================================
+	// Baked Crowd (AnimBake 표 + 인스턴싱) : VS t11 / b4 를 팔레트 링 대신 사용
+	// =========================================================================
+
+	Microsoft::WRL::ComPtr<ID3D11VertexShader> mVS_Crowd;      // VertexShaderCrowd.hlsl
+	Microsoft::WRL::ComPtr<ID3D11InputLayout>  mIL_Crowd;      // PNTT_BW(슬롯 0/1) + 인스턴스(슬롯 2)
+	AnimBakedSet mCrowdBake;
+	BakedCrowd   mCrowd;
+	std::vector<BakedCrowd::Instance> mCrowdInst;
+	static constexpr UINT kCrowdMaxInstances = 4096;
+
+	struct CrowdUI
+	{
+		bool   enabled = false;
+		int    countX = 16;
+		int    countZ = 16;
+		float  spacing = 120.0f;       // 모델 공간 단위 (mSkinX 스케일/회전이 같이 적용됨)
+		int    clip = 0;
+		bool   loop = true;
+		float  speed = 1.0f;
+		bool   desync = true;          // 인스턴스마다 시작 시각을 흩뜨림
+		double t = 0.0;
+
+		float  fps = 30.0f;            // 베이크 샘플링 속도
+		double bakeMs = 0.0;           // 베이크(또는 캐시 로드) 소요
+		bool   fromCache = false;
+	} mCrowdUI;
+
+	// =========================================================================
+	// Cooked Mesh (.meshcook) : 시작 시 정적 메시 로드 경로 / 소요 시간
+	// =========================================================================
+
+	struct MeshCookUI
+	{
+		bool   useCooked = true;       // InitScene 에서 쿠킹 캐시 사용 (끄면 매번 Assimp)
+		bool   loadedCooked = false;   // 이번 실행이 실제로 어느 경로였는지
+		double loadMs = 0.0;           // 정적 메시 + 머티리얼 전체 (텍스처 포함, 에셋별 시간 합)
+		int    cacheHits = 0;          // 쿠킹 파일을 그대로 매핑
+		int    cooked = 0;             // 임포트 후 새로 쿠킹
+		int    imported = 0;           // Assimp 경로 (쿠킹 끔/실패)
+		std::vector<std::wstring> files;
+
+		// 스켈레탈 (.skelcook: BoxHuman 리지드 + SkinningTest 스키닝)
+		double skelMs = 0.0;           // 에셋별 시간 합
+		int    skelHits = 0;
+		int    skelCooked = 0;
+
+		// MeasureMeshLoadPaths (메시만, 머티리얼/텍스처 제외)
+		double assimpMs = 0.0;
+		double cookedMs = 0.0;
+		uint64_t cookedBytes = 0;
+	} mMeshCookUI;
+
+	// InitScene 에셋 로드 (AssetLoadBatch: 에셋마다 잡 하나, 단계별 시간)
+	struct SceneLoadUI
+	{
+		bool     parallel = true;          // InitScene 에서 JobSystem 사용 (끄면 호출 스레드에서 순서대로)
+		bool     loadedParallel = false;   // 이번 실행이 실제로 어느 경로였는지
+		double   wallMs = 0.0;             // 전체 벽시계 시간
+		double   summedMs = 0.0;           // 에셋별 시간 합 (병렬이면 서로 겹침)
+		unsigned threads = 1;
+		std::vector<AssetLoadTiming> assets;
+	} mSceneLoadUI;
+
+	// 실행 중 스트리밍 (AssetStreamer): I/O 스레드에서 디코드 → OnUpdate 에서 예산 안에서 업로드
+	AssetStreamer mStreamer;
+	struct StreamUI
+	{
+		int   budgetKB = 4096;          // 프레임당 업로드 바이트
+		float budgetMs = 2.0f;          // 프레임당 업로드 시간
+		float ringRadius = 800.0f;      // 테스트 메시 배치 (원점 둘레)
+
+		struct Item
+		{
+			StreamHandle h;
+			std::string  name;
+			Matrix       world;             // 실제 메시
+			Matrix       placeholderWorld;  // 대체 큐브 (단위 큐브 → 대략의 크기, 바닥에 놓이게)
+		};
+		std::vector<Item> meshes;
+		StreamHandle texture;
+	} mStreamUI;
+
+	// =========================================================================
+	// Mesh LOD (MeshLod.h) : 정적 메시 단계 선택 + 패스별 삼각형 수
+	// =========================================================================
+
+	struct MeshLodUI
+	{
+		bool  enabled = true;          // 끄면 모든 패스 LOD0
+		float maxPixels = 1.0f;        // 허용 화면 오차 (px, 각 패스의 뷰포트 기준)
+		int   shadowBias = 1;          // 그림자 패스는 이만큼 더 거친 단계 (0 = 메인과 같은 기준)
+		int   forceLod = -1;           // 0~ 이면 모든 패스에 고정 (디버그)
+
+		enum Pass { Main, DirShadow, PointShadow, PassCount };
+		struct Frame
+		{
+			uint64_t tris[PassCount] = {};                  // 실제로 그린 삼각형
+			uint64_t lod0Tris[PassCount] = {};              // 전부 LOD0 이었다면
+			uint32_t draws[PassCount][kMeshLodLevels] = {}; // 단계별 서브메시 드로우 수
+		};
+		Frame cur, last;               // OnRender 시작에서 cur → last (패널은 last)
+	} mMeshLodUI;
+
+	// view/proj: 그 패스의 카메라 (row-major), viewportH: 그 패스 뷰포트 높이
+	UINT SelectStaticLod(const StaticMesh& mesh, const Matrix& world,
+		const Matrix& view, const Matrix& proj, float viewportH, MeshLodUI::Pass pass) const;
+	void CountStaticLod(const StaticMesh& mesh, size_t smIdx, UINT lod, MeshLodUI::Pass pass);
+
 	// =========================================================================
 	// Shadow Resources (Directional)
 	// =========================================================================
@@ -281,6 +415,7 @@ private:
 
 	Microsoft::WRL::ComPtr<ID3D11VertexShader>       mVS_Depth;
 	Microsoft::WRL::ComPtr<ID3D11VertexShader>       mVS_DepthSkinned;
+	Microsoft::WRL::ComPtr<ID3D11VertexShader>       mVS_DepthSkinnedDQ;
 	Microsoft::WRL::ComPtr<ID3D11PixelShader>        mPS_Depth;
 	Microsoft::WRL::ComPtr<ID3D11PixelShader>        mPS_PointShadow;
 	Microsoft::WRL::ComPtr<ID3D11InputLayout>        mIL_PNTT;
@@ -342,11 +477,19 @@ private:
 		bool   loop = true;
 		float  speed = 1.0f;
 		double t = 0.0;
+
+		int           clip = 0;        // 클립 라이브러리 인덱스
+		float         fadeSec = 0.25f; // 클립 전환 크로스페이드 시간
+		AnimCrossfade xf;              // 빠져나가는 클립 상태
 	};
 
 	AnimCtrl mBoxAC;
 	AnimCtrl mSkinAC;
 
+	// 인스턴스 일괄 평가 (OnUpdate에서 등록 → 워커로 분배)
+	std::unique_ptr<JobSystem> mJobs;
+	AnimationSystem            mAnimSys;
+
 	// =========================================================================
 	// Debug Arrow / Markers
 	// =========================================================================
@@ -37,6 +37,33 @@ void TutorialApp::UninitImGUI()
 // Local UI Helper
 // ============================================================================
 
+// 클립 선택 콤보 + 크로스페이드 시간. 선택이 바뀌면 true
+static bool ClipUI(const char* label, const AnimClipLibrary& lib, int& clip, float& fadeSec)
+{
+	if (lib.Count() <= 1)
+		return false;
+
+	bool changed = false;
+	const std::string& cur = lib.Get(clip).name;
+	if (ImGui::BeginCombo(label, cur.empty() ? "(unnamed)" : cur.c_str()))
+	{
+		for (int i = 0; i < (int)lib.Count(); ++i)
+		{
+			const std::string& name = lib.Get(i).name;
+			char item[128];
+			snprintf(item, sizeof(item), "%d: %s", i, name.empty() ? "(unnamed)" : name.c_str());
+			if (ImGui::Selectable(item, i == clip) && i != clip)
+			{
+				clip = i;
+				changed = true;
+			}
+		}
+		ImGui::EndCombo();
+	}
+	ImGui::DragFloat("크로스페이드(Fade, sec)", &fadeSec, 0.01f, 0.0f, 2.0f, "%.2f");
+	return changed;
+}
+
 static void AnimUI(
 	const char* label,
 	bool& play,
@@ -515,6 +542,14 @@ void TutorialApp::UpdateImGUI()
 				ImGui::Text("Ticks/sec: %.3f", tps);
 				ImGui::Text("Duration : %.3f sec", durS);
 
+				const int prevClip = mBoxAC.clip;
+				if (ClipUI("클립(Clip)##Box", mBoxRig->Clips(), mBoxAC.clip, mBoxAC.fadeSec))
+				{
+					mBoxAC.xf.Begin(prevClip, mBoxAC.t, mBoxAC.loop, mBoxAC.fadeSec);
+					mBoxAC.t = 0.0;
+					mBoxRig->SetClip(mBoxAC.clip);
+				}
+
 				AnimUI(
 					"Controls",
 					mBoxAC.play, mBoxAC.loop, mBoxAC.speed, mBoxAC.t,
@@ -561,6 +596,14 @@ void TutorialApp::UpdateImGUI()
 				const double durS = mSkinRig->DurationSec();
 				ImGui::Text("Duration : %.3f sec", durS);
 
+				const int prevClip = mSkinAC.clip;
+				if (ClipUI("클립(Clip)##skin", mSkinRig->Clips(), mSkinAC.clip, mSkinAC.fadeSec))
+				{
+					mSkinAC.xf.Begin(prevClip, mSkinAC.t, mSkinAC.loop, mSkinAC.fadeSec);
+					mSkinAC.t = 0.0;
+					mSkinRig->SetClip(mSkinAC.clip);
+				}
+
 				AnimUI(
 					"Controls##skin",
 					mSkinAC.play, mSkinAC.loop, mSkinAC.speed, mSkinAC.t,
@@ -582,6 +625,382 @@ void TutorialApp::UpdateImGUI()
 			}
 		}
 
+		// --------------------------------------------------------------------
+		// Animation LOD / AnimationSystem 통계
+		// --------------------------------------------------------------------
+		if (ImGui::CollapsingHeader("애니메이션 LOD(Animation LOD)"))
+		{
+			AnimLodSettings& lod = mAnimSys.Lod();
+			ImGui::Checkbox("LOD 사용(Enable)", &lod.enabled);
+			ImGui::DragFloat("Reduced 거리", &lod.reducedDistance, 10.0f, 0.0f, 100000.0f, "%.0f");
+			ImGui::DragFloat("Far 거리", &lod.farDistance, 10.0f, 0.0f, 100000.0f, "%.0f");
+			ImGui::SliderInt("Reduced 주기(frames)", &lod.reducedInterval, 1, 8);
+			ImGui::SliderInt("Far 주기(frames)", &lod.farInterval, 1, 16);
+			ImGui::SliderInt("Offscreen 주기(0=정지)", &lod.offscreenInterval, 0, 16);
+			ImGui::Checkbox("주기 사이 보간(Interpolate)", &lod.interpolate);
+			ImGui::DragFloat("말단 본 생략(px 미만)", &lod.leafSkipPixels, 1.0f, 0.0f, 1000.0f, "%.0f");
+
+			const AnimationSystem::Stats& st = mAnimSys.LastStats();
+			ImGui::SeparatorText("통계(Stats)");
+			ImGui::Text("Instances: %zu  Batches: %zu  Update: %.3f ms", st.instances, st.batches, st.updateMs);
+			for (size_t i = 0; i < (size_t)AnimLodLevel::Count; ++i)
+				ImGui::Text("  %-9s : %zu", AnimLodLevelName((AnimLodLevel)i), st.lodCount[i]);
+			ImGui::Text("Evaluated: %zu (leaf skip %zu)  Interpolated: %zu  Skipped: %zu",
+				st.evaluated, st.leafSkipped, st.interpolated, st.skipped);
+
+			const BonePaletteRing::Stats& bp = mBonePalette.LastFrame();
+			ImGui::SeparatorText("본 팔레트 업로드(Bone Palette)");
+			ImGui::Text("Uploads: %u  Reused: %u  Base CB: %u  Discards: %u",
+				bp.uploads, bp.reuses, bp.baseUpdates, bp.discards);
+			ImGui::Text("Bytes/frame: %llu (ring %u bones)", (unsigned long long)bp.bytes, mBonePalette.CapacityBones());
+
+			ImGui::SeparatorText("스키닝 방식(Skinning Mode)");
+			if (mSkinRig)
+			{
+				int mode = (int)mSkinRig->GetSkinMode();
+				const char* modes[] = { SkinModeName(SkinMode::Linear), SkinModeName(SkinMode::DualQuat) };
+				if (ImGui::Combo("Mode##skin", &mode, modes, IM_ARRAYSIZE(modes)))
+					mSkinRig->SetSkinMode((SkinMode)mode);
+				ImGui::Text("Palette: %u B/bone",
+					(unsigned)((mode == (int)SkinMode::DualQuat ? BonePaletteRing::kRowsPerBoneDQ : BonePaletteRing::kRowsPerBone) * 16));
+			}
+
+			ImGui::SeparatorText("스킨 캐시(Skin Cache)");
+			if (ImGui::Checkbox("한 번 스키닝 후 재사용(Skin once)", &mUseSkinCache) && mSkinRig)
+				mSkinRig->EnableSkinCache(m_pDevice, mUseSkinCache && mCS_Skinning);
+			if (mSkinRig && mSkinRig->SkinCacheActive())
+			{
+				const SkinCache::Stats& sc = mSkinRig->SkinCacheStats();
+				ImGui::Text("Dispatches: %u  Skipped: %u  Vertices: %llu",
+					sc.dispatches, sc.skips, (unsigned long long)sc.vertices);
+
+				// GPU 결과 ↔ CPU 레퍼런스 비교 (readback 으로 GPU 동기화가 걸림: 버튼 누를 때만)
+				static SkinDiff s_skinDiff{};
+				static double   s_skinRefMs = -1.0;
+				if (ImGui::Button("검증(Validate)"))
+				{
+					if (mSkinRig->ValidateSkinCache(m_pDeviceContext, s_skinDiff, s_skinRefMs))
+						printf("[SkinCache] max err pos=%g nrm=%g tan=%g (vertex %zu), CPU ref %.3f ms\n",
+							s_skinDiff.pos, s_skinDiff.nrm, s_skinDiff.tan, s_skinDiff.worstVertex, s_skinRefMs);
+					else
+						s_skinRefMs = -1.0;
+				}
+				if (s_skinRefMs >= 0.0)
+				{
+					ImGui::Text("Max err  pos %.2e  nrm %.2e  tan %.2e", s_skinDiff.pos, s_skinDiff.nrm, s_skinDiff.tan);
+					ImGui::Text("CPU reference: %.3f ms", s_skinRefMs);
+				}
+			}
+
+			// CPU 스키닝 커널 측정 (단일 스레드 / JobSystem 청크 분할)
+			ImGui::SeparatorText("CPU 스키닝(CPU Skinning)");
+			static SkinBenchResult s_skinBench[(size_t)SkinKernel::Count][2];
+			static bool s_skinBenchDone = false;
+			if (mSkinRig && ImGui::Button("벤치마크(Benchmark)"))
+			{
+				for (size_t k = 0; k < (size_t)SkinKernel::Count; ++k)
+				{
+					s_skinBench[k][0] = mSkinRig->BenchmarkCpuSkinning(nullptr, (SkinKernel)k, 50);
+					s_skinBench[k][1] = mSkinRig->BenchmarkCpuSkinning(mJobs.get(), (SkinKernel)k, 50);
+					for (const SkinBenchResult& r : s_skinBench[k])
+						printf("[SkinCPU] %-6s x%u : %.2f Mverts/s (max err pos=%g nrm=%g)\n",
+							SkinKernelName(r.kernel), r.threads, r.VertsPerSec() * 1e-6, r.err.pos, r.err.nrm);
+				}
+				s_skinBenchDone = true;
+			}
+			if (s_skinBenchDone)
+			{
+				for (size_t k = 0; k < (size_t)SkinKernel::Count; ++k)
+					ImGui::Text("%-6s 1T %7.2f  %uT %7.2f  Mverts/s%s",
+						SkinKernelName((SkinKernel)k),
+						s_skinBench[k][0].VertsPerSec() * 1e-6,
+						s_skinBench[k][1].threads, s_skinBench[k][1].VertsPerSec() * 1e-6,
+						SkinKernelAvailable((SkinKernel)k) ? "" : " (fallback)");
+			}
+		}
+
+		// --------------------------------------------------------------------
+		// Baked Crowd (AnimBake 표 + 인스턴싱)
+		// --------------------------------------------------------------------
+		if (ImGui::CollapsingHeader("베이크 군중(Baked Crowd)"))
+		{
+			if (mCrowd.Ready())
+			{
+				ImGui::Checkbox("활성화(Enabled)##crowd", &mCrowdUI.enabled);
+				ImGui::SliderInt("X 개수##crowd", &mCrowdUI.countX, 1, 64);
+				ImGui::SliderInt("Z 개수##crowd", &mCrowdUI.countZ, 1, 64);
+				ImGui::DragFloat("간격(Spacing)##crowd", &mCrowdUI.spacing, 1.0f, 1.0f, 10000.0f, "%.0f");
+
+				std::vector<const char*> names;
+				for (const AnimBakeClipInfo& c : mCrowdBake.clips) names.push_back(c.name.c_str());
+				ImGui::Combo("클립(Clip)##crowd", &mCrowdUI.clip, names.data(), (int)names.size());
+				ImGui::Checkbox("반복(Loop)##crowd", &mCrowdUI.loop);
+				ImGui::SameLine();
+				ImGui::Checkbox("위상 분산(Desync)##crowd", &mCrowdUI.desync);
+				ImGui::DragFloat("속도(Speed)##crowd", &mCrowdUI.speed, 0.01f, -4.0f, 4.0f);
+
+				const BakedCrowd::Stats& cs = mCrowd.GetStats();
+				ImGui::SeparatorText("통계(Stats)");
+				ImGui::Text("Instances: %u / %u  Draws: %u", cs.instances, mCrowd.MaxInstances(), cs.drawCalls);
+				ImGui::Text("Upload/frame: %llu B  Table: %.1f KB",
+					(unsigned long long)cs.uploadBytes, cs.tableBytes / 1024.0);
+			}
+			else
+			{
+				ImGui::TextDisabled("Crowd bake not available.");
+			}
+
+			// 베이크 보고서 (클립별 프레임 / 크기 / 보간 오차)
+			ImGui::SeparatorText("베이크(Bake)");
+			ImGui::Text("%.0f fps, %u bones + %zu nodes, %u frames, %.1f KB",
+				mCrowdBake.fps, mCrowdBake.boneCount, mCrowdBake.nodes.size(),
+				mCrowdBake.FrameCount(), mCrowdBake.Bytes() / 1024.0);
+			ImGui::Text("%s %.2f ms", mCrowdUI.fromCache ? "Cache load" : "Baked in", mCrowdUI.bakeMs);
+			const size_t frameBytes = (size_t)mCrowdBake.RowsPerFrame() * sizeof(float) * 4;
+			for (const AnimBakeClipInfo& c : mCrowdBake.clips)
+				ImGui::Text("  %-16s %4u fr  %7.1f KB  err max %.3g avg %.3g",
+					c.name.c_str(), c.frameCount, c.frameCount * frameBytes / 1024.0, c.maxError, c.avgError);
+		}
+
+		// --------------------------------------------------------------------
+		// Vertex Packing (로드된 메시 전체: float 정점 대비 크기 / 왕복 오차)
+		// --------------------------------------------------------------------
+		if (ImGui::CollapsingHeader("정점 압축(Vertex Packing)"))
+		{
+			const VertexPackReport vp = VertexPackTotalsSnapshot();
+			ImGui::Text("Static : %llu verts  %u -> %u B/vert",
+				(unsigned long long)vp.staticVerts, (unsigned)sizeof(VertexCPU_PNTT), (unsigned)sizeof(VertexPacked_PNTT));
+			ImGui::Text("Skinned: %llu verts  %u -> %u B/vert",
+				(unsigned long long)vp.skinnedVerts, (unsigned)sizeof(VertexCPU_PNTT_BW), (unsigned)sizeof(VertexPacked_PNTT_BW));
+			ImGui::Text("VB total: %.1f KB -> %.1f KB (%.1f%%)",
+				vp.bytesFloat / 1024.0, vp.bytesPacked / 1024.0, vp.Ratio() * 100.0);
+
+			ImGui::SeparatorText("왕복 오차(Round-trip Error)");
+			ImGui::Text("Normal  max %.4f deg", vp.maxNormalDeg);
+			ImGui::Text("Tangent max %.4f deg  (sign flips %llu)", vp.maxTangentDeg, (unsigned long long)vp.signFlips);
+			ImGui::Text("UV      max %.2e", vp.maxUV);
+			ImGui::Text("Weight  max %.2e", vp.maxWeight);
+		}
+
+		// --------------------------------------------------------------------
+		// Mesh Optimize (임포트한 메시 전체: 정점 캐시 / fetch 전후)
+		// --------------------------------------------------------------------
+		if (ImGui::CollapsingHeader("메시 최적화(Mesh Optimize)"))
+		{
+			const MeshOptReport mo = MeshOptTotalsSnapshot();
+			ImGui::Text("Imported: %llu submeshes  %llu tris  %llu verts  (%.1f ms)",
+				(unsigned long long)mo.submeshes, (unsigned long long)mo.triangles, (unsigned long long)mo.vertices, mo.ms);
+			if (mo.submeshes == 0)
+				ImGui::TextDisabled("모두 쿠킹 캐시에서 로드 (이미 최적화된 순서)");
+			ImGui::Text("ACMR  %.3f -> %.3f", mo.AcmrBefore(), mo.AcmrAfter());
+			ImGui::Text("ATVR  %.3f -> %.3f", mo.AtvrBefore(), mo.AtvrAfter());
+			ImGui::Text("Fetch %.1f%% -> %.1f%%  (skipped %llu)",
+				mo.FetchEfficiencyBefore() * 100.0, mo.FetchEfficiencyAfter() * 100.0, (unsigned long long)mo.skippedFetch);
+		}
+
+		// --------------------------------------------------------------------
+		// Mesh LOD (정적 메시: 화면 오차로 단계 선택, 패스별 삼각형 수)
+		// --------------------------------------------------------------------
+		if (ImGui::CollapsingHeader("메시 LOD(Mesh LOD)"))
+		{
+			ImGui::Checkbox("LOD 사용(Enable)", &mMeshLodUI.enabled);
+			ImGui::SliderFloat("허용 오차(Max Error px)", &mMeshLodUI.maxPixels, 0.1f, 16.0f, "%.2f", ImGuiSliderFlags_Logarithmic);
+			ImGui::SliderInt("그림자 bias(Shadow Bias)", &mMeshLodUI.shadowBias, 0, (int)kMeshLodLevels - 1);
+			ImGui::SliderInt("고정 단계(Force LOD)", &mMeshLodUI.forceLod, -1, (int)kMeshLodLevels - 1);
+
+			ImGui::SeparatorText("패스별 삼각형(Triangles, last frame)");
+			static const char* kPassNames[MeshLodUI::PassCount] = { "Main", "DirShadow", "PointShadow" };
+			const MeshLodUI::Frame& f = mMeshLodUI.last;
+			for (int p = 0; p < MeshLodUI::PassCount; ++p)
+			{
+				const double pct = f.lod0Tris[p] ? 100.0 * (double)f.tris[p] / (double)f.lod0Tris[p] : 100.0;
+				ImGui::Text("%-11s %9llu / %9llu (%.1f%%)  draws %u/%u/%u/%u", kPassNames[p],
+					(unsigned long long)f.tris[p], (unsigned long long)f.lod0Tris[p], pct,
+					f.draws[p][0], f.draws[p][1], f.draws[p][2], f.draws[p][3]);
+			}
+
+			ImGui::SeparatorText("임포트(Imported)");
+			const MeshLodReport ml = MeshLodTotalsSnapshot();
+			if (ml.submeshes == 0)
+				ImGui::TextDisabled("모두 쿠킹 캐시에서 로드 (LOD 는 파일에 저장됨)");
+			ImGui::Text("%llu submeshes  locked %llu verts  (%.1f ms)",
+				(unsigned long long)ml.submeshes, (unsigned long long)ml.lockedVertices, ml.ms);
+			for (uint32_t k = 0; k < kMeshLodLevels; ++k)
+				ImGui::Text("LOD%u  %llu tris", k, (unsigned long long)ml.triangles[k]);
+		}
+
+		// --------------------------------------------------------------------
+		// Cooked Mesh (.meshcook mmap vs Assimp 임포트)
+		// --------------------------------------------------------------------
+		if (ImGui::CollapsingHeader("메시 쿠킹(Cooked Mesh)"))
+		{
+			ImGui::Text("Startup: %s  %.1f ms summed  (%zu files)",
+				mMeshCookUI.loadedCooked ? "cooked" : "assimp", mMeshCookUI.loadMs, mMeshCookUI.files.size());
+			ImGui::Text("Cache hit %d  Cooked %d  Imported %d",
+				mMeshCookUI.cacheHits, mMeshCookUI.cooked, mMeshCookUI.imported);
+			ImGui::Text("Skeletal: %.1f ms summed  (hit %d, cooked %d)",
+				mMeshCookUI.skelMs, mMeshCookUI.skelHits, mMeshCookUI.skelCooked);
+
+			ImGui::SeparatorText("경로 비교(Compare, mesh only)");
+			if (ImGui::Button("측정(Measure)##cook"))
+				MeasureMeshLoadPaths();
+			if (mMeshCookUI.assimpMs > 0.0 || mMeshCookUI.cookedMs > 0.0)
+			{
+				ImGui::Text("Assimp : %.1f ms", mMeshCookUI.assimpMs);
+				ImGui::Text("Cooked : %.1f ms  (%.1f KB mapped)", mMeshCookUI.cookedMs, mMeshCookUI.cookedBytes / 1024.0);
+				if (mMeshCookUI.cookedMs > 0.0)
+					ImGui::Text("Speedup: x%.1f", mMeshCookUI.assimpMs / mMeshCookUI.cookedMs);
+			}
+		}
+
+		// --------------------------------------------------------------------
+		// Scene Load (InitScene 에셋별 단계 시간)
+		// --------------------------------------------------------------------
+		if (ImGui::CollapsingHeader("씬 로드(Scene Load)"))
+		{
+			const SceneLoadUI& sl = mSceneLoadUI;
+			ImGui::Text("%s  %u threads", sl.loadedParallel ? "parallel" : "serial", sl.threads);
+			ImGui::Text("Wall %.1f ms  (summed %.1f ms)", sl.wallMs, sl.summedMs);
+
+			const TextureCacheStats tc = TextureCache::Instance().Stats();
+			ImGui::Text("Textures: %zu resident, %.1f MB", tc.entries, tc.residentBytes / (1024.0 * 1024.0));
+			ImGui::Text("  hits %llu / misses %llu (failed %llu)",
+				(unsigned long long)tc.hits, (unsigned long long)tc.misses, (unsigned long long)tc.failed);
+
+			// 텍스처 경로 해결: 매번 fs::exists vs 루트 색인 (가짜 머티리얼 10k × 5 슬롯)
+			static TexturePathBenchResult s_pathBench;
+			static bool s_pathBenchDone = false;
+			if (ImGui::Button("경로 해결 벤치(Path Resolve Bench)"))
+			{
+				s_pathBench = TexturePathBenchmark(L"../Resource/", 10000);
+				printf("[TexPath] %zu files, %zu lookups: probe %.1f ms, index %.1f ms (+build %.1f ms), mismatches %zu\n",
+					s_pathBench.files, s_pathBench.lookups, s_pathBench.probeMs, s_pathBench.indexMs,
+					s_pathBench.buildMs, s_pathBench.mismatches);
+				s_pathBenchDone = true;
+			}
+			if (s_pathBenchDone)
+			{
+				ImGui::Text("%zu lookups: probe %.1f ms / index %.1f ms (+build %.1f ms, %zu files)",
+					s_pathBench.lookups, s_pathBench.probeMs, s_pathBench.indexMs, s_pathBench.buildMs, s_pathBench.files);
+				if (s_pathBench.mismatches)
+					ImGui::Text("MISMATCHES: %zu", s_pathBench.mismatches);
+			}
+
+			if (ImGui::BeginTable("scene_load_tbl", 5, ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit))
+			{
+				ImGui::TableSetupColumn("Asset");
+				ImGui::TableSetupColumn("Start");
+				ImGui::TableSetupColumn("CPU");
+				ImGui::TableSetupColumn("GPU");
+				ImGui::TableSetupColumn("Src");
+				ImGui::TableHeadersRow();
+				for (const AssetLoadTiming& t : sl.assets)
+				{
+					ImGui::TableNextRow();
+					ImGui::TableSetColumnIndex(0); ImGui::TextUnformatted(t.name.c_str());
+					ImGui::TableSetColumnIndex(1); ImGui::Text("%.1f", t.startMs);
+					ImGui::TableSetColumnIndex(2); ImGui::Text("%.1f", t.cpuMs);
+					ImGui::TableSetColumnIndex(3); ImGui::Text("%.1f", t.gpuMs);
+					ImGui::TableSetColumnIndex(4); ImGui::TextUnformatted(!t.ok ? "FAILED" : (t.fromCache ? "cache" : "import"));
+				}
+				ImGui::EndTable();
+			}
+		}
+
+		// --------------------------------------------------------------------
+		// Streaming (실행 중 비동기 로드: 준비 전엔 큐브 / 1x1)
+		// --------------------------------------------------------------------
+		if (ImGui::CollapsingHeader("스트리밍(Streaming)"))
+		{
+			ImGui::SliderInt("예산 KB/frame##stream", &mStreamUI.budgetKB, 16, 65536);
+			ImGui::SliderFloat("예산 ms/frame##stream", &mStreamUI.budgetMs, 0.1f, 16.0f, "%.1f");
+			ImGui::DragFloat("배치 반지름(Ring)##stream", &mStreamUI.ringRadius, 10.0f, 100.0f, 10000.0f, "%.0f");
+
+			if (ImGui::Button("메시 요청(Request meshes)"))
+			{
+				// 원점 둘레에 배치 → 카메라에 가까운 것부터 올라옴
+				struct Src { const char* name; const wchar_t* fbx; const wchar_t* dir; float scale; float size; };
+				static const Src kSrc[] =
+				{
+					{ "Tree",      L"../Resource/Tree/Tree.fbx",           L"../Resource/Tree/",      100.0f, 200.0f },
+					{ "Character", L"../Resource/Character/Character.fbx", L"../Resource/Character/",   1.0f, 150.0f },
+					{ "Zelda",     L"../Resource/Zelda/zeldaPosed001.fbx", L"../Resource/Zelda/",       1.0f, 150.0f },
+					{ "char",      L"../Resource/FBX/char.fbx",            L"../Resource/FBX/",         1.0f, 150.0f },
+					{ "IcoSphere", L"../Resource/FBX/IcoSphere.fbx",       L"../Resource/FBX/",         1.0f, 100.0f },
+					{ "Torus",     L"../Resource/FBX/Torus.fbx",           L"../Resource/FBX/",         1.0f, 100.0f },
+				};
+				const int n = (int)(sizeof(kSrc) / sizeof(kSrc[0]));
+				const float turn = (float)(mStreamUI.meshes.size() / n) * 0.5f;   // 다시 누르면 반 칸씩 돌려서 겹치지 않게
+				for (int i = 0; i < n; ++i)
+				{
+					const float a = DirectX::XM_2PI * ((float)i + turn) / (float)n;
+					const Vector3 pos(cosf(a) * mStreamUI.ringRadius, mGridY, sinf(a) * mStreamUI.ringRadius);
+
+					const float size = kSrc[i].size;
+					StreamUI::Item it;
+					it.name = kSrc[i].name;
+					it.world = Matrix::CreateScale(kSrc[i].scale) * Matrix::CreateTranslation(pos);
+					it.placeholderWorld = Matrix::CreateScale(size) * Matrix::CreateTranslation(pos + Vector3(0, size * 0.5f, 0));
+					it.h = mStreamer.RequestStaticMesh(kSrc[i].fbx, kSrc[i].dir, pos, size * 0.5f);
+					mStreamUI.meshes.push_back(it);
+				}
+			}
+			ImGui::SameLine();
+			if (ImGui::Button("텍스처 요청(Request texture)"))
+			{
+				mStreamer.Cancel(mStreamUI.texture);
+				mStreamUI.texture = mStreamer.RequestTexture(L"../Resource/Tree/DB2X2_L01.png", Vector3::Zero);
+			}
+			ImGui::SameLine();
+			if (ImGui::Button("전부 취소(Cancel all)"))
+			{
+				for (const StreamUI::Item& it : mStreamUI.meshes) mStreamer.Cancel(it.h);
+				mStreamUI.meshes.clear();
+				mStreamer.Cancel(mStreamUI.texture);
+				mStreamUI.texture = {};
+			}
+
+			const StreamStats s = mStreamer.Stats();
+			ImGui::Text("Queued %u  Decoding %u  Decoded %u  Resident %u  Failed %u",
+				s.queued, s.decoding, s.decoded, s.resident, s.failed);
+			ImGui::Text("Resident %.1f MB  |  last frame: %u uploads, %.1f KB, %.2f ms",
+				s.residentBytes / (1024.0 * 1024.0), s.frameUploads, s.frameBytes / 1024.0, s.frameMs);
+
+			int cancelIdx = -1;
+			if (!mStreamUI.meshes.empty() &&
+				ImGui::BeginTable("stream_tbl", 4, ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit))
+			{
+				ImGui::TableSetupColumn("Asset");
+				ImGui::TableSetupColumn("State");
+				ImGui::TableSetupColumn("Priority");
+				ImGui::TableSetupColumn("");
+				ImGui::TableHeadersRow();
+				for (int i = 0; i < (int)mStreamUI.meshes.size(); ++i)
+				{
+					const StreamUI::Item& it = mStreamUI.meshes[i];
+					ImGui::PushID(i);
+					ImGui::TableNextRow();
+					ImGui::TableSetColumnIndex(0); ImGui::TextUnformatted(it.name.c_str());
+					ImGui::TableSetColumnIndex(1); ImGui::TextUnformatted(StreamStateName(mStreamer.State(it.h)));
+					ImGui::TableSetColumnIndex(2); ImGui::Text("%.0f", mStreamer.Priority(it.h));
+					ImGui::TableSetColumnIndex(3); if (ImGui::SmallButton("취소(Cancel)")) cancelIdx = i;
+					ImGui::PopID();
+				}
+				ImGui::EndTable();
+			}
+			if (cancelIdx >= 0)
+			{
+				mStreamer.Cancel(mStreamUI.meshes[cancelIdx].h);
+				mStreamUI.meshes.erase(mStreamUI.meshes.begin() + cancelIdx);
+			}
+
+			if (mStreamUI.texture.Valid())
+			{
+				ImGui::Text("Texture: %s", StreamStateName(mStreamer.State(mStreamUI.texture)));
+				ImGui::Image((ImTextureID)mStreamer.Texture(mStreamUI.texture), ImVec2(96, 96));
+			}
+		}
+
 		// --------------------------------------------------------------------
 		// Toon
 		// --------------------------------------------------------------------
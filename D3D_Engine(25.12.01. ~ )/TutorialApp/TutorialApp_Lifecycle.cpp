@@ -55,6 +55,11 @@ bool TutorialApp::OnInitialize()
 		mPxWorld = std::make_unique<PhysXWorld>(*mPxCtx, wdesc);
 	}
 
+	// =========================================================================
+	// 2.6) Job System (애니메이션 평가 등 병렬 작업)
+	// =========================================================================
+	mJobs = std::make_unique<JobSystem>();
+
 	// =========================================================================
 	// 3) Scene / Assets
 	// =========================================================================
@@ -81,6 +86,8 @@ void TutorialApp::OnUninitialize()
 	mPxWorld.reset();
 	mPxCtx.reset();
 
+	mJobs.reset();
+
 #ifdef _DEBUG
 	// =========================================================================
 	// 1) ImGui
@@ -241,10 +248,28 @@ void TutorialApp::OnUpdate()
 	// =========================================================================
 	const double dt = (double)GameTimer::m_Instance->DeltaTime();
 
+	// 시간만 여기서 진행하고, 실제 포즈 평가는 아래에서 AnimationSystem이 일괄 처리
+	mAnimSys.Begin();
+
+	// 애니메이션 LOD 입력: 카메라 거리 / 절두체 가시성 / 화면상 크기 (투영은 직전 프레임 값)
+	Matrix lodView;
+	m_Camera.GetViewMatrix(lodView);
+	auto animLod = [&](const XformUI& X, const AnimatedInstance& inst) -> AnimLodInput
+		{
+			const Matrix W = ComposeSRT(X);
+			const Vector3 c = W.Translation();
+			const float center[3] = { c.x, c.y, c.z };
+			const float s = max(fabsf(X.scl.x), max(fabsf(X.scl.y), fabsf(X.scl.z)));
+			AnimLodInput in = AnimLodFromView(center, inst.Skeleton().bindRadius * s,
+				&lodView._11, &m_Projection._11, (float)m_ClientHeight);
+			if (!X.enabled) in.visible = false;
+			return in;
+		};
+
 	// ---- BoxHuman (Rigid) ----
 	if (mBoxRig)
 	{
-		if (!mDbg.freezeTime && mBoxAC.play) mBoxAC.t += dt * mBoxAC.speed;
+		if (!mDbg.freezeTime && mBoxAC.play) { mBoxAC.t += dt * mBoxAC.speed; mBoxAC.xf.Advance(dt * mBoxAC.speed); }
 
 		const double durSec = mBoxRig->GetClipDurationSec();
 		if (durSec > 0.0)
@@ -261,13 +286,24 @@ void TutorialApp::OnUpdate()
 			}
 		}
 
-		mBoxRig->EvaluatePose(mBoxAC.t, mBoxAC.loop);
+		const AnimLodInput lod = animLod(mBoxX, mBoxRig->Instance());
+		if (mBoxAC.xf.Active())
+		{
+			// 크로스페이드 중: 이전/현재 클립 2레이어 블렌딩
+			AnimLayer cur; cur.clip = mBoxAC.clip; cur.tSec = mBoxAC.t; cur.loop = mBoxAC.loop;
+			AnimLayer layers[2];
+			mAnimSys.AddLayers(mBoxRig->Instance(), layers, mBoxAC.xf.Layers(cur, layers), /*buildPalette*/false, &lod);
+		}
+		else
+		{
+			mAnimSys.Add(mBoxRig->Instance(), mBoxAC.t, mBoxAC.loop, /*buildPalette*/false, &lod);
+		}
 	}
 
 	// ---- Skinned ----
 	if (mSkinRig)
 	{
-		if (!mDbg.freezeTime && mSkinAC.play) mSkinAC.t += dt * mSkinAC.speed;
+		if (!mDbg.freezeTime && mSkinAC.play) { mSkinAC.t += dt * mSkinAC.speed; mSkinAC.xf.Advance(dt * mSkinAC.speed); }
 
 		const double durSec = mSkinRig->DurationSec();
 		if (durSec > 0.0)
@@ -284,14 +320,52 @@ void TutorialApp::OnUpdate()
 			}
 		}
 
-		mSkinRig->EvaluatePose(mSkinAC.t, mSkinAC.loop);
+		const AnimLodInput lod = animLod(mSkinX, mSkinRig->Instance());
+		if (mSkinAC.xf.Active())
+		{
+			AnimLayer cur; cur.clip = mSkinAC.clip; cur.tSec = mSkinAC.t; cur.loop = mSkinAC.loop;
+			AnimLayer layers[2];
+			mAnimSys.AddLayers(mSkinRig->Instance(), layers, mSkinAC.xf.Layers(cur, layers), /*buildPalette*/true, &lod);
+		}
+		else
+		{
+			mAnimSys.Add(mSkinRig->Instance(), mSkinAC.t, mSkinAC.loop, /*buildPalette*/true, &lod);
+		}
 	}
+
+	// ---- Baked crowd (포즈 평가 없음: 재생 시각만 진행, 레코드는 OnRender 에서) ----
+	if (mCrowdUI.enabled && !mDbg.freezeTime)
+		mCrowdUI.t += dt * mCrowdUI.speed;
+
+	mAnimSys.Update(mJobs.get());
+
+	// ---- 스트리밍: 뷰어(카메라)에 가까운 것부터, 프레임 예산 안에서 업로드 ----
+	StreamBudget budget;
+	budget.bytesPerFrame = (uint64_t)mStreamUI.budgetKB * 1024;
+	budget.msPerFrame = mStreamUI.budgetMs;
+	mStreamer.Update(m_Camera.m_World.Translation(), budget);
 }
 
 void TutorialApp::OnRender()
 {
 	auto* ctx = m_pDeviceContext;
 
+	// 본 팔레트 링: 프레임 통계 넘김 (업로드는 각 스키닝 Draw에서 필요할 때만)
+	mBonePalette.BeginFrame();
+
+	// 정적 메시 LOD: 패스별 삼각형 수를 이번 프레임 기준으로 새로 셈 (패널은 직전 프레임 값)
+	mMeshLodUI.last = mMeshLodUI.cur;
+	mMeshLodUI.cur = {};
+
+	// 스킨 캐시: 포즈가 바뀐 경우만 CS 로 한 번 스키닝 → 이후 모든 패스가 결과 VB 를 읽음
+	if (mSkinRig && mSkinX.enabled)
+		mSkinRig->UpdateSkinCache(ctx,
+			mSkinRig->GetSkinMode() == SkinMode::DualQuat ? mCS_SkinningDQ.Get() : mCS_Skinning.Get(),
+			&mBonePalette);
+
+	// 베이크 군중: 인스턴스 레코드만 업로드 (포즈/팔레트 없음)
+	UpdateBakedCrowd(ctx);
+
 	// =========================================================================
 	// 0) Common sampler binding (s0~s3)
 	// =========================================================================
@@ -65,11 +65,14 @@ void TutorialApp::RenderShadowPass_Main(ID3D11DeviceContext* ctx, ConstantBuffer
 			ctx->VSSetConstantBuffers(0, 1, &m_pConstantBuffer);
 
 			// Depth-only 파이프라인
-			ctx->IASetInputLayout(m_pMeshIL);
+			ctx->IASetInputLayout(mIL_PNTT.Get());   // 위치 스트림만
 			ctx->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 			ctx->VSSetShader(mVS_Depth.Get(), nullptr, 0);
 			ctx->PSSetShader(mPS_Depth.Get(), nullptr, 0);
 
+			// 그림자 맵 해상도 기준 + shadowBias 만큼 더 거친 단계
+			const UINT lod = SelectStaticLod(mesh, world, mLightView, mLightProj, mShadowVP.Height, MeshLodUI::DirShadow);
+
 			for (size_t i = 0; i < mesh.Ranges().size(); ++i)
 			{
 				const auto& r = mesh.Ranges()[i];
@@ -86,7 +89,8 @@ void TutorialApp::RenderShadowPass_Main(ID3D11DeviceContext* ctx, ConstantBuffer
 
 				// opacity 텍스처를 PS에서 clip()에 사용
 				mat.Bind(ctx);
-				mesh.DrawSubmesh(ctx, (UINT)i);
+				mesh.DrawSubmeshDepth(ctx, (UINT)i, lod);
+				CountStaticLod(mesh, i, lod, MeshLodUI::DirShadow);
 				MaterialGPU::Unbind(ctx);
 			}
 		};
@@ -157,9 +161,16 @@ void TutorialApp::RenderShadowPass_Main(ID3D11DeviceContext* ctx, ConstantBuffer
 	{
 		const Matrix W = ComposeSRT(mSkinX);
 
-		ctx->IASetInputLayout(mIL_PNTT_BW.Get());
+		// 스킨 캐시 사용 시 정적 깊이 VS / PNTT IL
+		const bool skinCached = mSkinRig->SkinCacheActive();
+		const bool skinDQ = mSkinRig->GetSkinMode() == SkinMode::DualQuat;
+		ID3D11VertexShader* vsDepth = skinCached ? mVS_Depth.Get()
+			: (skinDQ ? mVS_DepthSkinnedDQ.Get() : mVS_DepthSkinned.Get());
+		ID3D11InputLayout* ilDepth = skinCached ? mIL_PNTT.Get() : mIL_PNTT_BW.Get();
+
+		ctx->IASetInputLayout(ilDepth);
 		ctx->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-		ctx->VSSetShader(mVS_DepthSkinned.Get(), nullptr, 0);
+		ctx->VSSetShader(vsDepth, nullptr, 0);
 		ctx->PSSetShader(mPS_Depth.Get(), nullptr, 0);
 
 		ConstantBuffer cbd = baseCB;
@@ -176,10 +187,10 @@ void TutorialApp::RenderShadowPass_Main(ID3D11DeviceContext* ctx, ConstantBuffer
 			mLightView, mLightProj,
 			m_pConstantBuffer,   // b0
 			m_pUseCB,            // b2 (alphaCut)
-			m_pBoneCB,           // b4
-			mVS_DepthSkinned.Get(),
+			&mBonePalette,       // t11 + b4
+			vsDepth,
 			mPS_Depth.Get(),
-			mIL_PNTT_BW.Get(),
+			ilDepth,
 			mShadowAlphaCut
 		);
 	}
@@ -285,11 +296,13 @@ void TutorialApp::RenderPointShadowPass_Cube(ID3D11DeviceContext* ctx, ConstantB
 			ctx->UpdateSubresource(m_pConstantBuffer, 0, nullptr, &cbd, 0, 0);
 			ctx->VSSetConstantBuffers(0, 1, &m_pConstantBuffer);
 
-			ctx->IASetInputLayout(m_pMeshIL);
+			ctx->IASetInputLayout(mIL_PNTT.Get());   // 위치 스트림만
 			ctx->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 			ctx->VSSetShader(mVS_Depth.Get(), nullptr, 0);
 			ctx->PSSetShader(mPS_PointShadow.Get(), nullptr, 0);
 
+			const UINT lod = SelectStaticLod(mesh, world, V, P, mPointShadowVP.Height, MeshLodUI::PointShadow);
+
 			for (size_t i = 0; i < mesh.Ranges().size(); ++i)
 			{
 				const auto& r = mesh.Ranges()[i];
@@ -305,7 +318,8 @@ void TutorialApp::RenderPointShadowPass_Cube(ID3D11DeviceContext* ctx, ConstantB
 				ctx->PSSetConstantBuffers(2, 1, &m_pUseCB);
 
 				mat.Bind(ctx);
-				mesh.DrawSubmesh(ctx, (UINT)i);
+				mesh.DrawSubmeshDepth(ctx, (UINT)i, lod);
+				CountStaticLod(mesh, i, lod, MeshLodUI::PointShadow);
 				MaterialGPU::Unbind(ctx);
 			}
 		};
@@ -396,9 +410,16 @@ void TutorialApp::RenderPointShadowPass_Cube(ID3D11DeviceContext* ctx, ConstantB
 		{
 			const Matrix W = ComposeSRT(mSkinX);
 
-			ctx->IASetInputLayout(mIL_PNTT_BW.Get());
+			// 스킨 캐시 사용 시 정적 깊이 VS / PNTT IL
+			const bool skinCached = mSkinRig->SkinCacheActive();
+			const bool skinDQ = mSkinRig->GetSkinMode() == SkinMode::DualQuat;
+			ID3D11VertexShader* vsDepth = skinCached ? mVS_Depth.Get()
+				: (skinDQ ? mVS_DepthSkinnedDQ.Get() : mVS_DepthSkinned.Get());
+			ID3D11InputLayout* ilDepth = skinCached ? mIL_PNTT.Get() : mIL_PNTT_BW.Get();
+
+			ctx->IASetInputLayout(ilDepth);
 			ctx->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-			ctx->VSSetShader(mVS_DepthSkinned.Get(), nullptr, 0);
+			ctx->VSSetShader(vsDepth, nullptr, 0);
 			ctx->PSSetShader(mPS_PointShadow.Get(), nullptr, 0);
 
 			ConstantBuffer cbd = baseCB;
@@ -415,10 +436,10 @@ void TutorialApp::RenderPointShadowPass_Cube(ID3D11DeviceContext* ctx, ConstantB
 				V, P,
 				m_pConstantBuffer,
 				m_pUseCB,
-				m_pBoneCB,
-				mVS_DepthSkinned.Get(),
+				&mBonePalette,
+				vsDepth,
 				mPS_PointShadow.Get(),
-				mIL_PNTT_BW.Get(),
+				ilDepth,
 				mShadowAlphaCut
 			);
 		}
@@ -483,6 +504,7 @@ void TutorialApp::RenderGBufferPass(ID3D11DeviceContext* ctx, ConstantBuffer& ba
 		}
 		// ============================================================================
 
+		DrawStreamedOpaque(ctx, baseCB);
 	}
 
 	if (mDbg.forceAlphaClip && mDbg.showTransparent)
@@ -787,6 +809,7 @@ void TutorialApp::RenderOpaquePass(ID3D11DeviceContext* ctx, ConstantBuffer& bas
 	}
 	// ============================================================================
 
+	DrawStreamedOpaque(ctx, baseCB);
 
 	// 여자 모델: PBR 토글에 따라 PS 교체
 	if (mFemaleX.enabled)
@@ -817,13 +840,26 @@ void TutorialApp::RenderOpaquePass(ID3D11DeviceContext* ctx, ConstantBuffer& bas
 		BindSkinnedMeshPipeline(ctx);
 		mSkinRig->DrawOpaqueOnly(
 			ctx, ComposeSRT(mSkinX),
-			view, m_Projection, m_pConstantBuffer, m_pUseCB, m_pBoneCB,
+			view, m_Projection, m_pConstantBuffer, m_pUseCB, &mBonePalette,
 			baseCB.vLightDir, baseCB.vLightColor, eye,
 			m_Ka, m_Ks, m_Shininess, m_Ia,
 			mDbg.disableNormal, mDbg.disableSpecular, mDbg.disableEmissive
 		);
 		BindStaticMeshPipeline(ctx);
 	}
+
+	// Baked crowd (불투명 서브메시만, 서브메시당 인스턴싱 드로우 1회)
+	if (mSkinRig && mCrowdUI.enabled && mCrowd.InstanceCount() > 0)
+	{
+		BindCrowdPipeline(ctx);
+		mSkinRig->DrawCrowdOpaque(
+			ctx, mCrowd,
+			view, m_Projection, m_pConstantBuffer, m_pUseCB,
+			baseCB.vLightDir, baseCB.vLightColor,
+			mDbg.disableNormal, mDbg.disableSpecular, mDbg.disableEmissive
+		);
+		BindStaticMeshPipeline(ctx);
+	}
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -880,7 +916,7 @@ void TutorialApp::RenderCutoutPass(ID3D11DeviceContext* ctx, ConstantBuffer& bas
 		BindSkinnedMeshPipeline(ctx);
 		mSkinRig->DrawAlphaCutOnly(
 			ctx, ComposeSRT(mSkinX),
-			view, m_Projection, m_pConstantBuffer, m_pUseCB, m_pBoneCB,
+			view, m_Projection, m_pConstantBuffer, m_pUseCB, &mBonePalette,
 			baseCB.vLightDir, baseCB.vLightColor, eye,
 			m_Ka, m_Ks, m_Shininess, m_Ia,
 			mDbg.disableNormal, mDbg.disableSpecular, mDbg.disableEmissive
@@ -979,7 +1015,7 @@ void TutorialApp::RenderTransparentPass(ID3D11DeviceContext* ctx, ConstantBuffer
 					BindSkinnedMeshPipeline(ctx);
 					mSkinRig->DrawTransparentOnly(
 						ctx, W,
-						view, m_Projection, m_pConstantBuffer, m_pUseCB, m_pBoneCB,
+						view, m_Projection, m_pConstantBuffer, m_pUseCB, &mBonePalette,
 						baseCB.vLightDir, baseCB.vLightColor, eye,
 						m_Ka, m_Ks, m_Shininess, m_Ia,
 						mDbg.disableNormal, mDbg.disableSpecular, mDbg.disableEmissive
@@ -1343,15 +1379,110 @@ void TutorialApp::BindStaticMeshPipeline_PBR(ID3D11DeviceContext* ctx)
 
 void TutorialApp::BindSkinnedMeshPipeline(ID3D11DeviceContext* ctx)
 {
-	ctx->IASetInputLayout(m_pSkinnedIL);
+	// 스킨 캐시가 켜져 있으면 이미 스키닝된 PNTT VB → 정적 메시 VS/IL
+	const bool cached = mSkinRig && mSkinRig->SkinCacheActive();
+	ctx->IASetInputLayout(cached ? m_pMeshIL : m_pSkinnedIL);
 	ctx->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-	ctx->VSSetShader(m_pSkinnedVS, nullptr, 0);
+	ID3D11VertexShader* skinVS = (mSkinRig && mSkinRig->GetSkinMode() == SkinMode::DualQuat)
+		? mVS_SkinnedDQ.Get() : m_pSkinnedVS;
+	ctx->VSSetShader(cached ? m_pMeshVS : skinVS, nullptr, 0);
 	ctx->PSSetShader(m_pMeshPS, nullptr, 0);
 }
 
+void TutorialApp::BindCrowdPipeline(ID3D11DeviceContext* ctx)
+{
+	// 스키닝 정점(슬롯 0/1) + 인스턴스 레코드(슬롯 2). 베이크 표 t11 / b4 는 DrawCrowdOpaque 가 바인딩
+	ctx->IASetInputLayout(mIL_Crowd.Get());
+	ctx->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	ctx->VSSetShader(mVS_Crowd.Get(), nullptr, 0);
+	ctx->PSSetShader(m_pMeshPS, nullptr, 0);
+}
+
+void TutorialApp::UpdateBakedCrowd(ID3D11DeviceContext* ctx)
+{
+	mCrowd.BeginFrame();
+	mCrowdInst.clear();
+	if (!mCrowdUI.enabled || !mCrowd.Ready() || mCrowdBake.clips.empty())
+	{
+		mCrowd.Upload(ctx, nullptr, 0);
+		return;
+	}
+
+	int clip = mCrowdUI.clip;
+	if (clip < 0) clip = 0;
+	if (clip >= (int)mCrowdBake.clips.size()) clip = (int)mCrowdBake.clips.size() - 1;
+	const double dur = mCrowdBake.clips[clip].durationSec;
+
+	const int nx = mCrowdUI.countX > 0 ? mCrowdUI.countX : 1;
+	const int nz = mCrowdUI.countZ > 0 ? mCrowdUI.countZ : 1;
+	const Matrix base = ComposeSRT(mSkinX);
+
+	for (int iz = 0; iz < nz; ++iz)
+	{
+		for (int ix = 0; ix < nx; ++ix)
+		{
+			if (mCrowdInst.size() >= kCrowdMaxInstances) break;
+
+			// 리그 앞쪽 격자 (모델 공간 오프셋 → 리그 트랜스폼)
+			const Vector3 off((ix - (nx - 1) * 0.5f) * mCrowdUI.spacing, 0.0f, (iz + 1) * mCrowdUI.spacing);
+			const Matrix wt = (Matrix::CreateTranslation(off) * base).Transpose();
+
+			BakedCrowd::Instance r{};
+			memcpy(r.world, &wt, sizeof(r.world));
+
+			// 황금비 간격으로 시작 위상을 흩뜨림 (전원이 같은 포즈로 움직이지 않게)
+			const size_t idx = mCrowdInst.size();
+			const double phase = mCrowdUI.desync ? fmod(idx * 0.6180339887, 1.0) * dur : 0.0;
+			mCrowdBake.Locate((uint32_t)clip, mCrowdUI.t + phase, mCrowdUI.loop, r.rowA, r.rowB, r.blend);
+			mCrowdInst.push_back(r);
+		}
+	}
+
+	mCrowd.Upload(ctx, mCrowdInst.data(), (UINT)mCrowdInst.size());
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // 13) STATIC DRAW HELPERS (Opaque / AlphaCut / Transparent)
 ////////////////////////////////////////////////////////////////////////////////
+UINT TutorialApp::SelectStaticLod(const StaticMesh& mesh, const Matrix& world,
+	const Matrix& view, const Matrix& proj, float viewportH, MeshLodUI::Pass pass) const
+{
+	const UINT levels = mesh.LodCount();
+	if (levels <= 1 || !mMeshLodUI.enabled) return 0;
+	if (mMeshLodUI.forceLod >= 0)
+		return (UINT)mMeshLodUI.forceLod < levels ? (UINT)mMeshLodUI.forceLod : levels - 1;
+
+	// 오브젝트 공간 바운딩 구 → 월드 (반지름 / 단계 오차는 가장 큰 축 스케일만큼)
+	const float* c = mesh.BoundsCenter();
+	const Vector3 wc = Vector3::Transform(Vector3(c[0], c[1], c[2]), world);
+	const float sx = Vector3(world._11, world._12, world._13).Length();
+	const float sy = Vector3(world._21, world._22, world._23).Length();
+	const float sz = Vector3(world._31, world._32, world._33).Length();
+	const float s = max(sx, max(sy, sz));
+
+	const float center[3] = { wc.x, wc.y, wc.z };
+	const float ppu = MeshLodPixelsPerUnit(center, mesh.BoundsRadius() * s, &view._11, &proj._11, viewportH);
+	const UINT bias = (pass == MeshLodUI::Main || mMeshLodUI.shadowBias < 0) ? 0u : (UINT)mMeshLodUI.shadowBias;
+	return MeshLodSelect(mesh.LodErrors(), levels, ppu * s, mMeshLodUI.maxPixels, bias);
+}
+
+void TutorialApp::CountStaticLod(const StaticMesh& mesh, size_t i, UINT lod, MeshLodUI::Pass pass)
+{
+	MeshLodUI::Frame& f = mMeshLodUI.cur;
+	f.tris[pass] += mesh.SubmeshIndexCount(i, lod) / 3;
+	f.lod0Tris[pass] += mesh.Ranges()[i].indexCount / 3;
+	++f.draws[pass][lod];
+}
+
+void TutorialApp::DrawStreamedOpaque(ID3D11DeviceContext* ctx, const ConstantBuffer& baseCB)
+{
+	for (const StreamUI::Item& it : mStreamUI.meshes)
+	{
+		const AssetStreamer::MeshView v = mStreamer.StaticMeshView(it.h);
+		DrawStaticOpaqueOnly(ctx, *v.mesh, *v.materials, v.placeholder ? it.placeholderWorld : it.world, baseCB);
+	}
+}
+
 void TutorialApp::DrawStaticOpaqueOnly(ID3D11DeviceContext* ctx,
 	StaticMesh& mesh,
 	const std::vector<MaterialGPU>& mtls,
@@ -1363,6 +1494,9 @@ void TutorialApp::DrawStaticOpaqueOnly(ID3D11DeviceContext* ctx,
 	local.mWorldInvTranspose = world.Invert();
 	ctx->UpdateSubresource(m_pConstantBuffer, 0, nullptr, &local, 0, 0);
 
+	const UINT lod = SelectStaticLod(mesh, world, Matrix(baseCB.mView).Transpose(), Matrix(baseCB.mProjection).Transpose(),
+		(float)m_ClientHeight, MeshLodUI::Main);
+
 	for (size_t i = 0; i < mesh.Ranges().size(); ++i)
 	{
 		const auto& r = mesh.Ranges()[i];
@@ -1392,7 +1526,8 @@ void TutorialApp::DrawStaticOpaqueOnly(ID3D11DeviceContext* ctx,
 		ctx->UpdateSubresource(m_pUseCB, 0, nullptr, &use, 0, 0);
 		ctx->PSSetConstantBuffers(2, 1, &m_pUseCB);
 
-		mesh.DrawSubmesh(ctx, (UINT)i);
+		mesh.DrawSubmesh(ctx, (UINT)i, lod);
+		CountStaticLod(mesh, i, lod, MeshLodUI::Main);
 		MaterialGPU::Unbind(ctx);
 	}
 }
@@ -1408,6 +1543,9 @@ void TutorialApp::DrawStaticAlphaCutOnly(ID3D11DeviceContext* ctx,
 	local.mWorldInvTranspose = world.Invert();
 	ctx->UpdateSubresource(m_pConstantBuffer, 0, nullptr, &local, 0, 0);
 
+	const UINT lod = SelectStaticLod(mesh, world, Matrix(baseCB.mView).Transpose(), Matrix(baseCB.mProjection).Transpose(),
+		(float)m_ClientHeight, MeshLodUI::Main);
+
 	for (size_t i = 0; i < mesh.Ranges().size(); ++i)
 	{
 		const auto& r = mesh.Ranges()[i];
@@ -1436,7 +1574,8 @@ void TutorialApp::DrawStaticAlphaCutOnly(ID3D11DeviceContext* ctx,
 		ctx->UpdateSubresource(m_pUseCB, 0, nullptr, &use, 0, 0);
 		ctx->PSSetConstantBuffers(2, 1, &m_pUseCB);
 
-		mesh.DrawSubmesh(ctx, (UINT)i);
+		mesh.DrawSubmesh(ctx, (UINT)i, lod);
+		CountStaticLod(mesh, i, lod, MeshLodUI::Main);
 		MaterialGPU::Unbind(ctx);
 	}
 }
@@ -1454,6 +1593,9 @@ void TutorialApp::DrawStaticTransparentOnly(ID3D11DeviceContext* ctx,
 	local.mWorldInvTranspose = world.Invert();
 	ctx->UpdateSubresource(m_pConstantBuffer, 0, nullptr, &local, 0, 0);
 
+	const UINT lod = SelectStaticLod(mesh, world, Matrix(baseCB.mView).Transpose(), Matrix(baseCB.mProjection).Transpose(),
+		(float)m_ClientHeight, MeshLodUI::Main);
+
 	for (size_t i = 0; i < mesh.Ranges().size(); ++i)
 	{
 		const auto& r = mesh.Ranges()[i];
@@ -1482,7 +1624,8 @@ void TutorialApp::DrawStaticTransparentOnly(ID3D11DeviceContext* ctx,
 		ctx->UpdateSubresource(m_pUseCB, 0, nullptr, &use, 0, 0);
 		ctx->PSSetConstantBuffers(2, 1, &m_pUseCB);
 
-		mesh.DrawSubmesh(ctx, (UINT)i);
+		mesh.DrawSubmesh(ctx, (UINT)i, lod);
+		CountStaticLod(mesh, i, lod, MeshLodUI::Main);
 		MaterialGPU::Unbind(ctx);
 	}
 }
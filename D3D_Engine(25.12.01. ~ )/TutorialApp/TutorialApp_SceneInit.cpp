@@ -8,6 +8,8 @@
 #include <d3dcompiler.h>
 #include <algorithm>
 #include <cfloat>
+#include <chrono>
+#include <mutex>
 
 // ============================================================================
 // Utility
@@ -194,12 +196,14 @@ bool TutorialApp::InitScene()
 		Compile(L"../Shader/VertexShader.hlsl", "main", "vs_5_0", vsb);
 		CreateVS(vsb, &m_pMeshVS);
 
+		// 압축 정점 분리 스트림 (MeshDataEx.h / Shader/VertexPack.hlsli)
+		//  - 슬롯 0 VertexStreamPos_PNTT (16B), 슬롯 1 VertexStreamAttr (8B)
 		const D3D11_INPUT_ELEMENT_DESC IL_PNTT[] =
 		{
 			{ "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT,    0,  0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
-			{ "NORMAL",   0, DXGI_FORMAT_R32G32B32_FLOAT,    0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
-			{ "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT,       0, 24, D3D11_INPUT_PER_VERTEX_DATA, 0 },
-			{ "TANGENT",  0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 32, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+			{ "TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT,       0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+			{ "NORMAL",   0, DXGI_FORMAT_R16G16_SNORM,       1,  0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+			{ "TANGENT",  0, DXGI_FORMAT_R16G16_UINT,        1,  4, D3D11_INPUT_PER_VERTEX_DATA, 0 },
 		};
 		CreateIL(IL_PNTT, _countof(IL_PNTT), vsb, &m_pMeshIL);
 
@@ -320,16 +324,47 @@ bool TutorialApp::InitScene()
 
 		HR_T(m_pDevice->CreateVertexShader(vsb->GetBufferPointer(), vsb->GetBufferSize(), nullptr, &m_pSkinnedVS));
 
+		// 듀얼 쿼터니언 변형 (입력 시그니처 동일 → IL 공유)
+		D3D_SHADER_MACRO defsDQ[] = { {"SKINNED","1"}, {"SKIN_DQ","1"}, {nullptr,nullptr} };
+		ComPtr<ID3DBlob> vsbDQ;
+		HR_T(D3DCompileFromFile(
+			L"../Shader/VertexShaderSkinning.hlsl",
+			defsDQ, D3D_COMPILE_STANDARD_FILE_INCLUDE,
+			"main", "vs_5_0", 0, 0, &vsbDQ, nullptr));
+		HR_T(m_pDevice->CreateVertexShader(vsbDQ->GetBufferPointer(), vsbDQ->GetBufferSize(), nullptr, mVS_SkinnedDQ.GetAddressOf()));
+
+		// 압축 스키닝 정점 분리 스트림: 슬롯 0 VertexStreamPos_PNTT_BW (24B), 슬롯 1 VertexStreamAttr (8B)
 		const D3D11_INPUT_ELEMENT_DESC IL_SKIN[] =
 		{
 			{ "POSITION",     0, DXGI_FORMAT_R32G32B32_FLOAT,    0,  0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
-			{ "NORMAL",       0, DXGI_FORMAT_R32G32B32_FLOAT,    0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
-			{ "TEXCOORD",     0, DXGI_FORMAT_R32G32_FLOAT,       0, 24, D3D11_INPUT_PER_VERTEX_DATA, 0 },
-			{ "TANGENT",      0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 32, D3D11_INPUT_PER_VERTEX_DATA, 0 },
-			{ "BLENDINDICES", 0, DXGI_FORMAT_R8G8B8A8_UINT,      0, 48, D3D11_INPUT_PER_VERTEX_DATA, 0 },
-			{ "BLENDWEIGHT",  0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 52, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+			{ "TEXCOORD",     0, DXGI_FORMAT_R16G16_FLOAT,       0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+			{ "BLENDINDICES", 0, DXGI_FORMAT_R8G8B8A8_UINT,      0, 16, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+			{ "BLENDWEIGHT",  0, DXGI_FORMAT_R8G8B8A8_UNORM,     0, 20, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+			{ "NORMAL",       0, DXGI_FORMAT_R16G16_SNORM,       1,  0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+			{ "TANGENT",      0, DXGI_FORMAT_R16G16_UINT,        1,  4, D3D11_INPUT_PER_VERTEX_DATA, 0 },
 		};
 		CreateIL(IL_SKIN, _countof(IL_SKIN), vsb, &m_pSkinnedIL);
+
+		// 베이크 군중 VS: 같은 스키닝 정점(슬롯 0/1) + BakedCrowd::Instance (슬롯 2, 64B)
+		ComPtr<ID3DBlob> vsbCrowd;
+		Compile(L"../Shader/VertexShaderCrowd.hlsl", "main", "vs_5_0", vsbCrowd);
+		CreateVS(vsbCrowd, mVS_Crowd.GetAddressOf());
+
+		const D3D11_INPUT_ELEMENT_DESC IL_CROWD[] =
+		{
+			{ "POSITION",     0, DXGI_FORMAT_R32G32B32_FLOAT,    0,  0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+			{ "TEXCOORD",     0, DXGI_FORMAT_R16G16_FLOAT,       0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+			{ "BLENDINDICES", 0, DXGI_FORMAT_R8G8B8A8_UINT,      0, 16, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+			{ "BLENDWEIGHT",  0, DXGI_FORMAT_R8G8B8A8_UNORM,     0, 20, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+			{ "NORMAL",       0, DXGI_FORMAT_R16G16_SNORM,       1,  0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+			{ "TANGENT",      0, DXGI_FORMAT_R16G16_UINT,        1,  4, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+			{ "INSTWORLD",    0, DXGI_FORMAT_R32G32B32A32_FLOAT, 2,  0, D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+			{ "INSTWORLD",    1, DXGI_FORMAT_R32G32B32A32_FLOAT, 2, 16, D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+			{ "INSTWORLD",    2, DXGI_FORMAT_R32G32B32A32_FLOAT, 2, 32, D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+			{ "INSTFRAME",    0, DXGI_FORMAT_R32G32_UINT,        2, 48, D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+			{ "INSTBLEND",    0, DXGI_FORMAT_R32_FLOAT,          2, 56, D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+		};
+		CreateIL(IL_CROWD, _countof(IL_CROWD), vsbCrowd, mIL_Crowd.GetAddressOf());
 	}
 
 	// =========================================================================
@@ -354,14 +389,27 @@ bool TutorialApp::InitScene()
 		if (!mCB_DeferredLights)
 			MakeCB(sizeof(CB_DeferredLights), mCB_DeferredLights.GetAddressOf());
 
-		// Bone palette (VS b4)
-		if (!m_pBoneCB)
+		// Bone palette ring (VS t11 + b4)
+		if (!mBonePalette.CapacityBones())
+		{
+			if (!mBonePalette.Create(m_pDevice))
+				HR_T(E_FAIL);
+		}
+
+		// Skin cache CS (팔레트 링 t11 을 읽어 파트 VB 를 한 번만 스키닝)
+		if (!mCS_Skinning)
 		{
-			D3D11_BUFFER_DESC cbd{};
-			cbd.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
-			cbd.Usage = D3D11_USAGE_DEFAULT;
-			cbd.ByteWidth = sizeof(DirectX::XMFLOAT4X4) * 256; // 256 bones
-			HR_T(m_pDevice->CreateBuffer(&cbd, nullptr, &m_pBoneCB));
+			Microsoft::WRL::ComPtr<ID3DBlob> csb;
+			HR_T(CompileShaderFromFile(L"../Shader/Skinning_CS.hlsl", "main", "cs_5_0", csb.GetAddressOf()));
+			HR_T(m_pDevice->CreateComputeShader(csb->GetBufferPointer(), csb->GetBufferSize(), nullptr, mCS_Skinning.GetAddressOf()));
+
+			D3D_SHADER_MACRO defsDQ[] = { {"SKIN_DQ","1"}, {nullptr,nullptr} };
+			Microsoft::WRL::ComPtr<ID3DBlob> csbDQ;
+			HR_T(D3DCompileFromFile(
+				L"../Shader/Skinning_CS.hlsl",
+				defsDQ, D3D_COMPILE_STANDARD_FILE_INCLUDE,
+				"main", "cs_5_0", 0, 0, csbDQ.GetAddressOf(), nullptr));
+			HR_T(m_pDevice->CreateComputeShader(csbDQ->GetBufferPointer(), csbDQ->GetBufferSize(), nullptr, mCS_SkinningDQ.GetAddressOf()));
 		}
 
 		// PS sampler (linear wrap)
@@ -507,75 +555,179 @@ bool TutorialApp::InitScene()
 	// 7) Load FBX + build GPU
 	// =========================================================================
 	{
-		//================================================================================
-		auto BuildAllKeepCPU = [&](const std::wstring& fbx, const std::wstring& texDir,
-			StaticMesh& mesh, std::vector<MaterialGPU>& mtls, MeshData_PNTT& outCpu)
+		// 에셋마다 잡 하나 (AssetLoadBatch): CPU 단계(쿠킹 파일 매핑 / Assimp 임포트)와
+		// GPU 단계(버퍼 + 텍스처 디코드/생성, 디바이스는 free-threaded)를 워커에서 동시에
+		//  - 컨텍스트가 필요한 일(본 팔레트 워밍업 등)은 Run 이 끝난 뒤 여기서
+		//  - 통계(mMeshCookUI)는 여러 잡이 올리므로 statMx 로
+		AssetLoadBatch loads;
+		std::mutex statMx;
+		const bool useCooked = mMeshCookUI.useCooked;
+
+		mMeshCookUI.cacheHits = mMeshCookUI.cooked = mMeshCookUI.imported = 0;
+		mMeshCookUI.skelHits = mMeshCookUI.skelCooked = 0;
+		mMeshCookUI.files.clear();
+
+		// 정적 메시: 쿠킹 캐시(.meshcook, mmap)가 있으면 Assimp 없이 포인터 그대로 Build, 없으면 임포트 후 쿠킹
+		//  - outPositions: 물리 바운드용 위치 사본 (드롭 메시만)
+		auto AddStatic = [&](const char* name, const std::wstring& fbx, const std::wstring& texDir,
+			StaticMesh& mesh, std::vector<MaterialGPU>& mtls, std::vector<Vec3>* outPositions = nullptr)
 			{
-				if (!AssimpImporterEx::LoadFBX_PNTT_AndMaterials(fbx, outCpu, /*flipUV*/true, /*leftHanded*/true))
-					throw std::runtime_error("FBX load failed");
-
-				if (!mesh.Build(m_pDevice, outCpu))
-					throw std::runtime_error("Mesh build failed");
-
-				mtls.resize(outCpu.materials.size());
-				for (size_t i = 0; i < outCpu.materials.size(); ++i)
-					mtls[i].Build(m_pDevice, outCpu.materials[i], texDir);
+				mMeshCookUI.files.push_back(fbx);
+				loads.Add(name, [this, fbx, texDir, useCooked, outPositions, &mesh, &mtls, &statMx](AssetLoadBatch::Stage& st)
+					{
+						if (useCooked)
+						{
+							CookedMesh cooked;
+							bool hit = false;
+							if (AssimpImporterEx::LoadCooked_PNTT(fbx, cooked, /*flipUV*/true, /*leftHanded*/true, &hit))
+							{
+								st.SetFromCache(hit);
+								st.GpuBegin();
+
+								const MeshCookView& v = cooked.View();
+								if (!mesh.Build(m_pDevice, v))
+									throw std::runtime_error("Mesh build failed");
+
+								mtls.resize(cooked.Materials().size());
+								st.ParallelFor(mtls.size(), [&](size_t i) { mtls[i].Build(m_pDevice, cooked.Materials()[i], texDir); });
+
+								if (outPositions) {
+									outPositions->resize(v.vertexCount);
+									for (uint32_t i = 0; i < v.vertexCount; ++i)
+										(*outPositions)[i] = Vec3(v.pos[i].px, v.pos[i].py, v.pos[i].pz);
+								}
+								if (hit) VertexPackAddSizesToTotals(v.vertexCount, /*skinned*/false);
+
+								std::lock_guard<std::mutex> lock(statMx);
+								++(hit ? mMeshCookUI.cacheHits : mMeshCookUI.cooked);
+								return;
+							}
+						}
+
+						MeshData_PNTT cpu;
+
+						if (!AssimpImporterEx::LoadFBX_PNTT_AndMaterials(fbx, cpu, /*flipUV*/true, /*leftHanded*/true))
+							throw std::runtime_error("FBX load failed");
+
+						st.GpuBegin();
+						if (!mesh.Build(m_pDevice, cpu))
+							throw std::runtime_error("Mesh build failed");
+
+						mtls.resize(cpu.materials.size());
+						st.ParallelFor(mtls.size(), [&](size_t i) { mtls[i].Build(m_pDevice, cpu.materials[i], texDir); });
+
+						if (outPositions) {
+							outPositions->resize(cpu.vertices.size());
+							for (size_t i = 0; i < cpu.vertices.size(); ++i)
+								(*outPositions)[i] = Vec3(cpu.vertices[i].px, cpu.vertices[i].py, cpu.vertices[i].pz);
+						}
+
+						std::lock_guard<std::mutex> lock(statMx);
+						++mMeshCookUI.imported;
+					});
 			};
-		//================================================================================
 
-		auto BuildAll = [&](const std::wstring& fbx, const std::wstring& texDir,
-			StaticMesh& mesh, std::vector<MaterialGPU>& mtls)
+		// 스켈레탈도 같은 스위치: .skelcook 이 유효하면 계층/본/클립/스트림을 매핑에서 바로
+		auto LoadSkel = [this, useCooked, &statMx](const std::wstring& fbx, uint32_t flags,
+			void (*import)(const std::wstring&, SkelCookData&), SkelCookData& data, AssetLoadBatch::Stage& st)
 			{
-				MeshData_PNTT cpu;
+				if (!useCooked) { import(fbx, data); return; }
 
-				if (!AssimpImporterEx::LoadFBX_PNTT_AndMaterials(fbx, cpu, /*flipUV*/true, /*leftHanded*/true))
-					throw std::runtime_error("FBX load failed");
+				bool hit = false;
+				if (!SkelCookLoadOrImport(fbx, flags, [&](SkelCookData& out) { import(fbx, out); }, data, &hit))
+					throw std::runtime_error("FBX not found");
+				st.SetFromCache(hit);
 
-				if (!mesh.Build(m_pDevice, cpu))
-					throw std::runtime_error("Mesh build failed");
-
-				mtls.resize(cpu.materials.size());
-				for (size_t i = 0; i < cpu.materials.size(); ++i)
-					mtls[i].Build(m_pDevice, cpu.materials[i], texDir);
+				std::lock_guard<std::mutex> lock(statMx);
+				++(hit ? mMeshCookUI.skelHits : mMeshCookUI.skelCooked);
 			};
 
-		BuildAll(L"../Resource/Tree/Tree.fbx", L"../Resource/Tree/", gTree, gTreeMtls);
-		BuildAll(L"../Resource/Character/Character.fbx", L"../Resource/Character/", gChar, gCharMtls);
-		BuildAll(L"../Resource/Zelda/zeldaPosed001.fbx", L"../Resource/Zelda/", gZelda, gZeldaMtls);
-		BuildAll(L"../Resource/BoxHuman/BoxHuman.fbx", L"../Resource/BoxHuman/", gBoxHuman, gBoxMtls);
-		BuildAll(L"../Resource/FBX/char.fbx", L"../Resource/FBX/", gFemale, gFemaleMtls);
+		AddStatic("Tree", L"../Resource/Tree/Tree.fbx", L"../Resource/Tree/", gTree, gTreeMtls);
+		AddStatic("Character", L"../Resource/Character/Character.fbx", L"../Resource/Character/", gChar, gCharMtls);
+		AddStatic("Zelda", L"../Resource/Zelda/zeldaPosed001.fbx", L"../Resource/Zelda/", gZelda, gZeldaMtls);
+		AddStatic("BoxHuman", L"../Resource/BoxHuman/BoxHuman.fbx", L"../Resource/BoxHuman/", gBoxHuman, gBoxMtls);
+		AddStatic("char", L"../Resource/FBX/char.fbx", L"../Resource/FBX/", gFemale, gFemaleMtls);
 
 		// === [ADD] Drop FBX 4개 로드 =================================================
-		MeshData_PNTT dropCPU[kDropCount];
+		std::vector<Vec3> dropPts[kDropCount];
 
-		struct DropPath { const wchar_t* fbx; const wchar_t* dir; };
+		struct DropPath { const char* name; const wchar_t* fbx; const wchar_t* dir; };
 		static const DropPath kDropPath[kDropCount] =
 		{
-			{ L"../Resource/FBX/IcoSphere.fbx", L"../Resource/FBX/" },
-			{ L"../Resource/FBX/sphere.fbx",    L"../Resource/FBX/" },
-			{ L"../Resource/FBX/box.fbx",       L"../Resource/FBX/" },
-			{ L"../Resource/FBX/Torus.fbx",     L"../Resource/FBX/" },
+			{ "IcoSphere", L"../Resource/FBX/IcoSphere.fbx", L"../Resource/FBX/" },
+			{ "sphere",    L"../Resource/FBX/sphere.fbx",    L"../Resource/FBX/" },
+			{ "box",       L"../Resource/FBX/box.fbx",       L"../Resource/FBX/" },
+			{ "Torus",     L"../Resource/FBX/Torus.fbx",     L"../Resource/FBX/" },
 		};
 
 		for (int i = 0; i < kDropCount; ++i)
 		{
-			BuildAllKeepCPU(kDropPath[i].fbx, kDropPath[i].dir, mDropMesh[i], mDropMtls[i], dropCPU[i]);
+			AddStatic(kDropPath[i].name, kDropPath[i].fbx, kDropPath[i].dir, mDropMesh[i], mDropMtls[i], &dropPts[i]);
 			mDropWorld[i] = Matrix::Identity;			
 		}
 		// ============================================================================
 
-		mBoxRig = RigidSkeletal::LoadFromFBX(
-			m_pDevice,
-			L"../Resource/BoxHuman/BoxHuman.fbx",
-			L"../Resource/BoxHuman/");
+		const size_t staticCount = mMeshCookUI.files.size();
 
-		mSkinRig = SkinnedSkeletal::LoadFromFBX(
-			m_pDevice,
-			L"../Resource/Skinning/SkinningTest.fbx",
-			L"../Resource/Skinning/");
-
-		if (mSkinRig && m_pBoneCB)
-			mSkinRig->WarmupBoneCB(m_pDeviceContext, m_pBoneCB);
+		loads.Add("BoxHuman (rigid)", [&](AssetLoadBatch::Stage& st)
+			{
+				SkelCookData data;
+				LoadSkel(L"../Resource/BoxHuman/BoxHuman.fbx", RigidSkeletal::kCookFlags, &RigidSkeletal::ImportFBX, data, st);
+				st.GpuBegin();
+				mBoxRig = RigidSkeletal::FromCookData(m_pDevice, data, L"../Resource/BoxHuman/");
+			});
+		loads.Add("SkinningTest (skinned)", [&](AssetLoadBatch::Stage& st)
+			{
+				SkelCookData data;
+				LoadSkel(L"../Resource/Skinning/SkinningTest.fbx", SkinnedSkeletal::kCookFlags, &SkinnedSkeletal::ImportFBX, data, st);
+				st.GpuBegin();
+				mSkinRig = SkinnedSkeletal::FromCookData(m_pDevice, data, L"../Resource/Skinning/");
+			});
+
+		loads.Run(mSceneLoadUI.parallel ? mJobs.get() : nullptr);
+		loads.Print();
+		{
+			// 파트 × 머티리얼 만큼 Build 해도 SRV 생성은 파일당 1번 (misses == 고유 텍스처 수)
+			const TextureCacheStats tc = TextureCache::Instance().Stats();
+			printf("[SceneLoad] textures: %zu resident (%.1f MB), %llu hits / %llu misses, %llu failed\n",
+				tc.entries, tc.residentBytes / (1024.0 * 1024.0),
+				(unsigned long long)tc.hits, (unsigned long long)tc.misses, (unsigned long long)tc.failed);
+		}
+		// 이번 실행에서 임포트한 메시만 (쿠킹 캐시 적중분은 이미 최적화된 순서)
+		const MeshOptReport optTotals = MeshOptTotalsSnapshot();
+		const MeshLodReport lodTotals = MeshLodTotalsSnapshot();
+		if (optTotals.submeshes > 0)
+			MeshOptPrintReport("imported meshes", optTotals);
+		if (lodTotals.submeshes > 0)
+			MeshLodPrintReport("imported meshes", lodTotals);
+
+		// 단계별 합 (병렬이라 벽시계 시간은 SceneLoadUI.wallMs 하나뿐)
+		mMeshCookUI.loadMs = mMeshCookUI.skelMs = 0.0;
+		for (size_t i = 0; i < loads.Timings().size(); ++i)
+			(i < staticCount ? mMeshCookUI.loadMs : mMeshCookUI.skelMs) += loads.Timings()[i].TotalMs();
+		mMeshCookUI.loadedCooked = useCooked;
+
+		mSceneLoadUI.wallMs = loads.WallMs();
+		mSceneLoadUI.summedMs = loads.SummedMs();
+		mSceneLoadUI.threads = loads.Threads();
+		mSceneLoadUI.assets = loads.Timings();
+		mSceneLoadUI.loadedParallel = mSceneLoadUI.parallel;
+
+		// 실행 중 스트리밍: 대체 리소스 + I/O 스레드 (요청은 ImGui 스트리밍 패널에서)
+		if (!mStreamer.Init(m_pDevice, /*ioThreads*/2))
+			throw std::runtime_error("AssetStreamer init failed");
+
+		if (mSkinRig)
+		{
+			mSkinRig->WarmupBonePalette(m_pDeviceContext, &mBonePalette);
+			mSkinRig->EnableSkinCache(m_pDevice, mUseSkinCache && mCS_Skinning);
+
+			// 베이크 군중: 소스 해시가 같은 캐시 파일이 있으면 읽기만, 없으면 베이크 후 저장
+			const auto t0 = std::chrono::steady_clock::now();
+			if (mSkinRig->BakeCrowd(mCrowdUI.fps, L"../Resource/Skinning/SkinningTest.animbake", mCrowdBake, &mCrowdUI.fromCache))
+				mCrowd.Create(m_pDevice, mCrowdBake, kCrowdMaxInstances);
+			mCrowdUI.bakeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+		}
 		// === [ADD] PhysX World + Drop Bodies =========================================
 		{
 			// 2) Floor (grid 높이에 맞춰 깔기)
@@ -590,30 +742,23 @@ bool TutorialApp::InitScene()
 			mPhysGround = mPxWorld->CreateStaticBox(floorPos, Quat::Identity, floor);
 
 			// 3) Bounds 계산 유틸		
-			auto GetPos = [](const auto& v) -> Vec3
-				{
-					return Vec3(v.px, v.py, v.pz);
-				};
-
-			auto ComputeAabb = [&](const MeshData_PNTT& cpu, Vec3& outMin, Vec3& outMax)
+			auto ComputeAabb = [&](const std::vector<Vec3>& pts, Vec3& outMin, Vec3& outMax)
 				{
 					outMin = { +FLT_MAX, +FLT_MAX, +FLT_MAX };
 					outMax = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
 
-					for (const auto& v : cpu.vertices)
+					for (const Vec3& p : pts)
 					{
-						const auto p = GetPos(v);
 						outMin.x = min(outMin.x, p.x); outMin.y = min(outMin.y, p.y); outMin.z = min(outMin.z, p.z);
 						outMax.x = max(outMax.x, p.x); outMax.y = max(outMax.y, p.y); outMax.z = max(outMax.z, p.z);
 					}
 				};
 
-			auto ComputeSphereRadius = [&](const MeshData_PNTT& cpu, const Vec3& center) -> float
+			auto ComputeSphereRadius = [&](const std::vector<Vec3>& pts, const Vec3& center) -> float
 				{
 					float r = 0.0f;
-					for (const auto& v : cpu.vertices)
+					for (const Vec3& p : pts)
 					{
-						const auto p = GetPos(v);
 						const float d = (p - center).Length();
 						r = max(r, d);
 					}
@@ -634,9 +779,9 @@ bool TutorialApp::InitScene()
 			// (0) IcoSphere -> Sphere collider
 			{
 				Vec3 mn, mx;
-				ComputeAabb(dropCPU[0], mn, mx);
+				ComputeAabb(dropPts[0], mn, mx);
 				const Vec3 center = (mn + mx) * 0.5f;
-				const float radius = ComputeSphereRadius(dropCPU[0], center);
+				const float radius = ComputeSphereRadius(dropPts[0], center);
 
 				SphereColliderDesc s{};
 				s.radius = radius;
@@ -651,9 +796,9 @@ bool TutorialApp::InitScene()
 			// (1) sphere -> Sphere collider
 			{
 				Vec3 mn, mx;
-				ComputeAabb(dropCPU[1], mn, mx);
+				ComputeAabb(dropPts[1], mn, mx);
 				const Vec3 center = (mn + mx) * 0.5f;
-				const float radius = ComputeSphereRadius(dropCPU[1], center);
+				const float radius = ComputeSphereRadius(dropPts[1], center);
 
 				SphereColliderDesc s{};
 				s.radius = radius;
@@ -668,7 +813,7 @@ bool TutorialApp::InitScene()
 			// (2) box -> Box collider
 			{
 				Vec3 mn, mx;
-				ComputeAabb(dropCPU[2], mn, mx);
+				ComputeAabb(dropPts[2], mn, mx);
 				const Vec3 half = (mx - mn) * 0.5f;
 
 				BoxColliderDesc b{};
@@ -684,9 +829,7 @@ bool TutorialApp::InitScene()
 			// (3) Torus -> Dynamic Convex Mesh (Hull)
 			{
 				// vertex cloud
-				std::vector<Vec3> verts;
-				verts.reserve(dropCPU[3].vertices.size());
-				for (const auto& v : dropCPU[3].vertices) verts.push_back(GetPos(v));
+				const std::vector<Vec3>& verts = dropPts[3];
 
 				ConvexMeshColliderDesc c{};
 				c.vertices = verts.data();
@@ -1246,25 +1389,29 @@ bool TutorialApp::CreateDepthOnlyShaders(ID3D11Device* dev)
 {
 	using Microsoft::WRL::ComPtr;
 
-	ComPtr<ID3DBlob> vsPntt, vsSkin, psDepth, psPoint;
+	ComPtr<ID3DBlob> vsPntt, vsSkin, vsSkinDQ, psDepth, psPoint;
 
 	HR_T(CompileShaderFromFile(L"../Shader/DepthOnly_VS.hlsl", "main", "vs_5_0", vsPntt.GetAddressOf()));
 	HR_T(CompileShaderFromFile(L"../Shader/DepthOnly_SkinnedVS.hlsl", "main", "vs_5_0", vsSkin.GetAddressOf()));
+	{
+		D3D_SHADER_MACRO defsDQ[] = { {"SKIN_DQ","1"}, {nullptr,nullptr} };
+		HR_T(D3DCompileFromFile(L"../Shader/DepthOnly_SkinnedVS.hlsl", defsDQ, D3D_COMPILE_STANDARD_FILE_INCLUDE,
+			"main", "vs_5_0", 0, 0, vsSkinDQ.GetAddressOf(), nullptr));
+	}
 	HR_T(CompileShaderFromFile(L"../Shader/DepthOnly_PS.hlsl", "main", "ps_5_0", psDepth.GetAddressOf()));
 	HR_T(CompileShaderFromFile(L"../Shader/PointShadow_PS.hlsl", "main", "ps_5_0", psPoint.GetAddressOf()));
 
 	HR_T(dev->CreateVertexShader(vsPntt->GetBufferPointer(), vsPntt->GetBufferSize(), nullptr, mVS_Depth.GetAddressOf()));
 	HR_T(dev->CreateVertexShader(vsSkin->GetBufferPointer(), vsSkin->GetBufferSize(), nullptr, mVS_DepthSkinned.GetAddressOf()));
+	HR_T(dev->CreateVertexShader(vsSkinDQ->GetBufferPointer(), vsSkinDQ->GetBufferSize(), nullptr, mVS_DepthSkinnedDQ.GetAddressOf()));
 	HR_T(dev->CreatePixelShader(psDepth->GetBufferPointer(), psDepth->GetBufferSize(), nullptr, mPS_Depth.GetAddressOf()));
 	HR_T(dev->CreatePixelShader(psPoint->GetBufferPointer(), psPoint->GetBufferSize(), nullptr, mPS_PointShadow.GetAddressOf()));
 
-	// IL: PNTT
+	// IL: 위치 스트림만 (슬롯 0, VertexStreamPos_PNTT 16B) → 깊이 패스는 노멀/탄젠트를 읽지 않는다
 	static const D3D11_INPUT_ELEMENT_DESC IL_PNTT[] =
 	{
 		{ "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT,    0,  0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
-		{ "NORMAL",   0, DXGI_FORMAT_R32G32B32_FLOAT,    0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
-		{ "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT,       0, 24, D3D11_INPUT_PER_VERTEX_DATA, 0 },
-		{ "TANGENT",  0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 32, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT,       0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
 	};
 
 	HR_T(dev->CreateInputLayout(
@@ -1272,15 +1419,13 @@ bool TutorialApp::CreateDepthOnlyShaders(ID3D11Device* dev)
 		vsPntt->GetBufferPointer(), vsPntt->GetBufferSize(),
 		mIL_PNTT.GetAddressOf()));
 
-	// IL: PNTT + Bone
+	// IL: 위치 + Bone 스트림만 (슬롯 0, VertexStreamPos_PNTT_BW 24B)
 	static const D3D11_INPUT_ELEMENT_DESC IL_SKIN[] =
 	{
 		{ "POSITION",     0, DXGI_FORMAT_R32G32B32_FLOAT,    0,  0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
-		{ "NORMAL",       0, DXGI_FORMAT_R32G32B32_FLOAT,    0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
-		{ "TEXCOORD",     0, DXGI_FORMAT_R32G32_FLOAT,       0, 24, D3D11_INPUT_PER_VERTEX_DATA, 0 },
-		{ "TANGENT",      0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 32, D3D11_INPUT_PER_VERTEX_DATA, 0 },
-		{ "BLENDINDICES", 0, DXGI_FORMAT_R8G8B8A8_UINT,      0, 48, D3D11_INPUT_PER_VERTEX_DATA, 0 },
-		{ "BLENDWEIGHT",  0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 52, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "TEXCOORD",     0, DXGI_FORMAT_R16G16_FLOAT,       0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "BLENDINDICES", 0, DXGI_FORMAT_R8G8B8A8_UINT,      0, 16, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+		{ "BLENDWEIGHT",  0, DXGI_FORMAT_R8G8B8A8_UNORM,     0, 20, D3D11_INPUT_PER_VERTEX_DATA, 0 },
 	};
 
 	HR_T(dev->CreateInputLayout(
@@ -1291,12 +1436,59 @@ bool TutorialApp::CreateDepthOnlyShaders(ID3D11Device* dev)
 	return true;
 }
 
+// ============================================================================
+// Mesh load path comparison
+// ============================================================================
+
+void TutorialApp::MeasureMeshLoadPaths()
+{
+	using Clock = std::chrono::steady_clock;
+	auto Ms = [](Clock::time_point t0) { return std::chrono::duration<double, std::milli>(Clock::now() - t0).count(); };
+	// 측정용 Build / 임포트 통계는 여기로 (전역 합계는 스트리밍 I/O 스레드가 동시에 누적 중일 수 있음)
+	MeshImportReport scratch;
+
+	// 1) Assimp: 후처리 전체 + float 정점 → 압축/분리 → 버퍼
+	auto t0 = Clock::now();
+	for (const std::wstring& fbx : mMeshCookUI.files)
+	{
+		MeshData_PNTT cpu;
+		StaticMesh mesh;
+		if (AssimpImporterEx::LoadFBX_PNTT_AndMaterials(fbx, cpu, /*flipUV*/true, /*leftHanded*/true, &scratch))
+			mesh.Build(m_pDevice, cpu, &scratch.pack);
+	}
+	mMeshCookUI.assimpMs = Ms(t0);
+
+	// 2) 쿠킹 파일: 매핑 + 검증 → 포인터 그대로 버퍼 (첫 실행이면 여기서 쿠킹될 수 있음)
+	mMeshCookUI.cookedBytes = 0;
+	t0 = Clock::now();
+	for (const std::wstring& fbx : mMeshCookUI.files)
+	{
+		CookedMesh cooked;
+		StaticMesh mesh;
+		if (AssimpImporterEx::LoadCooked_PNTT(fbx, cooked, /*flipUV*/true, /*leftHanded*/true, nullptr, &scratch))
+		{
+			mesh.Build(m_pDevice, cooked.View());
+			mMeshCookUI.cookedBytes += cooked.FileBytes();
+		}
+	}
+	mMeshCookUI.cookedMs = Ms(t0);
+}
+
 // ============================================================================
 // Scene Uninit
 // ============================================================================
 
 void TutorialApp::UninitScene()
 {
+	// 스트리밍 먼저: I/O 스레드 합류 + 스트리밍 리소스 해제
+	mStreamUI.meshes.clear();
+	mStreamUI.texture = {};
+	mStreamer.Shutdown();
+
+	// 텍스처 캐시 참조 해제 (머티리얼이 잡고 있는 SRV 는 각 메시가 해제될 때 같이 풀림)
+	TextureCache::Instance().Clear();
+	TexturePathIndex::ClearAll();   // 다음 InitScene 은 폴더를 다시 훑음 (실행 중 추가된 텍스처 반영)
+
 	// ------------------------------------------------------------------------
 	// FBX / 기본 렌더 파이프라인
 	// ------------------------------------------------------------------------
@@ -1358,7 +1550,13 @@ void TutorialApp::UninitScene()
 	// ------------------------------------------------------------------------
 	SAFE_RELEASE(m_pSkinnedIL);
 	SAFE_RELEASE(m_pSkinnedVS);
-	SAFE_RELEASE(m_pBoneCB);
+	mVS_SkinnedDQ.Reset();
+	mBonePalette.Release();
+	mCS_Skinning.Reset();
+	mCS_SkinningDQ.Reset();
+	mCrowd.Release();
+	mVS_Crowd.Reset();
+	mIL_Crowd.Reset();
 
 	SAFE_RELEASE(m_pRampSRV);
 	SAFE_RELEASE(m_pToonCB);
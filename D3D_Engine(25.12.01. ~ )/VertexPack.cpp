@@ -0,0 +1,360 @@
+﻿// ============================================================================
+// VertexPack.cpp
+// - VertexPack 구현: 옥타헤드럴 / half / UNORM8 가중치 + 왕복 오차 측정
+// ============================================================================
+
+// ---- includes ----
+
+#include "../D3D_Core/pch.h"
+#include "VertexPack.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+
+// ---------------------------------------------------------------------------
+// helpers
+// ---------------------------------------------------------------------------
+static inline float SignNotZero(float v) { return v >= 0.0f ? 1.0f : -1.0f; }
+static inline float Clamp11(float v) { return v < -1.0f ? -1.0f : (v > 1.0f ? 1.0f : v); }
+
+static inline int16_t ToSnorm16(float v) { return (int16_t)std::lrintf(Clamp11(v) * 32767.0f); }
+static inline float   FromSnorm16(int16_t q) { const float f = q / 32767.0f; return f < -1.0f ? -1.0f : f; }
+
+// [-1,1] → UNORM (bits 비트)
+static inline uint16_t ToUnorm(float v, float maxQ) { return (uint16_t)std::lrintf((Clamp11(v) * 0.5f + 0.5f) * maxQ); }
+static inline float    FromUnorm(uint32_t q, float maxQ) { return q / maxQ * 2.0f - 1.0f; }
+
+// acos(dot) 는 float 에서 1 근처 해상도가 ~0.02 도라 압축 오차보다 커짐 → atan2(|a×b|, a·b)
+static float AngleDeg(float ax, float ay, float az, float bx, float by, float bz)
+{
+    const float cx = ay * bz - az * by, cy = az * bx - ax * bz, cz = ax * by - ay * bx;
+    const float s = std::sqrt(cx * cx + cy * cy + cz * cz);
+    const float c = ax * bx + ay * by + az * bz;
+    if (s <= 0.0f && c == 0.0f) return 0.0f;  // 길이 0
+    return std::atan2(s, c) * (180.0f / 3.14159265358979f);
+}
+
+// ---------------------------------------------------------------------------
+// 옥타헤드럴
+// ---------------------------------------------------------------------------
+void VertexOctEncode(float x, float y, float z, float& ex, float& ey)
+{
+    const float l1 = std::fabs(x) + std::fabs(y) + std::fabs(z);
+    if (l1 <= 0.0f) { ex = ey = 0.0f; return; }
+
+    x /= l1; y /= l1;
+    if (z < 0.0f) {
+        const float ox = x;
+        x = (1.0f - std::fabs(y)) * SignNotZero(ox);
+        y = (1.0f - std::fabs(ox)) * SignNotZero(y);
+    }
+    ex = x; ey = y;
+}
+
+void VertexOctDecode(float ex, float ey, float& x, float& y, float& z)
+{
+    x = ex; y = ey;
+    z = 1.0f - std::fabs(ex) - std::fabs(ey);
+    const float t = z < 0.0f ? -z : 0.0f;
+    x += x >= 0.0f ? -t : t;
+    y += y >= 0.0f ? -t : t;
+
+    const float l = std::sqrt(x * x + y * y + z * z);
+    x /= l; y /= l; z /= l;
+}
+
+// ---------------------------------------------------------------------------
+// half
+// ---------------------------------------------------------------------------
+uint16_t VertexFloatToHalf(float f)
+{
+    uint32_t x; memcpy(&x, &f, sizeof(x));
+    const uint16_t sign = (uint16_t)((x >> 16) & 0x8000u);
+    uint32_t a = x & 0x7FFFFFFFu;
+
+    if (a >= 0x7F800000u) return sign | (a > 0x7F800000u ? 0x7E00u : 0x7C00u);  // NaN / Inf
+    if (a >= 0x477FF000u) return sign | 0x7C00u;                                // 65520 이상 → Inf
+    if (a < 0x38800000u) {                                                      // half 비정규수
+        float m; memcpy(&m, &a, sizeof(m));
+        return sign | (uint16_t)std::lrintf(m * 16777216.0f);                  // / 2^-24
+    }
+
+    a -= 0x38000000u;                       // 지수 127 → 15
+    a += 0x0FFFu + ((a >> 13) & 1u);        // 가까운 짝수
+    return sign | (uint16_t)(a >> 13);
+}
+
+float VertexHalfToFloat(uint16_t h)
+{
+    const uint32_t sign = (uint32_t)(h & 0x8000u) << 16;
+    const uint32_t e = (h >> 10) & 0x1Fu;
+    const uint32_t m = h & 0x3FFu;
+
+    if (e == 0) {
+        const float v = m * (1.0f / 16777216.0f);
+        return sign ? -v : v;
+    }
+
+    uint32_t x = sign | ((e == 31) ? (0xFFu << 23) | (m << 13) : ((e + 112u) << 23) | (m << 13));
+    float f; memcpy(&f, &x, sizeof(f));
+    return f;
+}
+
+// ---------------------------------------------------------------------------
+// 가중치
+// ---------------------------------------------------------------------------
+void VertexPackWeights(const float w[4], uint8_t out[4])
+{
+    float sum = 0.0f;
+    for (int i = 0; i < 4; ++i) sum += w[i] > 0.0f ? w[i] : 0.0f;
+    if (sum <= 0.0f) { out[0] = 255; out[1] = out[2] = out[3] = 0; return; }
+
+    // 내림 후 남은 몫을 소수부가 큰 순서로 1씩
+    float frac[4];
+    int total = 0;
+    for (int i = 0; i < 4; ++i) {
+        const float s = (w[i] > 0.0f ? w[i] : 0.0f) / sum * 255.0f;
+        const int q = (int)s;
+        out[i] = (uint8_t)q;
+        frac[i] = s - (float)q;
+        total += q;
+    }
+    for (; total < 255; ++total) {
+        int best = 0;
+        for (int i = 1; i < 4; ++i) if (frac[i] > frac[best]) best = i;
+        ++out[best];
+        frac[best] = -1.0f;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// 정점
+// ---------------------------------------------------------------------------
+template<class P, class V>
+static void PackCommon(const V& v, P& o)
+{
+    o.px = v.px; o.py = v.py; o.pz = v.pz;
+
+    float ex, ey;
+    VertexOctEncode(v.nx, v.ny, v.nz, ex, ey);
+    o.n[0] = ToSnorm16(ex);
+    o.n[1] = ToSnorm16(ey);
+
+    VertexOctEncode(v.tx, v.ty, v.tz, ex, ey);
+    o.t[0] = ToUnorm(ex, 65535.0f);
+    o.t[1] = (uint16_t)(ToUnorm(ey, 32767.0f) | (v.tw < 0.0f ? 0x8000u : 0u));
+
+    o.uv[0] = VertexFloatToHalf(v.u);
+    o.uv[1] = VertexFloatToHalf(v.v);
+}
+
+template<class V, class P>
+static void UnpackCommon(const P& p, V& o)
+{
+    o.px = p.px; o.py = p.py; o.pz = p.pz;
+    VertexOctDecode(FromSnorm16(p.n[0]), FromSnorm16(p.n[1]), o.nx, o.ny, o.nz);
+    VertexOctDecode(FromUnorm(p.t[0], 65535.0f), FromUnorm(p.t[1] & 0x7FFFu, 32767.0f), o.tx, o.ty, o.tz);
+    o.tw = (p.t[1] & 0x8000u) ? -1.0f : 1.0f;
+    o.u = VertexHalfToFloat(p.uv[0]);
+    o.v = VertexHalfToFloat(p.uv[1]);
+}
+
+VertexPacked_PNTT VertexPack(const VertexCPU_PNTT& v)
+{
+    VertexPacked_PNTT o{};
+    PackCommon(v, o);
+    return o;
+}
+
+VertexPacked_PNTT_BW VertexPack(const VertexCPU_PNTT_BW& v)
+{
+    VertexPacked_PNTT_BW o{};
+    PackCommon(v, o);
+    memcpy(o.bi, v.bi, sizeof(o.bi));
+    VertexPackWeights(v.bw, o.bw);
+    return o;
+}
+
+VertexCPU_PNTT VertexUnpack(const VertexPacked_PNTT& p)
+{
+    VertexCPU_PNTT o{};
+    UnpackCommon(p, o);
+    return o;
+}
+
+VertexCPU_PNTT_BW VertexUnpack(const VertexPacked_PNTT_BW& p)
+{
+    VertexCPU_PNTT_BW o{};
+    UnpackCommon(p, o);
+    memcpy(o.bi, p.bi, sizeof(o.bi));
+    for (int i = 0; i < 4; ++i) o.bw[i] = p.bw[i] / 255.0f;
+    return o;
+}
+
+// ---------------------------------------------------------------------------
+// 배열 + 보고
+// ---------------------------------------------------------------------------
+void VertexPackReport::Merge(const VertexPackReport& o)
+{
+    staticVerts += o.staticVerts;
+    skinnedVerts += o.skinnedVerts;
+    bytesFloat += o.bytesFloat;
+    bytesPacked += o.bytesPacked;
+    if (o.maxNormalDeg > maxNormalDeg) maxNormalDeg = o.maxNormalDeg;
+    if (o.maxTangentDeg > maxTangentDeg) maxTangentDeg = o.maxTangentDeg;
+    if (o.maxUV > maxUV) maxUV = o.maxUV;
+    if (o.maxWeight > maxWeight) maxWeight = o.maxWeight;
+    signFlips += o.signFlips;
+}
+
+template<class V>
+static void MeasureCommon(const V& a, const V& b, VertexPackReport& r)
+{
+    const float dn = AngleDeg(a.nx, a.ny, a.nz, b.nx, b.ny, b.nz);
+    const float dt = AngleDeg(a.tx, a.ty, a.tz, b.tx, b.ty, b.tz);
+    const float du = std::fmax(std::fabs(a.u - b.u), std::fabs(a.v - b.v));
+    if (dn > r.maxNormalDeg) r.maxNormalDeg = dn;
+    if (dt > r.maxTangentDeg) r.maxTangentDeg = dt;
+    if (du > r.maxUV) r.maxUV = du;
+    if ((a.tw < 0.0f) != (b.tw < 0.0f)) ++r.signFlips;
+}
+
+void VertexPackArray(const VertexCPU_PNTT* src, size_t count, VertexPacked_PNTT* dst, VertexPackReport* report)
+{
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] = VertexPack(src[i]);
+        if (report) MeasureCommon(src[i], VertexUnpack(dst[i]), *report);
+    }
+    if (report) {
+        report->staticVerts += count;
+        report->bytesFloat += count * sizeof(VertexCPU_PNTT);
+        report->bytesPacked += count * sizeof(VertexPacked_PNTT);
+    }
+}
+
+void VertexPackArray(const VertexCPU_PNTT_BW* src, size_t count, VertexPacked_PNTT_BW* dst, VertexPackReport* report)
+{
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] = VertexPack(src[i]);
+        if (!report) continue;
+
+        const VertexCPU_PNTT_BW back = VertexUnpack(dst[i]);
+        MeasureCommon(src[i], back, *report);
+
+        float sum = 0.0f;
+        for (int k = 0; k < 4; ++k) sum += src[i].bw[k] > 0.0f ? src[i].bw[k] : 0.0f;
+        if (sum <= 0.0f) continue;
+        for (int k = 0; k < 4; ++k) {
+            const float w = (src[i].bw[k] > 0.0f ? src[i].bw[k] : 0.0f) / sum;
+            const float d = std::fabs(w - back.bw[k]);
+            if (d > report->maxWeight) report->maxWeight = d;
+        }
+    }
+    if (report) {
+        report->skinnedVerts += count;
+        report->bytesFloat += count * sizeof(VertexCPU_PNTT_BW);
+        report->bytesPacked += count * sizeof(VertexPacked_PNTT_BW);
+    }
+}
+
+static std::mutex s_totalsMx;
+static VertexPackReport s_totals;   // s_totalsMx 로 보호
+
+VertexPackReport VertexPackTotalsSnapshot()
+{
+    std::lock_guard<std::mutex> lock(s_totalsMx);
+    return s_totals;
+}
+
+void VertexPackResetTotals()
+{
+    std::lock_guard<std::mutex> lock(s_totalsMx);
+    s_totals = {};
+}
+
+void VertexPackAddToTotals(const VertexPackReport& r)
+{
+    std::lock_guard<std::mutex> lock(s_totalsMx);
+    s_totals.Merge(r);
+}
+
+void VertexPackAddSizesToTotals(size_t vertexCount, bool skinned)
+{
+    VertexPackReport r;
+    if (skinned) {
+        r.skinnedVerts = vertexCount;
+        r.bytesFloat = (uint64_t)vertexCount * sizeof(VertexCPU_PNTT_BW);
+        r.bytesPacked = (uint64_t)vertexCount * sizeof(VertexPacked_PNTT_BW);
+    }
+    else {
+        r.staticVerts = vertexCount;
+        r.bytesFloat = (uint64_t)vertexCount * sizeof(VertexCPU_PNTT);
+        r.bytesPacked = (uint64_t)vertexCount * sizeof(VertexPacked_PNTT);
+    }
+    VertexPackAddToTotals(r);
+}
+
+void VertexPackPrintReport(const char* label, const VertexPackReport& r)
+{
+    printf("[VertexPack] %s: %llu static + %llu skinned verts | %.1f KB -> %.1f KB (%.1f%%) | normal %.4f deg, tangent %.4f deg (%llu flips), uv %.2e, weight %.2e\n",
+        label, (unsigned long long)r.staticVerts, (unsigned long long)r.skinnedVerts,
+        r.bytesFloat / 1024.0, r.bytesPacked / 1024.0, r.Ratio() * 100.0,
+        r.maxNormalDeg, r.maxTangentDeg, (unsigned long long)r.signFlips, r.maxUV, r.maxWeight);
+}
+
+// ---------------------------------------------------------------------------
+// 분리 스트림
+// ---------------------------------------------------------------------------
+template<class P, class S>
+static inline void SplitCommon(const P& v, S& pos, VertexStreamAttr& attr)
+{
+    pos.px = v.px; pos.py = v.py; pos.pz = v.pz;
+    pos.uv[0] = v.uv[0]; pos.uv[1] = v.uv[1];
+    attr.n[0] = v.n[0]; attr.n[1] = v.n[1];
+    attr.t[0] = v.t[0]; attr.t[1] = v.t[1];
+}
+
+void VertexSplitStreams(const VertexPacked_PNTT* src, size_t count,
+    VertexStreamPos_PNTT* pos, VertexStreamAttr* attr)
+{
+    for (size_t i = 0; i < count; ++i)
+        SplitCommon(src[i], pos[i], attr[i]);
+}
+
+void VertexSplitStreams(const VertexPacked_PNTT_BW* src, size_t count,
+    VertexStreamPos_PNTT_BW* pos, VertexStreamAttr* attr)
+{
+    for (size_t i = 0; i < count; ++i) {
+        SplitCommon(src[i], pos[i], attr[i]);
+        memcpy(pos[i].bi, src[i].bi, sizeof(pos[i].bi));
+        memcpy(pos[i].bw, src[i].bw, sizeof(pos[i].bw));
+    }
+}
+
+template<class S, class P>
+static inline void JoinCommon(const S& pos, const VertexStreamAttr& attr, P& o)
+{
+    o.px = pos.px; o.py = pos.py; o.pz = pos.pz;
+    o.uv[0] = pos.uv[0]; o.uv[1] = pos.uv[1];
+    o.n[0] = attr.n[0]; o.n[1] = attr.n[1];
+    o.t[0] = attr.t[0]; o.t[1] = attr.t[1];
+}
+
+void VertexJoinStreams(const VertexStreamPos_PNTT* pos, const VertexStreamAttr* attr,
+    size_t count, VertexPacked_PNTT* dst)
+{
+    for (size_t i = 0; i < count; ++i)
+        JoinCommon(pos[i], attr[i], dst[i]);
+}
+
+void VertexJoinStreams(const VertexStreamPos_PNTT_BW* pos, const VertexStreamAttr* attr,
+    size_t count, VertexPacked_PNTT_BW* dst)
+{
+    for (size_t i = 0; i < count; ++i) {
+        JoinCommon(pos[i], attr[i], dst[i]);
+        memcpy(dst[i].bi, pos[i].bi, sizeof(dst[i].bi));
+        memcpy(dst[i].bw, pos[i].bw, sizeof(dst[i].bw));
+    }
+}
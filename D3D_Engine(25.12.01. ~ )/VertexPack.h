@@ -0,0 +1,88 @@
+﻿// ============================================================================
+// VertexPack.h
+// - 정점 압축/복원 (VertexCPU_* float → VertexPacked_* , MeshDataEx.h)
+//   · 정적 48B → 24B, 스키닝 68B → 32B
+//   · 노멀/탄젠트: 옥타헤드럴 (탄젠트는 y 15bit + handedness 부호 비트)
+//   · UV: half, 가중치: UNORM8 (합이 정확히 255가 되도록 최대 나머지 배분)
+// - GPU 에는 다시 두 스트림으로 나눠 올린다 (VertexSplitStreams)
+//   · 슬롯 0 위치+UV(+본) 16B/24B, 슬롯 1 노멀+탄젠트 8B → 그림자/깊이 패스는 슬롯 0 만 fetch
+// - 식은 Shader/VertexPack.hlsli (VS 디코드 / 스킨 캐시 CS 인코드)와 같게 유지할 것
+// - D3D 의존 없음 (리눅스에서도 빌드/측정 가능)
+// ============================================================================
+
+#pragma once
+
+// ---- includes ----
+#include <cstddef>
+#include <cstdint>
+
+#include "MeshDataEx.h"
+
+// ---------------------------------------------------------------------------
+// 개별 코덱
+// ---------------------------------------------------------------------------
+// 단위 벡터 ↔ 옥타헤드럴 [-1,1]^2 (길이 0 이면 (0,0) → 복원 시 +Z)
+void VertexOctEncode(float x, float y, float z, float& ex, float& ey);
+void VertexOctDecode(float ex, float ey, float& x, float& y, float& z);
+
+// IEEE half (가까운 짝수 반올림, 비정규수/Inf/NaN 처리)
+uint16_t VertexFloatToHalf(float f);
+float    VertexHalfToFloat(uint16_t h);
+
+// 가중치 4개 → UNORM8 (합 255). 합이 0이면 첫 본 255
+void VertexPackWeights(const float w[4], uint8_t out[4]);
+
+VertexPacked_PNTT    VertexPack(const VertexCPU_PNTT& v);
+VertexPacked_PNTT_BW VertexPack(const VertexCPU_PNTT_BW& v);
+VertexCPU_PNTT       VertexUnpack(const VertexPacked_PNTT& v);
+VertexCPU_PNTT_BW    VertexUnpack(const VertexPacked_PNTT_BW& v);
+
+// ---------------------------------------------------------------------------
+// 배열 압축 + 왕복 오차 / 크기 보고
+// ---------------------------------------------------------------------------
+struct VertexPackReport
+{
+    uint64_t staticVerts = 0;
+    uint64_t skinnedVerts = 0;
+    uint64_t bytesFloat = 0;        // VertexCPU_* 기준
+    uint64_t bytesPacked = 0;       // VertexPacked_* 기준
+
+    float    maxNormalDeg = 0.0f;   // 노멀 방향 오차 (도)
+    float    maxTangentDeg = 0.0f;  // 탄젠트 방향 오차 (도)
+    float    maxUV = 0.0f;          // UV 절대 오차
+    float    maxWeight = 0.0f;      // 정규화된 가중치 절대 오차
+    uint64_t signFlips = 0;         // handedness 가 바뀐 정점 (0 이어야 함)
+
+    void Merge(const VertexPackReport& o);
+    double Ratio() const { return bytesFloat ? (double)bytesPacked / (double)bytesFloat : 1.0; }
+};
+
+// report 가 있으면 복원해서 오차를 누적
+void VertexPackArray(const VertexCPU_PNTT* src, size_t count, VertexPacked_PNTT* dst, VertexPackReport* report);
+void VertexPackArray(const VertexCPU_PNTT_BW* src, size_t count, VertexPacked_PNTT_BW* dst, VertexPackReport* report);
+
+// 로드된 메시 전체 합계 (StaticMesh / SkinnedMesh::Build 가 누적)
+//  - 병렬 로드 / 스트리밍 I/O 스레드가 동시에 누적 → 읽기는 잠금 안에서 복사한 스냅샷으로만
+VertexPackReport VertexPackTotalsSnapshot();
+void VertexPackResetTotals();
+void VertexPackAddToTotals(const VertexPackReport& r);
+
+// 쿠킹 캐시를 그대로 쓴 경우: 압축 오차는 모르니 크기만 합계에 반영
+void VertexPackAddSizesToTotals(size_t vertexCount, bool skinned);
+
+// 한 줄 요약 (AssetCookTool 파일별 / 전체). 오차는 쿠킹한 경우에만 의미 있음
+void VertexPackPrintReport(const char* label, const VertexPackReport& r);
+
+// ---------------------------------------------------------------------------
+// 분리 스트림 (슬롯 0 위치 / 슬롯 1 속성). 깊이 패스는 슬롯 0 만 바인딩
+// ---------------------------------------------------------------------------
+void VertexSplitStreams(const VertexPacked_PNTT* src, size_t count,
+    VertexStreamPos_PNTT* pos, VertexStreamAttr* attr);
+void VertexSplitStreams(const VertexPacked_PNTT_BW* src, size_t count,
+    VertexStreamPos_PNTT_BW* pos, VertexStreamAttr* attr);
+
+// 역변환 (스킨 캐시 readback / 검증용)
+void VertexJoinStreams(const VertexStreamPos_PNTT* pos, const VertexStreamAttr* attr,
+    size_t count, VertexPacked_PNTT* dst);
+void VertexJoinStreams(const VertexStreamPos_PNTT_BW* pos, const VertexStreamAttr* attr,
+    size_t count, VertexPacked_PNTT_BW* dst);
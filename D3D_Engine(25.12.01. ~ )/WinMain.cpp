@@ -1,8 +1,27 @@
 ﻿#include "TutorialApp/TutorialApp.h"
+#include "AssetCookTool.h"
+
+#include <shellapi.h>
 
 int APIENTRY wWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance,
 	_In_ LPWSTR    lpCmdLine, _In_ int       nCmdShow)
 {
+	// 오프라인 쿠킹: --cook <dir> [--verify] → 창 없이 FBX 를 쿠킹하고 종료 (AssetCookTool.h)
+	int argc = 0;
+	LPWSTR* argv = CommandLineToArgvW(GetCommandLineW(), &argc);
+	if (argv && argc >= 2 && wcscmp(argv[1], L"--cook") == 0)
+	{
+		if (!AttachConsole(ATTACH_PARENT_PROCESS)) AllocConsole();
+
+		FILE* fp;
+		freopen_s(&fp, "CONOUT$", "w", stdout);
+		freopen_s(&fp, "CONOUT$", "w", stderr);
+
+		const std::vector<std::wstring> args(argv + 1, argv + argc);
+		LocalFree(argv);
+		return AssetCookMain(args);
+	}
+	if (argv) LocalFree(argv);
 
 #ifdef _DEBUG
 	AllocConsole(); // 콘솔 창 생성
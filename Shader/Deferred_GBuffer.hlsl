@@ -1,3 +1,5 @@
+#include "VertexPack.hlsli"
+
 // ============================================================================
 // Frame / Camera / Light CBs
 // ============================================================================
@@ -79,9 +81,9 @@ SamplerState s0 : register(s0);
 struct VS_IN
 {
     float3 Pos : POSITION;
-    float3 Nor : NORMAL;
+    float2 Nor : NORMAL;       // 옥타헤드럴 (VertexPack.hlsli)
     float2 UV : TEXCOORD0;
-    float4 Tan : TANGENT;
+    uint2  Tan : TANGENT;      // 압축 탄젠트
 };
 
 struct VS_OUT
@@ -114,17 +116,18 @@ VS_OUT VS_Main(VS_IN i)
     float4 wpos = mul(float4(i.Pos, 1), World);
     o.PosH = mul(mul(wpos, View), Projection);
     o.WorldPos = wpos.xyz;
-    o.TanSign = i.Tan.w;
+    const float4 tng = DecodeTangent(i.Tan);
+    o.TanSign = tng.w;
 
-    float3 Nw = normalize(mul(float4(i.Nor, 0), WorldInvTranspose).xyz);
+    float3 Nw = normalize(mul(float4(OctDecode(i.Nor), 0), WorldInvTranspose).xyz);
 
-    float3 Tw = mul(float4(i.Tan.xyz, 0), World).xyz;
+    float3 Tw = mul(float4(tng.xyz, 0), World).xyz;
     Tw = normalize(Tw);
 
     Tw = Tw - Nw * dot(Tw, Nw);
     Tw = normalize(Tw);
 
-    float3 Bw = normalize(cross(Nw, Tw) * i.Tan.w);
+    float3 Bw = normalize(cross(Nw, Tw) * tng.w);
 
     o.Nw = Nw;
     o.Tw = Tw;
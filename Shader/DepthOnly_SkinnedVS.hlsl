@@ -3,10 +3,8 @@
 
 struct VS_IN
 {
-    float3 Pos : POSITION;
-    float3 Norm : NORMAL;
+    float3 Pos : POSITION;     // 위치 스트림만 (노멀/탄젠트 스트림은 바인딩하지 않음)
     float2 Tex : TEXCOORD0;
-    float4 Tang : TANGENT;
     uint4 BlendIndices : BLENDINDICES;
     float4 BlendWeight : BLENDWEIGHT;
 };
@@ -20,17 +18,13 @@ struct VS_OUT
 
 VS_OUT main(VS_IN i)
 {
-    // 스키닝(4본 가정. 너의 Shared.hlsli에 BonePalette[b4]가 있을 것)
+    // 스키닝(4본 가정. 팔레트는 Shared.hlsli 의 BoneRows[t11] / BoneBase[b4])
     uint4 bi = i.BlendIndices;
     float4 bw = i.BlendWeight;
 
-    float4x4 B =
-          bw.x * BonePalette[bi.x]
-        + bw.y * BonePalette[bi.y]
-        + bw.z * BonePalette[bi.z]
-        + bw.w * BonePalette[bi.w];
+    float3x4 B = SkinMatrix(bi, bw);
 
-    float4 P = mul(float4(i.Pos, 1), B);
+    float4 P = float4(mul(B, float4(i.Pos, 1)), 1);
     float4 Pw = mul(P, World);
 
     VS_OUT o;
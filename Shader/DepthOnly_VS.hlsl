@@ -1,13 +1,11 @@
 #include "Shared.hlsli"
 
 // 네가 쓰는 정점 포맷의 "시맨틱"만 맞으면 이름은 달라도 됨.
-// (PNTT: POSITION/NORMAL/TEXCOORD0/TANGENT)
+// (위치 스트림만: POSITION/TEXCOORD0, 노멀/탄젠트 스트림은 바인딩하지 않음)
 struct VS_IN
 {
     float3 Pos : POSITION;
-    float3 Norm : NORMAL;
     float2 Tex : TEXCOORD0;
-    float4 Tang : TANGENT;
 };
 
 struct VS_OUT
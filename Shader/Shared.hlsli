@@ -1,6 +1,8 @@
 #ifndef SHARED_HLSLI_INCLUDED
 #define SHARED_HLSLI_INCLUDED
 
+#include "VertexPack.hlsli"
+
 // ============================================================================
 // Material (b5)
 // ============================================================================
@@ -120,9 +122,9 @@ SamplerState samClampLinear : register(s3);
 struct VS_INPUT
 {
     float3 Pos : POSITION;
-    float3 Norm : NORMAL;
+    float2 Norm : NORMAL;      // 옥타헤드럴 → OctDecode
     float2 Tex : TEXCOORD0;
-    float4 Tang : TANGENT;
+    uint2  Tang : TANGENT;     // 압축 탄젠트 → DecodeTangent
 
 #if defined(SKINNED)
     uint4  BlendIndices : BLENDINDICES;
@@ -212,15 +214,23 @@ float SampleShadow_PCF(float3 worldPos, float3 Nw)
 }
 
 // ============================================================================
-// Skinning Bone Palette (b4)
+// Skinning Bone Palette (t11 + b4)
+//  - 팔레트 형식/블렌딩은 Skinning.hlsli (SKIN_DQ 정의 시 듀얼 쿼터니언 변형)
+//  - 인스턴스마다 링 버퍼 안의 시작 위치(BoneBase)만 b4 로 받는다
 // ============================================================================
 
-static const uint kMaxBones = 256;
-
 #if defined(SKINNED)
+#include "Skinning.hlsli"
+
 cbuffer Bones : register(b4)
 {
-    float4x4 BonePalette[kMaxBones];
+    uint  BoneBase;
+    uint3 _bonePad;
+}
+
+float3x4 SkinMatrix(uint4 bi, float4 bw)
+{
+    return SkinMatrixAt(BoneBase, bi, bw);
 }
 #endif
 
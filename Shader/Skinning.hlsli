@@ -0,0 +1,67 @@
+#ifndef SKINNING_HLSLI_INCLUDED
+#define SKINNING_HLSLI_INCLUDED
+
+// ============================================================================
+// Skinning palette (t11) : VS(Shared.hlsli) / 스킨 캐시 CS 공용
+//  - 기본(LBS)  : 본당 3행 (스키닝 행렬 M 의 열 0~2 = 전치 팔레트의 앞 3행)
+//  - SKIN_DQ    : 본당 2행 (real, dual 쿼터니언) → 블렌딩 후 3x4 로 바꿔 같은 식으로 사용
+//  - 식은 Animation/SkinningCPU.cpp, Animation/AnimDualQuat.cpp 와 같게 유지할 것
+// ============================================================================
+
+Buffer<float4> BoneRows : register(t11);
+
+#if defined(SKIN_DQ)
+static const uint kBoneRows = 2;
+
+// 정규화된 듀얼 쿼터니언 → [R | t]
+float3x4 DualQuatToMatrix(float4 r, float4 d)
+{
+    const float3 t = 2.0f * (r.w * d.xyz - d.w * r.xyz + cross(r.xyz, d.xyz));
+    const float x = r.x, y = r.y, z = r.z, w = r.w;
+    return float3x4(
+        1.0f - 2.0f * (y * y + z * z), 2.0f * (x * y - w * z), 2.0f * (x * z + w * y), t.x,
+        2.0f * (x * y + w * z), 1.0f - 2.0f * (x * x + z * z), 2.0f * (y * z - w * x), t.y,
+        2.0f * (x * z - w * y), 2.0f * (y * z + w * x), 1.0f - 2.0f * (x * x + y * y), t.z);
+}
+
+// 4본 블렌딩: 첫 번째로 기여한 본과 같은 반구로 부호 맞춤 → 가중 합 → |real| 로 정규화
+float3x4 SkinMatrixAt(uint base, uint4 bi, float4 bw)
+{
+    float4 pivot = 0;
+    bool hasPivot = false;
+    float4 r = 0, d = 0;
+    [unroll]
+    for (int k = 0; k < 4; ++k)
+    {
+        if (bw[k] == 0.0f)
+            continue;
+        const uint o = base + bi[k] * kBoneRows;
+        const float4 qr = BoneRows.Load(o);
+        if (!hasPivot) { pivot = qr; hasPivot = true; }
+        const float w = (dot(pivot, qr) < 0.0f) ? -bw[k] : bw[k];
+        r += w * qr;
+        d += w * BoneRows.Load(o + 1);
+    }
+    const float len = length(r);
+    if (len <= 0.0f)
+        return float3x4(1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0);
+    return DualQuatToMatrix(r / len, d / len);
+}
+#else
+static const uint kBoneRows = 3;
+
+// 4본 가중 합 (float3x4: mul(S, float4(p,1)) = 스키닝된 위치, (float3x3)S = 회전/스케일)
+float3x4 SkinMatrixAt(uint base, uint4 bi, float4 bw)
+{
+    float3x4 S = 0;
+    [unroll]
+    for (int k = 0; k < 4; ++k)
+    {
+        const uint o = base + bi[k] * kBoneRows;
+        S += bw[k] * float3x4(BoneRows.Load(o), BoneRows.Load(o + 1), BoneRows.Load(o + 2));
+    }
+    return S;
+}
+#endif
+
+#endif // SKINNING_HLSLI_INCLUDED
@@ -0,0 +1,67 @@
+// Skin-once 캐시: 분리 스트림 스키닝 정점 → 분리 스트림 정점 (MeshDataEx.h VertexStream*)
+//  - 입력 t0 위치+UV+본(24B) / t1 노멀+탄젠트(8B), 출력 u0 위치+UV(16B) / u1 노멀+탄젠트(8B)
+//  - 프레임당 인스턴스 파트마다 한 번 → 그림자/큐브 그림자/불투명/컷아웃/투명 패스는 정적 메시처럼 읽는다
+//  - 팔레트 블렌딩은 Skinning.hlsli (SKIN_DQ 로 컴파일하면 듀얼 쿼터니언 변형)
+//  - 식은 Animation/SkinningCPU.cpp (CPU 레퍼런스)와 같게 유지할 것
+
+#include "Skinning.hlsli"
+#include "VertexPack.hlsli"
+
+ByteAddressBuffer   SrcPos  : register(t0);   // VertexStreamPos_PNTT_BW (24B)
+ByteAddressBuffer   SrcAttr : register(t1);   // VertexStreamAttr (8B)
+RWByteAddressBuffer DstPos  : register(u0);   // VertexStreamPos_PNTT (16B)
+RWByteAddressBuffer DstAttr : register(u1);   // VertexStreamAttr (8B)
+
+cbuffer SkinCS : register(b0)
+{
+    uint BoneBase;
+    uint BoneCount;
+    uint VertexCount;
+    uint _pad;
+}
+
+static const uint kSrcPosStride = 24;
+static const uint kDstPosStride = 16;
+static const uint kAttrStride = 8;
+
+float3 SafeNormalize(float3 v)
+{
+    const float l2 = dot(v, v);
+    return (l2 > 0.0f) ? v * rsqrt(l2) : v;
+}
+
+[numthreads(64, 1, 1)]
+void main(uint3 id : SV_DispatchThreadID)
+{
+    const uint i = id.x;
+    if (i >= VertexCount)
+        return;
+
+    const uint s = i * kSrcPosStride;
+    const uint4  pu = SrcPos.Load4(s);                  // pos xyz / uv(half2) 워드
+    const float3 p  = asfloat(pu.xyz);
+    const uint2  bb = SrcPos.Load2(s + 16);             // bone index u8x4 / weight unorm8x4
+    const uint2  nt = SrcAttr.Load2(i * kAttrStride);   // normal / tangent 워드
+    const float3 n  = UnpackNormalWord(nt.x);
+    const float4 t  = UnpackTangentWord(nt.y);
+    const uint   bi = bb.x;
+    const float4 bw = float4(bb.y & 0xFF, (bb.y >> 8) & 0xFF, (bb.y >> 16) & 0xFF, bb.y >> 24) / 255.0f;
+
+    // 4본 (범위 밖 본은 가중치 0 + 0번 본으로 → 무시)
+    uint4 b = uint4(bi & 0xFF, (bi >> 8) & 0xFF, (bi >> 16) & 0xFF, bi >> 24);
+    float4 w = bw;
+    [unroll]
+    for (uint k = 0; k < 4; ++k)
+    {
+        if (b[k] >= BoneCount) { b[k] = 0; w[k] = 0.0f; }
+    }
+    const float3x4 S = SkinMatrixAt(BoneBase, b, w);
+
+    const float3 P = mul(S, float4(p, 1.0f));
+    const float3 N = SafeNormalize(mul((float3x3)S, n));
+    const float3 T = SafeNormalize(mul((float3x3)S, t.xyz));
+
+    // uv 는 건드리지 않으므로 half2 워드 그대로 복사
+    DstPos.Store4(i * kDstPosStride, uint4(asuint(P), pu.w));
+    DstAttr.Store2(i * kAttrStride, uint2(PackNormalWord(N), PackTangentWord(T, t.w)));
+}
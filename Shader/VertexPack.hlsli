@@ -0,0 +1,66 @@
+#ifndef VERTEXPACK_HLSLI_INCLUDED
+#define VERTEXPACK_HLSLI_INCLUDED
+
+// ============================================================================
+// 압축 정점 (VertexPacked_PNTT 24B / VertexPacked_PNTT_BW 32B, MeshDataEx.h)
+//  - NORMAL  : R16G16_SNORM  옥타헤드럴          → float2
+//  - TANGENT : R16G16_UINT   x UNORM16, y UNORM15 + bit15 handedness → uint2
+//  - TEXCOORD: R16G16_FLOAT  (하드웨어가 float2 로 변환)
+//  - BLENDWEIGHT: R8G8B8A8_UNORM (합 255 → 그대로 정규화된 가중치)
+//  - 식은 VertexPack.cpp 와 같게 유지할 것
+// ============================================================================
+
+float3 OctDecode(float2 e)
+{
+    float3 n = float3(e, 1.0f - abs(e.x) - abs(e.y));
+    const float t = saturate(-n.z);
+    n.xy += (n.xy >= 0.0f) ? -t : t;
+    return normalize(n);
+}
+
+float2 OctEncode(float3 n)
+{
+    const float l1 = abs(n.x) + abs(n.y) + abs(n.z);
+    if (l1 <= 0.0f)
+        return 0.0f;
+    float2 e = n.xy / l1;
+    if (n.z < 0.0f)
+        e = (1.0f - abs(e.yx)) * ((e >= 0.0f) ? 1.0f : -1.0f);
+    return e;
+}
+
+// 압축 탄젠트 → (xyz, handedness)
+float4 DecodeTangent(uint2 q)
+{
+    const float2 e = float2(q.x / 65535.0f, (q.y & 0x7FFF) / 32767.0f) * 2.0f - 1.0f;
+    return float4(OctDecode(e), (q.y & 0x8000) ? -1.0f : 1.0f);
+}
+
+// --- raw 버퍼(스킨 캐시 CS)용: 32-bit 워드 단위 ---
+
+float3 UnpackNormalWord(uint w)
+{
+    const int2 q = int2((int)(w << 16) >> 16, (int)w >> 16);
+    return OctDecode(max(float2(q) / 32767.0f, -1.0f));
+}
+
+uint PackNormalWord(float3 n)
+{
+    const int2 q = (int2)round(clamp(OctEncode(n), -1.0f, 1.0f) * 32767.0f);
+    return (uint(q.x) & 0xFFFF) | (uint(q.y) << 16);
+}
+
+float4 UnpackTangentWord(uint w)
+{
+    return DecodeTangent(uint2(w & 0xFFFF, w >> 16));
+}
+
+uint PackTangentWord(float3 t, float sign)
+{
+    const float2 e = saturate(OctEncode(t) * 0.5f + 0.5f);
+    const uint x = (uint)round(e.x * 65535.0f);
+    const uint y = (uint)round(e.y * 32767.0f) | ((sign < 0.0f) ? 0x8000 : 0);
+    return x | (y << 16);
+}
+
+#endif // VERTEXPACK_HLSLI_INCLUDED
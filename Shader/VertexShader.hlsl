@@ -12,9 +12,10 @@ PS_INPUT main(VS_INPUT input)
     
     //===========================================
     
-    output.NormalW = normalize(mul(float4(input.Norm, 0.0f), WorldInvTranspose).xyz);
-    float sign = input.Tang.w; // w값(좌수 / 우수)임    
-    output.TangentW = float4(normalize(mul(input.Tang.xyz, (float3x3) World)), sign);    
+    const float4 tang = DecodeTangent(input.Tang); // 압축 정점 (VertexPack.hlsli)
+    output.NormalW = normalize(mul(float4(OctDecode(input.Norm), 0.0f), WorldInvTranspose).xyz);
+    float sign = tang.w; // w값(좌수 / 우수)임    
+    output.TangentW = float4(normalize(mul(tang.xyz, (float3x3) World)), sign);    
     
     output.Tex = input.Tex; // 이건 그냥 그대로 넘겨줌 여기서 쓰는거 아님
 
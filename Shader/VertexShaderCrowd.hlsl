@@ -0,0 +1,69 @@
+// 베이크 군중 VS: 인스턴스마다 (프레임 A/B 행, 보간 계수) → 베이크 표(t11)에서 두 프레임 팔레트를 읽어 섞는다
+//  - 표 레이아웃은 Animation/AnimBake.h (프레임마다 본 팔레트 3행 x 본 수 + 파트 노드 글로벌 3행 x 노드 수)
+//  - 포즈 평가 / 팔레트 업로드 없음. 월드는 인스턴스 레코드(BakedCrowd::Instance, 64B)
+//  - 출력은 PS_INPUT 그대로 → 메시 PS 재사용
+
+#include "Shared.hlsli"
+#include "Skinning.hlsli"
+
+cbuffer CrowdPart : register(b4)
+{
+    uint PartRow;       // 프레임 시작 기준 파트 노드 글로벌 행 ((본 수 + 파트) * 3)
+    uint3 _crowdPad;
+}
+
+struct VS_CROWD
+{
+    float3 Pos : POSITION;
+    float2 Norm : NORMAL;
+    float2 Tex : TEXCOORD0;
+    uint2  Tang : TANGENT;
+    uint4  BlendIndices : BLENDINDICES;
+    float4 BlendWeights : BLENDWEIGHT;
+
+    // 슬롯 2 (per-instance, 0/1 은 메시 분리 스트림)
+    float4 W0 : INSTWORLD0;
+    float4 W1 : INSTWORLD1;
+    float4 W2 : INSTWORLD2;
+    uint2  Rows : INSTFRAME;    // 프레임 A / B 시작 행
+    float  Blend : INSTBLEND;
+};
+
+float3x4 LoadRows(uint o)
+{
+    return float3x4(BoneRows.Load(o), BoneRows.Load(o + 1), BoneRows.Load(o + 2));
+}
+
+PS_INPUT main(VS_CROWD i)
+{
+    const float u = i.Blend;
+
+    // 스키닝 행렬은 팔레트에 선형 → 두 프레임 각각 블렌딩 후 섞어도 팔레트를 먼저 섞은 것과 같다
+    const float3x4 S = SkinMatrixAt(i.Rows.x, i.BlendIndices, i.BlendWeights) * (1.0f - u)
+                     + SkinMatrixAt(i.Rows.y, i.BlendIndices, i.BlendWeights) * u;
+    const float3x4 P = LoadRows(i.Rows.x + PartRow) * (1.0f - u) + LoadRows(i.Rows.y + PartRow) * u;
+    const float3x4 W = float3x4(i.W0, i.W1, i.W2);
+
+    // 스킨 → 파트 노드 글로벌 → 인스턴스 월드 (모두 열벡터 형태)
+    const float3 Pm = mul(S, float4(i.Pos, 1.0f));
+    const float3 Pn = mul(P, float4(Pm, 1.0f));
+    const float4 Pw = float4(mul(W, float4(Pn, 1.0f)), 1.0f);
+
+    const float4 tang = DecodeTangent(i.Tang);
+    const float3x3 S3 = (float3x3)S;
+    const float3x3 P3 = (float3x3)P;
+    const float3x3 W3 = (float3x3)W;
+    const float3 Nw = normalize(mul(W3, mul(P3, mul(S3, OctDecode(i.Norm)))));
+    const float3 Tw = normalize(mul(W3, mul(P3, mul(S3, tang.xyz))));
+
+    float4 Pv = mul(Pw, View);
+    float4 Pc = mul(Pv, Projection);
+
+    PS_INPUT o;
+    o.PosH = Pc;
+    o.WorldPos = Pw.xyz;
+    o.Tex = i.Tex;
+    o.TangentW = float4(Tw, tang.w);
+    o.NormalW = Nw;
+    return o;
+}
@@ -0,0 +1,231 @@
+﻿// ============================================================================
+// AnimBakeTest.cpp
+// - AnimBake: 베이크한 행 == 그 프레임 시각의 Evaluate + BuildPalette (팔레트 3행 + 노드 글로벌 3행)
+// - AnimBakedSet::Locate: loop 감싸기 / t == 길이 / 음수 t / 비 loop 끝 고정
+// - 캐시: 같은 입력이면 해시 같음 → Save/Load 적중, fps / 키 / 노드가 바뀌면 해시가 달라 Load 거부
+//   잘린 파일 / 클립 배치가 어긋난 파일은 거부
+// ============================================================================
+
+// ---- includes ----
+#include "TestCommon.h"
+#include "TestRig.h"
+#include "../D3D_Engine(25.12.01. ~ )/Animation/AnimBake.h"
+#include "../D3D_Engine(25.12.01. ~ )/Animation/AnimatedInstance.h"
+
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    std::string ReadBytes(const fs::path& p)
+    {
+        std::ifstream f(p, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+    }
+
+    void WriteBytes(const fs::path& p, const std::string& s)
+    {
+        std::ofstream(p, std::ios::binary).write(s.data(), std::streamsize(s.size()));
+    }
+
+    // 프레임 f 의 행 vs 그 시각 평가 결과 (같은 식이라 비트 단위로 같아야 함)
+    bool FrameMatches(const AnimBakedSet& set, uint32_t clip, uint32_t f, AnimatedInstance& inst)
+    {
+        const AnimBakeClipInfo& info = set.clips[clip];
+        const double t = (double)f / set.fps;
+        inst.SetClip((int)clip);
+        inst.Evaluate(t < info.durationSec ? t : info.durationSec, /*loop*/false);
+        inst.BuildPalette();
+
+        const float* row = set.rows.data() + (size_t)(info.firstFrame + f) * set.RowsPerFrame() * 4;
+        for (const auto& m : inst.Palette()) {
+            if (memcmp(row, &m, sizeof(float) * 12) != 0) return false;
+            row += 12;
+        }
+        for (int n : set.nodes) {
+            const DirectX::SimpleMath::Matrix g = inst.Global(n).Transpose();
+            if (memcmp(row, &g, sizeof(float) * 12) != 0) return false;
+            row += 12;
+        }
+        return true;
+    }
+}
+
+int main()
+{
+    const fs::path dir = fs::temp_directory_path() / "AnimBakeTest";
+    std::error_code ec;
+    fs::create_directories(dir, ec);
+
+    auto sk = MakeTestSkeleton(16, 5);
+    auto lib = std::make_shared<AnimClipLibrary>();
+    lib->Add(MakeTestClip(*sk, 10, 6));     // 9 tick = 0.3 s
+    lib->Add(MakeTestClip(*sk, 7, 7));      // 6 tick = 0.2 s
+    const std::vector<int> nodes = { 3, 9 };
+    const float fps = 60.0f;
+
+    AnimBakedSet set;
+    AnimBake(sk, lib, fps, nodes, set);
+
+    // ------------------------------------------------------------------------
+    // 배치 + 행 == Evaluate / BuildPalette
+    // ------------------------------------------------------------------------
+    CHECK(set.clips.size() == 2);
+    CHECK(set.boneCount == sk->BoneCount());
+    CHECK(set.RowsPerFrame() == (uint32_t)(sk->BoneCount() + nodes.size()) * 3);
+    CHECK(set.clips[1].firstFrame == set.clips[0].frameCount);
+    CHECK(set.FrameCount() == set.clips[0].frameCount + set.clips[1].frameCount);
+    for (uint32_t c = 0; c < 2; ++c) {
+        const AnimBakeClipInfo& info = set.clips[c];
+        CHECK(info.frameCount == (uint32_t)std::floor(info.durationSec * set.fps) + 1);
+        CHECK(info.maxError >= info.avgError && info.avgError >= 0.0f);
+    }
+
+    {
+        AnimatedInstance inst;
+        inst.Init(sk, lib);
+        bool all = true;
+        for (uint32_t c = 0; c < 2; ++c)
+            for (uint32_t f = 0; f < set.clips[c].frameCount; ++f) all = FrameMatches(set, c, f, inst) && all;
+        CHECK(all);
+    }
+
+    // ------------------------------------------------------------------------
+    // Locate
+    // ------------------------------------------------------------------------
+    {
+        const AnimBakeClipInfo& info = set.clips[1];
+        const uint32_t rpf = set.RowsPerFrame();
+        const double dur = info.durationSec;
+        const double step = 1.0 / set.fps;
+        uint32_t a = 0, b = 0;
+        float u = -1.0f;
+
+        set.Locate(1, 2.25 * step, true, a, b, u);
+        CHECK(a == (info.firstFrame + 2) * rpf && b == (info.firstFrame + 3) * rpf);
+        CHECK_NEAR(u, 0.25, 1e-4);
+
+        // loop: 길이를 넘으면 감싸서 같은 위치
+        uint32_t a2 = 0, b2 = 0;
+        float u2 = -1.0f;
+        set.Locate(1, dur * 3 + 2.25 * step, true, a2, b2, u2);
+        CHECK(a2 == a && b2 == b);
+        CHECK_NEAR(u2, u, 1e-3);
+
+        // loop 에서 t == 길이 → 처음
+        set.Locate(1, dur, true, a, b, u);
+        CHECK(a == info.firstFrame * rpf && b == (info.firstFrame + 1) * rpf);
+        CHECK_NEAR(u, 0.0, 1e-4);
+
+        // 비 loop 에서 t == 길이 / 넘어감 → 마지막 프레임 고정 (다음 클립 행을 읽지 않음)
+        const uint32_t last = (info.firstFrame + info.frameCount - 1) * rpf;
+        set.Locate(1, dur, false, a, b, u);
+        CHECK(a == last && b == last && u == 0.0f);
+        set.Locate(1, dur + 1.0, false, a, b, u);
+        CHECK(a == last && b == last && u == 0.0f);
+
+        // 음수: loop 면 끝에서부터, 아니면 첫 프레임
+        set.Locate(1, -0.25 * step, true, a, b, u);
+        set.Locate(1, dur - 0.25 * step, true, a2, b2, u2);
+        CHECK(a == a2 && b == b2);
+        CHECK_NEAR(u, u2, 1e-3);
+        CHECK(a >= info.firstFrame * rpf && b <= last);
+        set.Locate(1, -0.5, false, a, b, u);
+        CHECK(a == info.firstFrame * rpf && u == 0.0f);
+
+        // 첫 클립 범위도 다른 클립 행을 넘지 않음
+        set.Locate(0, 1e6, false, a, b, u);
+        CHECK(b < set.clips[1].firstFrame * rpf);
+    }
+
+    // ------------------------------------------------------------------------
+    // 캐시: 해시 적중 / 불일치
+    // ------------------------------------------------------------------------
+    const fs::path file = dir / "crowd.animbake";
+    CHECK(AnimBakeSave(set, file));
+    {
+        const uint64_t hash = AnimBakeSourceHash(*sk, *lib, fps, nodes);
+        CHECK(hash == set.sourceHash);
+
+        AnimBakedSet loaded;
+        CHECK(AnimBakeLoad(loaded, file, hash));
+        CHECK(loaded.rows == set.rows);
+        CHECK(loaded.nodes == set.nodes);
+        CHECK(loaded.clips.size() == set.clips.size() && loaded.clips[1].name == set.clips[1].name);
+        CHECK(loaded.fps == set.fps && loaded.boneCount == set.boneCount);
+
+        // fps 가 바뀜
+        const uint64_t hashFps = AnimBakeSourceHash(*sk, *lib, 30.0f, nodes);
+        CHECK(hashFps != hash);
+        CHECK(!AnimBakeLoad(loaded, file, hashFps));
+
+        // 키 하나가 바뀜
+        auto changed = std::make_shared<AnimationClipAsset>(lib->Get(0));
+        changed->channels[4].T[2].v.x += 1e-3f;
+        AnimClipLibrary lib2;
+        lib2.Add(changed);
+        lib2.Add(lib->clips[1]);
+        const uint64_t hashKey = AnimBakeSourceHash(*sk, lib2, fps, nodes);
+        CHECK(hashKey != hash);
+        CHECK(!AnimBakeLoad(loaded, file, hashKey));
+
+        // 노드 목록이 바뀜
+        CHECK(AnimBakeSourceHash(*sk, *lib, fps, { 3 }) != hash);
+
+        // 실패한 Load 는 이전 내용을 건드리지 않음
+        CHECK(loaded.rows == set.rows);
+    }
+
+    // ------------------------------------------------------------------------
+    // 잘린 / 어긋난 파일
+    // ------------------------------------------------------------------------
+    {
+        const std::string bytes = ReadBytes(file);
+        const fs::path bad = dir / "bad.animbake";
+        int accepted = 0;
+        for (size_t cut = 0; cut < bytes.size(); cut += (cut < 256 ? 1 : 997)) {
+            WriteBytes(bad, bytes.substr(0, cut));
+            AnimBakedSet s;
+            if (AnimBakeLoad(s, bad, set.sourceHash)) ++accepted;
+        }
+        WriteBytes(bad, bytes.substr(0, bytes.size() - 1));
+        AnimBakedSet s;
+        if (AnimBakeLoad(s, bad, set.sourceHash)) ++accepted;
+        CHECK(accepted == 0);
+
+        // 두 번째 클립의 firstFrame 을 한 칸 밀기 (헤더 24B + 노드 + 클립 수 + 첫 클립)
+        size_t off = 24 + 4 + nodes.size() * 4 + 4;
+        off += 4 + set.clips[0].name.size() + 5 * 4;
+        off += 4 + set.clips[1].name.size();
+        std::string shifted = bytes;
+        uint32_t first = 0;
+        memcpy(&first, &shifted[off], 4);
+        CHECK(first == set.clips[1].firstFrame);
+        ++first;
+        memcpy(&shifted[off], &first, 4);
+        WriteBytes(bad, shifted);
+        CHECK(!AnimBakeLoad(s, bad, set.sourceHash));
+
+        // 행 수 변조
+        std::string rows = bytes;
+        const size_t countOff = off + 5 * 4;
+        uint64_t count = 0;
+        memcpy(&count, &rows[countOff], 8);
+        CHECK(count == set.rows.size());
+        count -= 4;
+        memcpy(&rows[countOff], &count, 8);
+        WriteBytes(bad, rows);
+        CHECK(!AnimBakeLoad(s, bad, set.sourceHash));
+    }
+
+    fs::remove_all(dir, ec);
+    return TestResult("AnimBakeTest");
+}
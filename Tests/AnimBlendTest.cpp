@@ -0,0 +1,271 @@
+﻿// ============================================================================
+// AnimBlendTest.cpp
+// - AnimatedInstance::EvaluateLayers (AnimBlend.h)
+//   · 일반 레이어: 가중치 정규화 + 채널 없는 레이어 몫은 바인드 포즈
+//     (부분 클립 == 나머지 노드를 바인드 포즈 상수 키로 채운 클립)
+//   · 가산 레이어: 기준 포즈(additiveRef) 대비 차이만 더함 (같은 축 회전 → 각도 합으로 확인)
+//   · 크로스페이드 양 끝 == 단일 클립 Evaluate
+//   · 마스크: 가중치 0 노드는 바인드 포즈 (Evaluate 직후 첫 블렌딩 포함), 짧은 마스크는 모자란 노드 1
+// ============================================================================
+
+// ---- includes ----
+#include "TestCommon.h"
+#include "TestRig.h"
+#include "../D3D_Engine(25.12.01. ~ )/Animation/AnimatedInstance.h"
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace DirectX::SimpleMath;
+
+static float MaxDiff(const Matrix& a, const Matrix& b)
+{
+    float d = 0.0f;
+    for (int r = 0; r < 4; ++r)
+        for (int c = 0; c < 4; ++c) d = std::fmax(d, std::fabs(a.m[r][c] - b.m[r][c]));
+    return d;
+}
+
+static float MaxDiff(const std::vector<Matrix>& a, const std::vector<Matrix>& b)
+{
+    float d = 0.0f;
+    for (size_t i = 0; i < a.size(); ++i) d = std::fmax(d, MaxDiff(a[i], b[i]));
+    return d;
+}
+
+// 노드 이름 → 채널 목록으로 클립 마무리 (키는 tick 0 / 1, 30 tps)
+static void FinishClip(AnimationClipAsset& clip, const SkeletonAsset& sk)
+{
+    clip.tps = 30.0;
+    for (size_t c = 0; c < clip.channels.size(); ++c) clip.map[clip.channels[c].target] = int(c);
+    clip.bindings = AnimBindChannels(clip, sk.names);
+}
+
+static void AddChannel(AnimationClipAsset& clip, const std::string& target,
+    const Vector3& t0, const Quaternion& r0, const Vector3& t1, const Quaternion& r1)
+{
+    AnimChannel ch;
+    ch.target = target;
+    ch.T = { { 0.0, t0 }, { clip.duration, t1 } };
+    ch.R = { { 0.0, r0 }, { clip.duration, r1 } };
+    ch.S = { { 0.0, Vector3::One }, { clip.duration, Vector3::One } };
+    clip.channels.push_back(std::move(ch));
+}
+
+int main()
+{
+    const size_t N = 12;
+    auto sk = MakeTestSkeleton(N, 3);
+
+    // ------------------------------------------------------------------------
+    // 라이브러리: A / E 전체 노드, C 짝수 노드만, D = C + 홀수 노드 바인드 포즈 상수 키
+    //            B 상수 기준 포즈, X 가산 (B 와 같은 축 회전)
+    // ------------------------------------------------------------------------
+    auto A = MakeTestClip(*sk, 6, 10);
+    auto E = MakeTestClip(*sk, 6, 12);
+    auto full = MakeTestClip(*sk, 6, 11);
+
+    auto C = std::make_shared<AnimationClipAsset>();
+    auto D = std::make_shared<AnimationClipAsset>();
+    C->name = "partial"; D->name = "partialFilled";
+    C->duration = D->duration = full->duration;
+    for (size_t n = 0; n < N; ++n) {
+        if (n % 2 == 0) {
+            C->channels.push_back(full->channels[n]);
+            D->channels.push_back(full->channels[n]);
+        }
+        else {
+            AddChannel(*D, sk->names[n], sk->bindT[n], sk->bindR[n], sk->bindT[n], sk->bindR[n]);
+            D->channels.back().S = { { 0.0, sk->bindS[n] }, { D->duration, sk->bindS[n] } };
+        }
+    }
+    FinishClip(*C, *sk);
+    FinishClip(*D, *sk);
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> u(-1.0f, 1.0f);
+    std::vector<Vector3> axis(N), Tb(N), T0(N), T1(N);
+    std::vector<float> beta(N), a0(N), a1(N);
+    auto B = std::make_shared<AnimationClipAsset>();
+    auto X = std::make_shared<AnimationClipAsset>();
+    B->name = "base"; X->name = "additive";
+    B->duration = X->duration = 1.0;
+    for (size_t n = 0; n < N; ++n) {
+        axis[n] = Vector3(u(rng), u(rng), u(rng));
+        if (axis[n].LengthSquared() < 1e-4f) axis[n] = Vector3::UnitY;
+        axis[n].Normalize();
+        Tb[n] = Vector3(u(rng), u(rng), u(rng));
+        T0[n] = Vector3(u(rng), u(rng), u(rng));
+        T1[n] = Vector3(u(rng), u(rng), u(rng));
+        beta[n] = u(rng); a0[n] = 0.5f * u(rng); a1[n] = 0.5f * u(rng);
+        const Quaternion rb = Quaternion::CreateFromAxisAngle(axis[n], beta[n]);
+        AddChannel(*B, sk->names[n], Tb[n], rb, Tb[n], rb);
+        AddChannel(*X, sk->names[n], T0[n], Quaternion::CreateFromAxisAngle(axis[n], a0[n]),
+            T1[n], Quaternion::CreateFromAxisAngle(axis[n], a1[n]));
+    }
+    FinishClip(*B, *sk);
+    FinishClip(*X, *sk);
+    AnimBuildAdditiveRef(*X, *sk);
+
+    auto lib = std::make_shared<AnimClipLibrary>();
+    const int iA = lib->Add(A), iE = lib->Add(E), iC = lib->Add(C), iD = lib->Add(D);
+    const int iB = lib->Add(B), iX = lib->Add(X);
+
+    AnimatedInstance ref;
+    ref.Init(sk, lib);
+    auto Single = [&](int clip, double t, bool loop) {
+        ref.SetClip(clip);
+        ref.Evaluate(t, loop);
+        return ref.PoseLocal();
+        };
+
+    AnimatedInstance inst;
+    inst.Init(sk, lib);
+    auto Blend = [&](std::initializer_list<AnimLayer> layers) {
+        const std::vector<AnimLayer> v(layers);
+        inst.EvaluateLayers(v.data(), v.size());
+        return inst.PoseLocal();
+        };
+    auto Layer = [](int clip, double t, float w) {
+        AnimLayer L;
+        L.clip = clip; L.tSec = t; L.weight = w;
+        return L;
+        };
+
+    // ------------------------------------------------------------------------
+    // 1) 정규화 + 바인드 포즈 채우기
+    // ------------------------------------------------------------------------
+    {
+        const auto ac = Blend({ Layer(iA, 0.07, 1.0f), Layer(iC, 0.05, 1.0f) });
+        const auto ad = Blend({ Layer(iA, 0.07, 1.0f), Layer(iD, 0.05, 1.0f) });
+        CHECK(MaxDiff(ac, ad) < 1e-4f);
+
+        const auto scaled = Blend({ Layer(iA, 0.07, 0.3f), Layer(iC, 0.05, 0.3f) });
+        CHECK(MaxDiff(ac, scaled) < 1e-5f);
+
+        // 부분 클립 하나 (가중치 0.5): 채널 노드는 Evaluate 와 같고 나머지는 바인드 포즈
+        const auto half = Blend({ Layer(iC, 0.05, 0.5f) });
+        const auto c = Single(iC, 0.05, true);
+        for (size_t n = 0; n < N; ++n)
+            CHECK(MaxDiff(half[n], (n % 2 == 0) ? c[n] : sk->bindLocal[n]) < 1e-4f);
+    }
+
+    // ------------------------------------------------------------------------
+    // 2) 가산: 기준 B 위에 X (tick 1 에서 샘플 → 키 1, 기준 포즈는 키 0)
+    // ------------------------------------------------------------------------
+    {
+        const double t1 = 1.0 / 30.0;
+        AnimLayer add = Layer(iX, t1, 1.0f);
+        add.additive = true;
+        add.loop = false;
+        AnimLayer base = Layer(iB, t1, 1.0f);
+        base.loop = false;
+
+        const auto full1 = Blend({ base, add });
+        for (size_t n = 0; n < N; ++n) {
+            const Matrix expect = Matrix::CreateFromQuaternion(
+                Quaternion::CreateFromAxisAngle(axis[n], beta[n] + a1[n] - a0[n]))
+                * Matrix::CreateTranslation(Tb[n] + T1[n] - T0[n]);
+            CHECK(MaxDiff(full1[n], expect) < 1e-4f);
+        }
+
+        // 가중치 0.5: 이동은 차이의 절반
+        add.weight = 0.5f;
+        const auto halfAdd = Blend({ base, add });
+        for (size_t n = 0; n < N; ++n) {
+            const Vector3 t = Tb[n] + (T1[n] - T0[n]) * 0.5f;
+            CHECK_NEAR(halfAdd[n].m[3][0], t.x, 1e-4);
+            CHECK_NEAR(halfAdd[n].m[3][1], t.y, 1e-4);
+            CHECK_NEAR(halfAdd[n].m[3][2], t.z, 1e-4);
+        }
+
+        // t = 0 은 기준 포즈 그 자체 → 차이 없음
+        add.weight = 1.0f; add.tSec = 0.0;
+        CHECK(MaxDiff(Blend({ base, add }), Single(iB, t1, false)) < 1e-4f);
+
+        // 일반 레이어 없이: 바인드 포즈 위에 이동 차이
+        add.tSec = t1;
+        const auto onBind = Blend({ add });
+        for (size_t n = 0; n < N; ++n) {
+            const Vector3 t = sk->bindT[n] + T1[n] - T0[n];
+            CHECK_NEAR(onBind[n].m[3][0], t.x, 1e-4);
+            CHECK_NEAR(onBind[n].m[3][1], t.y, 1e-4);
+            CHECK_NEAR(onBind[n].m[3][2], t.z, 1e-4);
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // 3) 크로스페이드: 시작 == 빠져나가는 클립, 끝 == 현재 클립, 중간 == 0.5 / 0.5
+    // ------------------------------------------------------------------------
+    {
+        const AnimLayer current = Layer(iE, 0.1, 1.0f);
+        AnimLayer out[2];
+
+        AnimCrossfade xf;
+        xf.Begin(iA, 0.05, true, 0.5);
+        CHECK(xf.Active());
+        size_t n = xf.Layers(current, out);
+        CHECK(n == 2);
+        inst.EvaluateLayers(out, n);
+        CHECK(MaxDiff(inst.PoseLocal(), Single(iA, 0.05, true)) < 1e-4f);
+
+        xf.Advance(0.25);
+        n = xf.Layers(current, out);
+        CHECK(n == 2);
+        CHECK_NEAR(out[0].weight, 0.5f, 1e-6);
+        CHECK_NEAR(out[0].tSec, 0.3, 1e-9);
+        inst.EvaluateLayers(out, n);
+        CHECK(MaxDiff(inst.PoseLocal(), Blend({ Layer(iA, 0.3, 0.5f), Layer(iE, 0.1, 0.5f) })) < 1e-6f);
+
+        xf.Advance(0.25);
+        CHECK(!xf.Active());
+        n = xf.Layers(current, out);
+        CHECK(n == 1);
+        inst.EvaluateLayers(out, n);
+        CHECK(MaxDiff(inst.PoseLocal(), Single(iE, 0.1, true)) < 1e-4f);
+
+        AnimCrossfade none;
+        none.Begin(iA, 0.0, true, 0.0);     // 전환 시간 0 → 바로 현재 클립
+        CHECK(!none.Active());
+    }
+
+    // ------------------------------------------------------------------------
+    // 4) 마스크
+    // ------------------------------------------------------------------------
+    {
+        const auto a = Single(iA, 0.1, true);
+
+        // Evaluate 직후 첫 블렌딩: 마스크 0 노드가 Evaluate 포즈로 남지 않아야 함
+        AnimatedInstance m;
+        m.Init(sk, lib);
+        m.SetClip(iA);
+        m.Evaluate(0.1, true);
+        std::vector<float> mask(N, 1.0f);
+        mask[3] = 0.0f;
+        AnimLayer L = Layer(iA, 0.1, 1.0f);
+        L.mask = &mask;
+        m.EvaluateLayers(&L, 1);
+        for (size_t n = 0; n < N; ++n)
+            CHECK(MaxDiff(m.PoseLocal()[n], (n == 3) ? sk->bindLocal[n] : a[n]) < 1e-4f);
+
+        // 마스크 0.5 단독: 정규화되어 그대로
+        mask[3] = 0.5f;
+        m.EvaluateLayers(&L, 1);
+        CHECK(MaxDiff(m.PoseLocal(), a) < 1e-4f);
+
+        // 노드 수보다 짧은 마스크: 모자란 노드는 1
+        const std::vector<float> shortMask(2, 0.0f);
+        L.mask = &shortMask;
+        m.EvaluateLayers(&L, 1);
+        for (size_t n = 0; n < N; ++n)
+            CHECK(MaxDiff(m.PoseLocal()[n], (n < 2) ? sk->bindLocal[n] : a[n]) < 1e-4f);
+
+        // 블렌딩 후 단일 Evaluate: 마스크로 바인드 포즈였던 노드도 다시 클립 포즈
+        m.Evaluate(0.1, true);
+        CHECK(MaxDiff(m.PoseLocal(), a) < 1e-6f);
+    }
+
+    return TestResult("AnimBlendTest");
+}
@@ -0,0 +1,116 @@
+﻿// ============================================================================
+// AnimCompressTest.cpp
+// - 보통 클립: 압축됨, 모델 공간 최대 오차 <= 예산, 키 시각에서 압축 샘플 ≈ 원본 샘플
+// - 16-bit 시간 한계: 키 간격 < duration / 65535 인 긴 클립은 압축하지 않고 원본 키 유지
+//   간격이 딱 한 단계인 클립은 압축되고 양자화 시간이 순증가
+// ============================================================================
+
+// ---- includes ----
+#include "TestCommon.h"
+#include "TestRig.h"
+#include "../D3D_Engine(25.12.01. ~ )/Animation/AnimCompress.h"
+
+#include <random>
+#include <vector>
+
+namespace
+{
+    // 노드 1개 리그에 간격 step tick 의 키 count 개 (값은 무작위 → 키 제거로 줄지 않음)
+    std::shared_ptr<AnimationClipAsset> MakeLongClip(const SkeletonAsset& sk, size_t count, double step)
+    {
+        using namespace DirectX::SimpleMath;
+        std::mt19937 rng(9);
+        std::uniform_real_distribution<float> u(-1.0f, 1.0f);
+
+        auto clip = std::make_shared<AnimationClipAsset>();
+        clip->name = "long";
+        clip->duration = step * double(count - 1);
+        AnimChannel ch;
+        ch.target = sk.names[0];
+        for (size_t i = 0; i < count; ++i)
+            ch.T.push_back({ step * double(i), Vector3(u(rng), u(rng), u(rng)) });
+        clip->channels.push_back(std::move(ch));
+        clip->map[sk.names[0]] = 0;
+        clip->bindings = AnimBindChannels(*clip, sk.names);
+        return clip;
+    }
+
+    bool StrictlyIncreasing(const std::vector<AnimPackedKey>& keys)
+    {
+        for (size_t i = 1; i < keys.size(); ++i)
+            if (keys[i].t <= keys[i - 1].t) return false;
+        return true;
+    }
+}
+
+int main()
+{
+    // ---- 보통 클립 ----
+    {
+        auto sk = MakeTestSkeleton(30, 4, true);
+        auto clip = MakeTestClip(*sk, 41, 8, true);
+        const AnimationClipAsset raw = *clip;
+
+        AnimCompressSettings set;
+        set.keepRaw = true;
+        AnimCompressReport rep;
+        AnimCompressClip(*clip, *sk, set, &rep);
+        CHECK(rep.compressed);
+        CHECK(!rep.timeCollision);
+        CHECK(!clip->packed.Empty());
+        CHECK(rep.packedBytes < rep.rawBytes);
+        CHECK(rep.maxError <= rep.budget);
+
+        // 키 시각에서 채널 하나씩: 압축 T 가 원본 T 와 양자화 범위 안에서 같음
+        AnimPoseSoA a, b;
+        a.Resize(1); b.Resize(1);
+        const float defT[3] = {};
+        float worstT = 0.0f;
+        for (size_t c = 0; c < raw.channels.size(); ++c) {
+            AnimKeyCursor ca, cb;
+            for (const auto& k : raw.channels[c].T) {
+                AnimGatherChannel(raw.channels[c], ca, k.t, defT, a, 0);
+                AnimGatherPacked(clip->packed.channels[c], cb, k.t * clip->packed.invTimeScale, defT, b, 0);
+                AnimScalar::SampleTRS(a);
+                AnimScalar::SampleTRS(b);
+                for (int i = 0; i < 3; ++i) {
+                    const float e = std::fabs(a.t[i][0] - b.t[i][0]);
+                    if (e > worstT) worstT = e;
+                }
+            }
+            CHECK(StrictlyIncreasing(clip->packed.channels[c].T.keys));
+            CHECK(StrictlyIncreasing(clip->packed.channels[c].R.keys));
+        }
+        CHECK(worstT <= rep.budget);
+    }
+
+    auto one = MakeTestSkeleton(1, 5);
+
+    // ---- 키 간격 0.5 tick, 길이 40000 tick: 한 단계 0.61 tick > 키 간격 → 원본 유지 ----
+    {
+        auto clip = MakeLongClip(*one, 80001, 0.5);
+        AnimCompressReport rep;
+        AnimCompressClip(*clip, *one, AnimCompressSettings{}, &rep);
+        CHECK(rep.timeCollision);
+        CHECK(!rep.compressed);
+        CHECK(clip->packed.Empty());
+        CHECK(clip->channels[0].T.size() == 80001);   // keepRaw 와 상관없이 원본 유지
+    }
+
+    // ---- 키 간격 1 tick, 키 65536 개: 한 단계 = 1 tick → 압축, 시간 순증가 ----
+    {
+        auto clip = MakeLongClip(*one, 65536, 1.0);
+        AnimCompressReport rep;
+        AnimCompressClip(*clip, *one, AnimCompressSettings{}, &rep);
+        CHECK(!rep.timeCollision);
+        CHECK(rep.compressed);
+        CHECK(!clip->packed.Empty());
+        if (!clip->packed.Empty()) {
+            const auto& keys = clip->packed.channels[0].T.keys;
+            CHECK(keys.size() > 1000);
+            CHECK(StrictlyIncreasing(keys));
+        }
+    }
+
+    return TestResult("AnimCompressTest");
+}
@@ -0,0 +1,96 @@
+﻿// ============================================================================
+// AnimDualQuatTest.cpp
+// - 스케일 없는 리그에서 듀얼 쿼터니언 팔레트 (AnimatedInstance::BuildPalette, DualQuat 모드) vs 행렬 팔레트
+//   · 본마다 AnimDualQuatToT34(dq) ≈ 전치 팔레트 앞 3행
+//   · 본 하나에만 묶인 정점: SkinVerticesDQRef ≈ SkinVerticesRef (위치 / 노멀 / 탄젠트)
+//   · q 와 -q 는 같은 변환 (블렌딩 반구 맞춤)
+// - SetSkinMode: 모드를 바꾸면 팔레트 버전이 올라감 (링 슬롯 / 스킨 캐시 갱신)
+// ============================================================================
+
+// ---- includes ----
+#include "TestCommon.h"
+#include "TestRig.h"
+#include "../D3D_Engine(25.12.01. ~ )/Animation/AnimatedInstance.h"
+#include "../D3D_Engine(25.12.01. ~ )/Animation/SkinningCPU.h"
+
+#include <vector>
+
+int main()
+{
+    auto sk = MakeTestSkeleton(50, 31, /*scaled*/false);
+    auto clip = MakeTestClip(*sk, 13, 32, /*scaled*/false);
+    const size_t nb = sk->BoneCount();
+
+    AnimatedInstance inst;
+    inst.Init(sk, clip);
+    const uint64_t v0 = inst.PaletteVersion();
+    inst.SetSkinMode(SkinMode::DualQuat);
+    CHECK(inst.PaletteVersion() > v0);
+    CHECK(inst.PaletteDQ().size() == nb);
+
+    // 단일 본 정점 (가중치 1 → 두 방식 모두 강체 변환)
+    auto single = MakeTestSkinVertices(4000, nb, 33, 2.0f);
+    for (auto& v : single) {
+        v.bw[0] = 1.0f;
+        v.bw[1] = v.bw[2] = v.bw[3] = 0.0f;
+    }
+    auto multi = MakeTestSkinVertices(4000, nb, 34, 2.0f);
+
+    std::vector<VertexCPU_PNTT> lbs(single.size()), dqs(single.size());
+    for (double t : { 0.0, 0.05, 0.21, 0.37 }) {
+        inst.Evaluate(t, true);
+        inst.BuildPalette();
+        const float* palette = &inst.Palette()[0].m[0][0];
+        const AnimDualQuat* dq = inst.PaletteDQ().data();
+
+        // 본마다 복원한 3행 vs 행렬 팔레트
+        float coord = 1.0f, rowErr = 0.0f, trErr = 0.0f;
+        for (size_t b = 0; b < nb; ++b) {
+            float rows[12];
+            AnimDualQuatToT34(dq[b], rows);
+            const float* m = palette + b * 16;
+            for (int r = 0; r < 3; ++r) {
+                coord = std::fmax(coord, std::fabs(m[r * 4 + 3]));
+                for (int c = 0; c < 3; ++c) rowErr = std::fmax(rowErr, std::fabs(rows[r * 4 + c] - m[r * 4 + c]));
+                trErr = std::fmax(trErr, std::fabs(rows[r * 4 + 3] - m[r * 4 + 3]));
+            }
+        }
+        CHECK(rowErr <= 1e-5f);
+        CHECK(trErr <= 1e-5f * coord);
+
+        // 스키닝 결과
+        SkinVerticesRef(single.data(), single.size(), palette, nb, lbs.data());
+        SkinVerticesDQRef(single.data(), single.size(), dq, nb, dqs.data());
+        const SkinDiff d = SkinCompare(lbs.data(), dqs.data(), single.size());
+        CHECK(d.pos <= 1e-5f * coord);
+        CHECK(d.nrm <= 1e-5f);
+        CHECK(d.tan <= 1e-5f);
+
+        // 팔레트 부호를 뒤집어도 (q == -q) 결과가 같아야 함: 여러 본 가중 정점으로
+        std::vector<AnimDualQuat> flipped(dq, dq + nb);
+        for (size_t b = 0; b < nb; b += 2)
+            for (int k = 0; k < 4; ++k) { flipped[b].r[k] = -flipped[b].r[k]; flipped[b].d[k] = -flipped[b].d[k]; }
+        std::vector<VertexCPU_PNTT> a(multi.size()), f(multi.size());
+        SkinVerticesDQRef(multi.data(), multi.size(), dq, nb, a.data());
+        SkinVerticesDQRef(multi.data(), multi.size(), flipped.data(), nb, f.data());
+        const SkinDiff df = SkinCompare(a.data(), f.data(), multi.size());
+        CHECK(df.pos <= 1e-5f * coord);
+        CHECK(df.nrm <= 1e-5f);
+    }
+
+    // 기여 본 없음 → 항등
+    VertexCPU_PNTT_BW none = single[0];
+    none.bw[0] = 0.0f;
+    VertexCPU_PNTT o;
+    SkinVerticesDQRef(&none, 1, inst.PaletteDQ().data(), nb, &o);
+    CHECK_NEAR(o.px, none.px, 1e-6f);
+    CHECK_NEAR(o.py, none.py, 1e-6f);
+    CHECK_NEAR(o.pz, none.pz, 1e-6f);
+
+    const uint64_t v1 = inst.PaletteVersion();
+    inst.SetSkinMode(SkinMode::Linear);
+    CHECK(inst.PaletteVersion() > v1);
+    CHECK(inst.PaletteDQ().empty());
+
+    return TestResult("AnimDualQuatTest");
+}
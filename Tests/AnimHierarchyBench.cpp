@@ -0,0 +1,72 @@
+﻿// ============================================================================
+// AnimHierarchyBench.cpp
+// - 글로벌 포즈: 기존 노드 구조체 + children 재귀 std::function DFS vs AnimLocalToGlobal 선형 루프
+//   · 본 50 / 250 / 1000 개, 노드당 ns
+//   · 비 Windows 에서는 Shim 행렬 곱 (스칼라) 이라 곱 자체 비용은 DirectXMath 보다 크다 → 차이는 순회 비용 쪽
+// ============================================================================
+
+// ---- includes ----
+#include "TestCommon.h"
+#include "../D3D_Engine(25.12.01. ~ )/Animation/AnimHierarchy.h"
+
+#include <directxtk/SimpleMath.h>
+
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+using DirectX::SimpleMath::Matrix;
+using DirectX::SimpleMath::Vector3;
+
+namespace
+{
+    // 기존 SK_Node 배치 (이름 / children / 행렬 3개가 노드마다)
+    struct OldNode
+    {
+        std::string name;
+        int parent = -1;
+        std::vector<int> children;
+        Matrix bindLocal, poseLocal, poseGlobal;
+    };
+}
+
+int main()
+{
+    std::mt19937 rng(11);
+
+    for (int n : { 50, 250, 1000 }) {
+        std::vector<OldNode> nodes(n);
+        std::vector<int> parents(n, -1);
+        std::vector<Matrix> local(n), global(n);
+        std::uniform_real_distribution<float> u(-1.0f, 1.0f);
+        for (int i = 0; i < n; ++i) {
+            nodes[i].name = "bone" + std::to_string(i);
+            if (i > 0) {
+                std::uniform_int_distribution<int> pick(i > 4 ? i - 4 : 0, i - 1);
+                parents[i] = nodes[i].parent = pick(rng);
+                nodes[parents[i]].children.push_back(i);
+            }
+            local[i] = nodes[i].poseLocal = Matrix::CreateTranslation(Vector3(u(rng), u(rng), u(rng)));
+        }
+
+        const int reps = 200000 / n;
+        const double dfsMs = BenchMs(reps, [&] {
+            nodes[0].poseGlobal = nodes[0].poseLocal;
+            std::function<void(int)> dfs = [&](int p) {
+                for (int c : nodes[p].children) {
+                    nodes[c].poseGlobal = nodes[c].poseLocal * nodes[p].poseGlobal;
+                    dfs(c);
+                }
+            };
+            dfs(0);
+        });
+        const double flatMs = BenchMs(reps, [&] {
+            AnimLocalToGlobal(parents.data(), local.data(), global.data(), local.size());
+        });
+
+        printf("%4d bones: recursive DFS %6.1f ns/node   flat %6.1f ns/node   (x%.2f)  [%g]\n",
+            n, dfsMs * 1e6 / n, flatMs * 1e6 / n, dfsMs / flatMs, global[n - 1]._41 + nodes[n - 1].poseGlobal._41);
+    }
+    return 0;
+}
@@ -0,0 +1,86 @@
+﻿// ============================================================================
+// AnimHierarchyTest.cpp
+// - AnimLocalToGlobal (부모 인덱스 배열 + 선형 루프) == 기존 children 재귀 DFS 결과 (비트 단위)
+// - AnimIsTopoOrdered: 부모가 자식보다 뒤 / 범위 밖 / 자기 자신이면 false
+// ============================================================================
+
+// ---- includes ----
+#include "TestCommon.h"
+#include "../D3D_Engine(25.12.01. ~ )/Animation/AnimHierarchy.h"
+
+#include <directxtk/SimpleMath.h>
+
+#include <cstring>
+#include <functional>
+#include <random>
+#include <vector>
+
+using DirectX::SimpleMath::Matrix;
+using DirectX::SimpleMath::Quaternion;
+using DirectX::SimpleMath::Vector3;
+
+namespace
+{
+    Matrix RandomLocal(std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> u(-1.0f, 1.0f);
+        Quaternion q(u(rng), u(rng), u(rng), u(rng));
+        q.Normalize();
+        const float s = 0.8f + 0.4f * (u(rng) * 0.5f + 0.5f);
+        return Matrix::CreateScale(s) * Matrix::CreateFromQuaternion(q)
+            * Matrix::CreateTranslation(Vector3(u(rng) * 10.0f, u(rng) * 10.0f, u(rng) * 10.0f));
+    }
+}
+
+int main()
+{
+    std::mt19937 rng(3);
+
+    for (int n : { 1, 2, 50, 250, 1000 }) {
+        // 부모가 항상 앞에 오는 임의 트리 (체인 / 넓은 트리 섞기)
+        std::vector<int> parents(n, -1);
+        std::vector<std::vector<int>> children(n);
+        for (int i = 1; i < n; ++i) {
+            std::uniform_int_distribution<int> pick(i % 3 == 0 ? 0 : (i > 8 ? i - 8 : 0), i - 1);
+            parents[i] = pick(rng);
+            children[parents[i]].push_back(i);
+        }
+        CHECK(AnimIsTopoOrdered(parents));
+
+        std::vector<Matrix> local(n), flat(n), dfs(n);
+        for (Matrix& m : local) m = RandomLocal(rng);
+
+        AnimLocalToGlobal(parents.data(), local.data(), flat.data(), local.size());
+
+        // 기존 EvaluatePose 의 재귀 DFS
+        dfs[0] = local[0];
+        std::function<void(int)> visit = [&](int u) {
+            for (int v : children[u]) {
+                dfs[v] = local[v] * dfs[u];
+                visit(v);
+            }
+        };
+        visit(0);
+
+        CHECK(std::memcmp(flat.data(), dfs.data(), sizeof(Matrix) * n) == 0);
+    }
+
+    // 루트 여러 개
+    {
+        const std::vector<int> parents = { -1, 0, -1, 2, 1 };
+        CHECK(AnimIsTopoOrdered(parents));
+        std::vector<Matrix> local(parents.size()), global(parents.size());
+        for (size_t i = 0; i < local.size(); ++i) local[i] = Matrix::CreateTranslation(Vector3((float)i, 0.0f, 0.0f));
+        AnimLocalToGlobal(parents.data(), local.data(), global.data(), local.size());
+        CHECK(global[2] == local[2]);
+        CHECK(global[4].Translation() == Vector3(5.0f, 0.0f, 0.0f));   // 4 + 1 + 0
+    }
+
+    CHECK(AnimIsTopoOrdered({}));
+    CHECK(!AnimIsTopoOrdered({ -1, 2, 0 }));     // 부모가 뒤
+    CHECK(!AnimIsTopoOrdered({ -1, 1 }));        // 자기 자신
+    CHECK(!AnimIsTopoOrdered({ -1, -2 }));       // 범위 밖
+    CHECK(!AnimIsTopoOrdered({ 0 }));            // 루트가 자기 자신
+
+    return TestResult("AnimHierarchyTest");
+}
@@ -0,0 +1,50 @@
+﻿// ============================================================================
+// AnimSIMDBench.cpp
+// - 포즈 커널 처리량 (bones/sec): AnimScalar vs AnimSimd
+//   · 샘플 (Lerp3 + Slerp4 + Lerp3) + ComposeTRS44, PaletteT44 따로
+//   · 본 256 개 배치를 반복 (L1 에 들어가는 크기 = 실제 리그 한 개 규모)
+// ============================================================================
+
+// ---- includes ----
+#include "TestCommon.h"
+#include "../D3D_Engine(25.12.01. ~ )/Animation/AnimSIMD.h"
+
+#include <random>
+#include <vector>
+
+int main()
+{
+    constexpr size_t kBones = 256;
+    constexpr int kReps = 20000;
+
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> u(-1.0f, 1.0f), u01(0.0f, 1.0f);
+
+    AnimPoseSoA base;
+    base.Resize(kBones);
+    for (size_t i = 0; i < kBones; ++i) {
+        for (int k = 0; k < 3; ++k) { base.ta[k][i] = u(rng); base.tb[k][i] = u(rng); base.sa[k][i] = base.sb[k][i] = 1.0f; }
+        float qa[4], qb[4], la = 0.0f, lb = 0.0f;
+        for (int k = 0; k < 4; ++k) { qa[k] = u(rng); qb[k] = u(rng); la += qa[k] * qa[k]; lb += qb[k] * qb[k]; }
+        for (int k = 0; k < 4; ++k) { base.ra[k][i] = qa[k] / std::sqrt(la); base.rb[k][i] = qb[k] / std::sqrt(lb); }
+        base.tu[i] = base.ru[i] = base.su[i] = u01(rng);
+    }
+
+    std::vector<float> global(16 * kBones), offsets(16 * kBones), palette(16 * kBones);
+    std::vector<int> boneNode(kBones);
+    for (size_t i = 0; i < kBones; ++i) boneNode[i] = int(i);
+
+    AnimPoseSoA soa = base;
+    const double scalarSample = BenchMs(kReps, [&] { AnimScalar::SampleTRS(soa); AnimScalar::ComposeTRS44(soa, nullptr, global.data()); });
+    const double simdSample = BenchMs(kReps, [&] { AnimSimd::SampleTRS(soa); AnimSimd::ComposeTRS44(soa, nullptr, global.data()); });
+    offsets = global;
+    const double scalarPal = BenchMs(kReps, [&] { AnimScalar::PaletteT44(offsets.data(), global.data(), boneNode.data(), kBones, palette.data()); });
+    const double simdPal = BenchMs(kReps, [&] { AnimSimd::PaletteT44(offsets.data(), global.data(), boneNode.data(), kBones, palette.data()); });
+
+    auto mbps = [](double ms) { return kBones / (ms * 1e-3) / 1e6; };
+    printf("sample+compose: scalar %6.1f M bones/s   simd %6.1f M bones/s   (x%.2f)\n",
+        mbps(scalarSample), mbps(simdSample), scalarSample / simdSample);
+    printf("palette       : scalar %6.1f M bones/s   simd %6.1f M bones/s   (x%.2f)  [%g]\n",
+        mbps(scalarPal), mbps(simdPal), scalarPal / simdPal, palette[5]);
+    return 0;
+}
@@ -0,0 +1,165 @@
+﻿// ============================================================================
+// AnimSIMDTest.cpp
+// - AnimSimd (SSE 4 lane) vs AnimScalar 같은 입력 → 결과 비교
+//   · Lerp3 / ComposeTRS44 / ComposeTRS34 / PaletteT44: 비트 단위 동일
+//   · Slerp4: 최대 절대 오차 1e-6 이하 (sin/acos 다항식 근사), double slerp 기준으로도 같음
+// - AnimScalar vs 기존 SimpleMath 경로 (CreateScale * CreateFromQuaternion * CreateTranslation,
+//   (offset * global).Transpose()) 도 허용 오차 안인지
+// ============================================================================
+
+// ---- includes ----
+#include "TestCommon.h"
+#include "../D3D_Engine(25.12.01. ~ )/Animation/AnimSIMD.h"
+
+#include <directxtk/SimpleMath.h>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+using DirectX::SimpleMath::Matrix;
+using DirectX::SimpleMath::Quaternion;
+using DirectX::SimpleMath::Vector3;
+
+namespace
+{
+    float MaxAbsDiff(const float* a, const float* b, size_t n)
+    {
+        float m = 0.0f;
+        for (size_t i = 0; i < n; ++i) {
+            const float d = std::fabs(a[i] - b[i]);
+            if (d > m) m = d;
+        }
+        return m;
+    }
+
+    void RandomQuat(std::mt19937& rng, float q[4])
+    {
+        std::uniform_real_distribution<float> u(-1.0f, 1.0f);
+        float l = 0.0f;
+        do {
+            for (int k = 0; k < 4; ++k) q[k] = u(rng);
+            l = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+        } while (l < 0.1f);
+        for (int k = 0; k < 4; ++k) q[k] /= l;
+    }
+
+    // lane 마다 임의 구간: 일반 / 거의 같은 쿼터니언 (선형 분기) / 반대 반구 (cos<0 뒤집기)
+    void FillRandom(AnimPoseSoA& soa, size_t n, std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> u01(0.0f, 1.0f), pos(-50.0f, 50.0f), scl(0.5f, 2.0f), tiny(-1e-4f, 1e-4f);
+        soa.Resize(n);
+        for (size_t i = 0; i < n; ++i) {
+            for (int k = 0; k < 3; ++k) {
+                soa.ta[k][i] = pos(rng); soa.tb[k][i] = pos(rng);
+                soa.sa[k][i] = scl(rng); soa.sb[k][i] = scl(rng);
+            }
+            float a[4], b[4];
+            RandomQuat(rng, a);
+            switch (i % 3) {
+            case 0: RandomQuat(rng, b); break;
+            case 1: for (int k = 0; k < 4; ++k) b[k] = a[k] + tiny(rng); break;
+            default: for (int k = 0; k < 4; ++k) b[k] = -a[k] + tiny(rng) * 100.0f; break;
+            }
+            for (int k = 0; k < 4; ++k) { soa.ra[k][i] = a[k]; soa.rb[k][i] = b[k]; }
+            soa.tu[i] = u01(rng); soa.ru[i] = u01(rng); soa.su[i] = u01(rng);
+        }
+    }
+}
+
+int main()
+{
+    std::mt19937 rng(21);
+
+    for (size_t n : { 1, 3, 4, 5, 64, 1001 }) {
+        AnimPoseSoA simd, ref;
+        FillRandom(simd, n, rng);
+        ref = simd;
+
+        AnimSimd::SampleTRS(simd);
+        AnimScalar::SampleTRS(ref);
+
+        const size_t p = simd.Padded();
+        for (int k = 0; k < 3; ++k) {
+            CHECK(std::memcmp(simd.t[k].data(), ref.t[k].data(), p * sizeof(float)) == 0);
+            CHECK(std::memcmp(simd.s[k].data(), ref.s[k].data(), p * sizeof(float)) == 0);
+        }
+        // 양쪽 다 double 정밀도 slerp 기준으로도 확인 (작은 각 / 반대 반구 lane 포함)
+        float vsScalar = 0.0f, vsExact = 0.0f;
+        for (size_t i = 0; i < n; ++i) {
+            double a[4], b[4], d = 0.0;
+            for (int k = 0; k < 4; ++k) { a[k] = ref.ra[k][i]; b[k] = ref.rb[k][i]; d += a[k] * b[k]; }
+            if (d < 0.0) { d = -d; for (int k = 0; k < 4; ++k) b[k] = -b[k]; }
+            const double u = ref.ru[i];
+            double s0 = 1.0 - u, s1 = u;
+            if (d < 1.0 - 1e-5) {
+                const double o = std::acos(d), inv = 1.0 / std::sin(o);
+                s0 = std::sin((1.0 - u) * o) * inv;
+                s1 = std::sin(u * o) * inv;
+            }
+            for (int k = 0; k < 4; ++k) {
+                const float exact = float(s0 * a[k] + s1 * b[k]);
+                const float e0 = std::fabs(simd.r[k][i] - ref.r[k][i]);
+                const float e1 = std::fabs(simd.r[k][i] - exact);
+                if (e0 > vsScalar) vsScalar = e0;
+                if (e1 > vsExact) vsExact = e1;
+            }
+        }
+        CHECK(vsScalar <= 1e-6f);
+        CHECK(vsExact <= 1e-6f);
+
+        // 같은 보간 결과에서 조립 (Slerp 오차가 섞이지 않게 ref 쪽 결과를 양쪽에)
+        simd = ref;
+        std::vector<float> a44(16 * n), b44(16 * n), a34(12 * n), b34(12 * n);
+        AnimSimd::ComposeTRS44(simd, nullptr, a44.data());
+        AnimScalar::ComposeTRS44(ref, nullptr, b44.data());
+        AnimSimd::ComposeTRS34(simd, nullptr, a34.data());
+        AnimScalar::ComposeTRS34(ref, nullptr, b34.data());
+        CHECK(std::memcmp(a44.data(), b44.data(), a44.size() * sizeof(float)) == 0);
+        CHECK(std::memcmp(a34.data(), b34.data(), a34.size() * sizeof(float)) == 0);
+
+        // dst 인덱스로 흩어 쓰기 (역순)
+        std::vector<int> dst(n);
+        for (size_t i = 0; i < n; ++i) dst[i] = int(n - 1 - i);
+        std::vector<float> c44(16 * n);
+        AnimSimd::ComposeTRS44(simd, dst.data(), c44.data());
+        for (size_t i = 0; i < n; ++i)
+            CHECK(std::memcmp(&c44[16 * dst[i]], &b44[16 * i], 16 * sizeof(float)) == 0);
+
+        // 기존 SimpleMath 경로와 비교 + 34 = 44 의 전치 3행
+        float composeErr = 0.0f;
+        for (size_t i = 0; i < n; ++i) {
+            const Quaternion q(ref.r[0][i], ref.r[1][i], ref.r[2][i], ref.r[3][i]);
+            const Matrix m = Matrix::CreateScale(Vector3(ref.s[0][i], ref.s[1][i], ref.s[2][i]))
+                * Matrix::CreateFromQuaternion(q)
+                * Matrix::CreateTranslation(Vector3(ref.t[0][i], ref.t[1][i], ref.t[2][i]));
+            const float e = MaxAbsDiff(&m.m[0][0], &b44[16 * i], 16);
+            if (e > composeErr) composeErr = e;
+            for (int r = 0; r < 3; ++r)
+                for (int c = 0; c < 4; ++c)
+                    CHECK(b34[12 * i + r * 4 + c] == b44[16 * i + c * 4 + r]);
+        }
+        CHECK(composeErr <= 1e-4f);   // |T| <= 50
+
+        // 팔레트
+        std::vector<float> offsets(16 * n), pa(16 * n), pb(16 * n);
+        std::vector<int> boneNode(n);
+        std::uniform_int_distribution<int> pick(0, (int)n - 1);
+        for (size_t i = 0; i < n; ++i) {
+            std::memcpy(&offsets[16 * i], &b44[16 * pick(rng)], 16 * sizeof(float));
+            boneNode[i] = pick(rng);
+        }
+        AnimSimd::PaletteT44(offsets.data(), b44.data(), boneNode.data(), n, pa.data());
+        AnimScalar::PaletteT44(offsets.data(), b44.data(), boneNode.data(), n, pb.data());
+        CHECK(std::memcmp(pa.data(), pb.data(), pa.size() * sizeof(float)) == 0);
+
+        for (size_t i = 0; i < n; ++i) {
+            const Matrix off(&offsets[16 * i]);
+            const Matrix glob(&b44[16 * boneNode[i]]);
+            const Matrix t = (off * glob).Transpose();
+            CHECK(std::memcmp(&t, &pb[16 * i], sizeof(Matrix)) == 0);
+        }
+    }
+
+    return TestResult("AnimSIMDTest");
+}
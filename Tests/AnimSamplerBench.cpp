@@ -0,0 +1,66 @@
+﻿// ============================================================================
+// AnimSamplerBench.cpp
+// - 키 탐색: 처음부터 선형 탐색 (기존 UB_T/R/S) vs AnimUpperBound (커서 + 이진 탐색)
+//   · 합성 클립: 채널 64개 × 키 10k / 40k, 30fps 순방향 재생 + 매 프레임 임의 시크
+//   · 결과는 샘플(채널 1개 탐색) 당 ns
+// ============================================================================
+
+// ---- includes ----
+#include "TestCommon.h"
+#include "../D3D_Engine(25.12.01. ~ )/Animation/AnimSampler.h"
+
+#include <random>
+#include <vector>
+
+namespace
+{
+    struct Key { double t; };
+
+    int LinearUpperBound(double t, const std::vector<Key>& v)
+    {
+        const int n = (int)v.size();
+        int i = 0;
+        while (i < n && v[i].t <= t) ++i;
+        return i;
+    }
+}
+
+int main()
+{
+    constexpr int kChannels = 64;
+    std::mt19937 rng(7);
+
+    for (int keyCount : { 10000, 40000 }) {
+        // 키 간격 1 tick, 재생은 프레임당 0.8 tick (30fps 재생 / 24tick 클립 근사)
+        std::vector<std::vector<Key>> channels(kChannels);
+        for (auto& ch : channels)
+            for (int k = 0; k < keyCount; ++k) ch.push_back({ (double)k });
+
+        std::vector<double> play, seek;
+        std::uniform_real_distribution<double> any(0.0, keyCount - 1.0);
+        for (double t = 0.0; t < keyCount - 1.0 && play.size() < 4096; t += 0.8) play.push_back(t);
+        for (int i = 0; i < 4096; ++i) seek.push_back(any(rng));
+
+        for (int mode = 0; mode < 2; ++mode) {
+            const std::vector<double>& times = mode == 0 ? play : seek;
+            const double samples = (double)times.size() * kChannels;
+            long long sink = 0;
+
+            const double linMs = BenchMs(1, [&] {
+                for (double t : times)
+                    for (const auto& ch : channels) sink += LinearUpperBound(t, ch);
+            });
+
+            std::vector<int> cursors(kChannels, 0);
+            const double curMs = BenchMs(1, [&] {
+                for (double t : times)
+                    for (int c = 0; c < kChannels; ++c) sink += AnimUpperBound(t, channels[c], cursors[c]);
+            });
+
+            printf("%5d keys, %-8s linear %9.1f ns/sample   cursor %6.1f ns/sample   (x%.0f)  [%lld]\n",
+                keyCount, mode == 0 ? "playback" : "seek",
+                linMs * 1e6 / samples, curMs * 1e6 / samples, linMs / (curMs > 0.0 ? curMs : 1e-9), sink & 1);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,95 @@
+﻿// ============================================================================
+// AnimSamplerTest.cpp
+// - AnimUpperBound (커서 캐시 + 이진 탐색) == 처음부터 선형 탐색 (기존 UB_T/R/S) 결과인지
+//   · 순방향 재생 / 루프 되감기 / 임의 시크 / 큰 점프 / 역재생, 같은 시각 키, 빈 배열
+// ============================================================================
+
+// ---- includes ----
+#include "TestCommon.h"
+#include "../D3D_Engine(25.12.01. ~ )/Animation/AnimSampler.h"
+
+#include <random>
+#include <vector>
+
+namespace
+{
+    struct Key { double t; };
+
+    // 기존 SkinnedSkeletal::UB_T 와 같은 선형 탐색
+    int LinearUpperBound(double t, const std::vector<Key>& v)
+    {
+        const int n = (int)v.size();
+        int i = 0;
+        while (i < n && v[i].t <= t) ++i;
+        return i;
+    }
+
+    std::vector<Key> MakeKeys(int n, std::mt19937& rng, bool duplicates)
+    {
+        std::uniform_real_distribution<double> step(0.1, 2.0);
+        std::uniform_int_distribution<int> dup(0, 9);
+        std::vector<Key> keys;
+        double t = 0.0;
+        for (int i = 0; i < n; ++i) {
+            if (!(duplicates && i > 0 && dup(rng) == 0)) t += step(rng);
+            keys.push_back({ t });
+        }
+        return keys;
+    }
+
+    // 시각 열 하나를 커서로 따라가며 매번 기준값과 비교
+    int Compare(const std::vector<Key>& keys, const std::vector<double>& times)
+    {
+        int cursor = 0, mismatches = 0;
+        for (double t : times)
+            if (AnimUpperBound(t, keys, cursor) != LinearUpperBound(t, keys)) ++mismatches;
+        return mismatches;
+    }
+}
+
+int main()
+{
+    std::mt19937 rng(12345);
+
+    for (int n : { 0, 1, 2, 5, 64, 10000 }) {
+        for (bool dup : { false, true }) {
+            const std::vector<Key> keys = MakeKeys(n, rng, dup);
+            const double end = keys.empty() ? 1.0 : keys.back().t;
+
+            // 순방향 재생 (작은 스텝) + 루프
+            std::vector<double> play;
+            for (int loop = 0; loop < 3; ++loop)
+                for (double t = -0.5; t < end + 0.5; t += end / 997.0 + 0.01) play.push_back(t);
+            CHECK(Compare(keys, play) == 0);
+
+            // 키 시각 정확히 (경계: time <= t 는 지나간 키)
+            std::vector<double> exact;
+            for (const Key& k : keys) exact.push_back(k.t);
+            for (size_t i = keys.size(); i-- > 0;) exact.push_back(keys[i].t);
+            CHECK(Compare(keys, exact) == 0);
+
+            // 임의 시크 / 큰 점프 / 역재생 섞기
+            std::uniform_real_distribution<double> any(-1.0, end + 1.0);
+            std::uniform_real_distribution<double> small(-0.3, 0.6);
+            std::vector<double> mixed;
+            double t = 0.0;
+            for (int i = 0; i < 20000; ++i) {
+                if (i % 97 == 0) t = any(rng);
+                else t += small(rng) * (i % 13 == 0 ? 50.0 : 1.0);
+                mixed.push_back(t);
+            }
+            CHECK(Compare(keys, mixed) == 0);
+        }
+    }
+
+    // 커서가 범위 밖 값이어도 (다른 클립에서 넘어온 커서) 결과는 같아야 함
+    {
+        const std::vector<Key> keys = MakeKeys(100, rng, false);
+        for (int bad : { -5, 0, 50, 100, 1000 }) {
+            int cursor = bad;
+            CHECK(AnimUpperBound(keys[40].t + 0.01, keys, cursor) == LinearUpperBound(keys[40].t + 0.01, keys));
+        }
+    }
+
+    return TestResult("AnimSamplerTest");
+}
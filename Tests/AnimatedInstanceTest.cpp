@@ -0,0 +1,55 @@
+﻿// ============================================================================
+// AnimatedInstanceTest.cpp
+// - InstanceId: 인스턴스마다 다르고, 해제 후 같은 주소에 새로 만든 인스턴스도 새 번호
+//   복사 / 이동 / 대입 결과도 새 번호 (BonePaletteRing 슬롯이 남의 팔레트를 재사용하지 않게)
+// ============================================================================
+
+// ---- includes ----
+#include "TestCommon.h"
+#include "TestRig.h"
+#include "../D3D_Engine(25.12.01. ~ )/Animation/AnimatedInstance.h"
+
+#include <new>
+#include <set>
+#include <utility>
+#include <vector>
+
+int main()
+{
+    auto sk = MakeTestSkeleton(10, 1);
+    auto clip = MakeTestClip(*sk, 5, 2);
+
+    // 같은 저장소에 만들고 지우기를 반복 → 주소는 같고 번호는 매번 새로
+    alignas(AnimatedInstance) unsigned char storage[sizeof(AnimatedInstance)];
+    std::set<uint64_t> seen;
+    for (int i = 0; i < 10; ++i) {
+        AnimatedInstance* inst = new (storage) AnimatedInstance();
+        inst->Init(sk, clip);
+        CHECK(seen.insert(inst->InstanceId()).second);
+        inst->~AnimatedInstance();
+    }
+
+    AnimatedInstance a;
+    a.Init(sk, clip);
+    a.Evaluate(0.1, true);
+    a.BuildPalette();
+
+    AnimatedInstance b = a;
+    CHECK(b.InstanceId() != a.InstanceId());
+    CHECK(b.PaletteVersion() == a.PaletteVersion());
+
+    AnimatedInstance c;
+    const uint64_t cId = c.InstanceId();
+    c = a;
+    CHECK(c.InstanceId() != cId);
+    CHECK(c.InstanceId() != a.InstanceId());
+
+    const uint64_t bId = b.InstanceId();
+    AnimatedInstance d = std::move(b);
+    CHECK(d.InstanceId() != bId);
+
+    std::vector<AnimatedInstance> many(100);
+    for (const auto& m : many) CHECK(seen.insert(m.InstanceId()).second);
+
+    return TestResult("AnimatedInstanceTest");
+}
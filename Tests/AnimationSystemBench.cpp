@@ -0,0 +1,52 @@
+﻿// ============================================================================
+// AnimationSystemBench.cpp
+// - AnimationSystem::Update 스케일링: 스레드 1/2/4/8/16 x 인스턴스 10..5000
+//   · 스레드 1 = 직렬 (jobs == nullptr), N = 워커 N-1 + 호출 스레드
+//   · 리그 60 노드 (전부 스키닝 본), 클립 2 개, 팔레트까지 (실제 프레임과 같은 일)
+// ============================================================================
+
+// ---- includes ----
+#include "TestCommon.h"
+#include "TestRig.h"
+#include "../D3D_Engine(25.12.01. ~ )/Animation/AnimationSystem.h"
+#include "../D3D_Core/JobSystem.h"
+
+#include <memory>
+#include <vector>
+
+int main()
+{
+    auto sk = MakeTestSkeleton(60, 7);
+    auto lib = std::make_shared<AnimClipLibrary>();
+    lib->Add(MakeTestClip(*sk, 61, 1));
+    lib->Add(MakeTestClip(*sk, 45, 2));
+
+    const unsigned threads[] = { 1, 2, 4, 8, 16 };
+    printf("%-9s", "instances");
+    for (unsigned t : threads) printf("  %7u thr", t);
+    printf("   (ms / frame)\n");
+
+    for (size_t count : { 10, 50, 100, 500, 1000, 5000 }) {
+        std::vector<AnimatedInstance> insts(count);
+        for (size_t i = 0; i < count; ++i) insts[i].Init(sk, lib, int(i % 2));
+
+        printf("%-9zu", count);
+        for (unsigned t : threads) {
+            std::unique_ptr<JobSystem> jobs;
+            if (t > 1) jobs = std::make_unique<JobSystem>(t - 1);
+
+            AnimationSystem sys;
+            int frame = 0;
+            const int reps = (count >= 1000) ? 20 : 200;
+            const double ms = BenchMs(reps, [&] {
+                sys.Begin();
+                for (size_t i = 0; i < count; ++i) sys.Add(insts[i], frame / 60.0 + i * 0.01, true, true);
+                sys.Update(jobs.get());
+                ++frame;
+                });
+            printf("  %11.3f", ms);
+        }
+        printf("\n");
+    }
+    return 0;
+}
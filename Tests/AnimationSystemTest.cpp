@@ -0,0 +1,378 @@
+﻿// ============================================================================
+// AnimationSystemTest.cpp
+// - AnimationSystem::Update(JobSystem) == Update(nullptr) (직렬)  : 글로벌 포즈 / 팔레트 비트 단위
+//   · 스켈레톤 / 클립이 다른 인스턴스 섞기, 레이어 블렌딩 인스턴스 포함, 여러 프레임, 워커 1/4/8
+// - LOD (AnimLod.h, AnimationSystem::PlanLod)
+//   · 레벨 선택 (거리 경계 / 화면 밖 / 꺼짐), 주기 clamp, 카메라 기준 입력 (거리 / 절두체 / 화면 px)
+//   · 프레임별 평가 / 보간 / 건너뜀 카운터, 말단 본 생략 (px 기준, 레이어 인스턴스 제외), 레벨 바뀌면 주기 재시작
+//   · 주기 N: phase 0 에서 (N-1) 프레임 앞 시간으로 평가 → 사이는 (k+1)/N 보간
+//     → 주기 마지막 프레임은 그 시간의 LOD 없는 평가와 비트 단위로 같음 (단일 클립 / 레이어)
+//   · interpolate 끔: phase 0 은 현재 시간 그대로 평가, 나머지는 포즈 유지. 화면 밖(interval 0)은 포즈 유지
+// ============================================================================
+
+// ---- includes ----
+#include "TestCommon.h"
+#include "TestRig.h"
+#include "../D3D_Engine(25.12.01. ~ )/Animation/AnimationSystem.h"
+#include "../D3D_Core/JobSystem.h"
+
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct Scene
+    {
+        std::vector<std::unique_ptr<AnimatedInstance>> insts;
+    };
+
+    Scene MakeScene(size_t count)
+    {
+        std::shared_ptr<const SkeletonAsset> sk[3] = {
+            MakeTestSkeleton(20, 1), MakeTestSkeleton(60, 2, true), MakeTestSkeleton(7, 3) };
+        std::shared_ptr<AnimClipLibrary> lib[3];
+        for (int s = 0; s < 3; ++s) {
+            lib[s] = std::make_shared<AnimClipLibrary>();
+            lib[s]->Add(MakeTestClip(*sk[s], 31, 10 + s, s == 1));
+            lib[s]->Add(MakeTestClip(*sk[s], 17, 20 + s, s == 1));
+        }
+
+        Scene sc;
+        for (size_t i = 0; i < count; ++i) {
+            auto inst = std::make_unique<AnimatedInstance>();
+            inst->Init(sk[i % 3], lib[i % 3], int(i / 3 % 2));
+            sc.insts.push_back(std::move(inst));
+        }
+        return sc;
+    }
+
+    void AddFrame(AnimationSystem& sys, Scene& sc, int frame)
+    {
+        sys.Begin();
+        for (size_t i = 0; i < sc.insts.size(); ++i) {
+            const double t = frame * (1.0 / 60.0) + i * 0.013;
+            if (i % 5 == 4) {
+                const AnimLayer layers[2] = { { 0, t, true, 0.7f }, { 1, t * 1.3, true, 0.3f } };
+                sys.AddLayers(*sc.insts[i], layers, 2, true);
+            }
+            else {
+                sys.Add(*sc.insts[i], t, i % 7 != 0, i % 2 == 0);
+            }
+        }
+    }
+}
+
+namespace
+{
+    using Pose = std::vector<AnimatedInstance::Matrix>;
+
+    bool SamePose(const Pose& a, const Pose& b)
+    {
+        return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(AnimatedInstance::Matrix)) == 0;
+    }
+
+    // |pose - lerp(from, to, a)| 최대값
+    double LerpError(const Pose& pose, const Pose& from, const Pose& to, float a)
+    {
+        if (pose.size() != from.size() || pose.size() != to.size()) return 1.0e9;
+        const float* p = reinterpret_cast<const float*>(pose.data());
+        const float* f = reinterpret_cast<const float*>(from.data());
+        const float* t = reinterpret_cast<const float*>(to.data());
+        double err = 0.0;
+        for (size_t i = 0; i < pose.size() * 16; ++i)
+            err = std::fmax(err, std::fabs(double(p[i]) - (double(f[i]) + (double(t[i]) - double(f[i])) * a)));
+        return err;
+    }
+
+    AnimLodInput LodAt(float distance, bool visible = true, float pixels = 1.0e9f)
+    {
+        AnimLodInput in;
+        in.distance = distance;
+        in.visible = visible;
+        in.screenPixels = pixels;
+        return in;
+    }
+
+    void TestSelect()
+    {
+        AnimLodSettings s;
+        CHECK(AnimSelectLod(s, LodAt(0.0f)) == AnimLodLevel::Full);
+        CHECK(AnimSelectLod(s, LodAt(799.9f)) == AnimLodLevel::Full);
+        CHECK(AnimSelectLod(s, LodAt(800.0f)) == AnimLodLevel::Reduced);
+        CHECK(AnimSelectLod(s, LodAt(1999.0f)) == AnimLodLevel::Reduced);
+        CHECK(AnimSelectLod(s, LodAt(2000.0f)) == AnimLodLevel::Far);
+        CHECK(AnimSelectLod(s, LodAt(1.0e6f)) == AnimLodLevel::Far);
+        CHECK(AnimSelectLod(s, LodAt(0.0f, false)) == AnimLodLevel::Offscreen);
+        CHECK(AnimSelectLod(s, LodAt(0.0f, true, 1.0f)) == AnimLodLevel::Full);    // px 는 레벨에 영향 없음
+
+        CHECK(AnimLodInterval(s, AnimLodLevel::Full) == 1);
+        CHECK(AnimLodInterval(s, AnimLodLevel::Reduced) == 2);
+        CHECK(AnimLodInterval(s, AnimLodLevel::Far) == 4);
+        CHECK(AnimLodInterval(s, AnimLodLevel::Offscreen) == 0);
+        s.reducedInterval = 0;
+        s.farInterval = -3;
+        s.offscreenInterval = -1;
+        CHECK(AnimLodInterval(s, AnimLodLevel::Reduced) == 1);
+        CHECK(AnimLodInterval(s, AnimLodLevel::Far) == 1);
+        CHECK(AnimLodInterval(s, AnimLodLevel::Offscreen) == 0);
+        s.offscreenInterval = 8;
+        CHECK(AnimLodInterval(s, AnimLodLevel::Offscreen) == 8);
+
+        s.enabled = false;
+        CHECK(AnimSelectLod(s, LodAt(5000.0f, false)) == AnimLodLevel::Full);
+
+        CHECK(std::string(AnimLodLevelName(AnimLodLevel::Far)) == "Far");
+        CHECK(std::string(AnimLodLevelName(AnimLodLevel::Count)) == "?");
+    }
+
+    void TestFromView()
+    {
+        // 카메라 원점, +z 를 봄 (LH), 세로 60도, 16:9, near 1 / far 10000
+        const float ys = 1.0f / std::tan(0.5236f), xs = ys * 9.0f / 16.0f, zn = 1.0f, zf = 10000.0f;
+        float V[16] = { 1,0,0,0, 0,1,0,0, 0,0,1,0, 0,0,0,1 };
+        const float P[16] = { xs,0,0,0, 0,ys,0,0, 0,0,zf / (zf - zn),1, 0,0,-zn * zf / (zf - zn),0 };
+        const float H = 1080.0f;
+
+        const float front[3] = { 0.0f, 0.0f, 100.0f };
+        AnimLodInput in = AnimLodFromView(front, 1.0f, V, P, H);
+        CHECK_NEAR(in.distance, 100.0f, 1.0e-3);
+        CHECK(in.visible);
+        CHECK_NEAR(in.screenPixels, ys * H / 100.0f, 1.0e-2);
+
+        const float behind[3] = { 0.0f, 0.0f, -100.0f };
+        CHECK(!AnimLodFromView(behind, 1.0f, V, P, H).visible);
+
+        // 카메라를 감싸는 구: 보임, 화면 크기는 "아주 큼"
+        const float around[3] = { 0.0f, 0.0f, -0.5f };
+        in = AnimLodFromView(around, 2.0f, V, P, H);
+        CHECK(in.visible);
+        CHECK(in.screenPixels >= 1.0e9f);
+
+        // 옆으로 벗어남 / 반지름이 커서 절두체에 걸침
+        const float side[3] = { 200.0f, 0.0f, 100.0f };
+        CHECK(!AnimLodFromView(side, 1.0f, V, P, H).visible);
+        CHECK(AnimLodFromView(side, 150.0f, V, P, H).visible);
+        const float above[3] = { 0.0f, 80.0f, 100.0f };
+        CHECK(!AnimLodFromView(above, 1.0f, V, P, H).visible);
+
+        // 카메라를 z = -50 으로 (view 이동 +50)
+        V[14] = 50.0f;
+        const float ahead[3] = { 0.0f, 0.0f, 50.0f };
+        in = AnimLodFromView(ahead, 1.0f, V, P, H);
+        CHECK_NEAR(in.distance, 100.0f, 1.0e-3);
+        CHECK(in.visible);
+    }
+
+    struct LodRig
+    {
+        std::shared_ptr<const SkeletonAsset> sk = MakeTestSkeleton(30, 7);
+        std::shared_ptr<AnimClipLibrary> lib = std::make_shared<AnimClipLibrary>();
+
+        LodRig()
+        {
+            lib->Add(MakeTestClip(*sk, 31, 70));
+            lib->Add(MakeTestClip(*sk, 31, 71));
+        }
+
+        void Init(AnimatedInstance& inst) const { inst.Init(sk, lib, 0); }
+    };
+
+    // 레이어 두 개의 시간은 tSec 에서 같은 만큼 떨어져 있음 (앞당김이 둘 다에 더해짐)
+    void AddAt(AnimationSystem& sys, AnimatedInstance& inst, double t, bool layered, const AnimLodInput* lod)
+    {
+        if (layered) {
+            const AnimLayer layers[2] = { { 0, t, true, 0.6f }, { 1, t + 0.25, true, 0.4f } };
+            sys.AddLayers(inst, layers, 2, false, lod);
+        }
+        else {
+            sys.Add(inst, t, true, false, lod);
+        }
+    }
+
+    // LOD 없이 t 에서 평가한 포즈
+    Pose Reference(const LodRig& rig, double t, bool layered)
+    {
+        AnimatedInstance ref;
+        rig.Init(ref);
+        AnimationSystem sys;
+        sys.Begin();
+        AddAt(sys, ref, t, layered, nullptr);
+        sys.Update(nullptr);
+        return ref.PoseGlobal();
+    }
+
+    // Far (N = 4), 프레임 간격 1/64 (2 의 거듭제곱 → 앞당긴 시간이 실제 프레임 시간과 정확히 같음)
+    void TestPeriods(bool layered)
+    {
+        const LodRig rig;
+        AnimatedInstance inst;
+        rig.Init(inst);
+        AnimationSystem sys;
+        const int N = sys.Lod().farInterval;
+        const AnimLodInput far = LodAt(2500.0f);
+        const double dt = 1.0 / 64.0;
+
+        Pose from, to;
+        for (int f = 0; f < 40; ++f) {
+            const Pose before = inst.PoseGlobal();
+            sys.Begin();
+            AddAt(sys, inst, f * dt, layered, &far);
+            sys.Update(nullptr);
+
+            const AnimationSystem::Stats& st = sys.LastStats();
+            CHECK(st.lodCount[(size_t)AnimLodLevel::Far] == 1);
+            CHECK(inst.LodState().level == AnimLodLevel::Far && inst.LodState().interval == N);
+
+            const int phase = f % N;
+            if (phase == 0) {
+                // 첫 프레임은 진행량을 아직 모름 → 앞당김 0
+                CHECK(st.evaluated == 1 && st.interpolated == 0);
+                from = before;
+                to = Reference(rig, f == 0 ? 0.0 : (f + N - 1) * dt, layered);
+            }
+            else {
+                CHECK(st.evaluated == 0 && st.interpolated == 1);
+            }
+            CHECK(LerpError(inst.PoseGlobal(), from, to, float(phase + 1) / float(N)) < 1.0e-4);
+            if (phase == N - 1) CHECK(SamePose(inst.PoseGlobal(), to));
+        }
+    }
+
+    void TestPlan()
+    {
+        const LodRig rig;
+        AnimatedInstance near, reduced, far, off, tiny, plain, tinyLayered;
+        AnimatedInstance* all[] = { &near, &reduced, &far, &off, &tiny, &plain, &tinyLayered };
+        for (AnimatedInstance* i : all) rig.Init(*i);
+
+        const AnimLodInput inNear = LodAt(10.0f, true, 500.0f), inReduced = LodAt(1000.0f, true, 500.0f),
+            inFar = LodAt(3000.0f, true, 500.0f), inOff = LodAt(10.0f, false), inTiny = LodAt(10.0f, true, 10.0f);
+
+        AnimationSystem sys;
+        Pose offPose;
+        auto frame = [&](int f) {
+            const double t = f / 60.0;
+            sys.Begin();
+            AddAt(sys, near, t, false, &inNear);
+            AddAt(sys, reduced, t, false, &inReduced);
+            AddAt(sys, far, t, false, &inFar);
+            AddAt(sys, off, t, false, f == 0 ? &inNear : &inOff);
+            AddAt(sys, tiny, t, false, &inTiny);
+            AddAt(sys, plain, t, false, nullptr);
+            AddAt(sys, tinyLayered, t, true, &inTiny);
+            sys.Update(nullptr);
+            return sys.LastStats();
+            };
+
+        // 0: 화면 밖 인스턴스도 처음엔 보임 → 전부 평가, 말단 생략은 tiny 하나 (레이어 인스턴스 제외)
+        AnimationSystem::Stats st = frame(0);
+        CHECK(st.instances == 7);
+        CHECK(st.lodCount[(size_t)AnimLodLevel::Full] == 5);
+        CHECK(st.lodCount[(size_t)AnimLodLevel::Reduced] == 1 && st.lodCount[(size_t)AnimLodLevel::Far] == 1);
+        CHECK(st.evaluated == 7 && st.interpolated == 0 && st.skipped == 0);
+        CHECK(st.leafSkipped == 1);
+        offPose = off.PoseGlobal();
+
+        // 1: reduced / far 보간, 화면 밖 건너뜀
+        st = frame(1);
+        CHECK(st.lodCount[(size_t)AnimLodLevel::Offscreen] == 1);
+        CHECK(st.evaluated == 4 && st.interpolated == 2 && st.skipped == 1);
+
+        // 2: reduced 새 주기, far 는 아직 보간
+        st = frame(2);
+        CHECK(st.evaluated == 5 && st.interpolated == 1 && st.skipped == 1);
+        CHECK(reduced.LodState().phase == 1 && far.LodState().phase == 3);
+        CHECK(SamePose(off.PoseGlobal(), offPose));
+
+        // 말단 생략 기준 끔 / LOD 자체 끔
+        sys.Lod().leafSkipPixels = 0.0f;
+        st = frame(3);
+        CHECK(st.leafSkipped == 0);
+        sys.Lod().leafSkipPixels = 48.0f;
+        sys.Lod().enabled = false;
+        st = frame(4);
+        CHECK(st.lodCount[(size_t)AnimLodLevel::Full] == 7);
+        CHECK(st.evaluated == 7 && st.leafSkipped == 0);
+        sys.Lod().enabled = true;
+
+        // far 가 주기 중간에 reduced 로 바뀌면 바로 새 주기 (phase 0 → 평가)
+        AnimatedInstance sw;
+        rig.Init(sw);
+        AnimationSystem one;
+        for (int f = 0; f < 3; ++f) {
+            one.Begin();
+            AddAt(one, sw, f / 60.0, false, &inFar);
+            one.Update(nullptr);
+        }
+        CHECK(sw.LodState().phase == 3);
+        one.Begin();
+        AddAt(one, sw, 3 / 60.0, false, &inReduced);
+        one.Update(nullptr);
+        CHECK(one.LastStats().evaluated == 1);
+        CHECK(sw.LodState().level == AnimLodLevel::Reduced && sw.LodState().phase == 1);
+    }
+
+    // 보간 끔: phase 0 은 현재 시간 그대로 (LOD 없는 평가와 같음), 나머지 프레임은 포즈 유지
+    void TestNoInterpolate()
+    {
+        const LodRig rig;
+        AnimatedInstance inst;
+        rig.Init(inst);
+        AnimationSystem sys;
+        sys.Lod().interpolate = false;
+        const AnimLodInput in = LodAt(1000.0f);
+
+        for (int f = 0; f < 8; ++f) {
+            const Pose before = inst.PoseGlobal();
+            sys.Begin();
+            AddAt(sys, inst, f / 64.0, false, &in);
+            sys.Update(nullptr);
+            if (f % 2 == 0) {
+                CHECK(sys.LastStats().evaluated == 1);
+                CHECK(SamePose(inst.PoseGlobal(), Reference(rig, f / 64.0, false)));
+            }
+            else {
+                CHECK(sys.LastStats().skipped == 1);
+                CHECK(SamePose(inst.PoseGlobal(), before));
+            }
+        }
+    }
+}
+
+int main()
+{
+    TestSelect();
+    TestFromView();
+    TestPlan();
+    TestPeriods(false);
+    TestPeriods(true);
+    TestNoInterpolate();
+
+    for (unsigned workers : { 1u, 4u, 8u }) {
+        JobSystem jobs(workers);
+        Scene serial = MakeScene(101), parallel = MakeScene(101);
+
+        AnimationSystem sysS, sysP;
+        sysP.SetBatchSize(3);
+        for (int frame = 0; frame < 20; ++frame) {
+            AddFrame(sysS, serial, frame);
+            sysS.Update(nullptr);
+            AddFrame(sysP, parallel, frame);
+            sysP.Update(&jobs);
+            CHECK(sysP.LastStats().instances == 101);
+
+            for (size_t i = 0; i < serial.insts.size(); ++i) {
+                const auto& a = *serial.insts[i];
+                const auto& b = *parallel.insts[i];
+                CHECK(std::memcmp(a.PoseGlobal().data(), b.PoseGlobal().data(), a.PoseGlobal().size() * sizeof(AnimatedInstance::Matrix)) == 0);
+                CHECK(std::memcmp(a.Palette().data(), b.Palette().data(), a.Palette().size() * sizeof(AnimatedInstance::Matrix)) == 0);
+                CHECK(a.PaletteVersion() == b.PaletteVersion());
+            }
+        }
+    }
+
+    return TestResult("AnimationSystemTest");
+}
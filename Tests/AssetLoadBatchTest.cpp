@@ -0,0 +1,132 @@
+﻿// ============================================================================
+// AssetLoadBatchTest.cpp
+// - AssetLoadBatch (실제 JobSystem, 워커 1 / 4)
+//   · 예외: 나머지 잡이 전부 끝난 뒤 Add 순서로 첫 번째 것을 다시 던짐, ok 플래그
+//   · Stage::ParallelFor 중첩 (잡 → ParallelFor → ParallelFor) 이 교착 없이 전부 처리
+//   · Run(nullptr): 호출 스레드에서 Add 순서대로 (ParallelFor 도 순서대로)
+//   · cpuMs / gpuMs: GpuBegin 기준으로 나뉨, 안 부르면 gpu 0, 두 번 불러도 첫 번째 기준
+// ============================================================================
+
+// ---- includes ----
+#include "TestCommon.h"
+#include "../D3D_Engine(25.12.01. ~ )/AssetLoadBatch.h"
+#include "../D3D_Core/JobSystem.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+static void SleepMs(int ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+int main()
+{
+    for (unsigned workers : { 1u, 4u }) {
+        JobSystem jobs(workers);
+
+        // ---- 예외: 뒤 잡이 먼저 던져도 Add 순서로 첫 번째, 그리고 나머지가 다 끝난 뒤 ----
+        {
+            AssetLoadBatch batch;
+            std::atomic<int> done{ 0 };
+            for (int i = 0; i < 8; ++i) {
+                batch.Add("asset" + std::to_string(i), [&done, i](AssetLoadBatch::Stage& st) {
+                    if (i == 2) { SleepMs(20); throw std::runtime_error("asset2"); }
+                    if (i == 5) throw std::runtime_error("asset5");
+                    if (i == 6)     // 에셋 안 팬아웃에서 던진 것도 잡 실패로
+                        st.ParallelFor(8, [](size_t k) { if (k == 3) throw std::runtime_error("asset6"); });
+                    SleepMs(5);
+                    done.fetch_add(1);
+                    });
+            }
+
+            std::string what;
+            int doneAtCatch = -1;
+            try { batch.Run(&jobs); }
+            catch (const std::runtime_error& e) { what = e.what(); doneAtCatch = done.load(); }
+            CHECK(what == "asset2");
+            CHECK(doneAtCatch == 5);
+            CHECK(batch.Timings().size() == 8);
+            for (int i = 0; i < 8; ++i)
+                CHECK(batch.Timings()[i].ok == (i != 2 && i != 5 && i != 6));
+            CHECK(batch.Threads() == workers + 1);
+        }
+
+        // ---- 중첩 ParallelFor: 워커가 전부 기다리는 중이어도 끝나야 함 ----
+        {
+            AssetLoadBatch batch;
+            std::atomic<int> hits{ 0 };
+            for (int i = 0; i < 8; ++i) {
+                batch.Add("nested" + std::to_string(i), [&hits](AssetLoadBatch::Stage& st) {
+                    st.ParallelFor(8, [&](size_t) {
+                        st.ParallelFor(8, [&](size_t) { hits.fetch_add(1); });
+                        });
+                    });
+            }
+            batch.Run(&jobs);
+            CHECK(hits == 8 * 8 * 8);
+            for (const AssetLoadTiming& t : batch.Timings()) CHECK(t.ok);
+        }
+    }
+
+    // ---- Run(nullptr): 순서대로 ----
+    {
+        AssetLoadBatch batch;
+        std::vector<int> order;
+        const std::thread::id caller = std::this_thread::get_id();
+        bool sameThread = true;
+        for (int i = 0; i < 6; ++i) {
+            batch.Add("serial" + std::to_string(i), [&, i](AssetLoadBatch::Stage& st) {
+                sameThread = sameThread && std::this_thread::get_id() == caller;
+                order.push_back(i * 10);
+                st.ParallelFor(3, [&, i](size_t k) { order.push_back(i * 10 + 1 + (int)k); });
+                });
+        }
+        batch.Run(nullptr);
+        CHECK(sameThread);
+        CHECK(batch.Threads() == 1);
+        std::vector<int> expect;
+        for (int i = 0; i < 6; ++i)
+            for (int k = 0; k < 4; ++k) expect.push_back(i * 10 + k);
+        CHECK(order == expect);
+        for (size_t i = 1; i < batch.Timings().size(); ++i)
+            CHECK(batch.Timings()[i].startMs >= batch.Timings()[i - 1].startMs);
+    }
+
+    // ---- cpu / gpu 나누기 ----
+    {
+        JobSystem jobs(2);
+        AssetLoadBatch batch;
+        batch.Add("split", [](AssetLoadBatch::Stage& st) {
+            SleepMs(30);
+            st.GpuBegin();
+            SleepMs(20);
+            st.GpuBegin();      // 두 번째는 무시
+            SleepMs(10);
+            });
+        batch.Add("cpuOnly", [](AssetLoadBatch::Stage& st) {
+            st.SetFromCache(true);
+            SleepMs(15);
+            });
+        batch.Run(&jobs);
+
+        const AssetLoadTiming& a = batch.Timings()[0];
+        const AssetLoadTiming& b = batch.Timings()[1];
+        CHECK(a.cpuMs >= 29.0);
+        CHECK(a.gpuMs >= 29.0);
+        CHECK(a.cpuMs < a.TotalMs() && a.gpuMs < a.TotalMs());
+        CHECK(!a.fromCache);
+        CHECK(b.cpuMs >= 14.0);
+        CHECK(b.gpuMs == 0.0);
+        CHECK(b.fromCache);
+        CHECK_NEAR(batch.SummedMs(), a.TotalMs() + b.TotalMs(), 1e-9);
+        CHECK(batch.WallMs() >= a.TotalMs());
+        batch.Print();
+    }
+
+    return TestResult("AssetLoadBatchTest");
+}
@@ -0,0 +1,320 @@
+﻿// ============================================================================
+// AssetStreamCoreTest.cpp
+// - AssetStreamCore 스케줄러를 가짜 IStreamBackend 로 (D3D 없음)
+//   · 우선순위: max(0, 거리 - radius) + bias, 디코드/업로드 모두 가까운 것부터, 뷰어/위치 이동 반영
+//   · 대체 → 준비: Resident 전에는 Resource 가 null (AssetStreamer 는 대체 리소스), 이후 백엔드 결과
+//   · 실패: 디코드 nullptr / 예외, 업로드 예외 → Failed
+//   · 취소: Queued / Decoded / Resident / 디코드 중(I/O 스레드) 모두 None, 페이로드/리소스 해제
+//   · 예산: 바이트 예산 안에서만 올리고, 예산보다 큰 항목도 프레임당 1개는 올림
+// ============================================================================
+
+// ---- includes ----
+#include "TestCommon.h"
+#include "../D3D_Engine(25.12.01. ~ )/AssetStreamCore.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    std::atomic<int> gLivePayloads{ 0 };
+    std::atomic<int> gLiveResources{ 0 };
+
+    struct FakePayload : StreamPayload
+    {
+        std::wstring path;
+        FakePayload() { ++gLivePayloads; }
+        ~FakePayload() override { --gLivePayloads; }
+    };
+
+    struct FakeResource : StreamResource
+    {
+        std::wstring path;
+        FakeResource() { ++gLiveResources; }
+        ~FakeResource() override { --gLiveResources; }
+    };
+
+    // path 로 동작 선택: "decode-null" / "decode-throw" / "upload-throw" / "block" (Release 까지 대기)
+    //  - kind = 업로드 바이트 (KB)
+    class FakeBackend : public IStreamBackend
+    {
+    public:
+        std::unique_ptr<StreamPayload> Decode(const StreamRequest& req, const std::atomic<bool>& cancel) override
+        {
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                decoded.push_back(req.path);
+            }
+            if (req.path == L"decode-null") return nullptr;
+            if (req.path == L"decode-throw") throw std::runtime_error("decode");
+            if (req.path == L"block") {
+                std::unique_lock<std::mutex> lock(mMutex);
+                blocked = true;
+                mCv.notify_all();
+                mCv.wait(lock, [&] { return released; });
+                blockResult = cancel.load() ? 2 : 1;
+            }
+            auto p = std::make_unique<FakePayload>();
+            p->path = req.path;
+            p->uploadBytes = uint64_t(req.kind) * 1024;
+            return p;
+        }
+
+        std::shared_ptr<StreamResource> Upload(const StreamRequest& req, StreamPayload& payload) override
+        {
+            uploaded.push_back(req.path);
+            if (req.path == L"upload-throw") throw std::runtime_error("upload");
+            auto r = std::make_shared<FakeResource>();
+            r->path = static_cast<FakePayload&>(payload).path;
+            r->residentBytes = payload.uploadBytes;
+            return r;
+        }
+
+        void WaitBlocked()
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mCv.wait(lock, [&] { return blocked; });
+        }
+
+        void Release()
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            released = true;
+            mCv.notify_all();
+        }
+
+        std::vector<std::wstring> Decoded()
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            return decoded;
+        }
+
+        std::vector<std::wstring> uploaded;     // Update 스레드만
+        std::atomic<int> blockResult{ 0 };     // "block" 디코드 끝: 1 = 취소 못 봄, 2 = 취소 봄
+
+    private:
+        std::mutex mMutex;
+        std::condition_variable mCv;
+        std::vector<std::wstring> decoded;
+        bool blocked = false, released = false;
+    };
+
+    StreamRequest Req(const wchar_t* path, float x, float y = 0.0f, float z = 0.0f, uint32_t kb = 1)
+    {
+        StreamRequest r;
+        r.kind = kb;
+        r.path = path;
+        r.position = { x, y, z };
+        return r;
+    }
+
+    // I/O 스레드 모드에서 조건이 설 때까지 (최대 5초)
+    template <class Fn>
+    bool WaitFor(Fn&& fn)
+    {
+        const auto t0 = std::chrono::steady_clock::now();
+        while (!fn()) {
+            if (std::chrono::steady_clock::now() - t0 > std::chrono::seconds(5)) return false;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+
+    const StreamBudget kUnlimited = { ~0ull, 1e9 };
+
+    void TestPriority()
+    {
+        FakeBackend be;
+        AssetStreamCore core;
+        core.Start(&be, 0);
+
+        const StreamHandle far = core.Request(Req(L"far", 30.0f));
+        const StreamHandle near = core.Request(Req(L"near", 0.0f, 2.0f));
+        StreamRequest big = Req(L"big", 0.0f, 0.0f, 10.0f);
+        big.radius = 9.0f;                          // 표면까지 1
+        const StreamHandle bigH = core.Request(big);
+        StreamRequest urgent = Req(L"urgent", -50.0f);
+        urgent.bias = -100.0f;                      // 50 - 100 = -50
+        const StreamHandle urgentH = core.Request(urgent);
+        StreamRequest inside = Req(L"inside", 3.0f);
+        inside.radius = 5.0f;                       // 뷰어가 안쪽 → 0
+        const StreamHandle insideH = core.Request(inside);
+
+        CHECK_NEAR(core.Priority(far), 30.0, 1e-5);
+        CHECK_NEAR(core.Priority(near), 2.0, 1e-5);
+        CHECK_NEAR(core.Priority(bigH), 1.0, 1e-5);
+        CHECK_NEAR(core.Priority(urgentH), -50.0, 1e-5);
+        CHECK_NEAR(core.Priority(insideH), 0.0, 1e-5);
+        CHECK(core.Priority(StreamHandle{ 999 }) == 0.0f);
+
+        // ioThreads = 0: Update 마다 가장 가까운 것 하나 디코드 → 바로 업로드
+        for (int i = 0; i < 5; ++i) core.Update(kUnlimited);
+        const std::vector<std::wstring> want = { L"urgent", L"inside", L"big", L"near", L"far" };
+        CHECK(be.Decoded() == want);
+        CHECK(be.uploaded == want);
+        CHECK(core.Stats().resident == 5);
+        core.Stop();
+
+        // 뷰어 / 요청 위치가 바뀌면 다음 선택부터 반영
+        FakeBackend be2;
+        core.Start(&be2, 0);
+        const StreamHandle a = core.Request(Req(L"a", 10.0f));
+        const StreamHandle b = core.Request(Req(L"b", -10.0f));
+        core.Request(Req(L"c", 0.0f, 20.0f));
+        core.SetViewer({ -9.0f, 0.0f, 0.0f });
+        CHECK_NEAR(core.Priority(b), 1.0, 1e-5);
+        core.Update(kUnlimited);                    // b
+        core.SetPosition(a, { 0.0f, 0.0f, 0.0f });  // a: 9, c: ~21.9
+        core.SetViewer({ 0.0f, 19.0f, 0.0f });      // a: 19, c: 1
+        core.Update(kUnlimited);                    // c
+        core.Update(kUnlimited);                    // a
+        const std::vector<std::wstring> want2 = { L"b", L"c", L"a" };
+        CHECK(be2.Decoded() == want2);
+        core.Stop();
+    }
+
+    void TestPlaceholderToReady()
+    {
+        FakeBackend be;
+        AssetStreamCore core;
+        core.Start(&be, 0);
+
+        const StreamHandle h = core.Request(Req(L"mesh", 1.0f));
+        const StreamHandle other = core.Request(Req(L"other", 2.0f));
+        CHECK(h.Valid() && other.Valid() && h.id != other.id);
+        CHECK(core.State(h) == StreamState::Queued);
+        CHECK(core.Resource(h) == nullptr);         // 아직 대체 리소스
+
+        core.Update(kUnlimited);
+        CHECK(core.State(h) == StreamState::Resident);
+        CHECK(core.State(other) == StreamState::Queued);
+        CHECK(core.Resource(other) == nullptr);
+        const auto res = std::dynamic_pointer_cast<FakeResource>(core.Resource(h));
+        CHECK(res && res->path == L"mesh");
+        CHECK(gLivePayloads == 0);                  // 업로드 후 페이로드는 버려짐
+
+        const StreamStats s = core.Stats();
+        CHECK(s.resident == 1 && s.queued == 1 && s.residentBytes == 1024);
+        CHECK(s.frameUploads == 1 && s.frameBytes == 1024 && s.totalUploads == 1);
+
+        // 실패 경로
+        const StreamHandle dn = core.Request(Req(L"decode-null", -1.0f));
+        const StreamHandle dt = core.Request(Req(L"decode-throw", -1.0f, 0.5f));
+        const StreamHandle ut = core.Request(Req(L"upload-throw", -1.0f, 1.0f));
+        for (int i = 0; i < 4; ++i) core.Update(kUnlimited);
+        CHECK(core.State(dn) == StreamState::Failed);
+        CHECK(core.State(dt) == StreamState::Failed);
+        CHECK(core.State(ut) == StreamState::Failed);
+        CHECK(core.Resource(ut) == nullptr);
+        CHECK(core.State(other) == StreamState::Resident);
+        CHECK(core.Stats().failed == 3);
+        CHECK(core.State(StreamHandle{}) == StreamState::None);
+
+        core.Stop();
+        CHECK(core.State(h) == StreamState::None);
+        CHECK(gLiveResources == 1);                 // res 가 아직 잡고 있음
+    }
+
+    void TestCancel()
+    {
+        FakeBackend be;
+        AssetStreamCore core;
+        core.Start(&be, 0);
+
+        const StreamHandle queued = core.Request(Req(L"queued", 100.0f));
+        const StreamHandle resident = core.Request(Req(L"resident", 1.0f));
+        core.Update(kUnlimited);
+        CHECK(core.State(resident) == StreamState::Resident);
+        CHECK(gLiveResources == 1);
+
+        core.Cancel(queued);
+        core.Cancel(resident);
+        CHECK(core.State(queued) == StreamState::None);
+        CHECK(core.State(resident) == StreamState::None);
+        CHECK(core.Resource(resident) == nullptr);
+        CHECK(gLiveResources == 0);
+        core.Update(kUnlimited);
+        CHECK(be.Decoded().size() == 1);            // 취소한 Queued 는 디코드하지 않음
+        CHECK(core.Stats().totalCancelled == 2);
+        core.Cancel(queued);                        // 두 번째 취소는 무시
+        CHECK(core.Stats().totalCancelled == 2);
+
+        core.Stop();
+
+        // 디코드 중 (I/O 스레드) 취소 → 끝난 결과를 버림
+        FakeBackend be2;
+        core.Start(&be2, 1);
+        const StreamHandle h = core.Request(Req(L"block", 1.0f));
+        be2.WaitBlocked();
+        CHECK(core.State(h) == StreamState::Decoding);
+        CHECK(core.Stats().decoding == 1);
+        core.Cancel(h);
+        CHECK(core.State(h) == StreamState::None);
+        be2.Release();
+        CHECK(WaitFor([&] { return be2.blockResult != 0 && gLivePayloads == 0; }));
+        CHECK(be2.blockResult == 2);
+        core.Update(kUnlimited);
+        CHECK(be2.uploaded.empty());
+        CHECK(core.Stats().resident == 0 && core.Stats().decoded == 0);
+
+        // 디코드는 끝났고 업로드 전 (Decoded) 취소
+        const StreamHandle d = core.Request(Req(L"decoded", 1.0f));
+        CHECK(WaitFor([&] { return core.State(d) == StreamState::Decoded; }));
+        CHECK(gLivePayloads == 1);
+        core.Cancel(d);
+        CHECK(gLivePayloads == 0);
+        core.Update(kUnlimited);
+        CHECK(be2.uploaded.empty());
+        core.Stop();
+        CHECK(gLivePayloads == 0 && gLiveResources == 0);
+    }
+
+    void TestBudget()
+    {
+        FakeBackend be;
+        AssetStreamCore core;
+        core.Start(&be, 2);
+
+        // 가까운 순: a(4KB) b(4KB) c(16KB) d(1KB)
+        const StreamHandle a = core.Request(Req(L"a", 1.0f, 0.0f, 0.0f, 4));
+        const StreamHandle b = core.Request(Req(L"b", 2.0f, 0.0f, 0.0f, 4));
+        const StreamHandle c = core.Request(Req(L"c", 3.0f, 0.0f, 0.0f, 16));
+        const StreamHandle d = core.Request(Req(L"d", 4.0f, 0.0f, 0.0f, 1));
+        CHECK(WaitFor([&] { return core.Stats().decoded == 4; }));
+
+        const StreamBudget budget = { 10 * 1024, 1e9 };
+        core.Update(budget);                        // a + b = 8KB, c 는 넘침 → 여기서 멈춤 (d 가 새치기 안 함)
+        CHECK(core.State(a) == StreamState::Resident && core.State(b) == StreamState::Resident);
+        CHECK(core.State(c) == StreamState::Decoded && core.State(d) == StreamState::Decoded);
+        CHECK(core.Stats().frameUploads == 2 && core.Stats().frameBytes == 8 * 1024);
+
+        core.Update(budget);                        // c 16KB > 예산이지만 첫 항목이라 올림, d 는 다음
+        CHECK(core.State(c) == StreamState::Resident && core.State(d) == StreamState::Decoded);
+        CHECK(core.Stats().frameUploads == 1 && core.Stats().frameBytes == 16 * 1024);
+
+        core.Update(budget);
+        CHECK(core.State(d) == StreamState::Resident);
+        const std::vector<std::wstring> want = { L"a", L"b", L"c", L"d" };
+        CHECK(be.uploaded == want);
+        CHECK(core.Stats().residentBytes == 25 * 1024 && core.Stats().totalUploads == 4);
+
+        core.Update(budget);                        // 할 일 없음
+        CHECK(core.Stats().frameUploads == 0);
+        core.Stop();
+    }
+}
+
+int main()
+{
+    TestPriority();
+    TestPlaceholderToReady();
+    TestCancel();
+    TestBudget();
+    return TestResult("AssetStreamCoreTest");
+}
@@ -0,0 +1,95 @@
+﻿// ============================================================================
+// JobSystemTest.cpp
+// - ParallelFor: 여러 count / batch / 워커 수에서 모든 인덱스를 정확히 한 번
+// - Submit / Wait: 카운터가 0 이 될 때까지 블록, 같은 카운터 재사용
+// - 예외: 잡에서 던져도 프로세스가 죽지 않고 카운터는 0 으로,
+//   Wait / ParallelFor 가 (나머지 작업이 끝난 뒤) 첫 예외를 다시 던짐. 카운터 없는 잡은 로그만
+// ============================================================================
+
+// ---- includes ----
+#include "TestCommon.h"
+#include "../D3D_Core/JobSystem.h"
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main()
+{
+    for (unsigned workers : { 1u, 3u, 8u }) {
+        JobSystem jobs(workers);
+        CHECK(jobs.WorkerCount() == workers);
+
+        // ---- ParallelFor 커버리지 ----
+        for (size_t count : { 0, 1, 7, 64, 1000, 100003 }) {
+            for (size_t batch : { 0, 1, 3, 64, 1000 }) {
+                if (batch == 1 && count > 1000) continue;   // 작업 10만 개는 의미 없음
+                std::unique_ptr<std::atomic<int>[]> hits(new std::atomic<int>[count + 1]);
+                for (size_t i = 0; i <= count; ++i) hits[i] = 0;
+                jobs.ParallelFor(count, batch, [&](size_t b, size_t e) {
+                    for (size_t i = b; i < e; ++i) hits[i].fetch_add(1, std::memory_order_relaxed);
+                    });
+                bool once = true;
+                for (size_t i = 0; i < count; ++i) once = once && hits[i] == 1;
+                CHECK(once);
+                CHECK(hits[count] == 0);
+            }
+        }
+
+        // ---- Submit / Wait, 카운터 재사용 ----
+        JobCounter counter;
+        std::atomic<int> sum{ 0 };
+        for (int round = 0; round < 3; ++round) {
+            for (int i = 1; i <= 500; ++i)
+                jobs.Submit([&sum, i] { sum.fetch_add(i, std::memory_order_relaxed); }, &counter);
+            jobs.Wait(counter);
+            CHECK(counter.Done());
+        }
+        CHECK(sum == 3 * 500 * 501 / 2);
+
+        // ---- Wait 가 첫 예외를 다시 던짐 (나머지 작업은 모두 실행) ----
+        std::atomic<int> ran{ 0 };
+        for (int i = 0; i < 200; ++i)
+            jobs.Submit([&ran, i] {
+                ran.fetch_add(1, std::memory_order_relaxed);
+                if (i % 50 == 7) throw std::runtime_error("job " + std::to_string(i));
+                }, &counter);
+        bool caught = false;
+        try { jobs.Wait(counter); }
+        catch (const std::runtime_error& e) { caught = std::string(e.what()).rfind("job ", 0) == 0; }
+        CHECK(caught);
+        CHECK(counter.Done());
+        CHECK(ran == 200);
+
+        // 예외를 넘긴 뒤 같은 카운터는 깨끗하게 다시 쓸 수 있어야 함
+        jobs.Submit([] {}, &counter);
+        bool threwAgain = false;
+        try { jobs.Wait(counter); }
+        catch (...) { threwAgain = true; }
+        CHECK(!threwAgain);
+
+        // ---- ParallelFor 예외 ----
+        std::atomic<int> items{ 0 };
+        caught = false;
+        try {
+            jobs.ParallelFor(1000, 10, [&](size_t b, size_t e) {
+                if (b == 500) throw std::logic_error("batch 500");
+                items.fetch_add(int(e - b), std::memory_order_relaxed);
+                });
+        }
+        catch (const std::logic_error&) { caught = true; }
+        CHECK(caught);
+        CHECK(items == 990);
+
+        // ---- 카운터 없는 잡: 로그만 남기고 계속 ----
+        std::atomic<bool> reached{ false };
+        jobs.Submit([&reached] { reached = true; throw 42; });
+        while (!reached) std::this_thread::yield();
+        jobs.ParallelFor(100, 1, [](size_t, size_t) {});   // 풀이 계속 동작하는지
+    }
+
+    return TestResult("JobSystemTest");
+}
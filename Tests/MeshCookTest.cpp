@@ -0,0 +1,227 @@
+﻿// ============================================================================
+// MeshCookTest.cpp
+// - .meshcook 저장 → CookedMesh::Open (Assimp 없음, 합성 메시)
+//   · 매핑한 뷰가 원본과 바이트 단위로 같음: 압축/분리 스트림 (StaticMesh::Build 와 같은 식), 인덱스,
+//     서브메시, LOD 범위, 머티리얼. 섹션 포인터는 64B 정렬
+//   · 거부: 해시 불일치 / 잘린 파일 / 어긋난 오프셋 / 범위 밖 서브메시·LOD / LOD 수 / magic
+//     거부된 뒤에는 열린 상태 아님 (뷰 비어 있음)
+//   · MeshCookSourceHash: 플래그 / 크기가 바뀌면 다른 값, 원본이 없으면 0
+// ============================================================================
+
+// ---- includes ----
+#include "TestCommon.h"
+#include "TestRig.h"
+#include "../D3D_Engine(25.12.01. ~ )/MeshCook.h"
+#include "../D3D_Engine(25.12.01. ~ )/VertexPack.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    // Header 필드 위치 (MeshCook.cpp, 버전 3)
+    constexpr size_t kOffVersion = 4;
+    constexpr size_t kOffLodCount = 36;
+    constexpr size_t kOffPosOffset = 40;
+    constexpr size_t kOffSubmeshOffset = 64;
+    constexpr size_t kOffFileBytes = 96;
+
+    std::string ReadBytes(const fs::path& p)
+    {
+        std::ifstream f(p, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+    }
+
+    void WriteBytes(const fs::path& p, const std::string& s)
+    {
+        std::ofstream(p, std::ios::binary).write(s.data(), std::streamsize(s.size()));
+    }
+
+    template <class T> T Get(const std::string& s, size_t at) { T v; memcpy(&v, &s[at], sizeof(T)); return v; }
+    template <class T> void Put(std::string& s, size_t at, T v) { memcpy(&s[at], &v, sizeof(T)); }
+
+    bool Aligned64(const void* p) { return (reinterpret_cast<uintptr_t>(p) & 63u) == 0; }
+
+    // 정점 2000 개, 서브메시 3 개 (LOD 범위 포함), 머티리얼 2 개
+    MeshData_PNTT MakeMesh()
+    {
+        MeshData_PNTT m;
+        const auto skin = MakeTestSkinVertices(2000, 8, 51);
+        m.vertices.resize(skin.size());
+        for (size_t i = 0; i < skin.size(); ++i) {
+            const VertexCPU_PNTT_BW& s = skin[i];
+            m.vertices[i] = { s.px, s.py, s.pz, s.nx, s.ny, s.nz, s.u, s.v, s.tx, s.ty, s.tz, s.tw };
+        }
+
+        std::mt19937 rng(52);
+        m.indices.resize(3 * 3000);
+        for (auto& i : m.indices) i = uint32_t(rng() % m.vertices.size());
+        m.submeshes = { { 0, 0, 3000, 0 }, { 0, 3000, 3000, 1 }, { 0, 6000, 3000, 1 } };
+        for (uint32_t s = 0; s < 3; ++s)
+            for (uint32_t l = 1; l < kMeshLodLevels; ++l) {
+                SubMeshLodCPU lod;
+                lod.indexStart = s * 3000;
+                lod.indexCount = 3000 / (3 * l) * 3;
+                lod.error = 0.01f * float(l);
+                m.lods.push_back(lod);
+            }
+
+        MaterialCPU a, b;
+        a.diffuse = L"body_d.png";
+        a.normal = L"body_n.png";
+        b.diffuse = L"한글.png";   // 비 ASCII (UTF-16 로 저장)
+        b.diffuseColor[0] = 0.5f;
+        m.materials = { a, b };
+        return m;
+    }
+}
+
+int main()
+{
+    const fs::path dir = fs::temp_directory_path() / "MeshCookTest";
+    std::error_code ec;
+    fs::create_directories(dir, ec);
+
+    const MeshData_PNTT src = MakeMesh();
+    const uint64_t hash = 0xC00C1E5ull;
+    const fs::path file = dir / "mesh.meshcook";
+    VertexPackReport report;
+    CHECK(MeshCookSave(src, hash, MeshCook_FlipUV, file, &report));
+    CHECK(report.staticVerts == src.vertices.size());
+    CHECK(!fs::exists(MeshCookTempPath(file)));
+
+    // ------------------------------------------------------------------------
+    // 매핑한 뷰 == 원본 (StaticMesh::Build 가 만들었을 스트림)
+    // ------------------------------------------------------------------------
+    {
+        const size_t vc = src.vertices.size();
+        std::vector<VertexPacked_PNTT> packed(vc);
+        VertexPackArray(src.vertices.data(), vc, packed.data(), nullptr);
+        std::vector<VertexStreamPos_PNTT> pos(vc);
+        std::vector<VertexStreamAttr> attr(vc);
+        VertexSplitStreams(packed.data(), vc, pos.data(), attr.data());
+
+        CookedMesh c;
+        CHECK(c.Open(file, hash));
+        CHECK(c.IsOpen());
+        CHECK(c.FileBytes() == fs::file_size(file));
+        const MeshCookView& v = c.View();
+        CHECK(v.vertexCount == vc);
+        CHECK(v.indexCount == src.indices.size());
+        CHECK(v.submeshCount == src.submeshes.size());
+        CHECK(v.lodCount == src.lods.size());
+        CHECK(memcmp(v.pos, pos.data(), vc * sizeof(VertexStreamPos_PNTT)) == 0);
+        CHECK(memcmp(v.attr, attr.data(), vc * sizeof(VertexStreamAttr)) == 0);
+        CHECK(memcmp(v.indices, src.indices.data(), src.indices.size() * sizeof(uint32_t)) == 0);
+        CHECK(memcmp(v.submeshes, src.submeshes.data(), src.submeshes.size() * sizeof(SubMeshCPU)) == 0);
+        CHECK(memcmp(v.lods, src.lods.data(), src.lods.size() * sizeof(SubMeshLodCPU)) == 0);
+        CHECK(Aligned64(v.pos) && Aligned64(v.attr) && Aligned64(v.indices)
+            && Aligned64(v.submeshes) && Aligned64(v.lods));
+
+        CHECK(c.Materials().size() == 2);
+        CHECK(c.Materials()[0].diffuse == src.materials[0].diffuse);
+        CHECK(c.Materials()[0].normal == src.materials[0].normal);
+        CHECK(c.Materials()[1].diffuse == src.materials[1].diffuse);
+        CHECK(c.Materials()[1].diffuseColor[0] == 0.5f);
+
+        // LOD 없는 메시는 lods == nullptr
+        MeshData_PNTT noLod = src;
+        noLod.lods.clear();
+        CHECK(MeshCookSave(noLod, hash, 0, dir / "nolod.meshcook"));
+        CookedMesh n;
+        CHECK(n.Open(dir / "nolod.meshcook", hash));
+        CHECK(n.View().lods == nullptr && n.View().lodCount == 0);
+    }
+
+    // ------------------------------------------------------------------------
+    // 거부
+    // ------------------------------------------------------------------------
+    {
+        const std::string bytes = ReadBytes(file);
+        const fs::path bad = dir / "bad.meshcook";
+        auto rejected = [&](const std::string& content) {
+            WriteBytes(bad, content);
+            CookedMesh c;
+            const bool open = c.Open(bad, hash);
+            return !open && !c.IsOpen() && c.View().pos == nullptr && c.Materials().empty();
+            };
+
+        CookedMesh wrongHash;
+        CHECK(!wrongHash.Open(file, hash + 1));
+        CHECK(!wrongHash.IsOpen());
+        CookedMesh missing;
+        CHECK(!missing.Open(dir / "none.meshcook", hash));
+
+        // 잘린 파일 (헤더 안 / 섹션 중간 / 1 바이트 모자람 / 빈 파일)
+        CHECK(rejected(std::string()));
+        CHECK(rejected(bytes.substr(0, 32)));
+        CHECK(rejected(bytes.substr(0, bytes.size() / 2)));
+        CHECK(rejected(bytes.substr(0, bytes.size() - 1)));
+
+        // 뒤에 쓰레기가 붙어도 fileBytes 가 다르면 거부
+        CHECK(rejected(bytes + std::string(64, '\0')));
+
+        std::string s = bytes;
+        Put<uint32_t>(s, 0, 0x12345678u);
+        CHECK(rejected(s));
+
+        s = bytes;
+        Put<uint32_t>(s, kOffVersion, Get<uint32_t>(bytes, kOffVersion) + 1);
+        CHECK(rejected(s));
+
+        // 오프셋이 파일 밖 / 정렬 어긋남
+        s = bytes;
+        Put<uint64_t>(s, kOffPosOffset, Get<uint64_t>(bytes, kOffFileBytes));
+        CHECK(rejected(s));
+        s = bytes;
+        Put<uint64_t>(s, kOffPosOffset, Get<uint64_t>(bytes, kOffPosOffset) + 4);
+        CHECK(rejected(s));
+        s = bytes;
+        Put<uint64_t>(s, kOffSubmeshOffset, ~0ull - 8);
+        CHECK(rejected(s));
+
+        // LOD 수가 서브메시 × 3 이 아님
+        s = bytes;
+        Put<uint32_t>(s, kOffLodCount, Get<uint32_t>(bytes, kOffLodCount) - 1);
+        CHECK(rejected(s));
+
+        // 서브메시 / LOD 범위가 인덱스 밖
+        const uint64_t smOff = Get<uint64_t>(bytes, kOffSubmeshOffset);
+        s = bytes;
+        Put<uint32_t>(s, size_t(smOff) + 2 * sizeof(SubMeshCPU) + 8, 3001);     // 세 번째 indexCount
+        CHECK(rejected(s));
+        const uint64_t lodOff = smOff + 64;     // 서브메시 48B → 다음 64B 경계
+        CHECK(Get<uint32_t>(bytes, size_t(lodOff)) == src.lods[0].indexStart);
+        s = bytes;
+        Put<uint32_t>(s, size_t(lodOff), 9000);
+        CHECK(rejected(s));
+
+        // 원본은 그대로 열림
+        CHECK(!rejected(bytes));
+    }
+
+    // ------------------------------------------------------------------------
+    // MeshCookSourceHash
+    // ------------------------------------------------------------------------
+    {
+        const fs::path fbx = dir / "source.fbx";
+        WriteBytes(fbx, "fbx");
+        const uint64_t h = MeshCookSourceHash(fbx, MeshCook_FlipUV);
+        CHECK(h != 0);
+        CHECK(h == MeshCookSourceHash(fbx, MeshCook_FlipUV));
+        CHECK(h != MeshCookSourceHash(fbx, MeshCook_FlipUV | MeshCook_LeftHanded));
+        WriteBytes(fbx, "fbx2");
+        CHECK(h != MeshCookSourceHash(fbx, MeshCook_FlipUV));
+        CHECK(MeshCookSourceHash(dir / "none.fbx", 0) == 0);
+    }
+
+    fs::remove_all(dir, ec);
+    return TestResult("MeshCookTest");
+}
@@ -0,0 +1,314 @@
+﻿// ============================================================================
+// MeshLodTest.cpp
+// - MeshLodGenerate 를 합성 메시로 (서브메시 5개: UV seam 있는 구 / 열린 격자 / 경계 공유 격자 2개 / 작은 격자)
+//   · 모든 단계: 범위 안, 퇴화 삼각형 없음, 삼각형 수 감소 / 오차 증가
+//   · 구: LOD1 ≤ 51%, LOD3 ≤ 14%, 오차 < 0.1. 단계마다 위치 기준으로 닫혀 있음 (틈 없음),
+//     seam 을 가로지르는 삼각형 없음, 뒤집힌 삼각형 없음
+//   · 열린 격자: 짝 없는 변은 모두 바깥 테두리 위
+//   · 머티리얼 경계 (두 격자가 공유하는 x = 70 열): 모든 단계에서 31 개 위치 그대로
+//   · minTriangles 보다 작은 서브메시: 모든 단계 = LOD0
+// - MeshLodPixelsPerUnit (원근/직교/구 안) / MeshLodSelect (bias 포함)
+// - .meshcook 저장 → 열기: LOD 범위 / 인덱스가 비트 단위로 같음, LOD 없는 메시는 lods 없음
+// ============================================================================
+
+// ---- includes ----
+#include "TestCommon.h"
+#include "../D3D_Engine(25.12.01. ~ )/MeshCook.h"
+#include "../D3D_Engine(25.12.01. ~ )/MeshLod.h"
+#include "../D3D_Engine(25.12.01. ~ )/MeshOptimize.h"
+
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <random>
+#include <set>
+#include <tuple>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    using Pos = std::tuple<float, float, float>;
+    using Edge = std::pair<Pos, Pos>;
+
+    Pos P(const VertexCPU_PNTT& v) { return { v.px, v.py, v.pz }; }
+
+    // 반지름 rad 구 (중심 x = cx). 열 cols 은 열 0 과 위치가 같고 u 만 다름 (UV seam), 극점도 열마다 따로
+    void AppendSphere(std::vector<VertexCPU_PNTT>& v, std::vector<uint32_t>& idx, int rows, int cols, float rad, float cx)
+    {
+        const uint32_t b = uint32_t(v.size());
+        for (int r = 0; r <= rows; ++r)
+            for (int c = 0; c <= cols; ++c) {
+                VertexCPU_PNTT x{};
+                const float th = 3.14159265f * float(r) / float(rows), ph = 6.2831853f * float(c % cols) / float(cols);
+                x.px = cx + rad * std::sin(th) * std::cos(ph);
+                x.py = rad * std::cos(th);
+                x.pz = rad * std::sin(th) * std::sin(ph);
+                if (r == 0 || r == rows) { x.px = cx; x.pz = 0.0f; }
+                x.u = float(c); x.v = float(r);
+                v.push_back(x);
+            }
+        for (int r = 0; r < rows; ++r)
+            for (int c = 0; c < cols; ++c) {
+                const uint32_t a = b + uint32_t(r * (cols + 1) + c), bb = a + 1, d = a + uint32_t(cols) + 1, e = d + 1;
+                if (r > 0)        idx.insert(idx.end(), { a, bb, d });
+                if (r < rows - 1) idx.insert(idx.end(), { bb, e, d });
+            }
+    }
+
+    // x ∈ [x0, x0 + n], z ∈ [0, n] 높이 격자
+    void AppendGrid(std::vector<VertexCPU_PNTT>& v, std::vector<uint32_t>& idx, int n, float x0)
+    {
+        const uint32_t b = uint32_t(v.size());
+        for (int j = 0; j <= n; ++j)
+            for (int i = 0; i <= n; ++i) {
+                VertexCPU_PNTT x{};
+                x.px = x0 + float(i); x.pz = float(j);
+                x.py = 0.3f * std::sin((x0 + float(i)) * 0.2f) * std::cos(float(j) * 0.15f);
+                x.u = float(i); x.v = float(j);
+                v.push_back(x);
+            }
+        for (int j = 0; j < n; ++j)
+            for (int i = 0; i < n; ++i) {
+                const uint32_t a = b + uint32_t(j * (n + 1) + i), bb = a + 1, d = a + uint32_t(n) + 1, e = d + 1;
+                idx.insert(idx.end(), { a, d, bb, bb, d, e });
+            }
+    }
+
+    void AddSubmesh(std::vector<SubMeshCPU>& sm, uint32_t start, size_t end, uint32_t material)
+    {
+        SubMeshCPU s;
+        s.indexStart = start;
+        s.indexCount = uint32_t(end) - start;
+        s.materialIndex = material;
+        sm.push_back(s);
+    }
+
+    struct Level { size_t start, count; float error; };
+
+    std::vector<Level> Levels(const std::vector<SubMeshCPU>& sm, const std::vector<SubMeshLodCPU>& lods, size_t i)
+    {
+        std::vector<Level> out = { { sm[i].indexStart, sm[i].indexCount, 0.0f } };
+        for (uint32_t k = 0; k < kMeshLodLevels - 1; ++k) {
+            const SubMeshLodCPU& l = lods[i * (kMeshLodLevels - 1) + k];
+            out.push_back({ l.indexStart, l.indexCount, l.error });
+        }
+        return out;
+    }
+
+    // 위치 기준 방향 있는 변 → 개수
+    std::map<Edge, int> Edges(const std::vector<VertexCPU_PNTT>& v, const std::vector<uint32_t>& idx, const Level& l)
+    {
+        std::map<Edge, int> e;
+        for (size_t t = l.start; t < l.start + l.count; t += 3)
+            for (int j = 0; j < 3; ++j) ++e[{ P(v[idx[t + j]]), P(v[idx[t + (j + 1) % 3]]) }];
+        return e;
+    }
+
+    void TestGenerate()
+    {
+        std::vector<VertexCPU_PNTT> v;
+        std::vector<uint32_t> idx;
+        std::vector<SubMeshCPU> sm;
+        AppendSphere(v, idx, 64, 128, 1.0f, 0.0f);
+        AddSubmesh(sm, 0, idx.size(), 0);
+        uint32_t start = uint32_t(idx.size());
+        AppendGrid(v, idx, 60, -100.0f);
+        AddSubmesh(sm, start, idx.size(), 1);
+        start = uint32_t(idx.size());
+        AppendGrid(v, idx, 30, 40.0f);                 // x = 70 열이 다음 격자와 위치 공유 (정점은 따로)
+        AddSubmesh(sm, start, idx.size(), 2);
+        start = uint32_t(idx.size());
+        AppendGrid(v, idx, 30, 70.0f);
+        AddSubmesh(sm, start, idx.size(), 3);
+        start = uint32_t(idx.size());
+        AppendGrid(v, idx, 2, 200.0f);                 // 8 삼각형 < minTriangles
+        AddSubmesh(sm, start, idx.size(), 4);
+
+        MeshOptimize(v, idx, sm, nullptr);             // 임포터와 같은 순서 (최적화 → LOD)
+        const size_t lod0Indices = idx.size();
+        std::vector<SubMeshLodCPU> lods;
+        MeshLodReport rep;
+        MeshLodGenerate(v, idx, sm, lods, &rep);
+        MeshLodPrintReport("synthetic", rep);
+        CHECK(lods.size() == sm.size() * (kMeshLodLevels - 1));
+        CHECK(idx.size() > lod0Indices);
+        CHECK(rep.submeshes == sm.size());
+
+        for (size_t i = 0; i < sm.size(); ++i) {
+            const std::vector<Level> L = Levels(sm, lods, i);
+            for (size_t k = 0; k < L.size(); ++k) {
+                CHECK(L[k].start + L[k].count <= idx.size() && L[k].count % 3 == 0);
+                if (k) CHECK(L[k].count <= L[k - 1].count && L[k].error >= L[k - 1].error);
+                size_t degenerate = 0;
+                for (size_t t = L[k].start; t < L[k].start + L[k].count; t += 3) {
+                    const Pos a = P(v[idx[t]]), b = P(v[idx[t + 1]]), c = P(v[idx[t + 2]]);
+                    if (a == b || b == c || a == c) ++degenerate;
+                }
+                CHECK(degenerate == 0);
+            }
+        }
+
+        // 구: 감소율 / 닫힘 / seam / 방향
+        {
+            const std::vector<Level> L = Levels(sm, lods, 0);
+            CHECK(L[1].count * 100 <= L[0].count * 51);
+            CHECK(L[3].count * 100 <= L[0].count * 14);
+            CHECK(L[3].error < 0.1f);
+            for (const Level& l : L) {
+                const std::map<Edge, int> e = Edges(v, idx, l);
+                size_t open = 0;
+                for (const auto& [edge, n] : e)
+                    if (!e.count({ edge.second, edge.first })) ++open;
+
+                size_t straddle = 0, outward = 0;
+                for (size_t t = l.start; t < l.start + l.count; t += 3) {
+                    const VertexCPU_PNTT* c[3] = { &v[idx[t]], &v[idx[t + 1]], &v[idx[t + 2]] };
+                    float umin = c[0]->u, umax = c[0]->u;
+                    for (int j = 1; j < 3; ++j) {
+                        umin = c[j]->u < umin ? c[j]->u : umin;
+                        umax = c[j]->u > umax ? c[j]->u : umax;
+                    }
+                    if (umax - umin > 64.0f) ++straddle;
+
+                    const float ax = c[1]->px - c[0]->px, ay = c[1]->py - c[0]->py, az = c[1]->pz - c[0]->pz;
+                    const float bx = c[2]->px - c[0]->px, by = c[2]->py - c[0]->py, bz = c[2]->pz - c[0]->pz;
+                    const float nx = ay * bz - az * by, ny = az * bx - ax * bz, nz = ax * by - ay * bx;
+                    const float cx = c[0]->px + c[1]->px + c[2]->px;
+                    const float cy = c[0]->py + c[1]->py + c[2]->py;
+                    const float cz = c[0]->pz + c[1]->pz + c[2]->pz;
+                    if (nx * cx + ny * cy + nz * cz > 0.0f) ++outward;
+                }
+                CHECK(open == 0);
+                CHECK(straddle == 0);
+                CHECK(outward == l.count / 3);
+            }
+        }
+
+        // 열린 격자: 짝 없는 변은 테두리 위에만
+        {
+            auto onBorder = [](const Pos& p) {
+                const float x = std::get<0>(p) + 100.0f, z = std::get<2>(p);
+                return x == 0.0f || x == 60.0f || z == 0.0f || z == 60.0f;
+            };
+            for (const Level& l : Levels(sm, lods, 1)) {
+                const std::map<Edge, int> e = Edges(v, idx, l);
+                size_t inner = 0;
+                for (const auto& [edge, n] : e)
+                    if (!e.count({ edge.second, edge.first }) && !(onBorder(edge.first) && onBorder(edge.second))) ++inner;
+                CHECK(inner == 0);
+            }
+        }
+
+        // 머티리얼 경계: 공유 열 x = 70 의 위치 31 개가 두 서브메시 모든 단계에 남음
+        for (size_t i : { 2u, 3u }) {
+            const std::vector<Level> L = Levels(sm, lods, i);
+            CHECK(L[3].count < L[0].count / 2);
+            for (const Level& l : L) {
+                std::set<float> zs;
+                for (size_t t = l.start; t < l.start + l.count; ++t)
+                    if (v[idx[t]].px == 70.0f) zs.insert(v[idx[t]].pz);
+                CHECK(zs.size() == 31);
+            }
+        }
+
+        // 작은 서브메시: LOD 없음
+        for (const Level& l : Levels(sm, lods, 4))
+            CHECK(l.start == sm[4].indexStart && l.count == sm[4].indexCount);
+    }
+
+    // 위치 잡음이 있는 큰 구 (평평한 면이 없어 quadric 이 쉽게 0 이 안 됨)에서도 단계 감소
+    void TestNoisySphere()
+    {
+        std::vector<VertexCPU_PNTT> v;
+        std::vector<uint32_t> idx;
+        AppendSphere(v, idx, 128, 200, 5.0f, 0.0f);
+        std::mt19937 rng(3);
+        std::uniform_real_distribution<float> d(-0.002f, 0.002f);
+        std::map<Pos, Pos> moved;   // seam 양쪽 정점은 같은 곳으로
+        for (VertexCPU_PNTT& x : v) {
+            const Pos k = P(x);
+            if (!moved.count(k)) moved[k] = { x.px + d(rng), x.py + d(rng), x.pz + d(rng) };
+            std::tie(x.px, x.py, x.pz) = moved[k];
+        }
+        std::vector<SubMeshCPU> sm;
+        AddSubmesh(sm, 0, idx.size(), 0);
+        MeshOptimize(v, idx, sm, nullptr);
+        std::vector<SubMeshLodCPU> lods;
+        MeshLodReport r;
+        MeshLodGenerate(v, idx, sm, lods, &r);
+        MeshLodPrintReport("noisy sphere", r);
+        CHECK(r.triangles[3] * 100 <= r.triangles[0] * 14);
+    }
+
+    void TestSelect()
+    {
+        const float err[4] = { 0.0f, 0.01f, 0.04f, 0.1f };
+        CHECK(MeshLodSelect(err, 4, 1e9f, 1.0f, 0) == 0);
+        CHECK(MeshLodSelect(err, 4, 50.0f, 1.0f, 0) == 1);
+        CHECK(MeshLodSelect(err, 4, 5.0f, 1.0f, 0) == 3);
+        CHECK(MeshLodSelect(err, 4, 50.0f, 1.0f, 1) == 2);
+        CHECK(MeshLodSelect(err, 4, 5.0f, 1.0f, 2) == 3);   // bias 는 마지막 단계까지
+        CHECK(MeshLodSelect(err, 1, 5.0f, 1.0f, 2) == 0);
+
+        // 원근 (fov 60, 종횡비 1): 거리 10 (중심 11 - 반지름 1), 높이 1000 → 1000 / (2 · 10 · tan30) ≈ 86.6
+        const float I[16] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
+        float proj[16] = {};
+        proj[0] = 1.732f; proj[5] = 1.732f; proj[10] = 1.0f; proj[11] = 1.0f; proj[14] = -0.1f;
+        const float c[3] = { 0.0f, 0.0f, 11.0f };
+        CHECK_NEAR(MeshLodPixelsPerUnit(c, 1.0f, I, proj, 1000.0f), 86.6, 0.1);
+        const float inside[3] = { 0.0f, 0.0f, 0.5f };
+        CHECK(MeshLodPixelsPerUnit(inside, 1.0f, I, proj, 1000.0f) > 1e8f);
+
+        // 직교 (높이 200 단위 → 4096 px): 거리와 무관하게 20.48
+        float ortho[16] = {};
+        ortho[0] = 0.01f; ortho[5] = 0.01f; ortho[10] = 0.001f; ortho[15] = 1.0f;
+        CHECK_NEAR(MeshLodPixelsPerUnit(c, 1.0f, I, ortho, 4096.0f), 20.48, 1e-3);
+    }
+
+    void TestCookRoundTrip()
+    {
+        const fs::path dir = fs::temp_directory_path() / "MeshLodTest";
+        std::error_code ec;
+        fs::create_directories(dir, ec);
+
+        MeshData_PNTT m;
+        AppendGrid(m.vertices, m.indices, 40, 0.0f);
+        for (VertexCPU_PNTT& x : m.vertices) { x.ny = 1.0f; x.tx = 1.0f; x.tw = 1.0f; }
+        AddSubmesh(m.submeshes, 0, m.indices.size(), 0);
+        MeshLodGenerate(m.vertices, m.indices, m.submeshes, m.lods, nullptr);
+        CHECK(m.lods.size() == kMeshLodLevels - 1);
+
+        CookedMesh c;
+        CHECK(MeshCookSave(m, 123, 0, dir / "lod.meshcook"));
+        CHECK(c.Open(dir / "lod.meshcook", 123));
+        const MeshCookView& view = c.View();
+        CHECK(view.lodCount == m.lods.size() && view.lods != nullptr);
+        if (view.lods && view.lodCount == m.lods.size())
+            CHECK(memcmp(view.lods, m.lods.data(), m.lods.size() * sizeof(SubMeshLodCPU)) == 0);
+        CHECK(view.indexCount == m.indices.size());
+        if (view.indexCount == m.indices.size())
+            CHECK(memcmp(view.indices, m.indices.data(), m.indices.size() * sizeof(uint32_t)) == 0);
+
+        MeshData_PNTT noLod = m;
+        noLod.lods.clear();
+        CookedMesh c2;
+        CHECK(MeshCookSave(noLod, 5, 0, dir / "nolod.meshcook"));
+        CHECK(c2.Open(dir / "nolod.meshcook", 5));
+        CHECK(c2.View().lodCount == 0 && c2.View().lods == nullptr);
+
+        c.Close();
+        c2.Close();
+        fs::remove_all(dir, ec);
+    }
+}
+
+int main()
+{
+    TestGenerate();
+    TestNoisySphere();
+    TestSelect();
+    TestCookRoundTrip();
+    return TestResult("MeshLodTest");
+}
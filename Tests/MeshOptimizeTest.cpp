@@ -0,0 +1,203 @@
+﻿// ============================================================================
+// MeshOptimizeTest.cpp
+// - 섞은 구 메시 (삼각형 순서 + 정점 순서 무작위) 3개 서브메시를 MeshOptimize
+//   · 정점/인덱스 개수, 서브메시마다 삼각형 집합과 감는 방향(winding) 그대로
+//     (삼각형 = 정점 UV 3개, 가장 작은 꼭짓점부터 회전만 허용)
+//   · ACMR 이 0.6 배 미만으로, 정점 범위가 안 겹치면 fetch 효율 증가
+//   · 정점 범위가 겹치면 fetch 재배치만 건너뜀 (skippedFetch), 나머지는 그대로 보존
+// - 단계별: MeshOptFetchRemap 은 순열 (쓰인 정점은 처음 쓰인 순서), VertexCache / Overdraw 도 삼각형 집합 보존
+// - 잘못된 서브메시 (3의 배수 아님 / 범위 밖) 는 건너뜀, 빈 입력
+// ============================================================================
+
+// ---- includes ----
+#include "TestCommon.h"
+#include "../D3D_Engine(25.12.01. ~ )/MeshOptimize.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using Tri = std::array<float, 6>;   // 꼭짓점 3개의 (u, v)
+
+    // 위도 rows × 경도 cols 구 (정점마다 (u, v) = (경도 칸, 위도 칸) → 정점 식별자), 삼각형 순서는 섞음
+    template <class V>
+    void AppendSphere(std::vector<V>& verts, std::vector<uint32_t>& idx, int rows, int cols, std::mt19937& rng)
+    {
+        const uint32_t base = uint32_t(verts.size());
+        for (int r = 0; r <= rows; ++r)
+            for (int c = 0; c <= cols; ++c) {
+                V v{};
+                const float th = 3.14159265f * float(r) / float(rows), ph = 6.2831853f * float(c) / float(cols);
+                v.px = std::sin(th) * std::cos(ph); v.py = std::cos(th); v.pz = std::sin(th) * std::sin(ph);
+                v.nx = v.px; v.ny = v.py; v.nz = v.pz;
+                v.u = float(c); v.v = float(r);
+                verts.push_back(v);
+            }
+
+        std::vector<std::array<uint32_t, 3>> tris;
+        for (int r = 0; r < rows; ++r)
+            for (int c = 0; c < cols; ++c) {
+                const uint32_t a = base + uint32_t(r * (cols + 1) + c), b = a + 1, d = a + uint32_t(cols) + 1, e = d + 1;
+                tris.push_back({ a, d, b });
+                tris.push_back({ b, d, e });
+            }
+        std::shuffle(tris.begin(), tris.end(), rng);
+        for (const auto& t : tris) idx.insert(idx.end(), t.begin(), t.end());
+    }
+
+    // 정렬된 삼각형 목록 (회전은 같은 삼각형, 뒤집힌 winding 은 다른 삼각형)
+    template <class V>
+    std::vector<Tri> TriangleSet(const std::vector<V>& verts, const uint32_t* idx, size_t count)
+    {
+        std::vector<Tri> out;
+        for (size_t i = 0; i + 2 < count; i += 3) {
+            std::array<std::array<float, 2>, 3> k;
+            for (int j = 0; j < 3; ++j) k[j] = { verts[idx[i + j]].u, verts[idx[i + j]].v };
+            const int m = int(std::min_element(k.begin(), k.end()) - k.begin());
+            Tri t;
+            for (int j = 0; j < 3; ++j) { t[j * 2] = k[(m + j) % 3][0]; t[j * 2 + 1] = k[(m + j) % 3][1]; }
+            out.push_back(t);
+        }
+        std::sort(out.begin(), out.end());
+        return out;
+    }
+
+    // 서브메시 3개 (정점 범위가 따로), 정점 순서는 서브메시 안에서만 (overlap 이면 전체에서) 섞음
+    template <class V>
+    void MakeShuffledSpheres(std::vector<V>& verts, std::vector<uint32_t>& idx, std::vector<SubMeshCPU>& sm,
+        bool overlap, uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::vector<size_t> ranges;
+        for (uint32_t s = 0; s < 3; ++s) {
+            SubMeshCPU x;
+            x.indexStart = uint32_t(idx.size());
+            const size_t v0 = verts.size();
+            AppendSphere(verts, idx, 40 + int(s) * 10, 60, rng);
+            x.indexCount = uint32_t(idx.size()) - x.indexStart;
+            x.materialIndex = s;
+            sm.push_back(x);
+            ranges.push_back(verts.size() - v0);
+        }
+
+        std::vector<uint32_t> perm(verts.size());
+        std::iota(perm.begin(), perm.end(), 0u);
+        if (overlap) std::shuffle(perm.begin(), perm.end(), rng);
+        else {
+            size_t s0 = 0;
+            for (size_t n : ranges) { std::shuffle(perm.begin() + s0, perm.begin() + s0 + n, rng); s0 += n; }
+        }
+        std::vector<V> moved(verts.size());
+        for (size_t i = 0; i < verts.size(); ++i) moved[perm[i]] = verts[i];
+        for (uint32_t& i : idx) i = perm[i];
+        verts.swap(moved);
+    }
+
+    template <class V>
+    void TestMesh(const char* label, bool overlap)
+    {
+        std::vector<V> verts;
+        std::vector<uint32_t> idx;
+        std::vector<SubMeshCPU> sm;
+        MakeShuffledSpheres(verts, idx, sm, overlap, 7);
+
+        std::vector<std::vector<Tri>> before;
+        for (const SubMeshCPU& s : sm) before.push_back(TriangleSet(verts, idx.data() + s.indexStart, s.indexCount));
+        const size_t vc = verts.size(), ic = idx.size();
+
+        MeshOptReport r;
+        MeshOptimize(verts, idx, sm, &r);
+        CHECK(verts.size() == vc && idx.size() == ic);
+        CHECK(std::all_of(idx.begin(), idx.end(), [&](uint32_t i) { return i < vc; }));
+        for (size_t s = 0; s < sm.size(); ++s)
+            CHECK(before[s] == TriangleSet(verts, idx.data() + sm[s].indexStart, sm[s].indexCount));
+
+        CHECK(r.submeshes == 3);
+        CHECK(r.triangles == ic / 3);
+        CHECK(r.AcmrAfter() < r.AcmrBefore() * 0.6);
+        if (overlap) CHECK(r.skippedFetch == 3);
+        else {
+            CHECK(r.skippedFetch == 0);
+            CHECK(r.FetchEfficiencyAfter() > r.FetchEfficiencyBefore());
+        }
+        MeshOptPrintReport(label, r);
+    }
+
+    void TestStages()
+    {
+        std::mt19937 rng(11);
+        std::vector<VertexCPU_PNTT> verts;
+        std::vector<uint32_t> idx;
+        AppendSphere(verts, idx, 30, 40, rng);
+        const std::vector<Tri> before = TriangleSet(verts, idx.data(), idx.size());
+        const uint64_t missBefore = MeshOptCacheMisses(idx.data(), idx.size(), verts.size(), 16);
+
+        MeshOptVertexCache(idx.data(), idx.size(), verts.size());
+        CHECK(TriangleSet(verts, idx.data(), idx.size()) == before);
+        const uint64_t missCache = MeshOptCacheMisses(idx.data(), idx.size(), verts.size(), 16);
+        CHECK(missCache * 10 < missBefore * 6);
+
+        MeshOptOverdraw(idx.data(), idx.size(), &verts[0].px, sizeof(VertexCPU_PNTT), verts.size(), 16, 1.05f);
+        CHECK(TriangleSet(verts, idx.data(), idx.size()) == before);
+        CHECK(MeshOptCacheMisses(idx.data(), idx.size(), verts.size(), 16) <= missCache * 1.05 + 3 * 16);
+
+        // 끝에 안 쓰는 정점 5개 → 순열의 맨 뒤 (원래 순서)
+        verts.resize(verts.size() + 5);
+        std::vector<uint32_t> remap(verts.size());
+        const size_t used = MeshOptFetchRemap(idx.data(), idx.size(), verts.size(), remap.data());
+        CHECK(used == verts.size() - 5);
+        std::vector<uint32_t> sorted = remap;
+        std::sort(sorted.begin(), sorted.end());
+        std::vector<uint32_t> iota(verts.size());
+        std::iota(iota.begin(), iota.end(), 0u);
+        CHECK(sorted == iota);
+        uint32_t next = 0;
+        bool firstUse = true;
+        std::vector<bool> seen(verts.size(), false);
+        for (uint32_t i : idx) {
+            if (seen[i]) continue;
+            seen[i] = true;
+            firstUse = firstUse && remap[i] == next++;
+        }
+        CHECK(firstUse);
+        for (size_t k = 0; k < 5; ++k) CHECK(remap[verts.size() - 5 + k] == used + k);
+    }
+
+    void TestEdgeCases()
+    {
+        // 3의 배수가 아니거나 범위를 벗어난 서브메시는 건드리지 않음
+        std::vector<VertexCPU_PNTT> v(3);
+        std::vector<uint32_t> i = { 0, 1, 2, 0 };
+        const std::vector<uint32_t> iBefore = i;
+        std::vector<SubMeshCPU> s = { { 0, 0, 4, 0 }, { 0, 10, 3, 0 } };
+        MeshOptReport r;
+        MeshOptimize(v, i, s, &r);
+        CHECK(r.submeshes == 0 && i == iBefore);
+
+        std::vector<uint32_t> one = { 0, 1, 2 };
+        std::vector<SubMeshCPU> s1 = { { 0, 0, 3, 0 } };
+        MeshOptReport r1;
+        MeshOptimize(v, one, s1, &r1);
+        CHECK(r1.submeshes == 1 && r1.triangles == 1 && r1.vertices == 3);
+
+        std::vector<VertexCPU_PNTT> none;
+        std::vector<uint32_t> noIdx;
+        MeshOptimize(none, noIdx, {}, nullptr);
+        CHECK(none.empty() && noIdx.empty());
+    }
+}
+
+int main()
+{
+    TestMesh<VertexCPU_PNTT>("static", false);
+    TestMesh<VertexCPU_PNTT_BW>("skinned", false);
+    TestMesh<VertexCPU_PNTT>("overlapping ranges", true);
+    TestStages();
+    TestEdgeCases();
+    return TestResult("MeshOptimizeTest");
+}
@@ -0,0 +1,258 @@
+﻿// ============================================================================
+// Tests/Shim/directxtk/SimpleMath.h
+// - 헤드리스 테스트 (비 Windows) 용 DirectXTK SimpleMath 대체 헤더
+//   · 엔진 코드가 실제로 쓰는 부분만: 같은 메모리 배치 (Vector3 12B / Quaternion 16B / Matrix row-major 64B)
+//   · 곱 순서 / Create* / Decompose 는 SimpleMath 와 같은 규칙 (row-vector, v * M)
+// - Windows 빌드는 vcpkg 의 진짜 DirectXTK 를 쓴다 (이 폴더는 Tests/CMakeLists.txt 가 비 Windows 에서만 추가)
+// ============================================================================
+
+#pragma once
+
+// ---- includes ----
+#include <cmath>
+
+namespace DirectX
+{
+    struct XMFLOAT4X4
+    {
+        union
+        {
+            struct
+            {
+                float _11, _12, _13, _14;
+                float _21, _22, _23, _24;
+                float _31, _32, _33, _34;
+                float _41, _42, _43, _44;
+            };
+            float m[4][4];
+        };
+    };
+
+    constexpr float XM_PI = 3.141592654f;
+    constexpr float XM_PIDIV2 = 1.570796327f;
+    inline float XMConvertToRadians(float deg) { return deg * (XM_PI / 180.0f); }
+
+    namespace SimpleMath
+    {
+        struct Vector2
+        {
+            float x = 0.0f, y = 0.0f;
+            Vector2() = default;
+            Vector2(float ix, float iy) : x(ix), y(iy) {}
+        };
+
+        struct Vector3
+        {
+            float x = 0.0f, y = 0.0f, z = 0.0f;
+            Vector3() = default;
+            Vector3(float ix, float iy, float iz) : x(ix), y(iy), z(iz) {}
+
+            Vector3 operator+(const Vector3& o) const { return { x + o.x, y + o.y, z + o.z }; }
+            Vector3 operator-(const Vector3& o) const { return { x - o.x, y - o.y, z - o.z }; }
+            Vector3 operator*(float s) const { return { x * s, y * s, z * s }; }
+            Vector3 operator-() const { return { -x, -y, -z }; }
+            Vector3& operator+=(const Vector3& o) { x += o.x; y += o.y; z += o.z; return *this; }
+            Vector3& operator-=(const Vector3& o) { x -= o.x; y -= o.y; z -= o.z; return *this; }
+            Vector3& operator*=(float s) { x *= s; y *= s; z *= s; return *this; }
+            bool operator==(const Vector3& o) const { return x == o.x && y == o.y && z == o.z; }
+
+            float Dot(const Vector3& o) const { return x * o.x + y * o.y + z * o.z; }
+            Vector3 Cross(const Vector3& o) const { return { y * o.z - z * o.y, z * o.x - x * o.z, x * o.y - y * o.x }; }
+            float LengthSquared() const { return Dot(*this); }
+            float Length() const { return std::sqrt(LengthSquared()); }
+            void Normalize() { const float l = Length(); if (l > 0.0f) *this *= 1.0f / l; }
+
+            static Vector3 Transform(const Vector3& v, const struct Matrix& m);
+            static Vector3 TransformNormal(const Vector3& v, const struct Matrix& m);
+
+            static const Vector3 Zero;
+            static const Vector3 One;
+            static const Vector3 UnitX;
+            static const Vector3 UnitY;
+            static const Vector3 UnitZ;
+        };
+        inline Vector3 operator*(float s, const Vector3& v) { return v * s; }
+        inline const Vector3 Vector3::Zero{ 0, 0, 0 };
+        inline const Vector3 Vector3::One{ 1, 1, 1 };
+        inline const Vector3 Vector3::UnitX{ 1, 0, 0 };
+        inline const Vector3 Vector3::UnitY{ 0, 1, 0 };
+        inline const Vector3 Vector3::UnitZ{ 0, 0, 1 };
+
+        struct Vector4
+        {
+            float x = 0.0f, y = 0.0f, z = 0.0f, w = 0.0f;
+            Vector4() = default;
+            Vector4(float ix, float iy, float iz, float iw) : x(ix), y(iy), z(iz), w(iw) {}
+        };
+
+        struct Quaternion
+        {
+            float x = 0.0f, y = 0.0f, z = 0.0f, w = 1.0f;
+            Quaternion() = default;
+            Quaternion(float ix, float iy, float iz, float iw) : x(ix), y(iy), z(iz), w(iw) {}
+
+            float Dot(const Quaternion& o) const { return x * o.x + y * o.y + z * o.z + w * o.w; }
+            float Length() const { return std::sqrt(Dot(*this)); }
+            void Normalize() { const float l = Length(); if (l > 0.0f) { x /= l; y /= l; z /= l; w /= l; } }
+
+            // XMQuaternionRotationAxis 와 같은 규칙 (축은 정규화되어 있다고 가정)
+            static Quaternion CreateFromAxisAngle(const Vector3& axis, float angle)
+            {
+                const float s = std::sin(0.5f * angle);
+                return { axis.x * s, axis.y * s, axis.z * s, std::cos(0.5f * angle) };
+            }
+
+            static const Quaternion Identity;
+        };
+        inline const Quaternion Quaternion::Identity{ 0, 0, 0, 1 };
+
+        struct Matrix : XMFLOAT4X4
+        {
+            Matrix()
+            {
+                for (int r = 0; r < 4; ++r)
+                    for (int c = 0; c < 4; ++c) m[r][c] = (r == c) ? 1.0f : 0.0f;
+            }
+            Matrix(float m00, float m01, float m02, float m03,
+                float m10, float m11, float m12, float m13,
+                float m20, float m21, float m22, float m23,
+                float m30, float m31, float m32, float m33)
+            {
+                const float v[16] = { m00, m01, m02, m03, m10, m11, m12, m13, m20, m21, m22, m23, m30, m31, m32, m33 };
+                for (int i = 0; i < 16; ++i) m[i / 4][i % 4] = v[i];
+            }
+            explicit Matrix(const float* pArray)
+            {
+                for (int i = 0; i < 16; ++i) m[i / 4][i % 4] = pArray[i];
+            }
+
+            Matrix operator*(const Matrix& b) const
+            {
+                Matrix r;
+                for (int i = 0; i < 4; ++i)
+                    for (int j = 0; j < 4; ++j)
+                        r.m[i][j] = m[i][0] * b.m[0][j] + m[i][1] * b.m[1][j] + m[i][2] * b.m[2][j] + m[i][3] * b.m[3][j];
+                return r;
+            }
+            Matrix& operator*=(const Matrix& b) { *this = *this * b; return *this; }
+            bool operator==(const Matrix& b) const
+            {
+                for (int i = 0; i < 16; ++i) if (m[i / 4][i % 4] != b.m[i / 4][i % 4]) return false;
+                return true;
+            }
+            bool operator!=(const Matrix& b) const { return !(*this == b); }
+
+            Vector3 Translation() const { return { _41, _42, _43 }; }
+            void Translation(const Vector3& t) { _41 = t.x; _42 = t.y; _43 = t.z; }
+
+            Matrix Transpose() const
+            {
+                Matrix r;
+                for (int i = 0; i < 4; ++i)
+                    for (int j = 0; j < 4; ++j) r.m[i][j] = m[j][i];
+                return r;
+            }
+
+            // 일반 4x4 역행렬 (여인수 전개). 특이 행렬이면 0 행렬
+            Matrix Invert() const
+            {
+                const float* a = &m[0][0];
+                float inv[16];
+                inv[0] = a[5] * a[10] * a[15] - a[5] * a[11] * a[14] - a[9] * a[6] * a[15] + a[9] * a[7] * a[14] + a[13] * a[6] * a[11] - a[13] * a[7] * a[10];
+                inv[4] = -a[4] * a[10] * a[15] + a[4] * a[11] * a[14] + a[8] * a[6] * a[15] - a[8] * a[7] * a[14] - a[12] * a[6] * a[11] + a[12] * a[7] * a[10];
+                inv[8] = a[4] * a[9] * a[15] - a[4] * a[11] * a[13] - a[8] * a[5] * a[15] + a[8] * a[7] * a[13] + a[12] * a[5] * a[11] - a[12] * a[7] * a[9];
+                inv[12] = -a[4] * a[9] * a[14] + a[4] * a[10] * a[13] + a[8] * a[5] * a[14] - a[8] * a[6] * a[13] - a[12] * a[5] * a[10] + a[12] * a[6] * a[9];
+                inv[1] = -a[1] * a[10] * a[15] + a[1] * a[11] * a[14] + a[9] * a[2] * a[15] - a[9] * a[3] * a[14] - a[13] * a[2] * a[11] + a[13] * a[3] * a[10];
+                inv[5] = a[0] * a[10] * a[15] - a[0] * a[11] * a[14] - a[8] * a[2] * a[15] + a[8] * a[3] * a[14] + a[12] * a[2] * a[11] - a[12] * a[3] * a[10];
+                inv[9] = -a[0] * a[9] * a[15] + a[0] * a[11] * a[13] + a[8] * a[1] * a[15] - a[8] * a[3] * a[13] - a[12] * a[1] * a[11] + a[12] * a[3] * a[9];
+                inv[13] = a[0] * a[9] * a[14] - a[0] * a[10] * a[13] - a[8] * a[1] * a[14] + a[8] * a[2] * a[13] + a[12] * a[1] * a[10] - a[12] * a[2] * a[9];
+                inv[2] = a[1] * a[6] * a[15] - a[1] * a[7] * a[14] - a[5] * a[2] * a[15] + a[5] * a[3] * a[14] + a[13] * a[2] * a[7] - a[13] * a[3] * a[6];
+                inv[6] = -a[0] * a[6] * a[15] + a[0] * a[7] * a[14] + a[4] * a[2] * a[15] - a[4] * a[3] * a[14] - a[12] * a[2] * a[7] + a[12] * a[3] * a[6];
+                inv[10] = a[0] * a[5] * a[15] - a[0] * a[7] * a[13] - a[4] * a[1] * a[15] + a[4] * a[3] * a[13] + a[12] * a[1] * a[7] - a[12] * a[3] * a[5];
+                inv[14] = -a[0] * a[5] * a[14] + a[0] * a[6] * a[13] + a[4] * a[1] * a[14] - a[4] * a[2] * a[13] - a[12] * a[1] * a[6] + a[12] * a[2] * a[5];
+                inv[3] = -a[1] * a[6] * a[11] + a[1] * a[7] * a[10] + a[5] * a[2] * a[11] - a[5] * a[3] * a[10] - a[9] * a[2] * a[7] + a[9] * a[3] * a[6];
+                inv[7] = a[0] * a[6] * a[11] - a[0] * a[7] * a[10] - a[4] * a[2] * a[11] + a[4] * a[3] * a[10] + a[8] * a[2] * a[7] - a[8] * a[3] * a[6];
+                inv[11] = -a[0] * a[5] * a[11] + a[0] * a[7] * a[9] + a[4] * a[1] * a[11] - a[4] * a[3] * a[9] - a[8] * a[1] * a[7] + a[8] * a[3] * a[5];
+                inv[15] = a[0] * a[5] * a[10] - a[0] * a[6] * a[9] - a[4] * a[1] * a[10] + a[4] * a[2] * a[9] + a[8] * a[1] * a[6] - a[8] * a[2] * a[5];
+                const float det = a[0] * inv[0] + a[1] * inv[4] + a[2] * inv[8] + a[3] * inv[12];
+                Matrix r;
+                const float s = (det != 0.0f) ? 1.0f / det : 0.0f;
+                for (int i = 0; i < 16; ++i) r.m[i / 4][i % 4] = inv[i] * s;
+                return r;
+            }
+
+            // XMMatrixDecompose 와 같은 배치: 행 길이 = 스케일, 남은 3x3 → 쿼터니언
+            bool Decompose(Vector3& scale, Quaternion& rot, Vector3& trans) const
+            {
+                trans = Translation();
+                float r[3][3];
+                float len[3];
+                for (int i = 0; i < 3; ++i) {
+                    len[i] = std::sqrt(m[i][0] * m[i][0] + m[i][1] * m[i][1] + m[i][2] * m[i][2]);
+                    for (int j = 0; j < 3; ++j) r[i][j] = (len[i] > 0.0f) ? m[i][j] / len[i] : 0.0f;
+                }
+                scale = { len[0], len[1], len[2] };
+                if (len[0] == 0.0f || len[1] == 0.0f || len[2] == 0.0f) { rot = Quaternion::Identity; return false; }
+
+                const float tr = r[0][0] + r[1][1] + r[2][2];
+                if (tr > 0.0f) {
+                    const float s = 2.0f * std::sqrt(1.0f + tr);
+                    rot = { (r[1][2] - r[2][1]) / s, (r[2][0] - r[0][2]) / s, (r[0][1] - r[1][0]) / s, 0.25f * s };
+                }
+                else if (r[0][0] > r[1][1] && r[0][0] > r[2][2]) {
+                    const float s = 2.0f * std::sqrt(1.0f + r[0][0] - r[1][1] - r[2][2]);
+                    rot = { 0.25f * s, (r[0][1] + r[1][0]) / s, (r[0][2] + r[2][0]) / s, (r[1][2] - r[2][1]) / s };
+                }
+                else if (r[1][1] > r[2][2]) {
+                    const float s = 2.0f * std::sqrt(1.0f - r[0][0] + r[1][1] - r[2][2]);
+                    rot = { (r[0][1] + r[1][0]) / s, 0.25f * s, (r[1][2] + r[2][1]) / s, (r[2][0] - r[0][2]) / s };
+                }
+                else {
+                    const float s = 2.0f * std::sqrt(1.0f - r[0][0] - r[1][1] + r[2][2]);
+                    rot = { (r[0][2] + r[2][0]) / s, (r[1][2] + r[2][1]) / s, 0.25f * s, (r[0][1] - r[1][0]) / s };
+                }
+                return true;
+            }
+
+            static Matrix CreateTranslation(const Vector3& t)
+            {
+                Matrix r; r._41 = t.x; r._42 = t.y; r._43 = t.z; return r;
+            }
+            static Matrix CreateTranslation(float x, float y, float z) { return CreateTranslation(Vector3(x, y, z)); }
+            static Matrix CreateScale(const Vector3& s)
+            {
+                Matrix r; r._11 = s.x; r._22 = s.y; r._33 = s.z; return r;
+            }
+            static Matrix CreateScale(float x, float y, float z) { return CreateScale(Vector3(x, y, z)); }
+            static Matrix CreateScale(float s) { return CreateScale(Vector3(s, s, s)); }
+            // XMMatrixRotationQuaternion 과 같은 배치
+            static Matrix CreateFromQuaternion(const Quaternion& q)
+            {
+                const float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+                const float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+                const float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+                return {
+                    1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy), 0.0f,
+                    2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx), 0.0f,
+                    2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy), 0.0f,
+                    0.0f, 0.0f, 0.0f, 1.0f };
+            }
+
+            static const Matrix Identity;
+        };
+        inline const Matrix Matrix::Identity{};
+
+        inline Vector3 Vector3::Transform(const Vector3& v, const Matrix& m)
+        {
+            return { v.x * m._11 + v.y * m._21 + v.z * m._31 + m._41,
+                     v.x * m._12 + v.y * m._22 + v.z * m._32 + m._42,
+                     v.x * m._13 + v.y * m._23 + v.z * m._33 + m._43 };
+        }
+        inline Vector3 Vector3::TransformNormal(const Vector3& v, const Matrix& m)
+        {
+            return { v.x * m._11 + v.y * m._21 + v.z * m._31,
+                     v.x * m._12 + v.y * m._22 + v.z * m._32,
+                     v.x * m._13 + v.y * m._23 + v.z * m._33 };
+        }
+    }
+}
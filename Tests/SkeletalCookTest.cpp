@@ -0,0 +1,205 @@
+﻿// ============================================================================
+// SkeletalCookTest.cpp
+// - .skelcook 저장 → 로드 왕복 (합성 스키닝 / 리지드 데이터, Assimp 없음)
+//   · 로드 결과가 원본과 비트 단위로 같음 (SkelCookEqual: 스켈레톤 파생값 / 바인딩 / 압축 클립 / 파트)
+//   · 로드한 데이터를 다시 저장하면 바이트가 같은 파일
+//   · 파트 스트림 / 인덱스는 64B 정렬 (매핑 포인터를 그대로 Build)
+// - 해시가 다르거나 잘린 파일은 거부, 임의 바이트 변조는 거부되거나 비교에서 잡힘 (죽지 않음)
+// - SkelCookUsedMaterials: 쓰는 / 안 쓰는 / 범위 밖 머티리얼 인덱스 (리지드·스키닝 파트, 로드 후 매핑 데이터)
+// ============================================================================
+
+// ---- includes ----
+#include "TestCommon.h"
+#include "TestRig.h"
+#include "../D3D_Engine(25.12.01. ~ )/SkeletalCook.h"
+#include "../D3D_Engine(25.12.01. ~ )/VertexPack.h"
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    // 리그 40 노드 + 클립 3개 (마지막은 길이 0) + 머티리얼 3개 + 파트 2개 (서브메시 2개씩)
+    void MakeCookData(SkelCookData& d, bool skinned)
+    {
+        d = SkelCookData{};
+        d.flags = SkelCook_KeepBindT | (skinned ? SkelCook_Skinned : 0u);
+        auto sk = MakeTestSkeleton(40, skinned ? 31 : 32);
+        sk->globalInv = DirectX::SimpleMath::Matrix::CreateTranslation(1.0f, 2.0f, 3.0f);
+        if (!skinned) {
+            sk->boneNames.clear();
+            sk->boneNodes.clear();
+            sk->boneOffsets.clear();
+        }
+        d.skeleton = sk;
+
+        for (int m = 0; m < 3; ++m) {
+            MaterialCPU mc;
+            mc.diffuse = L"tex" + std::to_wstring(m) + L".png";
+            if (m) mc.normal = L"n.png";
+            mc.diffuseColor[1] = 0.25f * float(m);
+            d.materials.push_back(mc);
+        }
+
+        std::mt19937 rng(33);
+        for (int p = 0; p < 2; ++p) {
+            const size_t vc = 3000 + 123 * size_t(p);
+            std::vector<uint32_t> idx(vc * 3);
+            for (auto& i : idx) i = uint32_t(rng() % vc);
+            const uint32_t half = uint32_t(idx.size() / 2);
+            const std::vector<SubMeshCPU> sm = { { 0, 0, half, 0 }, { 0, half, half, 2 } };
+
+            const auto skin = MakeTestSkinVertices(vc, 40, 34 + uint32_t(p));
+            if (skinned) {
+                d.AddPart(p * 7, skin.data(), vc, idx, sm, nullptr);
+            }
+            else {
+                std::vector<VertexCPU_PNTT> v(vc);
+                for (size_t i = 0; i < vc; ++i) {
+                    const VertexCPU_PNTT_BW& s = skin[i];
+                    v[i] = { s.px, s.py, s.pz, s.nx, s.ny, s.nz, s.u, s.v, s.tx, s.ty, s.tz, s.tw };
+                }
+                d.AddPart(p * 3, v.data(), vc, idx, sm, nullptr);
+            }
+        }
+
+        for (uint32_t c = 0; c < 3; ++c) {
+            auto clip = MakeTestClip(*sk, c == 2 ? 1 : 31, 40 + c);
+            d.clips.push_back(clip);
+        }
+        SkelCookFinishClips(d);
+    }
+
+    std::string ReadBytes(const fs::path& p)
+    {
+        std::ifstream f(p, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+    }
+
+    void WriteBytes(const fs::path& p, const std::string& s)
+    {
+        std::ofstream(p, std::ios::binary).write(s.data(), std::streamsize(s.size()));
+    }
+
+    bool Aligned64(const void* p) { return (reinterpret_cast<uintptr_t>(p) & 63u) == 0; }
+
+    void TestRoundTrip(const fs::path& dir, bool skinned)
+    {
+        const char* kind = skinned ? "skinned" : "rigid";
+        SkelCookData d;
+        MakeCookData(d, skinned);
+
+        const uint64_t hash = skinned ? 0x5EC0DE01ull : 0x5EC0DE02ull;
+        const fs::path a = dir / "a.skelcook", b = dir / "b.skelcook", c = dir / "c.skelcook";
+        CHECK(SkelCookSave(d, hash, a));
+
+        SkelCookData l;
+        CHECK(SkelCookLoad(a, hash, l));
+        std::string what;
+        if (!CHECK(SkelCookEqual(d, l, &what))) printf("  %s: first difference: %s\n", kind, what.c_str());
+        CHECK(l.Skinned() == skinned);
+        for (const SkelCookPart& p : l.parts)
+            CHECK(Aligned64(p.pos) && Aligned64(p.attr) && Aligned64(p.indices));
+
+        // 로드 → 다시 저장 = 같은 바이트
+        CHECK(SkelCookSave(l, hash, b));
+        const std::string bytes = ReadBytes(a);
+        CHECK(!bytes.empty() && bytes == ReadBytes(b));
+
+        // 이동해도 매핑 포인터 유효
+        SkelCookData moved = std::move(l);
+        CHECK(SkelCookEqual(d, moved));
+
+        // 해시 불일치 / 잘린 파일
+        SkelCookData x;
+        CHECK(!SkelCookLoad(a, hash + 1, x));
+        CHECK(x.parts.empty() && !x.skeleton);
+        WriteBytes(c, bytes.substr(0, bytes.size() - 10));
+        CHECK(!SkelCookLoad(c, hash, x));
+        WriteBytes(c, bytes.substr(0, 32));
+        CHECK(!SkelCookLoad(c, hash, x));
+
+        // 바이트 하나 변조: 거부 / 비교에서 잡힘 / 차이 없음(정렬 패딩) 중 하나, 어느 경우든 죽지 않음
+        std::mt19937 rng(skinned ? 50 : 51);
+        int rejected = 0, caught = 0, same = 0;
+        const size_t span = bytes.size() - 64 < 20000 ? bytes.size() - 64 : 20000;
+        for (int it = 0; it < 200; ++it) {
+            std::string bad = bytes;
+            bad[64 + rng() % span] ^= char(1 + rng() % 255);
+            WriteBytes(c, bad);
+            SkelCookData y;
+            if (!SkelCookLoad(c, hash, y)) ++rejected;
+            else if (!SkelCookEqual(d, y)) ++caught;
+            else ++same;
+        }
+        printf("%s: %zu bytes, corrupt: %d rejected, %d caught by compare, %d unchanged\n",
+            kind, bytes.size(), rejected, caught, same);
+    }
+
+    // MakeCookData 의 서브메시는 머티리얼 0, 2 만 씀 (1 은 안 씀)
+    void TestUsedMaterials(const fs::path& dir, bool skinned)
+    {
+        SkelCookData d;
+        MakeCookData(d, skinned);
+        CHECK(SkelCookUsedMaterials(d) == std::vector<bool>({ true, false, true }));
+
+        // 파트 없음 / 머티리얼 없음
+        SkelCookData empty;
+        empty.materials.resize(2);
+        CHECK(SkelCookUsedMaterials(empty) == std::vector<bool>({ false, false }));
+        CHECK(SkelCookUsedMaterials(SkelCookData{}).empty());
+
+        // 범위 밖 인덱스는 무시 (크기는 materials.size() 그대로), 다른 종류의 파트가 섞여도 같은 규칙
+        std::vector<uint32_t> idx = { 0, 1, 2, 2, 1, 0 };
+        const std::vector<SubMeshCPU> sm = { { 0, 0, 3, 3 }, { 0, 3, 3, 1 }, { 0, 0, 0, ~0u } };
+        const auto skin = MakeTestSkinVertices(3, 40, 60);
+        if (skinned) {
+            std::vector<VertexCPU_PNTT> v(skin.size());
+            for (size_t i = 0; i < skin.size(); ++i) {
+                const VertexCPU_PNTT_BW& s = skin[i];
+                v[i] = { s.px, s.py, s.pz, s.nx, s.ny, s.nz, s.u, s.v, s.tx, s.ty, s.tz, s.tw };
+            }
+            d.AddPart(1, v.data(), v.size(), idx, sm, nullptr);
+        }
+        else {
+            d.AddPart(1, skin.data(), skin.size(), idx, sm, nullptr);
+        }
+        CHECK(SkelCookUsedMaterials(d) == std::vector<bool>({ true, true, true }));
+
+        // 범위 밖만 쓰는 파트 하나뿐이면 전부 false
+        SkelCookData only;
+        only.materials.resize(3);
+        const std::vector<SubMeshCPU> outside = { { 0, 0, 6, 3 }, { 0, 0, 6, 100 } };
+        only.AddPart(0, skin.data(), skin.size(), idx, outside, nullptr);
+        CHECK(SkelCookUsedMaterials(only) == std::vector<bool>({ false, false, false }));
+
+        // 저장 → 로드한 (매핑된 서브메시) 데이터도 같은 결과
+        const fs::path a = dir / "used.skelcook";
+        MakeCookData(d, skinned);
+        CHECK(SkelCookSave(d, 0x05EDull, a));
+        SkelCookData l;
+        CHECK(SkelCookLoad(a, 0x05EDull, l));
+        CHECK(SkelCookUsedMaterials(l) == SkelCookUsedMaterials(d));
+    }
+}
+
+int main()
+{
+    const fs::path dir = fs::temp_directory_path() / "SkeletalCookTest";
+    std::error_code ec;
+    fs::create_directories(dir, ec);
+
+    TestRoundTrip(dir, true);
+    TestRoundTrip(dir, false);
+    TestUsedMaterials(dir, true);
+    TestUsedMaterials(dir, false);
+
+    fs::remove_all(dir, ec);
+    return TestResult("SkeletalCookTest");
+}
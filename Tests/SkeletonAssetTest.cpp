@@ -0,0 +1,79 @@
+﻿// ============================================================================
+// SkeletonAssetTest.cpp
+// - SkeletonFromNodes: 정상 계층 → leaf / nameToNode / bindRadius
+// - 잘못된 parent (범위 밖, 음수, 자식보다 뒤) → runtime_error, 배열 밖 쓰기 없음
+// ============================================================================
+
+// ---- includes ----
+#include "TestCommon.h"
+#include "../D3D_Engine(25.12.01. ~ )/Animation/SkeletonAsset.h"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using DirectX::SimpleMath::Matrix;
+using DirectX::SimpleMath::Vector3;
+
+namespace
+{
+    // 로더 노드 (SK_Node / RS_Node 와 같은 필드)
+    struct TestNode
+    {
+        std::string name;
+        int         parent = -1;
+        Matrix      bindLocal;
+    };
+
+    bool Throws(const std::vector<TestNode>& nodes)
+    {
+        SkeletonAsset s;
+        try { SkeletonFromNodes(s, nodes, true); }
+        catch (const std::runtime_error&) { return true; }
+        return false;
+    }
+}
+
+int main()
+{
+    // root ─┬─ spine ── head
+    //       └─ hip
+    std::vector<TestNode> nodes = {
+        { "root",  -1, Matrix::CreateTranslation(0, 1, 0) },
+        { "spine",  0, Matrix::CreateTranslation(0, 2, 0) },
+        { "hip",    0, Matrix::CreateTranslation(1, 0, 0) },
+        { "head",   1, Matrix::CreateTranslation(0, 3, 0) },
+    };
+
+    SkeletonAsset s;
+    SkeletonFromNodes(s, nodes, false);
+    CHECK(s.NodeCount() == 4);
+    CHECK(s.leaf[0] == 0 && s.leaf[1] == 0 && s.leaf[2] == 1 && s.leaf[3] == 1);
+    CHECK(s.nameToNode.at("head") == 3);
+    CHECK(s.defaultT[1] == Vector3::Zero);
+    CHECK_NEAR(s.bindRadius, 6.0f, 1e-5f);   // head 글로벌 원점 (0, 6, 0)
+
+    SkeletonFromNodes(s, nodes, true);
+    CHECK(s.defaultT[1] == Vector3(0, 2, 0));
+
+    // 잘못된 parent
+    auto bad = nodes;
+    bad[3].parent = 1000;
+    CHECK(Throws(bad));
+    bad = nodes;
+    bad[2].parent = -7;
+    CHECK(Throws(bad));
+    bad = nodes;
+    bad[1].parent = 3;          // 자식보다 뒤
+    CHECK(Throws(bad));
+    bad = nodes;
+    bad[2].parent = 2;          // 자기 자신
+    CHECK(Throws(bad));
+
+    // 빈 입력
+    SkeletonFromNodes(s, std::vector<TestNode>{}, true);
+    CHECK(s.NodeCount() == 0);
+    CHECK(s.bindRadius == 1.0f);
+
+    return TestResult("SkeletonAssetTest");
+}
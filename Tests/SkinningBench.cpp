@@ -0,0 +1,85 @@
+﻿// ============================================================================
+// SkinningBench.cpp
+// - CPU 스키닝 커널 처리량 (vertices/sec) + SkinVerticesRef 대비 최대 오차
+//   · Scalar / SSE / AVX, 단일 스레드 / JobSystem (하드웨어 스레드 수)
+//   · 정점 수: 캐릭터 하나 규모 (20k) / 군중 규모 (1M)
+// - 엔진 쪽 SkinBenchmark 를 그대로 호출 (디버그 UI 의 측정과 같은 코드)
+// ============================================================================
+
+// ---- includes ----
+#include "TestCommon.h"
+#include "../D3D_Engine(25.12.01. ~ )/Animation/SkinningCPU.h"
+#include "../D3D_Core/JobSystem.h"
+
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // 본마다 임의 회전에 가까운 3행 + 이동 (전치 4x4 배치, 4행은 0 0 0 1)
+    std::vector<float> MakePalette(size_t bones, uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> u(-1.0f, 1.0f);
+        std::vector<float> p(bones * 16, 0.0f);
+        for (size_t b = 0; b < bones; ++b) {
+            float* m = &p[b * 16];
+            for (int r = 0; r < 3; ++r) {
+                for (int c = 0; c < 3; ++c) m[r * 4 + c] = (r == c ? 1.0f : 0.0f) + 0.3f * u(rng);
+                m[r * 4 + 3] = 10.0f * u(rng);
+            }
+            m[15] = 1.0f;
+        }
+        return p;
+    }
+
+    std::vector<VertexCPU_PNTT_BW> MakeVertices(size_t count, size_t bones, uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> u(-1.0f, 1.0f), u01(0.05f, 1.0f);
+        std::vector<VertexCPU_PNTT_BW> v(count);
+        for (auto& x : v) {
+            x.px = u(rng); x.py = u(rng); x.pz = u(rng);
+            x.nx = u(rng); x.ny = u(rng); x.nz = u(rng);
+            x.tx = u(rng); x.ty = u(rng); x.tz = u(rng); x.tw = 1.0f;
+            x.u = u01(rng); x.v = u01(rng);
+            float sum = 0.0f;
+            for (int k = 0; k < 4; ++k) { x.bi[k] = uint8_t(rng() % bones); x.bw[k] = u01(rng); sum += x.bw[k]; }
+            for (int k = 0; k < 4; ++k) x.bw[k] /= sum;
+        }
+        return v;
+    }
+}
+
+int main()
+{
+    constexpr size_t kBones = 100;
+    const std::vector<float> palette = MakePalette(kBones, 1);
+
+    const unsigned hw = std::thread::hardware_concurrency();
+    JobSystem jobs((hw > 1) ? hw - 1 : 1);
+
+    printf("kernels: SSE %s, AVX %s   threads: %u\n",
+        SkinKernelAvailable(SkinKernel::SSE) ? "yes" : "no",
+        SkinKernelAvailable(SkinKernel::AVX) ? "yes" : "no", jobs.WorkerCount() + 1);
+
+    for (size_t count : { size_t(20000), size_t(1000000) }) {
+        const auto src = MakeVertices(count, kBones, 2);
+        const int iters = (count > 100000) ? 5 : 200;
+
+        printf("\n%zu vertices\n", count);
+        printf("  %-7s %-8s %14s %10s %12s %12s\n", "kernel", "threads", "Mverts/s", "x scalar", "max pos err", "max nrm err");
+        for (JobSystem* js : { (JobSystem*)nullptr, &jobs }) {
+            double scalarRate = 0.0;
+            for (SkinKernel k : { SkinKernel::Scalar, SkinKernel::SSE, SkinKernel::AVX }) {
+                if (!SkinKernelAvailable(k)) continue;
+                const SkinBenchResult r = SkinBenchmark(js, k, src.data(), count, palette.data(), kBones, iters);
+                if (k == SkinKernel::Scalar) scalarRate = r.VertsPerSec();
+                printf("  %-7s %-8u %14.1f %10.2f %12.3g %12.3g\n", SkinKernelName(r.kernel), r.threads,
+                    r.VertsPerSec() * 1e-6, scalarRate > 0.0 ? r.VertsPerSec() / scalarRate : 0.0, r.err.pos, r.err.nrm);
+            }
+        }
+    }
+    return 0;
+}
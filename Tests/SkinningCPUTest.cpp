@@ -0,0 +1,120 @@
+﻿// ============================================================================
+// SkinningCPUTest.cpp
+// - SkinVerticesRef (스킨 캐시 검증 기준) vs SimpleMath 로 따로 계산한 LBS
+//   · 본 행렬 = boneOffset * poseGlobal 가중 합 → Vector3::Transform / TransformNormal → 정규화
+//   · 최대 위치 오차 <= 1e-5 * 좌표 크기, 노멀/탄젠트 성분 오차 <= 1e-5
+// - boneCount 이상 인덱스 가중치는 무시 (셰이더와 같음)
+// - SkinCompare: 같은 입력 → 0, 정점 하나 밀면 그 정점 / 거리
+// - SSE / AVX 커널, SkinVerticesParallel == SkinVerticesRef (비트 단위, 이 CPU 에서 쓸 수 있는 커널만)
+// ============================================================================
+
+// ---- includes ----
+#include "TestCommon.h"
+#include "TestRig.h"
+#include "../D3D_Engine(25.12.01. ~ )/Animation/AnimatedInstance.h"
+#include "../D3D_Engine(25.12.01. ~ )/Animation/SkinningCPU.h"
+#include "../D3D_Core/JobSystem.h"
+
+#include <cstring>
+#include <vector>
+
+using DirectX::SimpleMath::Matrix;
+using DirectX::SimpleMath::Vector3;
+
+namespace
+{
+    // 셰이더와 같은 규칙의 독립 계산 (행벡터, 4x4 그대로)
+    VertexCPU_PNTT SkinOne(const VertexCPU_PNTT_BW& v, const AnimatedInstance& inst)
+    {
+        const SkeletonAsset& sk = inst.Skeleton();
+        Matrix M;
+        for (int r = 0; r < 4; ++r) for (int c = 0; c < 4; ++c) M.m[r][c] = 0.0f;
+        for (int k = 0; k < 4; ++k) {
+            if (v.bw[k] == 0.0f || v.bi[k] >= sk.BoneCount()) continue;
+            const Matrix B = sk.boneOffsets[v.bi[k]] * inst.Global(sk.boneNodes[v.bi[k]]);
+            for (int r = 0; r < 4; ++r) for (int c = 0; c < 4; ++c) M.m[r][c] += v.bw[k] * B.m[r][c];
+        }
+        const Vector3 p = Vector3::Transform(Vector3(v.px, v.py, v.pz), M);
+        Vector3 n = Vector3::TransformNormal(Vector3(v.nx, v.ny, v.nz), M);
+        Vector3 t = Vector3::TransformNormal(Vector3(v.tx, v.ty, v.tz), M);
+        n.Normalize();
+        t.Normalize();
+
+        VertexCPU_PNTT o{};
+        o.px = p.x; o.py = p.y; o.pz = p.z;
+        o.nx = n.x; o.ny = n.y; o.nz = n.z;
+        o.u = v.u; o.v = v.v;
+        o.tx = t.x; o.ty = t.y; o.tz = t.z; o.tw = v.tw;
+        return o;
+    }
+}
+
+int main()
+{
+    for (bool scaled : { false, true }) {
+        auto sk = MakeTestSkeleton(40, scaled ? 12 : 11, scaled);
+        auto clip = MakeTestClip(*sk, 9, 3, scaled);
+        AnimatedInstance inst;
+        inst.Init(sk, clip);
+        inst.Evaluate(0.123, true);
+        inst.BuildPalette();
+
+        const size_t nb = sk->BoneCount();
+        const float* palette = &inst.Palette()[0].m[0][0];
+        auto src = MakeTestSkinVertices(5000, nb, 7, 2.0f);
+
+        std::vector<VertexCPU_PNTT> ref(src.size()), want(src.size());
+        SkinVerticesRef(src.data(), src.size(), palette, nb, ref.data());
+        float coord = 0.0f;
+        for (size_t i = 0; i < src.size(); ++i) {
+            want[i] = SkinOne(src[i], inst);
+            coord = std::fmax(coord, std::fmax(std::fabs(want[i].px), std::fmax(std::fabs(want[i].py), std::fabs(want[i].pz))));
+        }
+
+        const SkinDiff d = SkinCompare(ref.data(), want.data(), src.size());
+        CHECK(d.pos <= 1e-5f * std::fmax(coord, 1.0f));
+        CHECK(d.nrm <= 1e-5f);
+        CHECK(d.tan <= 1e-5f);
+        bool passThrough = true;
+        for (size_t i = 0; i < src.size(); ++i)
+            passThrough = passThrough && ref[i].u == src[i].u && ref[i].v == src[i].v && ref[i].tw == src[i].tw;
+        CHECK(passThrough);
+
+        // 범위 밖 본 인덱스는 가중치째 무시
+        VertexCPU_PNTT_BW bad = src[0], good = src[0];
+        bad.bi[0] = 200; bad.bw[0] = 0.5f;
+        good.bi[0] = 0;  good.bw[0] = 0.0f;
+        VertexCPU_PNTT a, b;
+        SkinVerticesRef(&bad, 1, palette, nb, &a);
+        SkinVerticesRef(&good, 1, palette, nb, &b);
+        CHECK(a.px == b.px && a.py == b.py && a.pz == b.pz && a.nx == b.nx);
+
+        // SkinCompare
+        const SkinDiff same = SkinCompare(ref.data(), ref.data(), ref.size());
+        CHECK(same.pos == 0.0f && same.nrm == 0.0f && same.tan == 0.0f);
+        std::vector<VertexCPU_PNTT> moved = ref;
+        moved[77].py += 0.25f;
+        moved[77].nx += 0.125f;
+        const SkinDiff one = SkinCompare(ref.data(), moved.data(), ref.size());
+        CHECK(one.worstVertex == 77);
+        CHECK_NEAR(one.pos, 0.25f, 1e-6f);
+        CHECK_NEAR(one.nrm, 0.125f, 1e-6f);
+        CHECK(one.tan == 0.0f);
+
+        // SIMD 커널 / 병렬 분할: 스칼라와 같은 곱/합 순서 → 비트 단위 동일 (홀수 개수 포함)
+        JobSystem jobs(3);
+        for (SkinKernel k : { SkinKernel::Scalar, SkinKernel::SSE, SkinKernel::AVX }) {
+            if (!SkinKernelAvailable(k)) { printf("  %s kernel not available, skipped\n", SkinKernelName(k)); continue; }
+            for (size_t n : { size_t(1), size_t(3), src.size() - 1 }) {
+                std::vector<VertexCPU_PNTT> out(n);
+                SkinVertices(k, src.data(), n, palette, nb, out.data());
+                CHECK(std::memcmp(out.data(), ref.data(), n * sizeof(VertexCPU_PNTT)) == 0);
+            }
+            std::vector<VertexCPU_PNTT> par(src.size());
+            SkinVerticesParallel(&jobs, k, src.data(), src.size(), palette, nb, par.data(), 333);
+            CHECK(std::memcmp(par.data(), ref.data(), par.size() * sizeof(VertexCPU_PNTT)) == 0);
+        }
+    }
+
+    return TestResult("SkinningCPUTest");
+}
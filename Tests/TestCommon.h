@@ -0,0 +1,56 @@
+﻿// ============================================================================
+// TestCommon.h
+// - 헤드리스 테스트 공용: CHECK / CHECK_NEAR 는 실패를 출력하고 세기만 한다 (계속 진행)
+//   · main 끝에서 return TestResult("이름"); → 실패가 있으면 1 (ctest 실패)
+// - 벤치마크 공용 시간 측정 (BenchMs)
+// ============================================================================
+
+#pragma once
+
+// ---- includes ----
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+inline int& TestFailures()
+{
+    static int n = 0;
+    return n;
+}
+
+inline bool TestCheck(bool ok, const char* expr, const char* file, int line)
+{
+    if (!ok) {
+        ++TestFailures();
+        printf("FAILED %s:%d: %s\n", file, line, expr);
+    }
+    return ok;
+}
+
+inline bool TestCheckNear(double a, double b, double tol, const char* expr, const char* file, int line)
+{
+    const bool ok = std::fabs(a - b) <= tol;
+    if (!ok) {
+        ++TestFailures();
+        printf("FAILED %s:%d: %s (%.9g vs %.9g, tol %.3g)\n", file, line, expr, a, b, tol);
+    }
+    return ok;
+}
+
+#define CHECK(cond) TestCheck((cond), #cond, __FILE__, __LINE__)
+#define CHECK_NEAR(a, b, tol) TestCheckNear((double)(a), (double)(b), (double)(tol), #a " ~ " #b, __FILE__, __LINE__)
+
+inline int TestResult(const char* name)
+{
+    printf("%s: %s (%d failed checks)\n", name, TestFailures() ? "FAILED" : "ok", TestFailures());
+    return TestFailures() ? 1 : 0;
+}
+
+// fn 을 reps 번 돌린 평균 ms
+template <class Fn>
+double BenchMs(int reps, Fn&& fn)
+{
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < reps; ++i) fn();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count() / reps;
+}
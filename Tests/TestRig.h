@@ -0,0 +1,131 @@
+﻿// ============================================================================
+// TestRig.h
+// - 테스트 / 벤치마크 공용 합성 리그: 임의 트리 스켈레톤 + 모든 노드에 T/R/S 키를 가진 클립
+//   (FBX 없이 AnimatedInstance / AnimationSystem / 스키닝 / 쿠킹 경로를 돌리기 위한 것)
+// - 스키닝 정점: 임의 위치/노멀/탄젠트 + 본 1~4개 가중치 (합 1)
+// - 같은 seed 면 같은 리그 (비교 테스트에서 두 번 만들어도 동일)
+// ============================================================================
+
+#pragma once
+
+// ---- includes ----
+#include "../D3D_Engine(25.12.01. ~ )/Animation/AnimClip.h"
+#include "../D3D_Engine(25.12.01. ~ )/Animation/SkeletonAsset.h"
+#include "../D3D_Engine(25.12.01. ~ )/MeshDataEx.h"
+
+#include <directxtk/SimpleMath.h>
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+struct TestRigNode
+{
+    std::string name;
+    int         parent = -1;
+    DirectX::SimpleMath::Matrix bindLocal;
+};
+
+inline DirectX::SimpleMath::Quaternion TestRandomQuat(std::mt19937& rng, float maxAngle = 3.14159265f)
+{
+    std::uniform_real_distribution<float> u(-1.0f, 1.0f);
+    DirectX::SimpleMath::Vector3 axis(u(rng), u(rng), u(rng));
+    if (axis.LengthSquared() < 1e-4f) axis = DirectX::SimpleMath::Vector3::UnitY;
+    axis.Normalize();
+    return DirectX::SimpleMath::Quaternion::CreateFromAxisAngle(axis, maxAngle * u(rng));
+}
+
+// nodes 개 노드 (parent = 앞쪽 임의 노드), 모든 노드가 스키닝 본
+//  - scaled == false 면 스케일 없는 강체 리그 (듀얼 쿼터니언 비교용)
+inline std::shared_ptr<SkeletonAsset> MakeTestSkeleton(size_t nodes, uint32_t seed, bool scaled = false)
+{
+    using namespace DirectX::SimpleMath;
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> pos(-0.5f, 0.5f), scl(0.8f, 1.25f);
+
+    std::vector<TestRigNode> src(nodes);
+    for (size_t i = 0; i < nodes; ++i) {
+        src[i].name = "node" + std::to_string(i);
+        src[i].parent = (i == 0) ? -1 : int(rng() % i);
+        const Matrix s = scaled ? Matrix::CreateScale(scl(rng)) : Matrix::Identity;
+        src[i].bindLocal = s * Matrix::CreateFromQuaternion(TestRandomQuat(rng, 0.5f))
+            * Matrix::CreateTranslation(pos(rng), 0.5f + pos(rng), pos(rng));
+    }
+
+    auto sk = std::make_shared<SkeletonAsset>();
+    SkeletonFromNodes(*sk, src, true);
+
+    std::vector<Matrix> global(nodes);
+    AnimLocalToGlobal(sk->parents.data(), sk->bindLocal.data(), global.data(), nodes);
+    sk->boneNames = sk->names;
+    sk->boneNodes.resize(nodes);
+    sk->boneOffsets.resize(nodes);
+    for (size_t i = 0; i < nodes; ++i) {
+        sk->boneNodes[i] = int(i);
+        sk->boneOffsets[i] = global[i].Invert();
+    }
+    return sk;
+}
+
+// 모든 노드에 keys 개 T/R/S 키 (tick 0 .. keys-1, 30 tps)
+inline std::shared_ptr<AnimationClipAsset> MakeTestClip(const SkeletonAsset& sk, size_t keys, uint32_t seed,
+    bool scaled = false)
+{
+    using namespace DirectX::SimpleMath;
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> pos(-0.5f, 0.5f), scl(0.8f, 1.25f);
+
+    auto clip = std::make_shared<AnimationClipAsset>();
+    clip->name = "clip" + std::to_string(seed);
+    clip->tps = 30.0;
+    clip->duration = double(keys - 1);
+    clip->channels.resize(sk.NodeCount());
+    for (size_t n = 0; n < sk.NodeCount(); ++n) {
+        AnimChannel& ch = clip->channels[n];
+        ch.target = sk.names[n];
+        for (size_t k = 0; k < keys; ++k) {
+            const double t = double(k);
+            ch.T.push_back({ t, Vector3(pos(rng), 0.5f + pos(rng), pos(rng)) });
+            ch.R.push_back({ t, TestRandomQuat(rng, 1.0f) });
+            if (scaled) ch.S.push_back({ t, Vector3(scl(rng), scl(rng), scl(rng)) });
+            else        ch.S.push_back({ t, Vector3::One });
+        }
+        clip->map[ch.target] = int(n);
+    }
+    clip->bindings = AnimBindChannels(*clip, sk.names);
+    return clip;
+}
+
+// 바인드 공간 정점 count 개 (반지름 ~radius 구 안), 본 인덱스 < boneCount
+inline std::vector<VertexCPU_PNTT_BW> MakeTestSkinVertices(size_t count, size_t boneCount, uint32_t seed,
+    float radius = 1.0f)
+{
+    using namespace DirectX::SimpleMath;
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> u(-1.0f, 1.0f), u01(0.0f, 1.0f);
+
+    std::vector<VertexCPU_PNTT_BW> out(count);
+    for (auto& v : out) {
+        v.px = u(rng) * radius; v.py = u(rng) * radius; v.pz = u(rng) * radius;
+        Vector3 n(u(rng), u(rng), u(rng)), t(u(rng), u(rng), u(rng));
+        if (n.LengthSquared() < 1e-4f) n = Vector3::UnitY;
+        n.Normalize();
+        t = t - n * t.Dot(n);
+        if (t.LengthSquared() < 1e-4f) t = n.Cross(Vector3::UnitX).LengthSquared() > 1e-4f ? n.Cross(Vector3::UnitX) : n.Cross(Vector3::UnitZ);
+        t.Normalize();
+        v.nx = n.x; v.ny = n.y; v.nz = n.z;
+        v.tx = t.x; v.ty = t.y; v.tz = t.z; v.tw = (rng() & 1) ? 1.0f : -1.0f;
+        v.u = u01(rng); v.v = u01(rng);
+
+        const int influences = 1 + int(rng() % 4);
+        float sum = 0.0f;
+        for (int k = 0; k < 4; ++k) {
+            v.bi[k] = uint8_t(rng() % boneCount);
+            v.bw[k] = (k < influences) ? 0.05f + u01(rng) : 0.0f;
+            sum += v.bw[k];
+        }
+        for (int k = 0; k < 4; ++k) v.bw[k] /= sum;
+    }
+    return out;
+}
@@ -0,0 +1,205 @@
+﻿// ============================================================================
+// TextureCacheCoreTest.cpp
+// - TextureCacheCore 를 가짜 생성 콜백으로 (D3D 없음)
+//   · NormalizePath: 상대 경로 / '.' '..' / 중복 '/' 가 같은 키 → 두 번째는 적중
+//   · 색 공간이 다르면 다른 항목, 실패도 기록 (다시 생성하지 않음, Contains 는 false)
+//   · 통계: hits / misses / failed / entries / residentBytes
+//   · 8 스레드 × 50 = 400 번 Load (키 3개, 하나는 실패) → 생성 3번 + 적중 397, 실패 1, 모두 같은 리소스
+//   · 생성 중 Clear: 요청한 쪽은 결과를 받고, 통계/항목에는 안 들어감. 다음 Load 는 새로 생성
+// ============================================================================
+
+// ---- includes ----
+#include "TestCommon.h"
+#include "../D3D_Engine(25.12.01. ~ )/TextureCacheCore.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    struct FakeTexture : TextureCacheResource
+    {
+        std::wstring path;
+    };
+
+    // "missing" 이 들어간 경로는 실패, 나머지는 bytes 바이트짜리 가짜 텍스처
+    TextureCacheCore::CreateFn FakeCreate(const std::wstring& path, uint64_t bytes, std::atomic<int>& creates,
+        int sleepMs = 0)
+    {
+        return [path, bytes, &creates, sleepMs] {
+            ++creates;
+            if (sleepMs) std::this_thread::sleep_for(std::chrono::milliseconds(sleepMs));
+            TextureCacheCore::Created made;
+            if (path.find(L"missing") != std::wstring::npos) return made;
+            auto t = std::make_shared<FakeTexture>();
+            t->path = path;
+            made.resource = t;
+            made.bytes = bytes;
+            return made;
+            };
+    }
+}
+
+int main()
+{
+    const fs::path cwd = fs::current_path();
+
+    // ------------------------------------------------------------------------
+    // NormalizePath
+    // ------------------------------------------------------------------------
+    {
+        const std::wstring a = TextureCacheCore::NormalizePath(L"tex/a.png");
+        CHECK(a == (cwd / "tex" / "a.png").generic_wstring());
+        CHECK(TextureCacheCore::NormalizePath(L"tex/./sub/../a.png") == a);
+        CHECK(TextureCacheCore::NormalizePath(L"tex//a.png") == a);
+        CHECK(TextureCacheCore::NormalizePath((cwd / "tex" / "a.png").wstring()) == a);
+        CHECK(TextureCacheCore::NormalizePath(L"tex/b.png") != a);
+        CHECK(a.find(L'\\') == std::wstring::npos);
+    }
+
+    // ------------------------------------------------------------------------
+    // 단일 스레드: 적중 / 색 공간 / 실패 기록 / 통계
+    // ------------------------------------------------------------------------
+    {
+        TextureCacheCore cache;
+        std::atomic<int> creates{ 0 };
+
+        auto a = cache.Load(L"tex/a.png", TextureColorSpace::SRGB, FakeCreate(L"a", 100, creates));
+        auto a2 = cache.Load(L"tex/./a.png", TextureColorSpace::SRGB, FakeCreate(L"a", 100, creates));
+        CHECK(a && a == a2);
+        CHECK(creates == 1);
+
+        auto aLin = cache.Load(L"tex/a.png", TextureColorSpace::Linear, FakeCreate(L"a", 40, creates));
+        CHECK(aLin && aLin != a);
+        CHECK(creates == 2);
+
+        auto m = cache.Load(L"missing.png", TextureColorSpace::SRGB, FakeCreate(L"missing", 7, creates));
+        auto m2 = cache.Load(L"missing.png", TextureColorSpace::SRGB, FakeCreate(L"missing", 7, creates));
+        CHECK(!m && !m2);
+        CHECK(creates == 3);
+
+        CHECK(!cache.Load(L"", TextureColorSpace::SRGB, FakeCreate(L"x", 1, creates)));
+        CHECK(creates == 3);
+
+        CHECK(cache.Contains(L"tex/a.png", TextureColorSpace::SRGB));
+        CHECK(cache.Contains(L"tex/a.png", TextureColorSpace::Linear));
+        CHECK(!cache.Contains(L"missing.png", TextureColorSpace::SRGB));
+        CHECK(!cache.Contains(L"tex/b.png", TextureColorSpace::SRGB));
+
+        const TextureCacheStats s = cache.Stats();
+        CHECK(s.hits == 2 && s.misses == 3 && s.failed == 1);
+        CHECK(s.entries == 2 && s.residentBytes == 140);
+
+        cache.Clear();
+        const TextureCacheStats c = cache.Stats();
+        CHECK(c.hits == 0 && c.misses == 0 && c.failed == 0 && c.entries == 0 && c.residentBytes == 0);
+        CHECK(!cache.Contains(L"tex/a.png", TextureColorSpace::SRGB));
+        CHECK(a.use_count() == 2);      // 캐시가 놓아도 받은 쪽 참조는 유효
+    }
+
+    // ------------------------------------------------------------------------
+    // 8 스레드 × 50: 키 3개 (b 는 두 가지 표기, missing 은 실패) → 생성 3번
+    // ------------------------------------------------------------------------
+    {
+        TextureCacheCore cache;
+        std::atomic<int> creates{ 0 };
+        const std::wstring paths[4] = { L"tex/a.png", L"tex/b.png", L"tex/sub/../b.png", L"missing.png" };
+        const uint64_t bytes[4] = { 1000, 300, 300, 0 };
+
+        std::vector<std::vector<std::shared_ptr<TextureCacheResource>>> got(8);
+        std::atomic<int> ready{ 0 };
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 8; ++t) {
+            threads.emplace_back([&, t] {
+                ++ready;
+                while (ready < 8) std::this_thread::yield();
+                for (int i = 0; i < 50; ++i) {
+                    const int k = (t + i) % 4;
+                    got[t].push_back(cache.Load(paths[k], TextureColorSpace::SRGB,
+                        FakeCreate(paths[k], bytes[k], creates, 5)));
+                }
+                });
+        }
+        for (auto& th : threads) th.join();
+
+        CHECK(creates == 3);
+        const TextureCacheStats s = cache.Stats();
+        CHECK(s.misses == 3);
+        CHECK(s.hits == 397);
+        CHECK(s.failed == 1);
+        CHECK(s.entries == 2);
+        CHECK(s.residentBytes == 1300);
+
+        // 키마다 모든 스레드가 같은 리소스 (b 의 두 표기 포함), 실패 키는 전부 null
+        std::shared_ptr<TextureCacheResource> first[4];
+        bool same = true;
+        for (int t = 0; t < 8; ++t)
+            for (int i = 0; i < 50; ++i) {
+                const int k = (t + i) % 4;
+                const int key = (k == 2) ? 1 : k;
+                if (!first[key]) first[key] = got[t][i];
+                same = same && got[t][i] == first[key];
+            }
+        CHECK(same);
+        CHECK(first[0] && first[1] && !first[3]);
+    }
+
+    // ------------------------------------------------------------------------
+    // 생성 중 Clear
+    // ------------------------------------------------------------------------
+    {
+        TextureCacheCore cache;
+        std::atomic<int> creates{ 0 };
+        std::mutex mx;
+        std::condition_variable cv;
+        bool inside = false, release = false;
+
+        auto blocking = [&]() -> TextureCacheCore::Created {
+            ++creates;
+            std::unique_lock<std::mutex> lock(mx);
+            inside = true;
+            cv.notify_all();
+            cv.wait(lock, [&] { return release; });
+            TextureCacheCore::Created made;
+            made.resource = std::make_shared<FakeTexture>();
+            made.bytes = 500;
+            return made;
+            };
+
+        std::shared_ptr<TextureCacheResource> result;
+        std::thread loader([&] { result = cache.Load(L"tex/slow.png", TextureColorSpace::SRGB, blocking); });
+        {
+            std::unique_lock<std::mutex> lock(mx);
+            cv.wait(lock, [&] { return inside; });
+        }
+        cache.Clear();
+        {
+            std::lock_guard<std::mutex> lock(mx);
+            release = true;
+        }
+        cv.notify_all();
+        loader.join();
+
+        CHECK(result != nullptr);
+        const TextureCacheStats s = cache.Stats();
+        CHECK(s.misses == 0 && s.entries == 0 && s.residentBytes == 0 && s.failed == 0);
+        CHECK(!cache.Contains(L"tex/slow.png", TextureColorSpace::SRGB));
+
+        auto again = cache.Load(L"tex/slow.png", TextureColorSpace::SRGB, FakeCreate(L"slow", 500, creates));
+        CHECK(again && again != result);
+        CHECK(creates == 2);
+        const TextureCacheStats s2 = cache.Stats();
+        CHECK(s2.misses == 1 && s2.entries == 1 && s2.residentBytes == 500);
+    }
+
+    return TestResult("TextureCacheCoreTest");
+}
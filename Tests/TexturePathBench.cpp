@@ -0,0 +1,53 @@
+﻿// ============================================================================
+// TexturePathBench.cpp
+// - TexturePathBenchmark (씬 로드 패널 버튼과 같은 코드): 머티리얼 10k 개 × 5 슬롯
+//   · TexturePathResolveProbe (후보마다 fs::exists) vs TexturePathIndex (한 번 훑고 메모리 조회)
+//   · TexturePathBench <텍스처 루트> [머티리얼 수] → 그 폴더로 (예: ../Resource/)
+//     리눅스 libstdc++ 는 path → wstring 을 "C" 로캘로 바꿔서 비 ASCII 파일명이 있으면 예외 → 윈도우에서
+//   · 인자 없으면 임시 폴더에 텍스처 500 개 (루트 / textures / 서브폴더) 를 만들어서
+// - 불일치가 있으면 종료 코드 1
+// ============================================================================
+
+// ---- includes ----
+#include "../D3D_Engine(25.12.01. ~ )/TexturePathIndex.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace fs = std::filesystem;
+
+int main(int argc, char** argv)
+{
+    const size_t materials = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 10000;
+
+    fs::path root;
+    fs::path temp;
+    if (argc > 1) root = argv[1];
+    else {
+        temp = fs::temp_directory_path() / "TexturePathBench";
+        std::error_code ec;
+        fs::remove_all(temp, ec);
+        root = temp / "root";
+        for (int i = 0; i < 500; ++i) {
+            const fs::path sub = (i % 5 == 0) ? fs::path("textures") : (i % 5 == 1) ? fs::path("props") / "wood" : fs::path();
+            fs::create_directories(root / sub);
+            std::ofstream(root / sub / ("tex" + std::to_string(i) + ".png"), std::ios::binary) << "x";
+        }
+    }
+
+    const TexturePathBenchResult r = TexturePathBenchmark(root.wstring() + L"/", materials);
+    printf("%s: %zu files, %zu materials, %zu lookups\n", root.string().c_str(), r.files, materials, r.lookups);
+    printf("  probe %8.2f ms\n", r.probeMs);
+    printf("  index %8.2f ms (+ build %.2f ms)  x%.1f\n", r.indexMs, r.buildMs,
+        r.indexMs + r.buildMs > 0.0 ? r.probeMs / (r.indexMs + r.buildMs) : 0.0);
+    printf("  mismatches %zu\n", r.mismatches);
+
+    if (!temp.empty()) {
+        std::error_code ec;
+        fs::remove_all(temp, ec);
+    }
+    return r.mismatches ? 1 : 0;
+}
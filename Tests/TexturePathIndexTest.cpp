@@ -0,0 +1,145 @@
+﻿// ============================================================================
+// TexturePathIndexTest.cpp
+// - 임시 폴더에 텍스처 트리를 만들고 TexturePathIndex::Resolve 를 TexturePathResolveProbe (fs::exists 방식)와 비교
+//   · 경우별: 상대 / 깨진 서브폴더 / textures 폴백 / 다른 PC 절대 경로 / 루트 안·밖 절대 경로 / 없는 파일 / embedded
+//   · TexturePathBenchmark 의 섞인 입력 전체에서 불일치 0 (대소문자/구분자만 다른 건 같음)
+// - 대소문자 무시, For 공유 (루트 끝 '/' 무관, 여러 스레드), ClearAll 후 새 파일 반영
+// ============================================================================
+
+// ---- includes ----
+#include "TestCommon.h"
+#include "../D3D_Engine(25.12.01. ~ )/TexturePathIndex.h"
+
+#include <algorithm>
+#include <cwctype>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    // 비교용: 소문자 + '/' (벤치의 불일치 판정과 같은 기준)
+    std::wstring Norm(std::wstring s)
+    {
+        for (wchar_t& c : s) c = (c == L'\\') ? L'/' : wchar_t(std::towlower(c));
+        return s;
+    }
+
+    void Touch(const fs::path& p)
+    {
+        fs::create_directories(p.parent_path());
+        std::ofstream(p, std::ios::binary) << "x";
+    }
+
+    bool Exists(const std::wstring& p)
+    {
+        std::error_code ec;
+        return !p.empty() && fs::exists(p, ec);
+    }
+
+    void TestCases(const fs::path& dir)
+    {
+        const std::wstring root = (dir / L"root").wstring();
+        const std::wstring rootSlash = root + L"/";
+        const auto ix = TexturePathIndex::For(rootSlash);
+        CHECK(ix == TexturePathIndex::For(root));   // 끝 '/' 가 달라도 같은 색인
+        CHECK(ix->FileCount() == 100 + 10 + 10);
+
+        // 색인과 probe 가 같은 파일을 가리키는지 (대소문자는 probe 가 구분하는 OS 라 정확한 이름만)
+        auto same = [&](const std::wstring& in) {
+            const std::wstring a = ix->Resolve(in), b = TexturePathResolveProbe(in, rootSlash);
+            if (Norm(a) != Norm(b)) printf("  mismatch %ls: index %ls, probe %ls\n", in.c_str(), a.c_str(), b.c_str());
+            return Norm(a) == Norm(b);
+        };
+        const std::wstring foreign = (dir.root_path() / L"__other_pc__" / L"Textures").wstring();
+        const std::vector<std::wstring> inputs = {
+            L"r1.PNG",                                      // 상대
+            L"broken/r2.PNG",                               // 깨진 서브폴더 → 파일명
+            L"t5.png",                                      // textures/ 폴백
+            L"x/y/t6.png",
+            L"sub/deep/d7.tga",                             // 깊은 상대 경로
+            L"x/y/d7.tga",                                  // 깊은 파일은 파일명으로는 못 찾음 (probe 와 같음)
+            foreign + L"/r3.PNG",                           // 다른 PC 절대 경로 → 파일명
+            foreign + L"/t4.png",                           // → textures/파일명
+            (dir.root_path() / L"sub" / L"deep" / L"d1.tga").wstring(),   // → 루트 붙은 경로
+            root + L"/r4.PNG",                              // 루트 안 절대 경로
+            root + L"/sub/deep/d2.tga",
+            (dir / L"outside.png").wstring(),               // 루트 밖 절대 경로 (존재)
+            L"../outside.png",                              // 루트 밖 상대 경로
+            L"nope.png", L"sub/nope.png", foreign + L"/nope.png",   // 없는 파일 → 에러용 후보
+        };
+        for (const std::wstring& in : inputs) CHECK(same(in));
+
+        CHECK(Exists(ix->Resolve(L"t5.png")));
+        CHECK(Exists(ix->Resolve(foreign + L"/r3.PNG")));
+        CHECK(!Exists(ix->Resolve(L"x/y/d7.tga")));
+        CHECK(Exists(ix->Resolve(L"../outside.png")));
+        CHECK(ix->Resolve((dir / L"outside.png").wstring()) == (dir / L"outside.png").wstring());
+        CHECK(ix->Resolve(L"*0").empty() && ix->Resolve(L"").empty());
+        CHECK(TexturePathResolveProbe(L"*0", rootSlash).empty());
+
+        // 대소문자 무시 → 실제 파일 이름으로
+        CHECK(Norm(ix->Resolve(L"R1.png")) == Norm(ix->Resolve(L"r1.PNG")));
+        CHECK(fs::path(ix->Resolve(L"R1.png")).filename() == L"r1.PNG");
+        CHECK(Exists(ix->Resolve(L"SUB/Deep/D3.TGA")));
+
+        // 여러 스레드가 같은 루트를 요청 → 같은 색인
+        std::vector<std::thread> threads;
+        std::vector<const TexturePathIndex*> seen(8, nullptr);
+        for (size_t t = 0; t < seen.size(); ++t)
+            threads.emplace_back([&, t] {
+                for (int i = 0; i < 200; ++i) {
+                    const auto p = TexturePathIndex::For(root);
+                    seen[t] = p.get();
+                    p->Resolve(L"t3.png");
+                }
+            });
+        for (std::thread& t : threads) t.join();
+        CHECK(std::all_of(seen.begin(), seen.end(), [&](const TexturePathIndex* p) { return p == ix.get(); }));
+
+        // 색인은 만든 시점 기준 → ClearAll 후 새 파일 보임 (textures/ 폴백으로만 찾을 수 있는 위치)
+        Touch(dir / L"root" / L"textures" / L"late.png");
+        CHECK(!Exists(ix->Resolve(L"late.png")));
+        TexturePathIndex::ClearAll();
+        const auto fresh = TexturePathIndex::For(root);
+        CHECK(fresh != ix);
+        CHECK(Exists(fresh->Resolve(L"late.png")));
+        fs::remove(dir / L"root" / L"textures" / L"late.png");
+        TexturePathIndex::ClearAll();
+    }
+
+    void TestBenchmarkInputs(const fs::path& dir)
+    {
+        const std::wstring root = (dir / L"root").wstring() + L"/";
+        const TexturePathBenchResult r = TexturePathBenchmark(root, 2000);
+        CHECK(r.files == 120);
+        CHECK(r.lookups == 2000 * 5);
+        CHECK(r.mismatches == 0);
+        printf("benchmark: %zu files, %zu lookups, %zu mismatches | build %.2f ms, probe %.2f ms, index %.2f ms\n",
+            r.files, r.lookups, r.mismatches, r.buildMs, r.probeMs, r.indexMs);
+
+        const TexturePathBenchResult e = TexturePathBenchmark((dir / L"nonexistent").wstring(), 100);
+        CHECK(e.files == 0 && e.mismatches == 0);
+    }
+}
+
+int main()
+{
+    const fs::path dir = fs::temp_directory_path() / "TexturePathIndexTest";
+    std::error_code ec;
+    fs::remove_all(dir, ec);
+    for (int i = 0; i < 100; ++i) Touch(dir / L"root" / (L"r" + std::to_wstring(i) + L".PNG"));
+    for (int i = 0; i < 10; ++i) Touch(dir / L"root" / L"textures" / (L"t" + std::to_wstring(i) + L".png"));
+    for (int i = 0; i < 10; ++i) Touch(dir / L"root" / L"sub" / L"deep" / (L"d" + std::to_wstring(i) + L".tga"));
+    Touch(dir / L"outside.png");
+
+    TestCases(dir);
+    TestBenchmarkInputs(dir);
+
+    fs::remove_all(dir, ec);
+    return TestResult("TexturePathIndexTest");
+}
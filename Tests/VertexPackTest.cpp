@@ -0,0 +1,285 @@
+﻿// ============================================================================
+// VertexPackTest.cpp
+// - VertexPack 코덱 왕복 오차 (최대 오차 단언)
+//   · half: 유한한 half 65536 개 전부 half → float → half 가 같은 비트, 임의 float 는 상대 2^-11 이내
+//   · 옥타헤드럴 노멀 (SNORM16 x2): 임의 단위 벡터 최대 0.005 도, 축 방향은 정확
+//   · 옥타헤드럴 탄젠트 (UNORM16 + UNORM15 + 부호): 최대 0.008 도, handedness 부호 그대로
+//   · UV (half): |uv| <= 4 에서 최대 2^-10
+//   · 가중치 UNORM8: 합이 항상 255, 각 가중치 오차 < 1/255, 합 0 → 첫 본 255
+// - VertexPackArray 보고 (크기 48→24 / 68→32 B, 오차 최댓값이 double 로 직접 잰 값과 맞음)
+// - 분리 스트림: Split → Join 이 비트 단위로 원래 정점, 필드 오프셋은 Skinning_CS 가 읽는 자리
+// ============================================================================
+
+// ---- includes ----
+#include "TestCommon.h"
+#include "../D3D_Engine(25.12.01. ~ )/VertexPack.h"
+
+#include <cstddef>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+    double AngleDeg(double ax, double ay, double az, double bx, double by, double bz)
+    {
+        const double la = std::sqrt(ax * ax + ay * ay + az * az);
+        const double lb = std::sqrt(bx * bx + by * by + bz * bz);
+        double d = (ax * bx + ay * by + az * bz) / (la * lb);
+        d = d < -1.0 ? -1.0 : (d > 1.0 ? 1.0 : d);
+        return std::acos(d) * (180.0 / 3.14159265358979323846);
+    }
+
+    void RandomUnit(std::mt19937& rng, float& x, float& y, float& z)
+    {
+        std::normal_distribution<float> n(0.0f, 1.0f);
+        do { x = n(rng); y = n(rng); z = n(rng); } while (x * x + y * y + z * z < 1e-6f);
+        const float l = std::sqrt(x * x + y * y + z * z);
+        x /= l; y /= l; z /= l;
+    }
+
+    VertexCPU_PNTT_BW RandomVertex(std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> pos(-10.0f, 10.0f), uv(-4.0f, 4.0f), w(0.0f, 1.0f);
+        VertexCPU_PNTT_BW v{};
+        v.px = pos(rng); v.py = pos(rng); v.pz = pos(rng);
+        RandomUnit(rng, v.nx, v.ny, v.nz);
+        RandomUnit(rng, v.tx, v.ty, v.tz);
+        v.tw = (rng() & 1) ? 1.0f : -1.0f;
+        v.u = uv(rng); v.v = uv(rng);
+        float sum = 0.0f;
+        const int used = 1 + (int)(rng() % 4);
+        for (int k = 0; k < 4; ++k) {
+            v.bi[k] = (uint8_t)(rng() % 256);
+            v.bw[k] = k < used ? w(rng) : 0.0f;
+            sum += v.bw[k];
+        }
+        for (int k = 0; k < 4; ++k) v.bw[k] = sum > 0.0f ? v.bw[k] / sum : 0.0f;
+        return v;
+    }
+
+    void TestHalf()
+    {
+        int bad = 0;
+        for (uint32_t h = 0; h < 0x10000u; ++h) {
+            const float f = VertexHalfToFloat((uint16_t)h);
+            const uint16_t back = VertexFloatToHalf(f);
+            const bool nan = ((h >> 10) & 0x1Fu) == 0x1Fu && (h & 0x3FFu) != 0;
+            if (nan ? !(f != f) || (back & 0x7C00u) != 0x7C00u || (back & 0x3FFu) == 0 : back != h) ++bad;
+        }
+        CHECK(bad == 0);
+
+        // 정규 범위 임의 값: 가까운 짝수 반올림이면 상대 오차 <= 2^-11
+        std::mt19937 rng(15);
+        std::uniform_real_distribution<float> e(-14.0f, 15.0f);
+        float maxRel = 0.0f;
+        for (int i = 0; i < 200000; ++i) {
+            const float f = std::exp2(e(rng)) * ((rng() & 1) ? 1.0f : -1.0f);
+            const float back = VertexHalfToFloat(VertexFloatToHalf(f));
+            const float rel = std::fabs(back - f) / std::fabs(f);
+            if (rel > maxRel) maxRel = rel;
+        }
+        CHECK(maxRel <= 1.0f / 2048.0f);
+        CHECK(VertexFloatToHalf(65520.0f) == 0x7C00u);
+        CHECK(VertexFloatToHalf(-65520.0f) == 0xFC00u);
+        CHECK(VertexFloatToHalf(65504.0f) == 0x7BFFu);
+        printf("half: %d bad round trips, max rel %.3g\n", bad, maxRel);
+    }
+
+    void TestNormalTangent()
+    {
+        std::mt19937 rng(16);
+        double maxN = 0.0, maxT = 0.0;
+        int flips = 0;
+        for (int i = 0; i < 200000; ++i) {
+            VertexCPU_PNTT v{};
+            RandomUnit(rng, v.nx, v.ny, v.nz);
+            RandomUnit(rng, v.tx, v.ty, v.tz);
+            v.tw = (i & 1) ? -1.0f : 1.0f;
+            const VertexCPU_PNTT b = VertexUnpack(VertexPack(v));
+            const double dn = AngleDeg(v.nx, v.ny, v.nz, b.nx, b.ny, b.nz);
+            const double dt = AngleDeg(v.tx, v.ty, v.tz, b.tx, b.ty, b.tz);
+            if (dn > maxN) maxN = dn;
+            if (dt > maxT) maxT = dt;
+            if (b.tw != v.tw) ++flips;
+            CHECK_NEAR(b.nx * b.nx + b.ny * b.ny + b.nz * b.nz, 1.0, 1e-5);
+        }
+        CHECK(maxN <= 0.005);
+        CHECK(maxT <= 0.008);
+        CHECK(flips == 0);
+        printf("oct: normal max %.4f deg, tangent max %.4f deg, %d sign flips\n", maxN, maxT, flips);
+
+        // 축 방향 / 길이 0
+        const float axes[6][3] = { { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 } };
+        for (const auto& a : axes) {
+            VertexCPU_PNTT v{};
+            v.nx = v.tx = a[0]; v.ny = v.ty = a[1]; v.nz = v.tz = a[2];
+            v.tw = -1.0f;
+            const VertexCPU_PNTT b = VertexUnpack(VertexPack(v));
+            CHECK(b.nx == a[0] && b.ny == a[1] && b.nz == a[2]);
+            CHECK(AngleDeg(a[0], a[1], a[2], b.tx, b.ty, b.tz) <= 0.008);
+            CHECK(b.tw == -1.0f);
+        }
+        float x, y, z, ex, ey;
+        VertexOctEncode(0.0f, 0.0f, 0.0f, ex, ey);
+        VertexOctDecode(ex, ey, x, y, z);
+        CHECK(x == 0.0f && y == 0.0f && z == 1.0f);
+    }
+
+    void TestUV()
+    {
+        std::mt19937 rng(17);
+        std::uniform_real_distribution<float> uv(-4.0f, 4.0f);
+        float maxErr = 0.0f;
+        for (int i = 0; i < 200000; ++i) {
+            VertexCPU_PNTT v{};
+            v.u = uv(rng); v.v = uv(rng);
+            const VertexCPU_PNTT b = VertexUnpack(VertexPack(v));
+            const float d = std::fmax(std::fabs(b.u - v.u), std::fabs(b.v - v.v));
+            if (d > maxErr) maxErr = d;
+        }
+        CHECK(maxErr <= 1.0f / 1024.0f);    // [2,4) 의 half 간격 2^-9 의 절반
+        printf("uv: max %.3g (|uv| <= 4)\n", maxErr);
+    }
+
+    void TestWeights()
+    {
+        std::mt19937 rng(18);
+        float maxErr = 0.0f;
+        int badSum = 0;
+        for (int i = 0; i < 200000; ++i) {
+            const VertexCPU_PNTT_BW v = RandomVertex(rng);
+            uint8_t q[4];
+            VertexPackWeights(v.bw, q);
+            if (q[0] + q[1] + q[2] + q[3] != 255) ++badSum;
+            for (int k = 0; k < 4; ++k) {
+                const float d = std::fabs(q[k] / 255.0f - v.bw[k]);
+                if (d > maxErr) maxErr = d;
+                if (v.bw[k] == 0.0f) CHECK(q[k] == 0);
+            }
+        }
+        CHECK(badSum == 0);
+        CHECK(maxErr < 1.0f / 255.0f);
+        printf("weights: %d bad sums, max %.3g\n", badSum, maxErr);
+
+        // 합 0 / 음수만 → 첫 본 255, 음수는 0 으로, 정규화 안 된 입력
+        const float zero[4] = { 0, 0, 0, 0 }, neg[4] = { -1, -0.5f, 0, 0 };
+        const float mixed[4] = { 2, -1, 2, 0 }, thirds[4] = { 1, 1, 1, 0 };
+        uint8_t q[4];
+        VertexPackWeights(zero, q);
+        CHECK(q[0] == 255 && q[1] == 0 && q[2] == 0 && q[3] == 0);
+        VertexPackWeights(neg, q);
+        CHECK(q[0] == 255 && q[1] == 0 && q[2] == 0 && q[3] == 0);
+        VertexPackWeights(mixed, q);
+        CHECK(q[1] == 0 && q[3] == 0 && q[0] + q[2] == 255 && (q[0] == 127 || q[0] == 128));
+        VertexPackWeights(thirds, q);
+        CHECK(q[0] == 85 && q[1] == 85 && q[2] == 85 && q[3] == 0);
+    }
+
+    void TestArrayReport()
+    {
+        std::mt19937 rng(19);
+        std::vector<VertexCPU_PNTT_BW> skinned(5000);
+        for (auto& v : skinned) v = RandomVertex(rng);
+        std::vector<VertexCPU_PNTT> statics(3000);
+        for (size_t i = 0; i < statics.size(); ++i) memcpy(&statics[i], &skinned[i], sizeof(VertexCPU_PNTT));
+
+        VertexPackReport rs, rk;
+        std::vector<VertexPacked_PNTT> ps(statics.size());
+        std::vector<VertexPacked_PNTT_BW> pk(skinned.size());
+        VertexPackArray(statics.data(), statics.size(), ps.data(), &rs);
+        VertexPackArray(skinned.data(), skinned.size(), pk.data(), &rk);
+
+        CHECK(rs.staticVerts == 3000 && rs.skinnedVerts == 0);
+        CHECK(rs.bytesFloat == 3000u * 48u && rs.bytesPacked == 3000u * 24u);
+        CHECK(rk.skinnedVerts == 5000 && rk.staticVerts == 0);
+        CHECK(rk.bytesFloat == 5000u * 68u && rk.bytesPacked == 5000u * 32u);
+        CHECK(rs.signFlips == 0 && rk.signFlips == 0);
+        CHECK(rk.maxNormalDeg <= 0.005f && rk.maxTangentDeg <= 0.008f);
+        CHECK(rk.maxUV <= 1.0f / 1024.0f && rk.maxWeight < 1.0f / 255.0f);
+
+        // 보고가 직접 잰 최댓값과 맞는지 (각도는 float 계산이라 1e-4 도 이내)
+        float maxUV = 0.0f;
+        double maxN = 0.0;
+        for (size_t i = 0; i < statics.size(); ++i) {
+            const VertexCPU_PNTT b = VertexUnpack(ps[i]);
+            const VertexCPU_PNTT& a = statics[i];
+            maxUV = std::fmax(maxUV, std::fmax(std::fabs(b.u - a.u), std::fabs(b.v - a.v)));
+            const double dn = AngleDeg(a.nx, a.ny, a.nz, b.nx, b.ny, b.nz);
+            if (dn > maxN) maxN = dn;
+            CHECK(memcmp(&ps[i], &pk[i], sizeof(VertexPacked_PNTT)) == 0);
+        }
+        CHECK(rs.maxUV == maxUV);
+        CHECK_NEAR(rs.maxNormalDeg, maxN, 1e-4);
+
+        VertexPackReport all = rs;
+        all.Merge(rk);
+        CHECK(all.bytesFloat == rs.bytesFloat + rk.bytesFloat);
+        CHECK(all.maxUV == std::fmax(rs.maxUV, rk.maxUV));
+        VertexPackPrintReport("random", all);
+    }
+
+    // Skinning_CS: SrcPos.Load4(s) = pos xyz + uv, Load2(s + 16) = 본 인덱스 / 가중치, SrcAttr.Load2 = n / t
+    static_assert(offsetof(VertexStreamPos_PNTT, uv) == 12, "uv after position");
+    static_assert(offsetof(VertexStreamPos_PNTT_BW, uv) == 12, "uv after position");
+    static_assert(offsetof(VertexStreamPos_PNTT_BW, bi) == 16, "bone indices at +16");
+    static_assert(offsetof(VertexStreamPos_PNTT_BW, bw) == 20, "bone weights at +20");
+    static_assert(offsetof(VertexStreamAttr, t) == 4, "tangent after normal");
+
+    template <class Packed, class Pos>
+    void CheckSplitJoin(const std::vector<Packed>& src)
+    {
+        const size_t n = src.size();
+        std::vector<Pos> pos(n);
+        std::vector<VertexStreamAttr> attr(n);
+        VertexSplitStreams(src.data(), n, pos.data(), attr.data());
+
+        std::vector<Packed> back(n);
+        memset(back.data(), 0xCD, n * sizeof(Packed));
+        VertexJoinStreams(pos.data(), attr.data(), n, back.data());
+        CHECK(memcmp(back.data(), src.data(), n * sizeof(Packed)) == 0);
+
+        // 슬롯 0 은 위치 12B + UV 4B (+ 본 8B), 슬롯 1 은 노멀 4B + 탄젠트 4B 그대로
+        size_t bad = 0;
+        for (size_t i = 0; i < n; ++i) {
+            if (memcmp(&pos[i].px, &src[i].px, 12) != 0 || memcmp(pos[i].uv, src[i].uv, 4) != 0) ++bad;
+            if (memcmp(attr[i].n, src[i].n, 4) != 0 || memcmp(attr[i].t, src[i].t, 4) != 0) ++bad;
+        }
+        CHECK(bad == 0);
+    }
+
+    void TestStreams()
+    {
+        std::mt19937 rng(20);
+        std::vector<VertexPacked_PNTT_BW> skinned(100000);
+        std::vector<VertexPacked_PNTT> statics(skinned.size());
+        for (size_t i = 0; i < skinned.size(); ++i) {
+            const VertexCPU_PNTT_BW v = RandomVertex(rng);
+            skinned[i] = VertexPack(v);
+            VertexCPU_PNTT s;
+            memcpy(&s, &v, sizeof(s));
+            statics[i] = VertexPack(s);
+        }
+        CheckSplitJoin<VertexPacked_PNTT, VertexStreamPos_PNTT>(statics);
+        CheckSplitJoin<VertexPacked_PNTT_BW, VertexStreamPos_PNTT_BW>(skinned);
+
+        std::vector<VertexStreamPos_PNTT_BW> pos(skinned.size());
+        std::vector<VertexStreamAttr> attr(skinned.size());
+        VertexSplitStreams(skinned.data(), skinned.size(), pos.data(), attr.data());
+        size_t bad = 0;
+        for (size_t i = 0; i < skinned.size(); ++i)
+            if (memcmp(pos[i].bi, skinned[i].bi, 4) != 0 || memcmp(pos[i].bw, skinned[i].bw, 4) != 0) ++bad;
+        CHECK(bad == 0);
+    }
+}
+
+int main()
+{
+    TestHalf();
+    TestNormalTangent();
+    TestUV();
+    TestWeights();
+    TestArrayReport();
+    TestStreams();
+    return TestResult("VertexPackTest");
+}